@@ -108,7 +108,7 @@ def createOptions(numWorkers=1, initialTimeout=5, initialSplits=0, onlineSplits=
                   preprocessorBoundTolerance=0.0000000001, dumpBounds=False,
                   tighteningStrategy="deeppoly", milpTightening="none", milpSolverTimeout=0,
                   numSimulations=10, numBlasThreads=1, performLpTighteningAfterSplit=False,
-                  lpSolver="", produceProofs=False):
+                  lpSolver="", produceProofs=False, boundCacheFile="", numSbtThreads=1):
     """Create an options object for how Marabou should solve the query
 
     Args:
@@ -123,7 +123,7 @@ def createOptions(numWorkers=1, initialTimeout=5, initialSplits=0, onlineSplits=
         verbosity (int, optional): Verbosity level for Marabou, defaults to 2
         snc (bool, optional): If SnC mode should be used, defaults to False
         splittingStrategy (string, optional): Specifies which partitioning strategy to use (auto/largest-interval/relu-violation/polarity/earliest-relu)
-        sncSplittingStrategy (string, optional): Specifies which partitioning strategy to use in the SnC mode (auto/largest-interval/polarity).
+        sncSplittingStrategy (string, optional): Specifies which partitioning strategy to use in the SnC mode (auto/largest-interval/interval-propagation/polarity).
         restoreTreeStates (bool, optional): Whether to restore tree states in dnc mode, defaults to False
         solveWithMILP (bool, optional): Whther to solve the input query with a MILP encoding. Currently only works when Gurobi is installed. Defaults to False.
         preprocessorBoundTolerance ( float, optional): epsilon value for preprocess bound tightening . Defaults to 10^-10.
@@ -135,6 +135,8 @@ def createOptions(numWorkers=1, initialTimeout=5, initialSplits=0, onlineSplits=
         numBlasThreads (int, optional): Number of threads to use when using OpenBLAS matrix multiplication (e.g., for DeepPoly analysis), defaults to 1
         performLpTighteningAfterSplit (bool, optional): Whether to perform a LP tightening after a case split, defaults to False
         lpSolver (string, optional): the engine for solving LP (native/gurobi).
+        boundCacheFile (string, optional): File in which the bounds of the network are cached across runs, defaults to no caching
+        numSbtThreads (int, optional): Number of threads to use for symbolic bound tightening on wide layers, shared by the process, defaults to 1
     Returns:
         :class:`~maraboupy.MarabouCore.Options`
     """
@@ -162,4 +164,6 @@ def createOptions(numWorkers=1, initialTimeout=5, initialSplits=0, onlineSplits=
     options._performLpTighteningAfterSplit = performLpTighteningAfterSplit
     options._lpSolver = lpSolver
     options._produceProofs = produceProofs
+    options._boundCacheFile = boundCacheFile
+    options._numSbtThreads = numSbtThreads
     return options
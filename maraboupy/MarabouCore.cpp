@@ -40,10 +40,16 @@
 #include "SignConstraint.h"
 #include "SnCDivideStrategy.h"
 #include "SoftmaxConstraint.h"
+#include "SolveJob.h"
+#include "ThreadPool.h"
 #include "VnnLibParser.h"
 
+#include <cstdint>
 #include <fcntl.h>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <set>
@@ -111,6 +117,38 @@ void restoreOutputStream( int outputStream )
     close( outputStream );
 }
 
+/*
+  Redirects the standard output into a file for the lifetime of the
+  object, if a file is given. The standard output is shared by the whole
+  process, so calls that redirect it are serialized.
+*/
+class OutputRedirection
+{
+public:
+    OutputRedirection( const std::string &outputFilePath )
+        : _outputStream( -1 )
+    {
+        if ( outputFilePath.length() > 0 )
+        {
+            _lock = std::unique_lock<std::mutex>( _mutex );
+            _outputStream = redirectOutputToFile( outputFilePath );
+        }
+    }
+
+    ~OutputRedirection()
+    {
+        if ( _outputStream != -1 )
+            restoreOutputStream( _outputStream );
+    }
+
+private:
+    static std::mutex _mutex;
+    std::unique_lock<std::mutex> _lock;
+    int _outputStream;
+};
+
+std::mutex OutputRedirection::_mutex;
+
 void addClipConstraint( InputQuery &ipq,
                         unsigned var1,
                         unsigned var2,
@@ -186,6 +224,185 @@ void addAbsConstraint( InputQuery &ipq, unsigned b, unsigned f )
     ipq.addPiecewiseLinearConstraint( new AbsoluteValueConstraint( b, f ) );
 }
 
+/*
+  Bulk construction of an InputQuery from NumPy arrays. The arrays are
+  read in place through their buffers, so an array that is already
+  C-contiguous and of the expected dtype (float64 for values, int64 for
+  variables and offsets) is not copied; any other array is converted
+  once by pybind11.
+*/
+typedef py::array_t<double, py::array::c_style | py::array::forcecast> DoubleArray;
+typedef py::array_t<int64_t, py::array::c_style | py::array::forcecast> IndexArray;
+
+unsigned toVariable( const InputQuery &ipq, int64_t variable )
+{
+    if ( variable < 0 || (uint64_t)variable >= ipq.getNumberOfVariables() )
+        throw py::index_error( Stringf( "Variable %lld out of range (number of variables: %u)",
+                                        (long long)variable,
+                                        ipq.getNumberOfVariables() )
+                                   .ascii() );
+    return (unsigned)variable;
+}
+
+void checkSize( const py::array &array, py::ssize_t size, const char *name )
+{
+    if ( array.ndim() != 1 || array.shape( 0 ) != size )
+        throw py::value_error(
+            Stringf( "%s must be a 1-D array of length %ld", name, (long)size ).ascii() );
+}
+
+void checkColumns( const py::array &array, py::ssize_t columns, const char *name )
+{
+    if ( array.ndim() != 2 || array.shape( 1 ) != columns )
+        throw py::value_error(
+            Stringf( "%s must be a 2-D array with %ld columns", name, (long)columns ).ascii() );
+}
+
+void addEquations( InputQuery &ipq,
+                   const IndexArray &offsets,
+                   const IndexArray &variables,
+                   const DoubleArray &coefficients,
+                   const DoubleArray &scalars,
+                   const IndexArray &types )
+{
+    // Equation i consists of the addends in [offsets[i], offsets[i + 1])
+    py::ssize_t numberOfEquations = scalars.size();
+    checkSize( scalars, numberOfEquations, "scalars" );
+    checkSize( types, numberOfEquations, "types" );
+    checkSize( offsets, numberOfEquations + 1, "offsets" );
+    checkSize( variables, variables.size(), "variables" );
+    checkSize( coefficients, variables.size(), "coefficients" );
+
+    auto offset = offsets.unchecked<1>();
+    auto variable = variables.unchecked<1>();
+    auto coefficient = coefficients.unchecked<1>();
+    auto scalar = scalars.unchecked<1>();
+    auto type = types.unchecked<1>();
+
+    if ( offset( 0 ) != 0 || offset( numberOfEquations ) != variables.size() )
+        throw py::value_error( "offsets must start at 0 and end at the number of addends" );
+
+    for ( py::ssize_t i = 0; i < numberOfEquations; ++i )
+    {
+        if ( type( i ) != Equation::EQ && type( i ) != Equation::GE && type( i ) != Equation::LE )
+            throw py::value_error(
+                Stringf( "Unknown equation type %lld", (long long)type( i ) ).ascii() );
+        if ( offset( i ) > offset( i + 1 ) )
+            throw py::value_error( "offsets must be non-decreasing" );
+
+        Equation equation( (Equation::EquationType)type( i ) );
+        for ( int64_t j = offset( i ); j < offset( i + 1 ); ++j )
+            equation.addAddend( coefficient( j ), toVariable( ipq, variable( j ) ) );
+        equation.setScalar( scalar( i ) );
+        ipq.addEquation( equation );
+    }
+}
+
+void setLowerBounds( InputQuery &ipq, const IndexArray &variables, const DoubleArray &values )
+{
+    checkSize( variables, variables.size(), "variables" );
+    checkSize( values, variables.size(), "values" );
+
+    auto variable = variables.unchecked<1>();
+    auto value = values.unchecked<1>();
+    for ( py::ssize_t i = 0; i < variables.size(); ++i )
+        ipq.setLowerBound( toVariable( ipq, variable( i ) ), value( i ) );
+}
+
+void setUpperBounds( InputQuery &ipq, const IndexArray &variables, const DoubleArray &values )
+{
+    checkSize( variables, variables.size(), "variables" );
+    checkSize( values, variables.size(), "values" );
+
+    auto variable = variables.unchecked<1>();
+    auto value = values.unchecked<1>();
+    for ( py::ssize_t i = 0; i < variables.size(); ++i )
+        ipq.setUpperBound( toVariable( ipq, variable( i ) ), value( i ) );
+}
+
+void markInputVariables( InputQuery &ipq, const IndexArray &variables )
+{
+    checkSize( variables, variables.size(), "variables" );
+
+    auto variable = variables.unchecked<1>();
+    for ( py::ssize_t i = 0; i < variables.size(); ++i )
+        ipq.markInputVariable( toVariable( ipq, variable( i ) ), i );
+}
+
+void markOutputVariables( InputQuery &ipq, const IndexArray &variables )
+{
+    checkSize( variables, variables.size(), "variables" );
+
+    auto variable = variables.unchecked<1>();
+    for ( py::ssize_t i = 0; i < variables.size(); ++i )
+        ipq.markOutputVariable( toVariable( ipq, variable( i ) ), i );
+}
+
+void addReluConstraints( InputQuery &ipq, const IndexArray &pairs )
+{
+    checkColumns( pairs, 2, "pairs" );
+
+    auto pair = pairs.unchecked<2>();
+    for ( py::ssize_t i = 0; i < pairs.shape( 0 ); ++i )
+        ipq.addPiecewiseLinearConstraint( new ReluConstraint(
+            toVariable( ipq, pair( i, 0 ) ), toVariable( ipq, pair( i, 1 ) ) ) );
+}
+
+void addLeakyReluConstraints( InputQuery &ipq,
+                              const IndexArray &pairs,
+                              const DoubleArray &slopes )
+{
+    checkColumns( pairs, 2, "pairs" );
+    checkSize( slopes, pairs.shape( 0 ), "slopes" );
+
+    auto pair = pairs.unchecked<2>();
+    auto slope = slopes.unchecked<1>();
+    for ( py::ssize_t i = 0; i < pairs.shape( 0 ); ++i )
+        ipq.addPiecewiseLinearConstraint( new LeakyReluConstraint(
+            toVariable( ipq, pair( i, 0 ) ), toVariable( ipq, pair( i, 1 ) ), slope( i ) ) );
+}
+
+void addSigmoidConstraints( InputQuery &ipq, const IndexArray &pairs )
+{
+    checkColumns( pairs, 2, "pairs" );
+
+    auto pair = pairs.unchecked<2>();
+    for ( py::ssize_t i = 0; i < pairs.shape( 0 ); ++i )
+        ipq.addNonlinearConstraint( new SigmoidConstraint( toVariable( ipq, pair( i, 0 ) ),
+                                                           toVariable( ipq, pair( i, 1 ) ) ) );
+}
+
+void addSignConstraints( InputQuery &ipq, const IndexArray &pairs )
+{
+    checkColumns( pairs, 2, "pairs" );
+
+    auto pair = pairs.unchecked<2>();
+    for ( py::ssize_t i = 0; i < pairs.shape( 0 ); ++i )
+        ipq.addPiecewiseLinearConstraint( new SignConstraint( toVariable( ipq, pair( i, 0 ) ),
+                                                              toVariable( ipq, pair( i, 1 ) ) ) );
+}
+
+void addAbsConstraints( InputQuery &ipq, const IndexArray &pairs )
+{
+    checkColumns( pairs, 2, "pairs" );
+
+    auto pair = pairs.unchecked<2>();
+    for ( py::ssize_t i = 0; i < pairs.shape( 0 ); ++i )
+        ipq.addPiecewiseLinearConstraint( new AbsoluteValueConstraint(
+            toVariable( ipq, pair( i, 0 ) ), toVariable( ipq, pair( i, 1 ) ) ) );
+}
+
+void addBilinearConstraints( InputQuery &ipq, const IndexArray &triples )
+{
+    checkColumns( triples, 3, "triples" );
+
+    auto triple = triples.unchecked<2>();
+    for ( py::ssize_t i = 0; i < triples.shape( 0 ); ++i )
+        ipq.addNonlinearConstraint( new BilinearConstraint( toVariable( ipq, triple( i, 0 ) ),
+                                                            toVariable( ipq, triple( i, 1 ) ),
+                                                            toVariable( ipq, triple( i, 2 ) ) ) );
+}
+
 void loadProperty( InputQuery &inputQuery, std::string propertyFilePath )
 {
     String propertyFilePathM = String( propertyFilePath );
@@ -289,6 +506,7 @@ struct MarabouOptions
         , _dumpBounds( Options::get()->getBool( Options::DUMP_BOUNDS ) )
         , _numWorkers( Options::get()->getInt( Options::NUM_WORKERS ) )
         , _numBlasThreads( Options::get()->getInt( Options::NUM_BLAS_THREADS ) )
+        , _numSbtThreads( Options::get()->getInt( Options::NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS ) )
         , _initialTimeout( Options::get()->getInt( Options::INITIAL_TIMEOUT ) )
         , _initialDivides( Options::get()->getInt( Options::NUM_INITIAL_DIVIDES ) )
         , _onlineDivides( Options::get()->getInt( Options::NUM_ONLINE_DIVIDES ) )
@@ -311,6 +529,8 @@ struct MarabouOptions
         , _milpTighteningString(
               Options::get()->getString( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE ).ascii() )
         , _lpSolverString( Options::get()->getString( Options::LP_SOLVER ).ascii() )
+        , _boundCacheFileString(
+              Options::get()->getString( Options::NLR_BOUND_CACHE_FILE ).ascii() )
         , _produceProofs( Options::get()->getBool( Options::PRODUCE_PROOFS ) ){};
 
     void setOptions()
@@ -327,6 +547,7 @@ struct MarabouOptions
         // int options
         Options::get()->setInt( Options::NUM_WORKERS, _numWorkers );
         Options::get()->setInt( Options::NUM_BLAS_THREADS, _numBlasThreads );
+        Options::get()->setInt( Options::NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS, _numSbtThreads );
         Options::get()->setInt( Options::INITIAL_TIMEOUT, _initialTimeout );
         Options::get()->setInt( Options::NUM_INITIAL_DIVIDES, _initialDivides );
         Options::get()->setInt( Options::NUM_ONLINE_DIVIDES, _onlineDivides );
@@ -348,6 +569,7 @@ struct MarabouOptions
         Options::get()->setString( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE,
                                    _milpTighteningString );
         Options::get()->setString( Options::LP_SOLVER, _lpSolverString );
+        Options::get()->setString( Options::NLR_BOUND_CACHE_FILE, _boundCacheFileString );
     }
 
     bool _snc;
@@ -358,6 +580,7 @@ struct MarabouOptions
     bool _produceProofs;
     unsigned _numWorkers;
     unsigned _numBlasThreads;
+    unsigned _numSbtThreads;
     unsigned _initialTimeout;
     unsigned _initialDivides;
     unsigned _onlineDivides;
@@ -373,6 +596,7 @@ struct MarabouOptions
     std::string _tighteningStrategyString;
     std::string _milpTighteningString;
     std::string _lpSolverString;
+    std::string _boundCacheFileString;
 };
 
 
@@ -407,13 +631,22 @@ solve( InputQuery &inputQuery, MarabouOptions &options, std::string redirect = "
     std::string resultString = "";
     std::map<int, double> ret;
     Statistics retStats;
-    int output = -1;
-    if ( redirect.length() > 0 )
-        output = redirectOutputToFile( redirect );
+
+    // The engine touches no Python object, so other Python threads may run,
+    // and solve other queries, in the meantime
+    py::gil_scoped_release release;
+    OutputRedirection outputRedirection( redirect );
     try
     {
+        // The options of this call only, and of the threads it spawns
+        Options callOptions( *Options::get() );
+        Options::Scope optionsScope( &callOptions );
         options.setOptions();
 
+        // The pool is shared by the process, so the latest call sets its size
+        ThreadPool::get()->setNumberOfThreads(
+            Options::get()->getInt( Options::NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS ) );
+
         bool dnc = Options::get()->getBool( Options::DNC_MODE );
 
         Engine engine;
@@ -471,8 +704,6 @@ solve( InputQuery &inputQuery, MarabouOptions &options, std::string redirect = "
                  e.getUserMessage() );
         return std::make_tuple( "ERROR", ret, retStats );
     }
-    if ( output != -1 )
-        restoreOutputStream( output );
     return std::make_tuple( resultString, ret, retStats );
 }
 
@@ -484,13 +715,19 @@ calculateBounds( InputQuery &inputQuery, MarabouOptions &options, std::string re
     std::string resultString = "";
     std::map<int, std::tuple<double, double>> ret;
     Statistics retStats;
-    int output = -1;
-    if ( redirect.length() > 0 )
-        output = redirectOutputToFile( redirect );
+
+    py::gil_scoped_release release;
+    OutputRedirection outputRedirection( redirect );
     try
     {
+        Options callOptions( *Options::get() );
+        Options::Scope optionsScope( &callOptions );
         options.setOptions();
 
+        // The pool is shared by the process, so the latest call sets its size
+        ThreadPool::get()->setNumberOfThreads(
+            Options::get()->getInt( Options::NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS ) );
+
         bool dnc = Options::get()->getBool( Options::DNC_MODE );
 
         Engine engine;
@@ -515,11 +752,122 @@ calculateBounds( InputQuery &inputQuery, MarabouOptions &options, std::string re
         printf( "Caught a MarabouError. Code: %u. Message: %s\n", e.getCode(), e.getUserMessage() );
         return std::make_tuple( "ERROR", ret, retStats );
     }
-    if ( output != -1 )
-        restoreOutputStream( output );
     return std::make_tuple( resultString, ret, retStats );
 }
 
+/*
+  A solve job started from Python, along with the query it solves
+*/
+class PythonSolveJob
+{
+public:
+    PythonSolveJob( InputQuery &inputQuery, SolveJob *job )
+        : _inputQuery( inputQuery )
+        , _job( job )
+    {
+    }
+
+    void cancel()
+    {
+        _job->cancel();
+    }
+
+    bool poll() const
+    {
+        return _job->poll();
+    }
+
+    bool wait( py::object timeoutInSeconds )
+    {
+        double timeout = timeoutInSeconds.is_none() ? 0 : timeoutInSeconds.cast<double>();
+        if ( !timeoutInSeconds.is_none() && timeout <= 0 )
+            return _job->poll();
+
+        py::gil_scoped_release release;
+        return _job->wait( timeout );
+    }
+
+    std::tuple<std::string, std::map<int, double>, Statistics> result()
+    {
+        {
+            py::gil_scoped_release release;
+            _job->wait();
+        }
+
+        std::map<int, double> ret;
+        if ( _job->getExitCode() == IEngine::SAT )
+        {
+            for ( unsigned int i = 0; i < _inputQuery.getNumberOfVariables(); ++i )
+                ret[i] = _inputQuery.getSolutionValue( i );
+        }
+
+        return std::make_tuple( exitCodeToString( _job->getExitCode() ), ret, _job->getStatistics() );
+    }
+
+private:
+    InputQuery &_inputQuery;
+    std::unique_ptr<SolveJob> _job;
+};
+
+/*
+  Deleting a job waits for it, and the job may need the GIL to invoke the
+  progress callback
+*/
+struct PythonSolveJobDeleter
+{
+    void operator()( PythonSolveJob *job ) const
+    {
+        py::gil_scoped_release release;
+        delete job;
+    }
+};
+
+typedef std::unique_ptr<PythonSolveJob, PythonSolveJobDeleter> PythonSolveJobPointer;
+
+std::map<int, double> boundsToDict( const Map<unsigned, double> &bounds )
+{
+    std::map<int, double> ret;
+    for ( const auto &pair : bounds )
+        ret[pair.first] = pair.second;
+    return ret;
+}
+
+PythonSolveJobPointer solveAsync( InputQuery &inputQuery,
+                                  MarabouOptions &options,
+                                  py::object callback,
+                                  unsigned intervalInMilliseconds )
+{
+    // The job copies the options it is created with
+    Options callOptions( *Options::get() );
+    Options::Scope optionsScope( &callOptions );
+    options.setOptions();
+
+    if ( callback.is_none() )
+        return PythonSolveJobPointer( new PythonSolveJob( inputQuery, new SolveJob( inputQuery ) ) );
+
+    // The callback is invoked, and eventually released, on the solving
+    // threads, which do not hold the GIL
+    auto function = std::shared_ptr<py::object>( new py::object( callback ), []( py::object *object ) {
+        py::gil_scoped_acquire acquire;
+        delete object;
+    } );
+
+    auto report = [function]( const SolveProgress &progress ) {
+        py::gil_scoped_acquire acquire;
+        try
+        {
+            ( *function )( progress );
+        }
+        catch ( py::error_already_set &e )
+        {
+            e.discard_as_unraisable( "MarabouCore.solveAsync progress callback" );
+        }
+    };
+
+    return PythonSolveJobPointer(
+        new PythonSolveJob( inputQuery, new SolveJob( inputQuery, report, intervalInMilliseconds ) ) );
+}
+
 void saveQuery( InputQuery &inputQuery, std::string filename )
 {
     inputQuery.saveQuery( String( filename ) );
@@ -544,6 +892,7 @@ PYBIND11_MODULE( MarabouCore, m )
         .def( py::init() )
         .def_readwrite( "_numWorkers", &MarabouOptions::_numWorkers )
         .def_readwrite( "_numBlasThreads", &MarabouOptions::_numBlasThreads )
+        .def_readwrite( "_numSbtThreads", &MarabouOptions::_numSbtThreads )
         .def_readwrite( "_initialTimeout", &MarabouOptions::_initialTimeout )
         .def_readwrite( "_initialDivides", &MarabouOptions::_initialDivides )
         .def_readwrite( "_onlineDivides", &MarabouOptions::_onlineDivides )
@@ -563,6 +912,7 @@ PYBIND11_MODULE( MarabouCore, m )
         .def_readwrite( "_tighteningStrategy", &MarabouOptions::_tighteningStrategyString )
         .def_readwrite( "_milpTightening", &MarabouOptions::_milpTighteningString )
         .def_readwrite( "_lpSolver", &MarabouOptions::_lpSolverString )
+        .def_readwrite( "_boundCacheFile", &MarabouOptions::_boundCacheFileString )
         .def_readwrite( "_numSimulations", &MarabouOptions::_numSimulations )
         .def_readwrite( "_performLpTighteningAfterSplit",
                         &MarabouOptions::_performLpTighteningAfterSplit )
@@ -591,7 +941,31 @@ PYBIND11_MODULE( MarabouCore, m )
            py::arg( "inputQuery" ),
            py::arg( "options" ),
            py::arg( "redirect" ) = "" );
-    m.def( "calculateBounds",
+    m.def( "solveAsync",
+           &solveAsync,
+           R"pbdoc(
+        Start solving the InputQuery on a background thread, and return a handle to the job
+
+        The query must not be modified while the job is running. The callback, if given, is
+        invoked periodically from the solving threads with a :class:`~maraboupy.MarabouCore.SolveProgress`,
+        holding a snapshot of the statistics and the bounds of the output variables that are known to hold
+        (for the whole query, or in SnC mode, for the subquery being solved).
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            options (class:`~maraboupy.MarabouCore.Options`): Object defining the options used for Marabou
+            callback (callable, optional): Function receiving the progress reports, defaults to None
+            interval (int, optional): Milliseconds between progress reports, defaults to 1000
+
+        Returns:
+            :class:`~maraboupy.MarabouCore.SolveJob`
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "options" ),
+           py::arg( "callback" ) = py::none(),
+           py::arg( "interval" ) = 1000,
+           py::keep_alive<0, 1>() );
+    m.def( "calculateBounds",    m.def( "calculateBounds",
            &calculateBounds,
            R"pbdoc(
         Takes in a description of the InputQuery and returns the bounds
@@ -790,6 +1164,141 @@ PYBIND11_MODULE( MarabouCore, m )
         )pbdoc",
            py::arg( "inputQuery" ),
            py::arg( "disjuncts" ) );
+    m.def( "addEquations",
+           &addEquations,
+           R"pbdoc(
+        Add equations given in compressed sparse row form to the InputQuery, reading the arrays in place
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            offsets (numpy array of int64): Equation i consists of the addends in [offsets[i], offsets[i + 1])
+            variables (numpy array of int64): Variable of each addend
+            coefficients (numpy array of float64): Coefficient of each addend
+            scalars (numpy array of float64): Right hand side of each equation
+            types (numpy array of int64): Type of each equation (EQ, GE or LE)
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "offsets" ),
+           py::arg( "variables" ),
+           py::arg( "coefficients" ),
+           py::arg( "scalars" ),
+           py::arg( "types" ) );
+    m.def( "setLowerBounds",
+           &setLowerBounds,
+           R"pbdoc(
+        Set the lower bounds of several variables of the InputQuery
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            variables (numpy array of int64): Variables to bound
+            values (numpy array of float64): Lower bounds of the variables
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "variables" ),
+           py::arg( "values" ) );
+    m.def( "setUpperBounds",
+           &setUpperBounds,
+           R"pbdoc(
+        Set the upper bounds of several variables of the InputQuery
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            variables (numpy array of int64): Variables to bound
+            values (numpy array of float64): Upper bounds of the variables
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "variables" ),
+           py::arg( "values" ) );
+    m.def( "markInputVariables",
+           &markInputVariables,
+           R"pbdoc(
+        Mark the input variables of the InputQuery, in order
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            variables (numpy array of int64): Input variables
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "variables" ) );
+    m.def( "markOutputVariables",
+           &markOutputVariables,
+           R"pbdoc(
+        Mark the output variables of the InputQuery, in order
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            variables (numpy array of int64): Output variables
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "variables" ) );
+    m.def( "addReluConstraints",
+           &addReluConstraints,
+           R"pbdoc(
+        Add Relu constraints to the InputQuery
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            pairs (numpy array of int64): One row (input variable, output variable) per constraint
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "pairs" ) );
+    m.def( "addLeakyReluConstraints",
+           &addLeakyReluConstraints,
+           R"pbdoc(
+        Add LeakyRelu constraints to the InputQuery
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            pairs (numpy array of int64): One row (input variable, output variable) per constraint
+            slopes (numpy array of float64): Slope of each constraint
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "pairs" ),
+           py::arg( "slopes" ) );
+    m.def( "addSigmoidConstraints",
+           &addSigmoidConstraints,
+           R"pbdoc(
+        Add Sigmoid constraints to the InputQuery
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            pairs (numpy array of int64): One row (input variable, output variable) per constraint
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "pairs" ) );
+    m.def( "addSignConstraints",
+           &addSignConstraints,
+           R"pbdoc(
+        Add Sign constraints to the InputQuery
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            pairs (numpy array of int64): One row (input variable, output variable) per constraint
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "pairs" ) );
+    m.def( "addAbsConstraints",
+           &addAbsConstraints,
+           R"pbdoc(
+        Add Abs constraints to the InputQuery
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            pairs (numpy array of int64): One row (input variable, output variable) per constraint
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "pairs" ) );
+    m.def( "addBilinearConstraints",
+           &addBilinearConstraints,
+           R"pbdoc(
+        Add Bilinear constraints to the InputQuery
+
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be solved
+            triples (numpy array of int64): One row (input variable, input variable, output variable) per constraint
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "triples" ) );
     py::class_<InputQuery>( m, "InputQuery" )
         .def( py::init() )
         .def( "setUpperBound", &InputQuery::setUpperBound )
@@ -845,6 +1354,12 @@ PYBIND11_MODULE( MarabouCore, m )
                 Statistics::StatisticsUnsignedAttribute::PP_NUM_ELIMINATED_VARS )
         .value( "PP_NUM_EQUATIONS_REMOVED",
                 Statistics::StatisticsUnsignedAttribute::PP_NUM_EQUATIONS_REMOVED )
+        .value( "PP_NUM_EQUATIONS_PRESOLVED",
+                Statistics::StatisticsUnsignedAttribute::PP_NUM_EQUATIONS_PRESOLVED )
+        .value( "PP_NUM_BOUND_CACHE_HITS",
+                Statistics::StatisticsUnsignedAttribute::PP_NUM_BOUND_CACHE_HITS )
+        .value( "PP_NUM_BOUND_CACHE_TIGHTENINGS",
+                Statistics::StatisticsUnsignedAttribute::PP_NUM_BOUND_CACHE_TIGHTENINGS )
         .value( "NUM_PL_CONSTRAINTS", Statistics::StatisticsUnsignedAttribute::NUM_PL_CONSTRAINTS )
         .value( "CURRENT_TABLEAU_M", Statistics::StatisticsUnsignedAttribute::CURRENT_TABLEAU_M )
         .value( "NUM_SPLITS", Statistics::StatisticsUnsignedAttribute::NUM_SPLITS )
@@ -855,6 +1370,9 @@ PYBIND11_MODULE( MarabouCore, m )
         .value( "PP_NUM_CONSTRAINTS_REMOVED",
                 Statistics::StatisticsUnsignedAttribute::PP_NUM_CONSTRAINTS_REMOVED )
         .value( "CURRENT_TABLEAU_N", Statistics::StatisticsUnsignedAttribute::CURRENT_TABLEAU_N )
+        .value( "NUM_DEFERRED_ROWS", Statistics::StatisticsUnsignedAttribute::NUM_DEFERRED_ROWS )
+        .value( "NUM_LAZY_ROWS_ADDED",
+                Statistics::StatisticsUnsignedAttribute::NUM_LAZY_ROWS_ADDED )
         .value( "MAX_DECISION_LEVEL", Statistics::StatisticsUnsignedAttribute::MAX_DECISION_LEVEL )
         .value( "NUM_ACTIVE_PL_CONSTRAINTS",
                 Statistics::StatisticsUnsignedAttribute::NUM_ACTIVE_PL_CONSTRAINTS )
@@ -868,6 +1386,8 @@ PYBIND11_MODULE( MarabouCore, m )
                 Statistics::StatisticsLongAttribute::TOTAL_TIME_PERFORMING_VALID_CASE_SPLITS_MICRO )
         .value( "PREPROCESSING_TIME_MICRO",
                 Statistics::StatisticsLongAttribute::PREPROCESSING_TIME_MICRO )
+        .value( "NLR_CONSTRUCTION_TIME_MICRO",
+                Statistics::StatisticsLongAttribute::NLR_CONSTRUCTION_TIME_MICRO )
         .value( "NUM_SIMPLEX_UNSTABLE_PIVOTS",
                 Statistics::StatisticsLongAttribute::NUM_SIMPLEX_UNSTABLE_PIVOTS )
         .value( "NUM_BOUND_TIGHTENINGS_ON_EXPLICIT_BASIS",
@@ -908,6 +1428,11 @@ PYBIND11_MODULE( MarabouCore, m )
         .value(
             "NUM_TIGHTENINGS_FROM_SYMBOLIC_BOUND_TIGHTENING",
             Statistics::StatisticsLongAttribute::NUM_TIGHTENINGS_FROM_SYMBOLIC_BOUND_TIGHTENING )
+        .value( "NUM_INCREMENTAL_SYMBOLIC_BOUND_TIGHTENINGS",
+                Statistics::StatisticsLongAttribute::NUM_INCREMENTAL_SYMBOLIC_BOUND_TIGHTENINGS )
+        .value(
+            "NUM_LAYERS_SKIPPED_BY_SYMBOLIC_BOUND_TIGHTENING",
+            Statistics::StatisticsLongAttribute::NUM_LAYERS_SKIPPED_BY_SYMBOLIC_BOUND_TIGHTENING )
         .value( "NUM_ROWS_EXAMINED_BY_ROW_TIGHTENER",
                 Statistics::StatisticsLongAttribute::NUM_ROWS_EXAMINED_BY_ROW_TIGHTENER )
         .value(
@@ -932,6 +1457,16 @@ PYBIND11_MODULE( MarabouCore, m )
                 Statistics::StatisticsLongAttribute::NUM_BOUND_TIGHTENINGS_ON_CONSTRAINT_MATRIX )
         .value( "NUM_TABLEAU_BOUND_HOPPING",
                 Statistics::StatisticsLongAttribute::NUM_TABLEAU_BOUND_HOPPING )
+        .value( "NUM_TABLEAU_LONG_STEPS",
+                Statistics::StatisticsLongAttribute::NUM_TABLEAU_LONG_STEPS )
+        .value( "NUM_TABLEAU_BREAKPOINTS_PASSED",
+                Statistics::StatisticsLongAttribute::NUM_TABLEAU_BREAKPOINTS_PASSED )
+        .value( "NUM_COST_FUNCTION_COMPUTATIONS",
+                Statistics::StatisticsLongAttribute::NUM_COST_FUNCTION_COMPUTATIONS )
+        .value( "NUM_COST_FUNCTION_UPDATES",
+                Statistics::StatisticsLongAttribute::NUM_COST_FUNCTION_UPDATES )
+        .value( "NUM_MAIN_LOOP_HEAP_ALLOCATIONS",
+                Statistics::StatisticsLongAttribute::NUM_MAIN_LOOP_HEAP_ALLOCATIONS )
         .value( "TOTAL_TIME_DEGRADATION_CHECKING",
                 Statistics::StatisticsLongAttribute::TOTAL_TIME_DEGRADATION_CHECKING )
         .value( "TIME_CONSTRAINT_FIXING_STEPS_MICRO",
@@ -949,6 +1484,31 @@ PYBIND11_MODULE( MarabouCore, m )
         .value( "MAX_DEGRADATION", Statistics::StatisticsDoubleAttribute::MAX_DEGRADATION )
         .value( "CURRENT_DEGRADATION", Statistics::StatisticsDoubleAttribute::CURRENT_DEGRADATION )
         .export_values();
+    py::class_<PythonSolveJob, PythonSolveJobPointer>( m, "SolveJob" )
+        .def( "cancel",
+              &PythonSolveJob::cancel,
+              "Ask the job to stop; it then finishes with QUIT_REQUESTED, unless already done" )
+        .def( "poll", &PythonSolveJob::poll, "Return whether the job is done" )
+        .def( "wait",
+              &PythonSolveJob::wait,
+              "Wait until the job is done, or until the timeout (in seconds) has passed. Return "
+              "whether the job is done",
+              py::arg( "timeout" ) = py::none() )
+        .def( "result",
+              &PythonSolveJob::result,
+              "Wait until the job is done, and return its (exitCode, vals, stats), as solve does" );
+    py::class_<SolveProgress>( m, "SolveProgress" )
+        .def_property_readonly(
+            "queryId",
+            []( const SolveProgress &progress ) { return std::string( progress._queryId.ascii() ); } )
+        .def_property_readonly( "statistics",
+                                []( const SolveProgress &progress ) { return progress._statistics; } )
+        .def_property_readonly(
+            "lowerBounds",
+            []( const SolveProgress &progress ) { return boundsToDict( progress._lowerBounds ); } )
+        .def_property_readonly(
+            "upperBounds",
+            []( const SolveProgress &progress ) { return boundsToDict( progress._upperBounds ); } );
     py::class_<Statistics>( m, "Statistics" )
         .def( "getUnsignedAttribute", &Statistics::getUnsignedAttribute )
         .def( "getLongAttribute", &Statistics::getLongAttribute )
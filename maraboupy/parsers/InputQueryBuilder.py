@@ -18,6 +18,7 @@ from maraboupy import MarabouCore
 from maraboupy import MarabouUtils
 from maraboupy.MarabouPythonic import *
 from abc import ABC
+import numpy as np
 
 class InputQueryBuilder(ABC):
     """
@@ -255,56 +256,41 @@ class InputQueryBuilder(ABC):
     def getInputQuery(self):
         """Constructs the `InputQuery` object from the current set of constraints.
 
+        Equations, bounds, and constraints with a fixed number of variables are passed to
+        MarabouCore in bulk, as NumPy arrays, rather than one call per element.
+
         Returns:
             :class:`~maraboupy.MarabouCore.InputQuery`
         """
         ipq = MarabouCore.InputQuery()
         ipq.setNumberOfVariables(self.numVars)
 
-        i = 0
-        for inputVarArray in self.inputVars:
-            for inputVar in inputVarArray.flatten():
-                ipq.markInputVariable(inputVar, i)
-                i+=1
-
-        i = 0
-        for outputVarArray in self.outputVars:
-            for outputVar in outputVarArray.flatten():
-                ipq.markOutputVariable(outputVar, i)
-                i+=1
-
-        for e in self.equList:
-            eq = MarabouCore.Equation(e.EquationType)
-            for (c, v) in e.addendList:
-                assert v < self.numVars
-                eq.addAddend(c, v)
-            eq.setScalar(e.scalar)
-            ipq.addEquation(eq)
-
-        for e in self.additionalEquList:
-            eq = MarabouCore.Equation(e.EquationType)
-            for (c, v) in e.addendList:
-                assert v < self.numVars
-                eq.addAddend(c, v)
-            eq.setScalar(e.scalar)
-            ipq.addEquation(eq)
-
-        for r in self.reluList:
-            assert r[1] < self.numVars and r[0] < self.numVars
-            MarabouCore.addReluConstraint(ipq, r[0], r[1])
-
-        for r in self.leakyReluList:
-            assert r[1] < self.numVars and r[0] < self.numVars
-            assert(r[2] > 0 and r[2] < 1)
-            MarabouCore.addLeakyReluConstraint(ipq, r[0], r[1], r[2])
-
-        for r in self.bilinearList:
-            assert r[2] < self.numVars and r[1] < self.numVars and r[0] < self.numVars
-            MarabouCore.addBilinearConstraint(ipq, r[0], r[1], r[2])
-
-        for r in self.sigmoidList:
-            assert r[1] < self.numVars and r[0] < self.numVars
-            MarabouCore.addSigmoidConstraint(ipq, r[0], r[1])
+        if len(self.inputVars) > 0:
+            MarabouCore.markInputVariables(ipq, self._indexArray(
+                np.concatenate([np.asarray(v).flatten() for v in self.inputVars])))
+
+        if len(self.outputVars) > 0:
+            MarabouCore.markOutputVariables(ipq, self._indexArray(
+                np.concatenate([np.asarray(v).flatten() for v in self.outputVars])))
+
+        equations = self.equList + self.additionalEquList
+        if len(equations) > 0:
+            MarabouCore.addEquations(ipq, *self._equationArrays(equations))
+
+        if len(self.reluList) > 0:
+            MarabouCore.addReluConstraints(ipq, self._indexArray(self.reluList))
+
+        if len(self.leakyReluList) > 0:
+            leakyRelus = self._indexArray([r[:2] for r in self.leakyReluList])
+            slopes = np.array([r[2] for r in self.leakyReluList], dtype=np.float64)
+            assert np.all((slopes > 0) & (slopes < 1))
+            MarabouCore.addLeakyReluConstraints(ipq, leakyRelus, slopes)
+
+        if len(self.bilinearList) > 0:
+            MarabouCore.addBilinearConstraints(ipq, self._indexArray(self.bilinearList))
+
+        if len(self.sigmoidList) > 0:
+            MarabouCore.addSigmoidConstraints(ipq, self._indexArray(self.sigmoidList))
 
         for m in self.maxList:
             assert m[1] < self.numVars
@@ -319,11 +305,11 @@ class InputQueryBuilder(ABC):
                 assert e < self.numVars
             MarabouCore.addSoftmaxConstraint(ipq, m[0], m[1])
 
-        for b, f in self.absList:
-            MarabouCore.addAbsConstraint(ipq, b, f)
+        if len(self.absList) > 0:
+            MarabouCore.addAbsConstraints(ipq, self._indexArray(self.absList))
 
-        for b, f in self.signList:
-            MarabouCore.addSignConstraint(ipq, b, f)
+        if len(self.signList) > 0:
+            MarabouCore.addSignConstraints(ipq, self._indexArray(self.signList))
 
         for disjunction in self.disjunctionList:
             converted_disjunction = []
@@ -339,16 +325,57 @@ class InputQueryBuilder(ABC):
                 converted_disjunction.append(converted_disjunct)
             MarabouCore.addDisjunctionConstraint(ipq, converted_disjunction)
 
-        for l in self.lowerBounds:
-            assert l < self.numVars
-            ipq.setLowerBound(l, self.lowerBounds[l])
+        if len(self.lowerBounds) > 0:
+            MarabouCore.setLowerBounds(ipq,
+                                       self._indexArray(list(self.lowerBounds.keys())),
+                                       np.array(list(self.lowerBounds.values()), dtype=np.float64))
 
-        for u in self.upperBounds:
-            assert u < self.numVars
-            ipq.setUpperBound(u, self.upperBounds[u])
+        if len(self.upperBounds) > 0:
+            MarabouCore.setUpperBounds(ipq,
+                                       self._indexArray(list(self.upperBounds.keys())),
+                                       np.array(list(self.upperBounds.values()), dtype=np.float64))
 
         return ipq
 
+    @staticmethod
+    def _indexArray(values):
+        """Convert variables to a C-contiguous int64 array, which MarabouCore reads without copying
+
+        Args:
+            values (list or numpy array of int): Variables, or rows of variables
+
+        Returns:
+            (numpy array of int64)
+        """
+        return np.ascontiguousarray(values, dtype=np.int64)
+
+    @staticmethod
+    def _equationArrays(equations):
+        """Lay out equations in compressed sparse row form, as expected by `MarabouCore.addEquations`
+
+        Args:
+            equations (list of :class:`~maraboupy.MarabouUtils.Equation`): Equations to convert
+
+        Returns:
+            (tuple): offsets, variables, coefficients, scalars and types of the equations
+        """
+        numberOfEquations = len(equations)
+        lengths = np.fromiter((len(e.addendList) for e in equations), dtype=np.int64,
+                              count=numberOfEquations)
+        offsets = np.zeros(numberOfEquations + 1, dtype=np.int64)
+        np.cumsum(lengths, out=offsets[1:])
+
+        numberOfAddends = int(offsets[-1])
+        coefficients = np.fromiter((c for e in equations for (c, _) in e.addendList),
+                                   dtype=np.float64, count=numberOfAddends)
+        variables = np.fromiter((v for e in equations for (_, v) in e.addendList),
+                                dtype=np.int64, count=numberOfAddends)
+        scalars = np.fromiter((e.scalar for e in equations), dtype=np.float64,
+                              count=numberOfEquations)
+        types = np.fromiter((int(e.EquationType) for e in equations), dtype=np.int64,
+                            count=numberOfEquations)
+        return offsets, variables, coefficients, scalars, types
+
     def saveQuery(self, filename=""):
         """Serializes the inputQuery in the given filename
 
@@ -4,6 +4,8 @@ import warnings
 warnings.filterwarnings("ignore", category=DeprecationWarning)
 warnings.filterwarnings("ignore", category=PendingDeprecationWarning)
 
+import concurrent.futures
+import numpy as np
 import pytest
 from maraboupy import MarabouCore
 from maraboupy.Marabou import createOptions
@@ -141,6 +143,82 @@ def test_dump_query():
         assert vals[var] <= ipq.getUpperBound(var)
     assert exitCode == "sat"
 
+def test_bulk_construction():
+    """
+    This function tests that the query of define_ipq can be constructed from NumPy arrays,
+    and that it is solved as the one constructed element by element.
+    """
+    for property_bound, expectedExitCode in [(-2.0, "unsat"), (3.0, "sat")]:
+        ipq = MarabouCore.InputQuery()
+        ipq.setNumberOfVariables(3)
+
+        MarabouCore.setLowerBounds(ipq, np.array([0, 1, 2]), np.array([-1, 0, -LARGE]))
+        MarabouCore.setUpperBounds(ipq, np.array([0, 1]), np.array([1, LARGE]))
+        MarabouCore.addReluConstraints(ipq, np.array([[0, 1]]))
+
+        # y - relu(x) = 0, and x + y <= property_bound
+        MarabouCore.addEquations(ipq,
+                                 np.array([0, 2, 4]),
+                                 np.array([2, 1, 0, 2]),
+                                 np.array([1.0, -1.0, 1.0, 1.0]),
+                                 np.array([0, property_bound]),
+                                 np.array([int(MarabouCore.Equation.EQ),
+                                           int(MarabouCore.Equation.LE)]))
+
+        exitCode, vals, stats = MarabouCore.solve(ipq, OPT)
+        assert exitCode == expectedExitCode
+        assert exitCode == MarabouCore.solve(define_ipq(property_bound), OPT)[0]
+
+    # Malformed arrays are rejected
+    with pytest.raises(IndexError):
+        MarabouCore.addReluConstraints(ipq, np.array([[0, 3]]))
+    with pytest.raises(ValueError):
+        MarabouCore.addReluConstraints(ipq, np.array([0, 1]))
+    with pytest.raises(ValueError):
+        MarabouCore.setLowerBounds(ipq, np.array([0, 1]), np.array([0.0]))
+
+def test_concurrent_solves():
+    """
+    This function tests that MarabouCore.solve can be called from several threads at once,
+    each with its own options, and that every query is solved correctly.
+    """
+    verboseOptions = createOptions(verbosity = 1)
+    cases = [(-2.0, OPT, "unsat"), (3.0, verboseOptions, "sat")] * 4
+    with concurrent.futures.ThreadPoolExecutor(max_workers = 4) as executor:
+        futures = [executor.submit(MarabouCore.solve, define_ipq(property_bound), options)
+                   for property_bound, options, _ in cases]
+        for future, (_, _, expectedExitCode) in zip(futures, cases):
+            exitCode, vals, stats = future.result()
+            assert exitCode == expectedExitCode
+
+def test_solve_async():
+    """
+    This function tests that MarabouCore.solveAsync solves queries in the background, reports
+    the progress of the search, and can be cancelled.
+    """
+    reports = []
+    job = MarabouCore.solveAsync(define_ipq(3.0), OPT, reports.append, 0)
+    assert job.wait(60)
+    assert job.poll()
+    exitCode, vals, stats = job.result()
+    assert exitCode == "sat"
+    assert len(vals) > 0
+    assert len(reports) > 0
+    for report in reports:
+        assert report.queryId == ""
+        assert report.statistics.getTotalTimeInMicro() >= 0
+        assert report.lowerBounds.keys() == report.upperBounds.keys()
+
+    exitCode, vals, stats = MarabouCore.solveAsync(define_ipq(-2.0), OPT).result()
+    assert exitCode == "unsat"
+    assert len(vals) == 0
+
+    # A cancelled job stops, unless it was done already
+    job = MarabouCore.solveAsync(define_ipq(3.0), OPT)
+    job.cancel()
+    assert job.wait()
+    assert job.result()[0] in ["QUIT_REQUESTED", "sat"]
+
 def define_ipq(property_bound):
     """
     This function defines a simple input query directly through MarabouCore
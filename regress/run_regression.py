@@ -2,6 +2,7 @@ import argparse
 import os
 import subprocess
 import sys
+import tempfile
 import threading
 
 DEFAULT_TIMEOUT = 600
@@ -89,11 +90,45 @@ def run_marabou(marabou_binary, network_path, property_path, expected_result, ti
     if isinstance(arguments, list):
         for arg in arguments:
             args += arg.split("+")
+
+    num_remote_workers = 0
+    for arg in list(args):
+        if arg.startswith('--dnc-workers='):
+            num_remote_workers = int(arg.split('=')[1])
+            args.remove(arg)
+    if num_remote_workers > 0:
+        return run_distributed_marabou(args, num_remote_workers, expected_result, timeout)
+
     out, err, exit_status = run_process(args, os.curdir, timeout)
 
     return analyze_process_result(out, err, exit_status, expected_result)
 
 
+def run_distributed_marabou(args, num_remote_workers, expected_result, timeout):
+    '''
+    Run marabou as a distributed snc coordinator, together with
+    num_remote_workers local worker processes that connect to it over a
+    unix domain socket
+    '''
+    with tempfile.TemporaryDirectory() as socket_dir:
+        address = 'unix:' + os.path.join(socket_dir, 'coordinator.sock')
+        workers = [subprocess.Popen(args + ['--dnc-worker=' + address],
+                                    stdout=subprocess.DEVNULL,
+                                    stderr=subprocess.PIPE)
+                   for _ in range(num_remote_workers)]
+        try:
+            out, err, exit_status = run_process(args + ['--dnc-coordinator=' + address],
+                                                os.curdir, timeout)
+        finally:
+            for worker in workers:
+                try:
+                    worker.wait(timeout=60)
+                except subprocess.TimeoutExpired:
+                    worker.kill()
+
+    return analyze_process_result(out, err, exit_status, expected_result)
+
+
 def run_mpsparser(mps_binary, network_path, expected_result, arguments=None):
     '''
     Run marabou and assert the result is according to the expected_result
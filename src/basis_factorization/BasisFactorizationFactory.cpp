@@ -19,6 +19,7 @@
 #include "ForrestTomlinFactorization.h"
 #include "GlobalConfiguration.h"
 #include "LUFactorization.h"
+#include "MarkowitzFTFactorization.h"
 #include "SparseFTFactorization.h"
 #include "SparseLUFactorization.h"
 
@@ -45,6 +46,11 @@ IBasisFactorization *BasisFactorizationFactory::createBasisFactorization(
               GlobalConfiguration::SPARSE_FORREST_TOMLIN_FACTORIZATION )
         return new SparseFTFactorization( basisSize, basisColumnOracle );
 
+    // Markowitz FT
+    else if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
+              GlobalConfiguration::MARKOWITZ_FORREST_TOMLIN_FACTORIZATION )
+        return new MarkowitzFTFactorization( basisSize, basisColumnOracle );
+
     throw BasisFactorizationError( BasisFactorizationError::UNKNOWN_BASIS_FACTORIZATION_TYPE );
 }
 
@@ -19,6 +19,7 @@
 #include "EtaMatrix.h"
 #include "FloatUtils.h"
 #include "MalformedBasisException.h"
+#include "Tracer.h"
 
 #include <cstdlib>
 #include <cstring>
@@ -870,6 +871,8 @@ void ForrestTomlinFactorization::dump() const
 
 void ForrestTomlinFactorization::obtainFreshBasis()
 {
+    TraceSpan span( "ForrestTomlinFactorization::obtainFreshBasis" );
+
     for ( unsigned column = 0; column < _m; ++column )
     {
         _basisColumnOracle->getColumnOfBasis( column, _workVector );
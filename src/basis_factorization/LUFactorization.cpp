@@ -22,6 +22,7 @@
 #include "GlobalConfiguration.h"
 #include "LPElement.h"
 #include "MalformedBasisException.h"
+#include "Tracer.h"
 
 LUFactorization::LUFactorization( unsigned m, const BasisColumnOracle &basisColumnOracle )
     : IBasisFactorization( basisColumnOracle )
@@ -254,6 +255,8 @@ void LUFactorization::dump() const
 
 void LUFactorization::obtainFreshBasis()
 {
+    TraceSpan span( "LUFactorization::obtainFreshBasis" );
+
     for ( unsigned column = 0; column < _m; ++column )
     {
         _basisColumnOracle->getColumnOfBasis( column, _z );
@@ -0,0 +1,78 @@
+/*********************                                                        */
+/*! \file MarkowitzFTFactorization.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "MarkowitzFTFactorization.h"
+
+#include "BasisFactorizationError.h"
+#include "GlobalConfiguration.h"
+#include "MalformedBasisException.h"
+
+MarkowitzFTFactorization::MarkowitzFTFactorization( unsigned m,
+                                                    const BasisColumnOracle &basisColumnOracle )
+    : SparseFTFactorization( m, basisColumnOracle )
+    , _markowitzGaussianEliminator( m )
+    , _nnzOfF( 0 )
+    , _nnzAfterFactorization( 0 )
+{
+}
+
+void MarkowitzFTFactorization::factorizeBasis()
+{
+    clearFactorization();
+
+    try
+    {
+        _markowitzGaussianEliminator.run( &_B, &_sparseLUFactors );
+    }
+    catch ( const BasisFactorizationError &e )
+    {
+        if ( e.getCode() == BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED )
+            throw MalformedBasisException();
+        else
+            throw e;
+    }
+
+    _nnzOfF = _sparseLUFactors._F->getNnz();
+    _nnzAfterFactorization = _nnzOfF + _sparseLUFactors._V->getNnz();
+
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_BASIS_REFACTORIZATIONS );
+}
+
+bool MarkowitzFTFactorization::refactorizationNeeded() const
+{
+    if ( _etas.size() > GlobalConfiguration::REFACTORIZATION_THRESHOLD )
+        return true;
+
+    unsigned nnz = _nnzOfF + _sparseLUFactors._V->getNnz();
+    for ( const auto &eta : _etas )
+        nnz += eta->_sparseColumn.size();
+
+    return nnz > GlobalConfiguration::REFACTORIZATION_FILL_FACTOR * _nnzAfterFactorization;
+}
+
+void MarkowitzFTFactorization::setStatistics( Statistics *statistics )
+{
+    SparseFTFactorization::setStatistics( statistics );
+    _markowitzGaussianEliminator.setStatistics( statistics );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,68 @@
+/*********************                                                        */
+/*! \file MarkowitzFTFactorization.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __MarkowitzFTFactorization_h__
+#define __MarkowitzFTFactorization_h__
+
+#include "MarkowitzGaussianEliminator.h"
+#include "SparseFTFactorization.h"
+
+/*
+  A sparse FT factorization, A = F * H * V, whose LU factors are computed
+  by the MarkowitzGaussianEliminator.
+
+  Rather than after a fixed number of updates, a fresh factorization is
+  computed once the updates have made the factors too dense: when the
+  non-zeros of F, H and V exceed REFACTORIZATION_FILL_FACTOR times the
+  non-zeros of the last fresh factorization. REFACTORIZATION_THRESHOLD
+  still bounds the number of updates, to limit the accumulation of
+  numerical errors.
+*/
+class MarkowitzFTFactorization : public SparseFTFactorization
+{
+public:
+    MarkowitzFTFactorization( unsigned m, const BasisColumnOracle &basisColumnOracle );
+
+    /*
+      Have the Basis Factoriaztion object start reporting statistics.
+    */
+    void setStatistics( Statistics *statistics );
+
+private:
+    /*
+      The Gaussian eliminator, to compute basis factorizations
+    */
+    MarkowitzGaussianEliminator _markowitzGaussianEliminator;
+
+    /*
+      The number of non-zeros in F (which the updates do not change), and
+      in F and V together, after the last fresh factorization
+    */
+    unsigned _nnzOfF;
+    unsigned _nnzAfterFactorization;
+
+    void factorizeBasis();
+    bool refactorizationNeeded() const;
+};
+
+#endif // __MarkowitzFTFactorization_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
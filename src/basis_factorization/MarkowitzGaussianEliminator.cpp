@@ -0,0 +1,669 @@
+/*********************                                                        */
+/*! \file MarkowitzGaussianEliminator.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "MarkowitzGaussianEliminator.h"
+
+#include "BasisFactorizationError.h"
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+
+#include <climits>
+
+MarkowitzGaussianEliminator::CountBuckets::CountBuckets( unsigned m )
+    : _m( m )
+    , _head( NULL )
+    , _next( NULL )
+    , _previous( NULL )
+{
+    // Counts range from 0 to m
+    _head = new int[_m + 1];
+    _next = new int[_m];
+    _previous = new int[_m];
+
+    clear();
+}
+
+MarkowitzGaussianEliminator::CountBuckets::~CountBuckets()
+{
+    delete[] _head;
+    delete[] _next;
+    delete[] _previous;
+}
+
+void MarkowitzGaussianEliminator::CountBuckets::clear()
+{
+    std::fill_n( _head, _m + 1, (int)NONE );
+}
+
+void MarkowitzGaussianEliminator::CountBuckets::insert( unsigned index, unsigned count )
+{
+    ASSERT( count <= _m );
+
+    _previous[index] = NONE;
+    _next[index] = _head[count];
+    if ( _head[count] != NONE )
+        _previous[_head[count]] = index;
+    _head[count] = index;
+}
+
+void MarkowitzGaussianEliminator::CountBuckets::remove( unsigned index, unsigned count )
+{
+    if ( _previous[index] != NONE )
+        _next[_previous[index]] = _next[index];
+    else
+    {
+        ASSERT( _head[count] == (int)index );
+        _head[count] = _next[index];
+    }
+
+    if ( _next[index] != NONE )
+        _previous[_next[index]] = _previous[index];
+}
+
+void MarkowitzGaussianEliminator::CountBuckets::move( unsigned index,
+                                                      unsigned oldCount,
+                                                      unsigned newCount )
+{
+    if ( oldCount == newCount )
+        return;
+
+    remove( index, oldCount );
+    insert( index, newCount );
+}
+
+int MarkowitzGaussianEliminator::CountBuckets::first( unsigned count ) const
+{
+    return _head[count];
+}
+
+int MarkowitzGaussianEliminator::CountBuckets::next( unsigned index ) const
+{
+    return _next[index];
+}
+
+MarkowitzGaussianEliminator::MarkowitzGaussianEliminator( unsigned m )
+    : _m( m )
+    , _sparseLUFactors( NULL )
+    , _rowCounts( NULL )
+    , _columnCounts( NULL )
+    , _rowBuckets( m )
+    , _columnBuckets( m )
+    , _rowActive( NULL )
+    , _columnActive( NULL )
+    , _columnPatterns( NULL )
+    , _work( NULL )
+    , _stamps( NULL )
+    , _currentStamp( 0 )
+    , _fillIndices( NULL )
+    , _rowBuffer( NULL )
+    , _candidateRows( NULL )
+    , _candidateValues( NULL )
+    , _numSingletonSteps( 0 )
+    , _statistics( NULL )
+{
+    _rowCounts = new unsigned[_m];
+    if ( !_rowCounts )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::rowCounts" );
+
+    _columnCounts = new unsigned[_m];
+    if ( !_columnCounts )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::columnCounts" );
+
+    _rowActive = new bool[_m];
+    if ( !_rowActive )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::rowActive" );
+
+    _columnActive = new bool[_m];
+    if ( !_columnActive )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::columnActive" );
+
+    _columnPatterns = new std::vector<unsigned>[_m];
+    if ( !_columnPatterns )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::columnPatterns" );
+
+    _work = new double[_m];
+    if ( !_work )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::work" );
+
+    _stamps = new unsigned[_m];
+    if ( !_stamps )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::stamps" );
+
+    _fillIndices = new unsigned[_m];
+    if ( !_fillIndices )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::fillIndices" );
+
+    _rowBuffer = new SparseUnsortedArray::Entry[_m];
+    if ( !_rowBuffer )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::rowBuffer" );
+
+    _candidateRows = new unsigned[_m];
+    if ( !_candidateRows )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::candidateRows" );
+
+    _candidateValues = new double[_m];
+    if ( !_candidateValues )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "MarkowitzGaussianEliminator::candidateValues" );
+}
+
+MarkowitzGaussianEliminator::~MarkowitzGaussianEliminator()
+{
+    freeMemoryIfNeeded();
+}
+
+void MarkowitzGaussianEliminator::freeMemoryIfNeeded()
+{
+    if ( _rowCounts )
+    {
+        delete[] _rowCounts;
+        _rowCounts = NULL;
+    }
+
+    if ( _columnCounts )
+    {
+        delete[] _columnCounts;
+        _columnCounts = NULL;
+    }
+
+    if ( _rowActive )
+    {
+        delete[] _rowActive;
+        _rowActive = NULL;
+    }
+
+    if ( _columnActive )
+    {
+        delete[] _columnActive;
+        _columnActive = NULL;
+    }
+
+    if ( _columnPatterns )
+    {
+        delete[] _columnPatterns;
+        _columnPatterns = NULL;
+    }
+
+    if ( _work )
+    {
+        delete[] _work;
+        _work = NULL;
+    }
+
+    if ( _stamps )
+    {
+        delete[] _stamps;
+        _stamps = NULL;
+    }
+
+    if ( _fillIndices )
+    {
+        delete[] _fillIndices;
+        _fillIndices = NULL;
+    }
+
+    if ( _rowBuffer )
+    {
+        delete[] _rowBuffer;
+        _rowBuffer = NULL;
+    }
+
+    if ( _candidateRows )
+    {
+        delete[] _candidateRows;
+        _candidateRows = NULL;
+    }
+
+    if ( _candidateValues )
+    {
+        delete[] _candidateValues;
+        _candidateValues = NULL;
+    }
+}
+
+void MarkowitzGaussianEliminator::run( const SparseColumnsOfBasis *A,
+                                       SparseLUFactors *sparseLUFactors )
+{
+    initializeFactorization( A, sparseLUFactors );
+    factorize();
+
+    // The eliminations only maintained V and F, so rebuild their transposes
+    _sparseLUFactors->_V->transposeIntoOther( _sparseLUFactors->_Vt );
+    _sparseLUFactors->_F->transposeIntoOther( _sparseLUFactors->_Ft );
+}
+
+void MarkowitzGaussianEliminator::initializeFactorization( const SparseColumnsOfBasis *A,
+                                                           SparseLUFactors *sparseLUFactors )
+{
+    _sparseLUFactors = sparseLUFactors;
+
+    /*
+      Initially:
+
+        P = Q = I
+        V = U = A
+        F = L = I
+
+      As in the SparseGaussianEliminator, the diagonal of F is implicitly 1.
+    */
+
+    _sparseLUFactors->_Vt->initialize( A->_columns, _m, _m );
+    _sparseLUFactors->_Vt->transposeIntoOther( _sparseLUFactors->_V );
+
+    _sparseLUFactors->_F->initializeToEmpty( _m, _m );
+    _sparseLUFactors->_P.resetToIdentity();
+    _sparseLUFactors->_Q.resetToIdentity();
+    _sparseLUFactors->_usePForF = false;
+
+    _rowBuckets.clear();
+    _columnBuckets.clear();
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        _rowCounts[i] = _sparseLUFactors->_V->getRow( i )->getNnz();
+        _rowBuckets.insert( i, _rowCounts[i] );
+        _rowActive[i] = true;
+
+        const SparseUnsortedArray *column = _sparseLUFactors->_Vt->getRow( i );
+        const SparseUnsortedArray::Entry *entry = column->getArray();
+        _columnCounts[i] = column->getNnz();
+        _columnPatterns[i].clear();
+        for ( unsigned j = 0; j < _columnCounts[i]; ++j )
+            _columnPatterns[i].push_back( entry[j]._index );
+        _columnBuckets.insert( i, _columnCounts[i] );
+        _columnActive[i] = true;
+    }
+
+    std::fill_n( _stamps, _m, 0 );
+    _currentStamp = 0;
+    _numSingletonSteps = 0;
+}
+
+void MarkowitzGaussianEliminator::factorize()
+{
+    for ( unsigned step = 0; step < _m; ++step )
+    {
+        unsigned vRow;
+        unsigned vColumn;
+        double pivotElement;
+
+        choosePivot( vRow, vColumn, pivotElement );
+        pivot( step, vRow, vColumn, pivotElement );
+    }
+}
+
+void MarkowitzGaussianEliminator::choosePivot( unsigned &vRow,
+                                               unsigned &vColumn,
+                                               double &pivotElement )
+{
+    MGAUSSIAN_LOG( "Choose pivot invoked" );
+
+    if ( _columnBuckets.first( 0 ) != CountBuckets::NONE )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Have a zero column" );
+
+    if ( _rowBuckets.first( 0 ) != CountBuckets::NONE )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Have a zero row" );
+
+    // A singleton column needs no elimination at all
+    int singleton = _columnBuckets.first( 1 );
+    if ( singleton != CountBuckets::NONE )
+    {
+        vColumn = singleton;
+        unsigned numElements = collectColumn( vColumn );
+        ASSERT( numElements == 1 );
+        (void)numElements;
+
+        vRow = _candidateRows[0];
+        pivotElement = _candidateValues[0];
+        ++_numSingletonSteps;
+
+        MGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (singleton column): V[%u,%u] = %lf",
+                                vRow,
+                                vColumn,
+                                pivotElement )
+                           .ascii() );
+        return;
+    }
+
+    // A singleton row causes no fill-in
+    singleton = _rowBuckets.first( 1 );
+    if ( singleton != CountBuckets::NONE )
+    {
+        vRow = singleton;
+        const SparseUnsortedArray *sparseRow = _sparseLUFactors->_V->getRow( vRow );
+        ASSERT( sparseRow->getNnz() == 1U );
+
+        vColumn = sparseRow->getArray()[0]._index;
+        pivotElement = sparseRow->getArray()[0]._value;
+        ++_numSingletonSteps;
+
+        MGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (singleton row): V[%u,%u] = %lf",
+                                vRow,
+                                vColumn,
+                                pivotElement )
+                           .ascii() );
+        return;
+    }
+
+    if ( !chooseMarkowitzPivot( vRow, vColumn, pivotElement ) )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Couldn't find a pivot" );
+}
+
+bool MarkowitzGaussianEliminator::chooseMarkowitzPivot( unsigned &vRow,
+                                                        unsigned &vColumn,
+                                                        double &pivotElement )
+{
+    /*
+      Apply the Markowitz rule within the bump: pick a pivot a_ij that
+      minimizes (p_i - 1)(q_j - 1), where p_i and q_j are the numbers of
+      non-zero elements in row i and column j, among the elements that
+      are large enough compared to the rest of their column.
+
+      The columns are searched from the sparsest, and the search stops
+      once a few columns have been examined, or once no sparser pivot is
+      possible in the remaining columns.
+    */
+
+    unsigned minimalCost = UINT_MAX;
+    double absPivotElement = 0;
+    unsigned numExamined = 0;
+    bool found = false;
+
+    for ( unsigned count = 2; count <= _m; ++count )
+    {
+        // Rows have at least two elements, so these columns cost at least count - 1
+        if ( found && minimalCost <= count - 1 )
+            break;
+
+        for ( int column = _columnBuckets.first( count ); column != CountBuckets::NONE;
+              column = _columnBuckets.next( column ) )
+        {
+            unsigned numElements = collectColumn( column );
+
+            double maxInColumn = 0;
+            for ( unsigned i = 0; i < numElements; ++i )
+            {
+                double contender = FloatUtils::abs( _candidateValues[i] );
+                if ( contender > maxInColumn )
+                    maxInColumn = contender;
+            }
+
+            for ( unsigned i = 0; i < numElements; ++i )
+            {
+                double absContender = FloatUtils::abs( _candidateValues[i] );
+
+                // Only consider large-enough elements
+                if ( !FloatUtils::gt(
+                         absContender,
+                         maxInColumn *
+                             GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD ) )
+                    continue;
+
+                unsigned cost = ( _rowCounts[_candidateRows[i]] - 1 ) * ( count - 1 );
+                if ( ( cost < minimalCost ) ||
+                     ( ( cost == minimalCost ) && ( absContender > absPivotElement ) ) )
+                {
+                    minimalCost = cost;
+                    vRow = _candidateRows[i];
+                    vColumn = column;
+                    pivotElement = _candidateValues[i];
+                    absPivotElement = absContender;
+                    found = true;
+                }
+            }
+
+            ++numExamined;
+            if ( found && numExamined >= GlobalConfiguration::MARKOWITZ_PIVOT_SEARCH_LIMIT )
+                break;
+        }
+
+        if ( found && numExamined >= GlobalConfiguration::MARKOWITZ_PIVOT_SEARCH_LIMIT )
+            break;
+    }
+
+    if ( found )
+        MGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot: V[%u,%u] = %lf (cost %u)",
+                                vRow,
+                                vColumn,
+                                pivotElement,
+                                minimalCost )
+                           .ascii() );
+
+    return found;
+}
+
+unsigned MarkowitzGaussianEliminator::collectColumn( unsigned vColumn )
+{
+    nextStamp();
+
+    std::vector<unsigned> &pattern = _columnPatterns[vColumn];
+    unsigned numElements = 0;
+    unsigned kept = 0;
+
+    for ( unsigned i = 0; i < pattern.size(); ++i )
+    {
+        unsigned vRow = pattern[i];
+        if ( !_rowActive[vRow] || _stamps[vRow] == _currentStamp )
+            continue;
+        _stamps[vRow] = _currentStamp;
+
+        double value = _sparseLUFactors->_V->getRow( vRow )->get( vColumn );
+        if ( value == 0 )
+            continue;
+
+        pattern[kept++] = vRow;
+        _candidateRows[numElements] = vRow;
+        _candidateValues[numElements] = value;
+        ++numElements;
+    }
+
+    pattern.resize( kept );
+
+    ASSERT( numElements == _columnCounts[vColumn] );
+    return numElements;
+}
+
+void MarkowitzGaussianEliminator::pivot( unsigned step,
+                                         unsigned vRow,
+                                         unsigned vColumn,
+                                         double pivotElement )
+{
+    ASSERT( _rowActive[vRow] && _columnActive[vColumn] );
+    ASSERT( !FloatUtils::isZero( pivotElement ) );
+
+    /*
+      Move V[vRow, vColumn] to position [step, step] in U (= P'VQ')
+    */
+    _sparseLUFactors->_P._columnOrdering[step] = vRow;
+    _sparseLUFactors->_P._rowOrdering[vRow] = step;
+    _sparseLUFactors->_Q._rowOrdering[step] = vColumn;
+    _sparseLUFactors->_Q._columnOrdering[vColumn] = step;
+    _sparseLUFactors->_vDiagonalElements[vRow] = pivotElement;
+
+    // Collect the rest of the pivot column before the counters change
+    unsigned numElements = collectColumn( vColumn );
+
+    /*
+      The pivot row and column leave the active submatrix. The elements of
+      the pivot row in the active submatrix become a row of U.
+    */
+    _rowActive[vRow] = false;
+    _rowBuckets.remove( vRow, _rowCounts[vRow] );
+    _columnActive[vColumn] = false;
+    _columnBuckets.remove( vColumn, _columnCounts[vColumn] );
+
+    const SparseUnsortedArray *pivotRow = _sparseLUFactors->_V->getRow( vRow );
+    const SparseUnsortedArray::Entry *entry = pivotRow->getArray();
+    for ( unsigned i = 0; i < pivotRow->getNnz(); ++i )
+    {
+        if ( entry[i]._index != vColumn )
+            decrementColumnCount( entry[i]._index );
+    }
+
+    // Eliminate all other elements of the pivot column
+    for ( unsigned i = 0; i < numElements; ++i )
+    {
+        unsigned row = _candidateRows[i];
+        if ( row == vRow )
+            continue;
+
+        /*
+          The Gaussian row multiplier for this row is:
+          - V[row, vColumn] / pivotElement
+        */
+        double rowMultiplier = -_candidateValues[i] / pivotElement;
+        eliminateRow( row, vRow, vColumn, rowMultiplier );
+
+        /*
+          Store the row multiplier in matrix F, using F = PLP'.
+          F's rows are ordered same as V's
+        */
+        if ( !FloatUtils::isZero( rowMultiplier ) )
+            _sparseLUFactors->_F->append( row, vRow, -rowMultiplier );
+    }
+
+    _columnPatterns[vColumn].clear();
+}
+
+void MarkowitzGaussianEliminator::eliminateRow( unsigned vRow,
+                                                unsigned vPivotRow,
+                                                unsigned vPivotColumn,
+                                                double rowMultiplier )
+{
+    SparseUnsortedArray *sparseRow = _sparseLUFactors->_V->getRow( vRow );
+    const SparseUnsortedArray *pivotRow = _sparseLUFactors->_V->getRow( vPivotRow );
+
+    // Scatter the row being eliminated
+    nextStamp();
+    const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+    unsigned nnz = sparseRow->getNnz();
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        _work[entry[i]._index] = entry[i]._value;
+        _stamps[entry[i]._index] = _currentStamp;
+    }
+
+    // Add the multiple of the pivot row, noting the newly created elements
+    unsigned numFillIndices = 0;
+    const SparseUnsortedArray::Entry *pivotEntry = pivotRow->getArray();
+    for ( unsigned i = 0; i < pivotRow->getNnz(); ++i )
+    {
+        unsigned vColumn = pivotEntry[i]._index;
+        if ( vColumn == vPivotColumn )
+            continue;
+
+        if ( _stamps[vColumn] != _currentStamp )
+        {
+            _stamps[vColumn] = _currentStamp;
+            _work[vColumn] = 0;
+            _fillIndices[numFillIndices++] = vColumn;
+        }
+
+        _work[vColumn] += rowMultiplier * pivotEntry[i]._value;
+    }
+
+    // Gather the row back, dropping the eliminated and cancelled elements
+    unsigned newNnz = 0;
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        unsigned vColumn = entry[i]._index;
+        if ( vColumn == vPivotColumn )
+            continue;
+
+        if ( FloatUtils::isZero( _work[vColumn] ) )
+            decrementColumnCount( vColumn );
+        else
+            _rowBuffer[newNnz++] = SparseUnsortedArray::Entry( vColumn, _work[vColumn] );
+    }
+
+    for ( unsigned i = 0; i < numFillIndices; ++i )
+    {
+        unsigned vColumn = _fillIndices[i];
+        if ( FloatUtils::isZero( _work[vColumn] ) )
+            continue;
+
+        _rowBuffer[newNnz++] = SparseUnsortedArray::Entry( vColumn, _work[vColumn] );
+        _columnPatterns[vColumn].push_back( vRow );
+        incrementColumnCount( vColumn );
+    }
+
+    sparseRow->clear();
+    for ( unsigned i = 0; i < newNnz; ++i )
+        sparseRow->append( _rowBuffer[i]._index, _rowBuffer[i]._value );
+
+    setRowCount( vRow, newNnz );
+}
+
+void MarkowitzGaussianEliminator::setRowCount( unsigned vRow, unsigned count )
+{
+    _rowBuckets.move( vRow, _rowCounts[vRow], count );
+    _rowCounts[vRow] = count;
+}
+
+void MarkowitzGaussianEliminator::decrementColumnCount( unsigned vColumn )
+{
+    ASSERT( _columnActive[vColumn] && _columnCounts[vColumn] > 0 );
+    _columnBuckets.move( vColumn, _columnCounts[vColumn], _columnCounts[vColumn] - 1 );
+    --_columnCounts[vColumn];
+}
+
+void MarkowitzGaussianEliminator::incrementColumnCount( unsigned vColumn )
+{
+    ASSERT( _columnActive[vColumn] && _columnCounts[vColumn] < _m );
+    _columnBuckets.move( vColumn, _columnCounts[vColumn], _columnCounts[vColumn] + 1 );
+    ++_columnCounts[vColumn];
+}
+
+void MarkowitzGaussianEliminator::nextStamp()
+{
+    if ( ++_currentStamp == 0 )
+    {
+        std::fill_n( _stamps, _m, 0 );
+        _currentStamp = 1;
+    }
+}
+
+void MarkowitzGaussianEliminator::setStatistics( Statistics *statistics )
+{
+    _statistics = statistics;
+}
+
+unsigned MarkowitzGaussianEliminator::getNumSingletonSteps() const
+{
+    return _numSingletonSteps;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,187 @@
+/*********************                                                        */
+/*! \file MarkowitzGaussianEliminator.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A sparse LU-factorization with Markowitz ordering and threshold
+ ** pivoting, producing the same SparseLUFactors as the
+ ** SparseGaussianEliminator.
+ **
+ ** The rows and columns of the active submatrix are kept in buckets by
+ ** their number of non-zero elements, so that singleton rows and columns
+ ** are found in constant time. The triangular part of the basis (which,
+ ** for bases coming from networks, is most of it) is therefore peeled off
+ ** first, and the Markowitz search is only performed on the remaining
+ ** "bump", where it examines just the sparsest few columns. Eliminations
+ ** are performed on the sparse rows directly, so each costs time
+ ** proportional to the number of non-zeros involved, rather than to the
+ ** dimension of the matrix.
+
+ **/
+
+#ifndef __MarkowitzGaussianEliminator_h__
+#define __MarkowitzGaussianEliminator_h__
+
+#include "SparseColumnsOfBasis.h"
+#include "SparseLUFactors.h"
+#include "SparseUnsortedArray.h"
+#include "Statistics.h"
+
+#include <vector>
+
+#define MGAUSSIAN_LOG( x, ... )                                                                    \
+    LOG( GlobalConfiguration::GAUSSIAN_ELIMINATION_LOGGING, "MarkowitzGaussianEliminator: %s\n", x )
+
+class MarkowitzGaussianEliminator
+{
+public:
+    MarkowitzGaussianEliminator( unsigned m );
+    ~MarkowitzGaussianEliminator();
+
+    /*
+      Perform LU-factorization of a given matrix A, provided in
+      column-wise format. Store the results in the provided
+      SparseLUFactors.
+    */
+    void run( const SparseColumnsOfBasis *A, SparseLUFactors *sparseLUFactors );
+
+    /*
+      Have the eliminator start reporting statistics.
+    */
+    void setStatistics( Statistics *statistics );
+
+    /*
+      The number of elimination steps of the last factorization that
+      pivoted on a singleton row or column, i.e. were not part of the bump
+    */
+    unsigned getNumSingletonSteps() const;
+
+private:
+    /*
+      Rows or columns of the active submatrix, bucketed by their number of
+      non-zero elements. Each bucket is a doubly linked list.
+    */
+    class CountBuckets
+    {
+    public:
+        CountBuckets( unsigned m );
+        ~CountBuckets();
+
+        void clear();
+        void insert( unsigned index, unsigned count );
+        void remove( unsigned index, unsigned count );
+        void move( unsigned index, unsigned oldCount, unsigned newCount );
+
+        /*
+          The first element with the given count, or NONE
+        */
+        int first( unsigned count ) const;
+        int next( unsigned index ) const;
+
+        enum {
+            NONE = -1,
+        };
+
+    private:
+        unsigned _m;
+        int *_head;
+        int *_next;
+        int *_previous;
+    };
+
+    /*
+      The dimension of the (square) matrix being factorized
+    */
+    unsigned _m;
+
+    /*
+      The output factorization
+    */
+    SparseLUFactors *_sparseLUFactors;
+
+    /*
+      The number of non-zero elements of every row and column of the
+      active submatrix, their buckets, and whether they are still active
+    */
+    unsigned *_rowCounts;
+    unsigned *_columnCounts;
+    CountBuckets _rowBuckets;
+    CountBuckets _columnBuckets;
+    bool *_rowActive;
+    bool *_columnActive;
+
+    /*
+      For every column, the rows that have (or had) a non-zero element in
+      it. The patterns are not updated when elements are cancelled or rows
+      are pivoted; stale rows are dropped when a column is scanned.
+    */
+    std::vector<unsigned> *_columnPatterns;
+
+    /*
+      Work memory. The stamps mark the indices in use by the current
+      operation, so that they need not be cleared between operations.
+    */
+    double *_work;
+    unsigned *_stamps;
+    unsigned _currentStamp;
+    unsigned *_fillIndices;
+    SparseUnsortedArray::Entry *_rowBuffer;
+    unsigned *_candidateRows;
+    double *_candidateValues;
+
+    unsigned _numSingletonSteps;
+
+    /*
+      An object for reporting statistics
+    */
+    Statistics *_statistics;
+
+    void initializeFactorization( const SparseColumnsOfBasis *A, SparseLUFactors *sparseLUFactors );
+    void factorize();
+
+    /*
+      Choose the pivot of the next elimination step
+    */
+    void choosePivot( unsigned &vRow, unsigned &vColumn, double &pivotElement );
+    bool chooseMarkowitzPivot( unsigned &vRow, unsigned &vColumn, double &pivotElement );
+
+    /*
+      Collect the active non-zero elements of a column into
+      _candidateRows and _candidateValues, dropping stale rows from the
+      column's pattern. Returns the number of elements.
+    */
+    unsigned collectColumn( unsigned vColumn );
+
+    /*
+      Make V[vRow, vColumn] the pivot of the given elimination step, and
+      eliminate the rest of its column
+    */
+    void pivot( unsigned step, unsigned vRow, unsigned vColumn, double pivotElement );
+    void eliminateRow( unsigned vRow,
+                       unsigned vPivotRow,
+                       unsigned vPivotColumn,
+                       double rowMultiplier );
+
+    void setRowCount( unsigned vRow, unsigned count );
+    void decrementColumnCount( unsigned vColumn );
+    void incrementColumnCount( unsigned vColumn );
+
+    void nextStamp();
+    void freeMemoryIfNeeded();
+};
+
+#endif // __MarkowitzGaussianEliminator_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -41,6 +41,13 @@ SparseEtaMatrix::SparseEtaMatrix( unsigned m, unsigned index )
 {
 }
 
+void SparseEtaMatrix::reset( unsigned index )
+{
+    _columnIndex = index;
+    _sparseColumn.clear();
+    _diagonalElement = 0;
+}
+
 SparseEtaMatrix::SparseEtaMatrix( const SparseEtaMatrix &other )
     : _m( other._m )
     , _columnIndex( other._columnIndex )
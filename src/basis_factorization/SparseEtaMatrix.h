@@ -16,7 +16,7 @@
 #ifndef __SparseEtaMatrix_h__
 #define __SparseEtaMatrix_h__
 
-#include "List.h"
+#include "Vector.h"
 
 class SparseEtaMatrix
 {
@@ -28,6 +28,12 @@ public:
     */
     SparseEtaMatrix( unsigned m, unsigned index );
 
+    /*
+      Re-initializes the matrix to the identity matrix, keeping the
+      memory allocated for the entries
+    */
+    void reset( unsigned index );
+
     SparseEtaMatrix( const SparseEtaMatrix &other );
     SparseEtaMatrix &operator=( const SparseEtaMatrix &other );
 
@@ -55,7 +61,7 @@ public:
     unsigned _m;
     unsigned _columnIndex;
 
-    List<Entry> _sparseColumn;
+    Vector<Entry> _sparseColumn;
     double _diagonalElement;
 };
 
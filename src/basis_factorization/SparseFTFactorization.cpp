@@ -20,6 +20,7 @@
 #include "FloatUtils.h"
 #include "GlobalConfiguration.h"
 #include "MalformedBasisException.h"
+#include "Tracer.h"
 
 SparseFTFactorization::SparseFTFactorization( unsigned m,
                                               const BasisColumnOracle &basisColumnOracle )
@@ -64,6 +65,10 @@ void SparseFTFactorization::freeIfNeeded()
 {
     clearFactorization();
 
+    for ( const auto &eta : _etaPool )
+        delete eta;
+    _etaPool.clear();
+
     if ( _z1 )
     {
         delete[] _z1;
@@ -110,7 +115,7 @@ void SparseFTFactorization::updateToAdjacentBasis( unsigned columnIndex,
     // p = vRowDiagonalIndex
     // t = lastNonZeroEntryInU
 
-    if ( _etas.size() > GlobalConfiguration::REFACTORIZATION_THRESHOLD )
+    if ( refactorizationNeeded() )
     {
         obtainFreshBasis();
         return;
@@ -145,7 +150,16 @@ void SparseFTFactorization::updateToAdjacentBasis( unsigned columnIndex,
     unsigned lastNonZeroEntryInU = 0;
     DEBUG( bool foundNonZeroEntry = false );
 
-    _sparseLUFactors._Vt->clear( columnIndex );
+    // Only the rows of V with an old or a new element in this column change
+    SparseUnsortedArray *sparseColumn = _sparseLUFactors._Vt->getRow( columnIndex );
+    for ( unsigned i = 0; i < sparseColumn->getNnz(); ++i )
+    {
+        unsigned row = sparseColumn->getByArrayIndex( i )._index;
+        if ( FloatUtils::isZero( _z4[row] ) )
+            _sparseLUFactors._V->set( row, columnIndex, 0 );
+    }
+
+    sparseColumn->clear();
     for ( unsigned i = 0; i < _m; ++i )
     {
         if ( !FloatUtils::isZero( _z4[i] ) )
@@ -156,10 +170,9 @@ void SparseFTFactorization::updateToAdjacentBasis( unsigned columnIndex,
             if ( uRow > lastNonZeroEntryInU )
                 lastNonZeroEntryInU = uRow;
 
-            _sparseLUFactors._Vt->append( columnIndex, i, _z4[i] );
+            sparseColumn->append( i, _z4[i] );
+            _sparseLUFactors._V->set( i, columnIndex, _z4[i] );
         }
-
-        _sparseLUFactors._V->set( i, columnIndex, _z4[i] );
     }
 
     double pivotElement = _z4[vRowDiagonalIndex];
@@ -238,7 +251,16 @@ void SparseFTFactorization::updateToAdjacentBasis( unsigned columnIndex,
       Perform Gaussian Elimination on the spike row of U
     */
 
-    SparseEtaMatrix *sparseEtaMatrix = new SparseEtaMatrix( _m, vRowDiagonalIndex );
+    SparseEtaMatrix *sparseEtaMatrix;
+    if ( _etaPool.empty() )
+    {
+        sparseEtaMatrix = new SparseEtaMatrix( _m, vRowDiagonalIndex );
+    }
+    else
+    {
+        sparseEtaMatrix = _etaPool.pop();
+        sparseEtaMatrix->reset( vRowDiagonalIndex );
+    }
     // These eta matrices always have 1 as their pivot entry, but this is implicit.
 
     // Copy the spike row to work memory
@@ -304,9 +326,22 @@ void SparseFTFactorization::updateToAdjacentBasis( unsigned columnIndex,
 
       Finally, copy the (eliminated) spike row back into V and Vt
     */
+    // Only the columns of V with an old or a new element in this row change
+    sparseRow = _sparseLUFactors._V->getRow( vRowDiagonalIndex );
+    for ( unsigned i = 0; i < sparseRow->getNnz(); ++i )
+    {
+        unsigned column = sparseRow->getByArrayIndex( i )._index;
+        if ( FloatUtils::isZero( _z3[column] ) )
+            _sparseLUFactors._Vt->set( column, vRowDiagonalIndex, 0 );
+    }
+
     _sparseLUFactors._V->updateSingleRow( vRowDiagonalIndex, _z3 );
-    for ( unsigned i = 0; i < _m; ++i )
-        _sparseLUFactors._Vt->set( i, vRowDiagonalIndex, _z3[i] );
+    sparseRow = _sparseLUFactors._V->getRow( vRowDiagonalIndex );
+    for ( unsigned i = 0; i < sparseRow->getNnz(); ++i )
+    {
+        entry = sparseRow->getByArrayIndex( i );
+        _sparseLUFactors._Vt->set( entry._index, vRowDiagonalIndex, entry._value );
+    }
 
     _sparseLUFactors._vDiagonalElements[vRowDiagonalIndex] = _z3[columnIndex];
 }
@@ -349,9 +384,8 @@ void SparseFTFactorization::backwardTransformation( const double *y, double *x )
 
 void SparseFTFactorization::clearFactorization()
 {
-    List<SparseEtaMatrix *>::iterator it;
-    for ( it = _etas.begin(); it != _etas.end(); ++it )
-        delete *it;
+    for ( const auto &eta : _etas )
+        _etaPool.append( eta );
 
     _etas.clear();
 }
@@ -376,6 +410,11 @@ void SparseFTFactorization::factorizeBasis()
         _statistics->incLongAttribute( Statistics::NUM_BASIS_REFACTORIZATIONS );
 }
 
+bool SparseFTFactorization::refactorizationNeeded() const
+{
+    return _etas.size() > GlobalConfiguration::REFACTORIZATION_THRESHOLD;
+}
+
 void SparseFTFactorization::storeFactorization( IBasisFactorization *other )
 {
     SparseFTFactorization *otherSparseFTFactorization = (SparseFTFactorization *)other;
@@ -434,6 +473,8 @@ void SparseFTFactorization::dump() const
 
 void SparseFTFactorization::obtainFreshBasis()
 {
+    TraceSpan span( "SparseFTFactorization::obtainFreshBasis" );
+
     _basisColumnOracle->getSparseBasis( _B );
     factorizeBasis();
 }
@@ -106,7 +106,7 @@ public:
     void dump() const;
     void dumpExplicitBasis() const;
 
-private:
+protected:
     /*
       The Basis matrix.
     */
@@ -115,7 +115,14 @@ private:
     /*
       The extra ForrstTomlin factorization eta matrices
     */
-    List<SparseEtaMatrix *> _etas;
+    Vector<SparseEtaMatrix *> _etas;
+
+    /*
+      Eta matrices that are no longer in use. Their memory is reused for
+      the next updates, rather than freed and allocated again after every
+      refactorization.
+    */
+    Vector<SparseEtaMatrix *> _etaPool;
 
     /*
       The dimension of the basis matrix.
@@ -159,7 +166,14 @@ private:
     /*
       Factorize the stored _B matrix into LU form.
     */
-    void factorizeBasis();
+    virtual void factorizeBasis();
+
+    /*
+      Whether the accumulated updates call for a fresh factorization
+      before the next one is applied. By default, after
+      REFACTORIZATION_THRESHOLD updates.
+    */
+    virtual bool refactorizationNeeded() const;
 
     /*
       Compute the inverse of B0, using the LP factorization already stored.
@@ -180,7 +194,7 @@ private:
     /*
       Have the Basis Factoriaztion object start reporting statistics.
     */
-    void setStatistics( Statistics *statistics );
+    virtual void setStatistics( Statistics *statistics );
 };
 
 #endif // __SparseFTFactorization_h__
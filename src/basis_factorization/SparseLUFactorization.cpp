@@ -22,6 +22,7 @@
 #include "GlobalConfiguration.h"
 #include "LPElement.h"
 #include "MalformedBasisException.h"
+#include "Tracer.h"
 
 SparseLUFactorization::SparseLUFactorization( unsigned m,
                                               const BasisColumnOracle &basisColumnOracle )
@@ -246,6 +247,8 @@ void SparseLUFactorization::dump() const
 
 void SparseLUFactorization::obtainFreshBasis()
 {
+    TraceSpan span( "SparseLUFactorization::obtainFreshBasis" );
+
     _basisColumnOracle->getSparseBasis( _B );
     factorizeBasis();
 }
@@ -61,12 +61,14 @@ void SparseUnsortedArray::freeMemoryIfNeeded()
 
 void SparseUnsortedArray::initialize( const double *V, unsigned size )
 {
-    freeMemoryIfNeeded();
+    // Existing memory is reused
+    if ( !_array )
+    {
+        _array = new Entry[CHUNK_SIZE];
+        _allocatedSize = CHUNK_SIZE;
+    }
 
     _maxSize = size;
-
-    _array = new Entry[CHUNK_SIZE];
-    _allocatedSize = CHUNK_SIZE;
     _nnz = 0;
 
     for ( unsigned i = 0; i < _maxSize; ++i )
@@ -85,12 +87,16 @@ void SparseUnsortedArray::initialize( const double *V, unsigned size )
 
 void SparseUnsortedArray::initializeFromList( const SparseUnsortedList *list )
 {
-    freeMemoryIfNeeded();
-
     _maxSize = list->getSize();
 
-    _allocatedSize = list->getNnz();
-    _array = new Entry[_allocatedSize];
+    // Existing memory is reused, if large enough
+    if ( !_array || ( _allocatedSize < list->getNnz() ) )
+    {
+        freeMemoryIfNeeded();
+        _allocatedSize = list->getNnz();
+        _array = new Entry[_allocatedSize];
+    }
+
     _nnz = 0;
 
     for ( auto it = list->begin(); it != list->end(); ++it )
@@ -100,6 +106,12 @@ void SparseUnsortedArray::initializeFromList( const SparseUnsortedList *list )
     }
 }
 
+void SparseUnsortedArray::initializeToEmpty( unsigned size )
+{
+    _maxSize = size;
+    _nnz = 0;
+}
+
 void SparseUnsortedArray::clear()
 {
     _nnz = 0;
@@ -167,14 +179,20 @@ void SparseUnsortedArray::toDense( double *result ) const
 
 SparseUnsortedArray &SparseUnsortedArray::operator=( const SparseUnsortedArray &other )
 {
-    freeMemoryIfNeeded();
+    if ( this == &other )
+        return *this;
+
+    // Existing memory is reused, if large enough
+    if ( !_array || ( _allocatedSize < other._nnz ) )
+    {
+        freeMemoryIfNeeded();
+        _allocatedSize = other._allocatedSize;
+        _array = new Entry[_allocatedSize];
+    }
 
     _maxSize = other._maxSize;
-    _allocatedSize = other._allocatedSize;
     _nnz = other._nnz;
 
-    _array = new Entry[_allocatedSize];
-
     memcpy( _array, other._array, sizeof( Entry ) * _nnz );
 
     return *this;
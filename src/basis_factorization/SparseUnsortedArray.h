@@ -50,7 +50,7 @@ public:
     SparseUnsortedArray( unsigned size );
     SparseUnsortedArray( const double *V, unsigned size );
     void initialize( const double *V, unsigned size );
-    void initializeToEmpty();
+    void initializeToEmpty( unsigned size );
     void initializeFromList( const SparseUnsortedList *list );
 
     /*
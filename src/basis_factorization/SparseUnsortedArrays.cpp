@@ -51,12 +51,17 @@ void SparseUnsortedArrays::freeMemoryIfNeeded()
     }
 }
 
-void SparseUnsortedArrays::initialize( const double *M, unsigned m, unsigned n )
+void SparseUnsortedArrays::allocateRows( unsigned m, unsigned n )
 {
+    _n = n;
+
+    // Rows that already exist keep their memory, which is reused
+    if ( _rows && ( _m == m ) )
+        return;
+
     freeMemoryIfNeeded();
 
     _m = m;
-    _n = n;
 
     _rows = new SparseUnsortedArray *[_m];
     if ( !_rows )
@@ -69,76 +74,39 @@ void SparseUnsortedArrays::initialize( const double *M, unsigned m, unsigned n )
         if ( !_rows[i] )
             throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
                                            "SparseUnsortedArrays::rows[i]" );
-
-        _rows[i]->initialize( M + ( i * n ), n );
     }
 }
 
-void SparseUnsortedArrays::initialize( const SparseUnsortedArray **V, unsigned m, unsigned n )
+void SparseUnsortedArrays::initialize( const double *M, unsigned m, unsigned n )
 {
-    freeMemoryIfNeeded();
+    allocateRows( m, n );
 
-    _m = m;
-    _n = n;
+    for ( unsigned i = 0; i < _m; ++i )
+        _rows[i]->initialize( M + ( i * n ), n );
+}
 
-    _rows = new SparseUnsortedArray *[_m];
-    if ( !_rows )
-        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseUnsortedArrays::rows" );
+void SparseUnsortedArrays::initialize( const SparseUnsortedArray **V, unsigned m, unsigned n )
+{
+    allocateRows( m, n );
 
     for ( unsigned i = 0; i < _m; ++i )
-    {
-        _rows[i] = new SparseUnsortedArray;
-        if ( !_rows[i] )
-            throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                           "SparseUnsortedArrays::rows[i]" );
-
         V[i]->storeIntoOther( _rows[i] );
-    }
 }
 
 void SparseUnsortedArrays::initialize( const SparseUnsortedList **V, unsigned m, unsigned n )
 {
-    freeMemoryIfNeeded();
-
-    _m = m;
-    _n = n;
-
-    _rows = new SparseUnsortedArray *[_m];
-    if ( !_rows )
-        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseUnsortedLists::rows" );
+    allocateRows( m, n );
 
     for ( unsigned i = 0; i < _m; ++i )
-    {
-        _rows[i] = new SparseUnsortedArray;
-        if ( !_rows[i] )
-            throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                           "SparseUnsortedLists::rows[i]" );
-
         _rows[i]->initializeFromList( V[i] );
-    }
 }
 
 void SparseUnsortedArrays::initializeToEmpty( unsigned m, unsigned n )
 {
-    freeMemoryIfNeeded();
-
-    _m = m;
-    _n = n;
-
-    _rows = new SparseUnsortedArray *[_m];
-    if ( !_rows )
-        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseUnsortedArrays::rows" );
+    allocateRows( m, n );
 
     for ( unsigned i = 0; i < _m; ++i )
-    {
-        _rows[i] = new SparseUnsortedArray( _n );
-        if ( !_rows[i] )
-            throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                           "SparseUnsortedArrays::rows[i]" );
-    }
+        _rows[i]->initializeToEmpty( _n );
 }
 
 void SparseUnsortedArrays::updateSingleRow( unsigned row, const double *dense )
@@ -278,25 +246,10 @@ void SparseUnsortedArrays::dumpDense() const
 
 void SparseUnsortedArrays::storeIntoOther( SparseUnsortedArrays *other ) const
 {
-    other->freeMemoryIfNeeded();
-
-    other->_m = _m;
-    other->_n = _n;
-
-    other->_rows = new SparseUnsortedArray *[_m];
-    if ( !other->_rows )
-        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseUnsortedArrays::otherRows" );
+    other->allocateRows( _m, _n );
 
     for ( unsigned i = 0; i < _m; ++i )
-    {
-        other->_rows[i] = new SparseUnsortedArray;
-        if ( !other->_rows[i] )
-            throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                           "SparseUnsortedArrays::otherRows[i]" );
-
         _rows[i]->storeIntoOther( other->_rows[i] );
-    }
 }
 
 unsigned SparseUnsortedArrays::getNnz() const
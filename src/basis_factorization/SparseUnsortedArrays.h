@@ -118,6 +118,12 @@ private:
     unsigned _n;
 
     void freeMemoryIfNeeded();
+
+    /*
+      Allocate m (empty) rows of size n. If there already are m rows,
+      they are kept, so that their memory is reused.
+    */
+    void allocateRows( unsigned m, unsigned n );
 };
 
 #endif // __SparseUnsortedArrays_h__
@@ -16,6 +16,7 @@
 #include "FloatUtils.h"
 #include "ForrestTomlinFactorization.h"
 #include "LUFactorization.h"
+#include "MarkowitzFTFactorization.h"
 #include "MockColumnOracle.h"
 #include "MockErrno.h"
 #include "SparseFTFactorization.h"
@@ -51,11 +52,13 @@ public:
         ForrestTomlinFactorization *ft = NULL;
         LUFactorization *lu = NULL;
         SparseFTFactorization *sft = NULL;
+        MarkowitzFTFactorization *mft = NULL;
         SparseLUFactorization *slu = NULL;
 
         TS_ASSERT( ft = new ForrestTomlinFactorization( 4, *oracle ) );
         TS_ASSERT( lu = new LUFactorization( 4, *oracle ) );
         TS_ASSERT( sft = new SparseFTFactorization( 4, *oracle ) );
+        TS_ASSERT( mft = new MarkowitzFTFactorization( 4, *oracle ) );
         TS_ASSERT( slu = new SparseLUFactorization( 4, *oracle ) );
 
         double B[] = {
@@ -69,6 +72,7 @@ public:
         ft->obtainFreshBasis();
         lu->obtainFreshBasis();
         sft->obtainFreshBasis();
+        mft->obtainFreshBasis();
         slu->obtainFreshBasis();
 
         double y[4] = { 9, 15, 10, -12 };
@@ -76,10 +80,12 @@ public:
         double x2[4];
         double x3[4];
         double x4[4];
+        double x5[4];
 
         TS_ASSERT_THROWS_NOTHING( ft->forwardTransformation( y, x1 ) );
         TS_ASSERT_THROWS_NOTHING( lu->forwardTransformation( y, x2 ) );
         TS_ASSERT_THROWS_NOTHING( sft->forwardTransformation( y, x3 ) );
+        TS_ASSERT_THROWS_NOTHING( mft->forwardTransformation( y, x5 ) );
         TS_ASSERT_THROWS_NOTHING( slu->forwardTransformation( y, x4 ) );
 
         for ( unsigned i = 0; i < 4; ++i )
@@ -87,6 +93,7 @@ public:
             TS_ASSERT( FloatUtils::areEqual( x1[i], x2[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x3[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x4[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( x1[i], x5[i] ) );
         }
 
         double d1[] = { -4, 2, 0, 3 };
@@ -96,6 +103,7 @@ public:
         lu->updateToAdjacentBasis( 1, d1, a1 );
         slu->updateToAdjacentBasis( 1, d1, a1 );
         sft->updateToAdjacentBasis( 1, d1, a1 );
+        mft->updateToAdjacentBasis( 1, d1, a1 );
 
         /*
             Explicit basis should be:
@@ -109,6 +117,7 @@ public:
         TS_ASSERT_THROWS_NOTHING( ft->forwardTransformation( y, x1 ) );
         TS_ASSERT_THROWS_NOTHING( lu->forwardTransformation( y, x2 ) );
         TS_ASSERT_THROWS_NOTHING( sft->forwardTransformation( y, x3 ) );
+        TS_ASSERT_THROWS_NOTHING( mft->forwardTransformation( y, x5 ) );
         TS_ASSERT_THROWS_NOTHING( slu->forwardTransformation( y, x4 ) );
 
         for ( unsigned i = 0; i < 4; ++i )
@@ -116,6 +125,7 @@ public:
             TS_ASSERT( FloatUtils::areEqual( x1[i], x2[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x3[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x4[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( x1[i], x5[i] ) );
         }
 
         double d2[] = { 3.2, -2, 10, 3 };
@@ -124,6 +134,7 @@ public:
         ft->updateToAdjacentBasis( 2, d2, a2 );
         lu->updateToAdjacentBasis( 2, d2, a2 );
         sft->updateToAdjacentBasis( 2, d2, a2 );
+        mft->updateToAdjacentBasis( 2, d2, a2 );
         slu->updateToAdjacentBasis( 2, d2, a2 );
 
         /*
@@ -138,6 +149,7 @@ public:
         TS_ASSERT_THROWS_NOTHING( ft->forwardTransformation( y, x1 ) );
         TS_ASSERT_THROWS_NOTHING( lu->forwardTransformation( y, x2 ) );
         TS_ASSERT_THROWS_NOTHING( sft->forwardTransformation( y, x3 ) );
+        TS_ASSERT_THROWS_NOTHING( mft->forwardTransformation( y, x5 ) );
         TS_ASSERT_THROWS_NOTHING( slu->forwardTransformation( y, x4 ) );
 
         for ( unsigned i = 0; i < 4; ++i )
@@ -145,6 +157,7 @@ public:
             TS_ASSERT( FloatUtils::areEqual( x1[i], x2[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x3[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x4[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( x1[i], x5[i] ) );
         }
 
         double basisAtThisPoint[] = {
@@ -159,11 +172,13 @@ public:
         ft->makeExplicitBasisAvailable();
         lu->makeExplicitBasisAvailable();
         sft->makeExplicitBasisAvailable();
+        mft->makeExplicitBasisAvailable();
         slu->makeExplicitBasisAvailable();
 
         TS_ASSERT_THROWS_NOTHING( ft->forwardTransformation( y, x1 ) );
         TS_ASSERT_THROWS_NOTHING( lu->forwardTransformation( y, x2 ) );
         TS_ASSERT_THROWS_NOTHING( sft->forwardTransformation( y, x3 ) );
+        TS_ASSERT_THROWS_NOTHING( mft->forwardTransformation( y, x5 ) );
         TS_ASSERT_THROWS_NOTHING( slu->forwardTransformation( y, x4 ) );
 
         for ( unsigned i = 0; i < 4; ++i )
@@ -171,6 +186,7 @@ public:
             TS_ASSERT( FloatUtils::areEqual( x1[i], x2[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x3[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x4[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( x1[i], x5[i] ) );
         }
 
         lu->makeExplicitBasisAvailable();
@@ -178,6 +194,7 @@ public:
         TS_ASSERT_THROWS_NOTHING( ft->forwardTransformation( y, x1 ) );
         TS_ASSERT_THROWS_NOTHING( lu->forwardTransformation( y, x2 ) );
         TS_ASSERT_THROWS_NOTHING( sft->forwardTransformation( y, x3 ) );
+        TS_ASSERT_THROWS_NOTHING( mft->forwardTransformation( y, x5 ) );
         TS_ASSERT_THROWS_NOTHING( slu->forwardTransformation( y, x4 ) );
 
         for ( unsigned i = 0; i < 4; ++i )
@@ -185,12 +202,114 @@ public:
             TS_ASSERT( FloatUtils::areEqual( x1[i], x2[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x3[i] ) );
             TS_ASSERT( FloatUtils::areEqual( x1[i], x4[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( x1[i], x5[i] ) );
         }
 
         TS_ASSERT_THROWS_NOTHING( delete lu );
         TS_ASSERT_THROWS_NOTHING( delete ft );
         TS_ASSERT_THROWS_NOTHING( delete slu );
         TS_ASSERT_THROWS_NOTHING( delete sft );
+        TS_ASSERT_THROWS_NOTHING( delete mft );
+    }
+
+    void test_compare_sparse_ft_and_markowitz_ft_on_long_update_sequence()
+    {
+        srand( 7 );
+
+        const unsigned m = 30;
+        double B[m * m];
+
+        // A sparse, column diagonally dominant basis
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            for ( unsigned j = 0; j < m; ++j )
+            {
+                if ( i == j )
+                    B[i * m + j] = 10 + rand() % 10;
+                else if ( rand() % 8 == 0 )
+                    B[i * m + j] = ( rand() % 200 - 100 ) / 100.0;
+                else
+                    B[i * m + j] = 0;
+            }
+        }
+
+        oracle->storeBasis( m, B );
+
+        SparseFTFactorization *sft = NULL;
+        MarkowitzFTFactorization *mft = NULL;
+
+        TS_ASSERT( sft = new SparseFTFactorization( m, *oracle ) );
+        TS_ASSERT( mft = new MarkowitzFTFactorization( m, *oracle ) );
+
+        sft->obtainFreshBasis();
+        mft->obtainFreshBasis();
+
+        double a[m];
+        double d[m];
+        double y[m];
+        double x1[m];
+        double x2[m];
+
+        // More updates than REFACTORIZATION_THRESHOLD, so that both
+        // factorizations refactorize along the way
+        for ( unsigned iteration = 0; iteration < 150; ++iteration )
+        {
+            unsigned column = rand() % m;
+
+            for ( unsigned i = 0; i < m; ++i )
+            {
+                if ( i == column )
+                    a[i] = 10 + rand() % 10;
+                else if ( rand() % 6 == 0 )
+                    a[i] = ( rand() % 200 - 100 ) / 100.0;
+                else
+                    a[i] = 0;
+            }
+
+            TS_ASSERT_THROWS_NOTHING( sft->forwardTransformation( a, d ) );
+
+            // As in the tableau, the oracle already reflects the new basis
+            for ( unsigned i = 0; i < m; ++i )
+                B[i * m + column] = a[i];
+            oracle->storeBasis( m, B );
+
+            TS_ASSERT_THROWS_NOTHING( mft->updateToAdjacentBasis( column, d, a ) );
+            TS_ASSERT_THROWS_NOTHING( sft->updateToAdjacentBasis( column, d, a ) );
+
+            for ( unsigned i = 0; i < m; ++i )
+                y[i] = ( rand() % 200 - 100 ) / 10.0;
+
+            // Forward transformation: B * x = y
+            TS_ASSERT_THROWS_NOTHING( sft->forwardTransformation( y, x1 ) );
+            TS_ASSERT_THROWS_NOTHING( mft->forwardTransformation( y, x2 ) );
+
+            for ( unsigned i = 0; i < m; ++i )
+            {
+                double product = 0;
+                for ( unsigned j = 0; j < m; ++j )
+                    product += B[i * m + j] * x2[j];
+
+                TS_ASSERT( FloatUtils::areEqual( product, y[i], 1e-6 ) );
+                TS_ASSERT( FloatUtils::areEqual( x1[i], x2[i], 1e-6 ) );
+            }
+
+            // Backward transformation: x * B = y
+            TS_ASSERT_THROWS_NOTHING( sft->backwardTransformation( y, x1 ) );
+            TS_ASSERT_THROWS_NOTHING( mft->backwardTransformation( y, x2 ) );
+
+            for ( unsigned j = 0; j < m; ++j )
+            {
+                double product = 0;
+                for ( unsigned i = 0; i < m; ++i )
+                    product += x2[i] * B[i * m + j];
+
+                TS_ASSERT( FloatUtils::areEqual( product, y[j], 1e-6 ) );
+                TS_ASSERT( FloatUtils::areEqual( x1[j], x2[j], 1e-6 ) );
+            }
+        }
+
+        TS_ASSERT_THROWS_NOTHING( delete mft );
+        TS_ASSERT_THROWS_NOTHING( delete sft );
     }
 };
 
@@ -0,0 +1,270 @@
+/*********************                                                        */
+/*! \file Test_MarkowitzGaussianEliminator.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "BasisFactorizationError.h"
+#include "FloatUtils.h"
+#include "MarkowitzGaussianEliminator.h"
+
+#include <cstdlib>
+#include <cxxtest/TestSuite.h>
+
+class MarkowitzGaussianEliminatorTestSuite : public CxxTest::TestSuite
+{
+public:
+    List<SparseUnsortedList *> cleanup;
+
+    ~MarkowitzGaussianEliminatorTestSuite()
+    {
+        for ( const auto vector : cleanup )
+            delete vector;
+    }
+
+    void basisIntoSparseColumns( const double *B, unsigned m, SparseColumnsOfBasis &sparse )
+    {
+        double *denseColumn = new double[m];
+
+        for ( unsigned col = 0; col < m; ++col )
+        {
+            for ( unsigned row = 0; row < m; ++row )
+                denseColumn[row] = B[row * m + col];
+
+            SparseUnsortedList *list = new SparseUnsortedList( denseColumn, m );
+            sparse._columns[col] = list;
+            cleanup.append( list );
+        }
+
+        delete[] denseColumn;
+    }
+
+    /*
+      Check that A = FV, that the transposed factors match, and that
+      U = P'VQ' is upper triangular with the stored diagonal
+    */
+    void checkFactorization( const double *A, unsigned m, SparseLUFactors &lu )
+    {
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            for ( unsigned j = 0; j < m; ++j )
+            {
+                double product = 0;
+                for ( unsigned k = 0; k < m; ++k )
+                {
+                    double fValue = ( i == k ) ? 1.0 : lu._F->get( i, k );
+                    product += fValue * lu._V->get( k, j );
+                }
+                // Eliminated elements below the zero tolerance are dropped
+                TS_ASSERT( FloatUtils::areEqual( A[i * m + j], product, 1e-8 ) );
+
+                TS_ASSERT_EQUALS( lu._V->get( i, j ), lu._Vt->get( j, i ) );
+                TS_ASSERT_EQUALS( lu._F->get( i, j ), lu._Ft->get( j, i ) );
+            }
+        }
+
+        for ( unsigned uRow = 0; uRow < m; ++uRow )
+        {
+            unsigned vRow = lu._P._columnOrdering[uRow];
+            TS_ASSERT_EQUALS( lu._P._rowOrdering[vRow], uRow );
+
+            for ( unsigned uColumn = 0; uColumn < m; ++uColumn )
+            {
+                unsigned vColumn = lu._Q._rowOrdering[uColumn];
+                TS_ASSERT_EQUALS( lu._Q._columnOrdering[vColumn], uColumn );
+
+                double value = lu._V->get( vRow, vColumn );
+                if ( uColumn < uRow )
+                    TS_ASSERT_EQUALS( value, 0 );
+                if ( uColumn == uRow )
+                    TS_ASSERT_EQUALS( value, lu._vDiagonalElements[vRow] );
+            }
+        }
+    }
+
+    void test_sanity()
+    {
+        SparseLUFactors lu3( 3 );
+        SparseLUFactors lu4( 4 );
+        MarkowitzGaussianEliminator ge3( 3 );
+        MarkowitzGaussianEliminator ge4( 4 );
+
+        {
+            double A[] = {
+                2, 3, 0, //
+                0, 1, 2, //
+                0, 4, 1  //
+            };
+
+            SparseColumnsOfBasis sparseCols( 3 );
+            basisIntoSparseColumns( A, 3, sparseCols );
+
+            TS_ASSERT_THROWS_NOTHING( ge3.run( &sparseCols, &lu3 ) );
+            checkFactorization( A, 3, lu3 );
+        }
+
+        {
+            double A[] = {
+                2,  3, -4, //
+                -5, 1, 2,  //
+                0,  4, 1   //
+            };
+
+            SparseColumnsOfBasis sparseCols( 3 );
+            basisIntoSparseColumns( A, 3, sparseCols );
+
+            TS_ASSERT_THROWS_NOTHING( ge3.run( &sparseCols, &lu3 ) );
+            checkFactorization( A, 3, lu3 );
+        }
+
+        {
+            double A[] = {
+                2,  3, -4, 0,  //
+                -5, 1, 2,  2,  //
+                0,  4, 1,  -5, //
+                1,  2, 3,  4,  //
+            };
+
+            SparseColumnsOfBasis sparseCols( 4 );
+            basisIntoSparseColumns( A, 4, sparseCols );
+
+            TS_ASSERT_THROWS_NOTHING( ge4.run( &sparseCols, &lu4 ) );
+            checkFactorization( A, 4, lu4 );
+
+            // In a dense matrix, only the last (1x1) step is a singleton
+            TS_ASSERT_EQUALS( ge4.getNumSingletonSteps(), 1U );
+        }
+    }
+
+    void test_singular_matrices()
+    {
+        SparseLUFactors lu3( 3 );
+        MarkowitzGaussianEliminator ge( 3 );
+
+        {
+            double A[] = {
+                2, 3, 0, //
+                0, 1, 0, //
+                5, 4, 0  //
+            };
+
+            SparseColumnsOfBasis sparseCols( 3 );
+            basisIntoSparseColumns( A, 3, sparseCols );
+
+            TS_ASSERT_THROWS_EQUALS( ge.run( &sparseCols, &lu3 ),
+                                     const BasisFactorizationError &e,
+                                     e.getCode(),
+                                     BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED );
+        }
+
+        {
+            double A[] = {
+                2, 3, 7, //
+                0, 0, 0, //
+                5, 4, 0  //
+            };
+
+            SparseColumnsOfBasis sparseCols( 3 );
+            basisIntoSparseColumns( A, 3, sparseCols );
+
+            TS_ASSERT_THROWS_EQUALS( ge.run( &sparseCols, &lu3 ),
+                                     const BasisFactorizationError &e,
+                                     e.getCode(),
+                                     BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED );
+        }
+
+        {
+            // Rank 2, with no zero row or column
+            double A[] = {
+                1, 2, 3, //
+                2, 4, 6, //
+                1, 0, 1  //
+            };
+
+            SparseColumnsOfBasis sparseCols( 3 );
+            basisIntoSparseColumns( A, 3, sparseCols );
+
+            TS_ASSERT_THROWS_EQUALS( ge.run( &sparseCols, &lu3 ),
+                                     const BasisFactorizationError &e,
+                                     e.getCode(),
+                                     BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED );
+        }
+    }
+
+    void test_triangular_part_is_peeled_off()
+    {
+        /*
+          A permuted triangular matrix, like the bases of networks, whose
+          rows and columns all become singletons in turn
+        */
+        double A[] = {
+            0, 3, 0, 0, 1, //
+            0, 0, 0, 2, 0, //
+            4, 1, 0, 5, 0, //
+            0, 0, 0, 1, 7, //
+            1, 0, 6, 1, 0, //
+        };
+
+        SparseLUFactors lu( 5 );
+        MarkowitzGaussianEliminator ge( 5 );
+        SparseColumnsOfBasis sparseCols( 5 );
+        basisIntoSparseColumns( A, 5, sparseCols );
+
+        TS_ASSERT_THROWS_NOTHING( ge.run( &sparseCols, &lu ) );
+        checkFactorization( A, 5, lu );
+        TS_ASSERT_EQUALS( ge.getNumSingletonSteps(), 5U );
+
+        // Triangular matrices need no eliminations beyond row singletons, so no fill
+        TS_ASSERT( lu._V->getNnz() + lu._F->getNnz() <= 12U );
+    }
+
+    void test_random_sparse_matrices()
+    {
+        srand( 1 );
+
+        const unsigned m = 30;
+        double A[m * m];
+        SparseLUFactors lu( m );
+        MarkowitzGaussianEliminator ge( m );
+
+        for ( unsigned iteration = 0; iteration < 20; ++iteration )
+        {
+            // Sparse, with a diagonal that keeps the matrix non-singular
+            for ( unsigned i = 0; i < m; ++i )
+            {
+                for ( unsigned j = 0; j < m; ++j )
+                {
+                    if ( i == j )
+                        A[i * m + j] = 10 + rand() % 10;
+                    else if ( rand() % 10 == 0 )
+                        A[i * m + j] = ( rand() % 200 - 100 ) / 100.0;
+                    else
+                        A[i * m + j] = 0;
+                }
+            }
+
+            SparseColumnsOfBasis sparseCols( m );
+            basisIntoSparseColumns( A, m, sparseCols );
+
+            TS_ASSERT_THROWS_NOTHING( ge.run( &sparseCols, &lu ) );
+            checkFactorization( A, m, lu );
+        }
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
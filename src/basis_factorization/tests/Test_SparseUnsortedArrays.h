@@ -101,6 +101,52 @@ public:
                 TS_ASSERT_EQUALS( sv1.get( i, j ), sv3.get( i, j ) );
     }
 
+    void test_reinitialize()
+    {
+        // Rows are reused when re-initializing with the same dimensions
+        double M1[] = {
+            1, 2, 3, 4, //
+            5, 8, 5, 6, //
+            1, 2, 3, 4, //
+        };
+
+        double M2[] = {
+            0, 0, 0, 7, //
+            0, 0, 0, 0, //
+            9, 0, 0, 0, //
+        };
+
+        SparseUnsortedArrays sv1;
+        sv1.initialize( M1, 3, 4 );
+        sv1.initialize( M2, 3, 4 );
+
+        TS_ASSERT_EQUALS( sv1.getNnz(), 2U );
+        for ( unsigned i = 0; i < 3; ++i )
+            for ( unsigned j = 0; j < 4; ++j )
+                TS_ASSERT_EQUALS( sv1.get( i, j ), M2[i * 4 + j] );
+
+        SparseUnsortedArrays sv2;
+        sv2.initialize( M1, 3, 4 );
+        sv1.storeIntoOther( &sv2 );
+
+        for ( unsigned i = 0; i < 3; ++i )
+            for ( unsigned j = 0; j < 4; ++j )
+                TS_ASSERT_EQUALS( sv2.get( i, j ), M2[i * 4 + j] );
+
+        sv2.initializeToEmpty( 3, 4 );
+        TS_ASSERT_EQUALS( sv2.getNnz(), 0U );
+        for ( unsigned i = 0; i < 3; ++i )
+            for ( unsigned j = 0; j < 4; ++j )
+                TS_ASSERT_EQUALS( sv2.get( i, j ), 0.0 );
+
+        // Different dimensions
+        sv2.initialize( M1, 2, 4 );
+        TS_ASSERT_EQUALS( sv2.getNnz(), 8U );
+        for ( unsigned i = 0; i < 2; ++i )
+            for ( unsigned j = 0; j < 4; ++j )
+                TS_ASSERT_EQUALS( sv2.get( i, j ), M1[i * 4 + j] );
+    }
+
     void test_add_last_row()
     {
         double M1[] = {
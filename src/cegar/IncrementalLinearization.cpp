@@ -58,21 +58,39 @@ void IncrementalLinearization::solve()
         // Refine the non-linear constraints using the counter-example stored
         // in the _inputQuery
         Query refinement;
-        refinement.setNumberOfVariables( _inputQuery.getNumberOfVariables() );
+        unsigned firstNewVariable = _inputQuery.getNumberOfVariables();
+        refinement.setNumberOfVariables( firstNewVariable );
         _engine->extractSolution( refinement );
         _engine->extractBounds( refinement );
-        unsigned numRefined = refine( refinement );
+        unsigned numRefined = computeRefinement( refinement );
+
+        // Add the refinement to the current engine, if possible, before its
+        // ownership is transferred to the _inputQuery
+        bool refinedInPlace =
+            numRefined > 0 && _engine->addRefinement( refinement, firstNewVariable );
+        addRefinementToInputQuery( refinement );
 
         printStatus();
         if ( numRefined == 0 )
             return;
 
-        // Create a new engine
-        _engine = std::unique_ptr<Engine>( new Engine() );
-        _engine->setVerbosity( 0 );
+        bool readyToSolve = false;
+        if ( refinedInPlace )
+        {
+            INCREMENTAL_LINEARIZATION_LOG( "Refined the engine in place" );
+            _engine->setVerbosity( 0 );
+            readyToSolve = ( _engine->getExitCode() == IEngine::NOT_DONE );
+        }
+        else
+        {
+            // Create a new engine
+            _engine = std::unique_ptr<Engine>( new Engine() );
+            _engine->setVerbosity( 0 );
+            readyToSolve = _engine->processInputQuery( _inputQuery );
+        }
 
         // Solve the refined abstraction
-        if ( _engine->processInputQuery( _inputQuery ) )
+        if ( readyToSolve )
         {
             double timeoutInSeconds =
                 static_cast<long double>( _timeoutInMicroSeconds ) / MICROSECONDS_TO_SECONDS;
@@ -102,6 +120,13 @@ void IncrementalLinearization::solve()
 }
 
 unsigned IncrementalLinearization::refine( Query &refinement )
+{
+    unsigned numRefined = computeRefinement( refinement );
+    addRefinementToInputQuery( refinement );
+    return numRefined;
+}
+
+unsigned IncrementalLinearization::computeRefinement( Query &refinement )
 {
     INCREMENTAL_LINEARIZATION_LOG( "Performing abstraction refinement..." );
 
@@ -112,6 +137,14 @@ unsigned IncrementalLinearization::refine( Query &refinement )
         if ( numRefined >= _numConstraintsToRefine )
             break;
     }
+
+    INCREMENTAL_LINEARIZATION_LOG(
+        Stringf( "Refined %u non-linear constraints", numRefined ).ascii() );
+    return numRefined;
+}
+
+void IncrementalLinearization::addRefinementToInputQuery( Query &refinement )
+{
     _inputQuery.setNumberOfVariables( refinement.getNumberOfVariables() );
     for ( const auto &e : refinement.getEquations() )
         _inputQuery.addEquation( e );
@@ -124,10 +157,6 @@ unsigned IncrementalLinearization::refine( Query &refinement )
     _numAdditionalPLConstraints += refinement.getPiecewiseLinearConstraints().size();
     // Ownership of the additional constraints are transferred.
     refinement.getPiecewiseLinearConstraints().clear();
-
-    INCREMENTAL_LINEARIZATION_LOG(
-        Stringf( "Refined %u non-linear constraints", numRefined ).ascii() );
-    return numRefined;
 }
 
 void IncrementalLinearization::printStatus()
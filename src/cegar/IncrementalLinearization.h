@@ -77,6 +77,14 @@ private:
     unsigned _numConstraintsToRefine;
     double _refinementScalingFactor;
 
+    /*
+      Refine the non-linear constraints, adding the new equations and
+      piecewise-linear constraints to the given query, and move them
+      from the given query to _inputQuery
+    */
+    unsigned computeRefinement( Query &refinement );
+    void addRefinementToInputQuery( Query &refinement );
+
     void printStatus();
 };
 
@@ -0,0 +1,100 @@
+/*********************                                                        */
+/*! \file AllocationCounter.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "AllocationCounter.h"
+
+#ifdef ENABLE_ALLOCATION_COUNTING
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<unsigned long long> numAllocations( 0 );
+
+static void *countedAllocation( std::size_t size )
+{
+    numAllocations.fetch_add( 1, std::memory_order_relaxed );
+
+    void *result = std::malloc( size == 0 ? 1 : size );
+    if ( !result )
+        throw std::bad_alloc();
+
+    return result;
+}
+
+/*
+  The nothrow forms of operator new, in the standard library, call these
+*/
+void *operator new( std::size_t size )
+{
+    return countedAllocation( size );
+}
+
+void *operator new[]( std::size_t size )
+{
+    return countedAllocation( size );
+}
+
+void operator delete( void *pointer ) noexcept
+{
+    std::free( pointer );
+}
+
+void operator delete[]( void *pointer ) noexcept
+{
+    std::free( pointer );
+}
+
+void operator delete( void *pointer, std::size_t ) noexcept
+{
+    std::free( pointer );
+}
+
+void operator delete[]( void *pointer, std::size_t ) noexcept
+{
+    std::free( pointer );
+}
+
+bool AllocationCounter::isEnabled()
+{
+    return true;
+}
+
+unsigned long long AllocationCounter::getNumAllocations()
+{
+    return numAllocations.load( std::memory_order_relaxed );
+}
+
+#else
+
+bool AllocationCounter::isEnabled()
+{
+    return false;
+}
+
+unsigned long long AllocationCounter::getNumAllocations()
+{
+    return 0;
+}
+
+#endif // ENABLE_ALLOCATION_COUNTING
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
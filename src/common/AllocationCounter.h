@@ -0,0 +1,47 @@
+/*********************                                                        */
+/*! \file AllocationCounter.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Counts the heap allocations of the process, in order to check that the
+ ** hot paths of the solver (e.g., simplex steps) do not allocate memory.
+ **
+ ** Counting replaces the global operator new, and so it is only compiled in
+ ** when ENABLE_ALLOCATION_COUNTING is defined. Otherwise, the count is
+ ** always 0.
+
+ **/
+
+#ifndef __AllocationCounter_h__
+#define __AllocationCounter_h__
+
+class AllocationCounter
+{
+public:
+    /*
+      Whether allocations are being counted
+    */
+    static bool isEnabled();
+
+    /*
+      The number of allocations made so far, through any form of operator
+      new
+    */
+    static unsigned long long getNumAllocations();
+};
+
+#endif // __AllocationCounter_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -40,6 +40,7 @@ public:
         DIVISION_BY_ZERO = 15,
         UNEXPECTED_GUROBI_STATUS = 16,
         POPPING_ZERO_CONTEXT_LEVEL = 17,
+        SOCKET_FAILED = 18,
     };
 
     CommonError( CommonError::Code code )
@@ -168,6 +168,23 @@ public:
         _container.erase( value );
     }
 
+    /*
+      Erase one value and insert another. The memory of the erased value,
+      if it exists, is reused for the inserted one.
+    */
+    void replace( const Value &oldValue, const Value &newValue )
+    {
+        auto node = _container.extract( oldValue );
+        if ( node.empty() )
+        {
+            _container.insert( newValue );
+            return;
+        }
+
+        node.value() = newValue;
+        _container.insert( std::move( node ) );
+    }
+
     const Super &container() const
     {
         return _container;
@@ -32,7 +32,21 @@ SignalHandler *SignalHandler::getInstance()
 
 void SignalHandler::registerClient( Signalable *client )
 {
-    _clients.append( client );
+    _mutex.lock();
+    if ( !_clients.exists( client ) )
+        _clients.append( client );
+    _mutex.unlock();
+
+    deliverPendingSignal();
+}
+
+void SignalHandler::unregisterClient( Signalable *client )
+{
+    _mutex.lock();
+    _clients.erase( client );
+    _mutex.unlock();
+
+    deliverPendingSignal();
 }
 
 void SignalHandler::initialize()
@@ -53,8 +67,24 @@ void SignalHandler::initialize()
 
 void SignalHandler::signalReceived( unsigned /* signalNumber */ )
 {
-    for ( const auto &signalable : _clients )
-        signalable->quitSignal();
+    _signalPending = true;
+    deliverPendingSignal();
+}
+
+void SignalHandler::deliverPendingSignal()
+{
+    // The signal handler must not block, so it only tries the lock; if it
+    // fails, whoever holds the lock checks for the pending signal after
+    // releasing it
+    while ( _signalPending && _mutex.try_lock() )
+    {
+        if ( _signalPending.exchange( false ) )
+        {
+            for ( const auto &signalable : _clients )
+                signalable->quitSignal();
+        }
+        _mutex.unlock();
+    }
 }
 
 //
@@ -18,6 +18,9 @@
 
 #include "List.h"
 
+#include <atomic>
+#include <mutex>
+
 class SignalHandler
 {
 public:
@@ -33,9 +36,12 @@ public:
     static SignalHandler *getInstance();
 
     /*
-      Register a client to receive signals
+      Register a client to receive signals, and unregister it before it is
+      destroyed. Clients may (un)register concurrently, e.g. engines of
+      solves that run in parallel.
     */
     void registerClient( Signalable *client );
+    void unregisterClient( Signalable *client );
 
     /*
       Initialize the signal handling
@@ -50,10 +56,20 @@ public:
 private:
     List<Signalable *> _clients;
 
+    /*
+      Guards the clients. A signal that arrives while the lock is held
+      is left pending, and delivered by the holder once it releases it.
+    */
+    std::mutex _mutex;
+    std::atomic_bool _signalPending;
+
+    void deliverPendingSignal();
+
     /*
       Prevent additional instantiations of the class
     */
     SignalHandler()
+        : _signalPending( false )
     {
     }
     SignalHandler( const SignalHandler & )
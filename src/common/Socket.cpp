@@ -0,0 +1,399 @@
+/*********************                                                        */
+/*! \file Socket.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Socket.h"
+
+#include "CommonError.h"
+#include "MStringf.h"
+#include "Vector.h"
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+Socket::Socket( const String &address )
+    : _address( address )
+    , _descriptor( NO_DESCRIPTOR )
+    , _isUnixSocket( address.length() > 5 && address.substring( 0, 5 ) == "unix:" )
+{
+}
+
+Socket::Socket( const String &address, int descriptor )
+    : _address( address )
+    , _descriptor( descriptor )
+    , _isUnixSocket( address.length() > 5 && address.substring( 0, 5 ) == "unix:" )
+{
+}
+
+Socket::~Socket()
+{
+    closeIfNeeded();
+}
+
+void Socket::close()
+{
+    closeIfNeeded();
+}
+
+int Socket::getDescriptor() const
+{
+    return _descriptor;
+}
+
+const String &Socket::getAddress() const
+{
+    return _address;
+}
+
+void Socket::parseAddress( String &hostOrPath, String &port ) const
+{
+    if ( _isUnixSocket )
+    {
+        hostOrPath = _address.substring( 5, _address.length() - 5 );
+        port = "";
+        return;
+    }
+
+    size_t separator = std::string( _address.ascii() ).rfind( ':' );
+    if ( separator == std::string::npos || separator + 1 >= _address.length() )
+        throw CommonError( CommonError::SOCKET_FAILED,
+                           Stringf( "Invalid socket address: %s", _address.ascii() ).ascii() );
+
+    hostOrPath = _address.substring( 0, separator );
+    port = _address.substring( separator + 1, _address.length() - separator - 1 );
+}
+
+#ifndef _WIN32
+
+int Socket::createDescriptor( bool forListening )
+{
+    String hostOrPath;
+    String port;
+    parseAddress( hostOrPath, port );
+
+    if ( _isUnixSocket )
+    {
+        struct sockaddr_un socketAddress;
+        memset( &socketAddress, 0, sizeof( socketAddress ) );
+        socketAddress.sun_family = AF_UNIX;
+        if ( hostOrPath.length() >= sizeof( socketAddress.sun_path ) )
+            throw CommonError( CommonError::SOCKET_FAILED,
+                               Stringf( "Socket path too long: %s", hostOrPath.ascii() ).ascii() );
+        strncpy( socketAddress.sun_path, hostOrPath.ascii(), sizeof( socketAddress.sun_path ) - 1 );
+
+        int descriptor = ::socket( AF_UNIX, SOCK_STREAM, 0 );
+        if ( descriptor == NO_DESCRIPTOR )
+            throw CommonError( CommonError::SOCKET_FAILED, "socket() failed" );
+
+        int result;
+        if ( forListening )
+        {
+            // Remove a stale socket file left behind by a previous run
+            ::unlink( hostOrPath.ascii() );
+            result = ::bind( descriptor, (struct sockaddr *)&socketAddress, sizeof( socketAddress ) );
+        }
+        else
+            result =
+                ::connect( descriptor, (struct sockaddr *)&socketAddress, sizeof( socketAddress ) );
+
+        if ( result != 0 )
+        {
+            ::close( descriptor );
+            return NO_DESCRIPTOR;
+        }
+
+        return descriptor;
+    }
+
+    struct addrinfo hints;
+    memset( &hints, 0, sizeof( hints ) );
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if ( forListening )
+        hints.ai_flags = AI_PASSIVE;
+
+    const char *host = ( hostOrPath.length() == 0 || hostOrPath == "*" ) ? NULL : hostOrPath.ascii();
+
+    struct addrinfo *addresses = NULL;
+    if ( ::getaddrinfo( host, port.ascii(), &hints, &addresses ) != 0 )
+        throw CommonError( CommonError::SOCKET_FAILED,
+                           Stringf( "Cannot resolve address: %s", _address.ascii() ).ascii() );
+
+    int descriptor = NO_DESCRIPTOR;
+    for ( struct addrinfo *current = addresses; current; current = current->ai_next )
+    {
+        descriptor = ::socket( current->ai_family, current->ai_socktype, current->ai_protocol );
+        if ( descriptor == NO_DESCRIPTOR )
+            continue;
+
+        int result;
+        if ( forListening )
+        {
+            int reuse = 1;
+            ::setsockopt( descriptor, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof( reuse ) );
+            result = ::bind( descriptor, current->ai_addr, current->ai_addrlen );
+        }
+        else
+        {
+            result = ::connect( descriptor, current->ai_addr, current->ai_addrlen );
+
+            // Messages are small and latency-sensitive
+            int noDelay = 1;
+            ::setsockopt( descriptor, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof( noDelay ) );
+        }
+
+        if ( result == 0 )
+            break;
+
+        ::close( descriptor );
+        descriptor = NO_DESCRIPTOR;
+    }
+
+    ::freeaddrinfo( addresses );
+    return descriptor;
+}
+
+void Socket::listen()
+{
+    closeIfNeeded();
+
+    _descriptor = createDescriptor( true );
+    if ( _descriptor == NO_DESCRIPTOR )
+        throw CommonError( CommonError::SOCKET_FAILED,
+                           Stringf( "Cannot bind to %s", _address.ascii() ).ascii() );
+
+    if ( ::listen( _descriptor, SOMAXCONN ) != 0 )
+        throw CommonError( CommonError::SOCKET_FAILED,
+                           Stringf( "Cannot listen on %s", _address.ascii() ).ascii() );
+}
+
+Socket *Socket::accept()
+{
+    int descriptor = ::accept( _descriptor, NULL, NULL );
+    if ( descriptor == NO_DESCRIPTOR )
+        throw CommonError( CommonError::SOCKET_FAILED, "accept() failed" );
+
+    if ( !_isUnixSocket )
+    {
+        int noDelay = 1;
+        ::setsockopt( descriptor, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof( noDelay ) );
+    }
+
+    return new Socket( _address, descriptor );
+}
+
+bool Socket::connect()
+{
+    closeIfNeeded();
+
+    _descriptor = createDescriptor( false );
+    return _descriptor != NO_DESCRIPTOR;
+}
+
+bool Socket::waitForInput( unsigned timeoutInMilliseconds ) const
+{
+    struct pollfd descriptor;
+    descriptor.fd = _descriptor;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+
+    return ::poll( &descriptor, 1, (int)timeoutInMilliseconds ) > 0;
+}
+
+void Socket::waitForInput( const List<Socket *> &sockets,
+                           unsigned timeoutInMilliseconds,
+                           List<Socket *> &readySockets )
+{
+    readySockets.clear();
+
+    Vector<struct pollfd> descriptors;
+    for ( const auto &socket : sockets )
+    {
+        struct pollfd descriptor;
+        descriptor.fd = socket->_descriptor;
+        descriptor.events = POLLIN;
+        descriptor.revents = 0;
+        descriptors.append( descriptor );
+    }
+
+    if ( ::poll( descriptors.data(), descriptors.size(), (int)timeoutInMilliseconds ) <= 0 )
+        return;
+
+    unsigned index = 0;
+    for ( const auto &socket : sockets )
+    {
+        if ( descriptors[index++].revents != 0 )
+            readySockets.append( socket );
+    }
+}
+
+void Socket::sendBuffer( const char *buffer, unsigned size )
+{
+    unsigned sent = 0;
+    while ( sent < size )
+    {
+        ssize_t result = ::send( _descriptor, buffer + sent, size - sent, MSG_NOSIGNAL );
+        if ( result <= 0 )
+        {
+            if ( result < 0 && errno == EINTR )
+                continue;
+            throw CommonError( CommonError::SOCKET_FAILED,
+                               Stringf( "Cannot send to %s", _address.ascii() ).ascii() );
+        }
+        sent += result;
+    }
+}
+
+bool Socket::receiveBuffer( char *buffer, unsigned size )
+{
+    unsigned received = 0;
+    while ( received < size )
+    {
+        ssize_t result = ::recv( _descriptor, buffer + received, size - received, 0 );
+        if ( result == 0 )
+            return false;
+
+        if ( result < 0 )
+        {
+            if ( errno == EINTR )
+                continue;
+            if ( errno == ECONNRESET )
+                return false;
+            throw CommonError( CommonError::SOCKET_FAILED,
+                               Stringf( "Cannot receive from %s", _address.ascii() ).ascii() );
+        }
+        received += result;
+    }
+
+    return true;
+}
+
+void Socket::closeIfNeeded()
+{
+    if ( _descriptor != NO_DESCRIPTOR )
+    {
+        ::close( _descriptor );
+        _descriptor = NO_DESCRIPTOR;
+    }
+}
+
+#else
+
+int Socket::createDescriptor( bool )
+{
+    throw CommonError( CommonError::SOCKET_FAILED, "Sockets are not supported on Windows" );
+}
+
+void Socket::listen()
+{
+    createDescriptor( true );
+}
+
+Socket *Socket::accept()
+{
+    createDescriptor( true );
+    return NULL;
+}
+
+bool Socket::connect()
+{
+    createDescriptor( false );
+    return false;
+}
+
+bool Socket::waitForInput( unsigned ) const
+{
+    return false;
+}
+
+void Socket::waitForInput( const List<Socket *> &, unsigned, List<Socket *> &readySockets )
+{
+    readySockets.clear();
+}
+
+void Socket::sendBuffer( const char *, unsigned )
+{
+    createDescriptor( false );
+}
+
+bool Socket::receiveBuffer( char *, unsigned )
+{
+    createDescriptor( false );
+    return false;
+}
+
+void Socket::closeIfNeeded()
+{
+}
+
+#endif
+
+void Socket::sendMessage( const String &message )
+{
+    // Each message is preceded by its length, in network byte order
+    uint32_t length = message.length();
+    unsigned char header[4] = { (unsigned char)( ( length >> 24 ) & 0xff ),
+                                (unsigned char)( ( length >> 16 ) & 0xff ),
+                                (unsigned char)( ( length >> 8 ) & 0xff ),
+                                (unsigned char)( length & 0xff ) };
+
+    sendBuffer( (const char *)header, sizeof( header ) );
+    sendBuffer( message.ascii(), length );
+}
+
+void Socket::sendText( const String &text )
+{
+    sendBuffer( text.ascii(), text.length() );
+}
+
+bool Socket::receiveMessage( String &message )
+{
+    unsigned char header[4];
+    if ( !receiveBuffer( (char *)header, sizeof( header ) ) )
+        return false;
+
+    uint32_t length = ( (uint32_t)header[0] << 24 ) | ( (uint32_t)header[1] << 16 ) |
+                      ( (uint32_t)header[2] << 8 ) | (uint32_t)header[3];
+
+    Vector<char> buffer( length + 1, 0 );
+    if ( length > 0 && !receiveBuffer( buffer.data(), length ) )
+        return false;
+
+    message = String( buffer.data(), length );
+    return true;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,109 @@
+/*********************                                                        */
+/*! \file Socket.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A thin wrapper around stream sockets (TCP or Unix domain) that
+ ** exchanges length-prefixed messages.
+
+ **/
+
+#ifndef __Socket_h__
+#define __Socket_h__
+
+#include "List.h"
+#include "MString.h"
+
+class Socket
+{
+public:
+    enum {
+        NO_DESCRIPTOR = -1,
+    };
+
+    /*
+      The address is either "unix:<path>" for a Unix domain socket,
+      or "<host>:<port>" for a TCP socket.
+    */
+    Socket( const String &address );
+    ~Socket();
+
+    /*
+      Server side: bind to the address and start listening, then
+      accept incoming connections. The caller owns the returned socket.
+    */
+    void listen();
+    Socket *accept();
+
+    /*
+      Client side: connect to the address. Returns false if nobody is
+      listening (yet).
+    */
+    bool connect();
+
+    /*
+      Send a message, or receive the next message. receiveMessage() returns
+      false if the other side has closed the connection.
+    */
+    void sendMessage( const String &message );
+    bool receiveMessage( String &message );
+
+    /*
+      Send text as is, without a length header, for consumers that read
+      lines
+    */
+    void sendText( const String &text );
+
+    /*
+      Wait up to the given number of milliseconds for the socket to become
+      readable (incoming data, an incoming connection, or a hang-up).
+    */
+    bool waitForInput( unsigned timeoutInMilliseconds ) const;
+
+    /*
+      The same, for a group of sockets. The sockets that became readable
+      are stored in readySockets.
+    */
+    static void waitForInput( const List<Socket *> &sockets,
+                              unsigned timeoutInMilliseconds,
+                              List<Socket *> &readySockets );
+
+    int getDescriptor() const;
+    const String &getAddress() const;
+
+    void close();
+
+private:
+    String _address;
+    int _descriptor;
+    bool _isUnixSocket;
+
+    /*
+      For a socket returned by accept()
+    */
+    Socket( const String &address, int descriptor );
+
+    void parseAddress( String &hostOrPath, String &port ) const;
+    int createDescriptor( bool forListening );
+
+    void sendBuffer( const char *buffer, unsigned size );
+    bool receiveBuffer( char *buffer, unsigned size );
+
+    void closeIfNeeded();
+};
+
+#endif // __Socket_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
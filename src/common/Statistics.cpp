@@ -15,9 +15,225 @@
 
 #include "Statistics.h"
 
+#include "AllocationCounter.h"
 #include "FloatUtils.h"
+#include "MStringf.h"
 #include "TimeUtils.h"
 
+/*
+  The attribute names used in the JSON output
+*/
+static const char *attributeName( Statistics::StatisticsUnsignedAttribute attr )
+{
+    switch ( attr )
+    {
+    case Statistics::NUM_PL_CONSTRAINTS:
+        return "num_pl_constraints";
+    case Statistics::NUM_ACTIVE_PL_CONSTRAINTS:
+        return "num_active_pl_constraints";
+    case Statistics::NUM_PL_VALID_SPLITS:
+        return "num_pl_valid_splits";
+    case Statistics::NUM_PL_SMT_ORIGINATED_SPLITS:
+        return "num_pl_smt_originated_splits";
+    case Statistics::NUM_PRECISION_RESTORATIONS:
+        return "num_precision_restorations";
+    case Statistics::CURRENT_DECISION_LEVEL:
+        return "current_decision_level";
+    case Statistics::MAX_DECISION_LEVEL:
+        return "max_decision_level";
+    case Statistics::NUM_SPLITS:
+        return "num_splits";
+    case Statistics::NUM_POPS:
+        return "num_pops";
+    case Statistics::NUM_CONTEXT_PUSHES:
+        return "num_context_pushes";
+    case Statistics::NUM_CONTEXT_POPS:
+        return "num_context_pops";
+    case Statistics::NUM_VISITED_TREE_STATES:
+        return "num_visited_tree_states";
+    case Statistics::CURRENT_TABLEAU_M:
+        return "current_tableau_m";
+    case Statistics::CURRENT_TABLEAU_N:
+        return "current_tableau_n";
+    case Statistics::NUM_DEFERRED_ROWS:
+        return "num_deferred_rows";
+    case Statistics::NUM_LAZY_ROWS_ADDED:
+        return "num_lazy_rows_added";
+    case Statistics::PP_NUM_ELIMINATED_VARS:
+        return "pp_num_eliminated_vars";
+    case Statistics::PP_NUM_TIGHTENING_ITERATIONS:
+        return "pp_num_tightening_iterations";
+    case Statistics::PP_NUM_CONSTRAINTS_REMOVED:
+        return "pp_num_constraints_removed";
+    case Statistics::PP_NUM_EQUATIONS_REMOVED:
+        return "pp_num_equations_removed";
+    case Statistics::PP_NUM_EQUATIONS_PRESOLVED:
+        return "pp_num_equations_presolved";
+    case Statistics::PP_NUM_BOUND_CACHE_HITS:
+        return "pp_num_bound_cache_hits";
+    case Statistics::PP_NUM_BOUND_CACHE_TIGHTENINGS:
+        return "pp_num_bound_cache_tightenings";
+    case Statistics::TOTAL_NUMBER_OF_VALID_CASE_SPLITS:
+        return "total_number_of_valid_case_splits";
+    case Statistics::NUM_CERTIFIED_LEAVES:
+        return "num_certified_leaves";
+    case Statistics::NUM_DELEGATED_LEAVES:
+        return "num_delegated_leaves";
+    case Statistics::NUM_LEMMAS:
+        return "num_lemmas";
+    case Statistics::CERTIFIED_UNSAT:
+        return "certified_unsat";
+    }
+
+    return "unknown";
+}
+
+static const char *attributeName( Statistics::StatisticsLongAttribute attr )
+{
+    switch ( attr )
+    {
+    case Statistics::PREPROCESSING_TIME_MICRO:
+        return "preprocessing_time_micro";
+    case Statistics::CALCULATE_BOUNDS_TIME_MICRO:
+        return "calculate_bounds_time_micro";
+    case Statistics::NLR_CONSTRUCTION_TIME_MICRO:
+        return "nlr_construction_time_micro";
+    case Statistics::NUM_MAIN_LOOP_ITERATIONS:
+        return "num_main_loop_iterations";
+    case Statistics::NUM_SIMPLEX_STEPS:
+        return "num_simplex_steps";
+    case Statistics::TIME_SIMPLEX_STEPS_MICRO:
+        return "time_simplex_steps_micro";
+    case Statistics::TIME_MAIN_LOOP_MICRO:
+        return "time_main_loop_micro";
+    case Statistics::TIME_CONSTRAINT_FIXING_STEPS_MICRO:
+        return "time_constraint_fixing_steps_micro";
+    case Statistics::NUM_CONSTRAINT_FIXING_STEPS:
+        return "num_constraint_fixing_steps";
+    case Statistics::NUM_TABLEAU_PIVOTS:
+        return "num_tableau_pivots";
+    case Statistics::NUM_TABLEAU_DEGENERATE_PIVOTS:
+        return "num_tableau_degenerate_pivots";
+    case Statistics::NUM_TABLEAU_DEGENERATE_PIVOTS_BY_REQUEST:
+        return "num_tableau_degenerate_pivots_by_request";
+    case Statistics::TIME_PIVOTS_MICRO:
+        return "time_pivots_micro";
+    case Statistics::NUM_SIMPLEX_PIVOT_SELECTIONS_IGNORED_FOR_STABILITY:
+        return "num_simplex_pivot_selections_ignored_for_stability";
+    case Statistics::NUM_SIMPLEX_UNSTABLE_PIVOTS:
+        return "num_simplex_unstable_pivots";
+    case Statistics::NUM_ADDED_ROWS:
+        return "num_added_rows";
+    case Statistics::NUM_MERGED_COLUMNS:
+        return "num_merged_columns";
+    case Statistics::NUM_TABLEAU_BOUND_HOPPING:
+        return "num_tableau_bound_hopping";
+    case Statistics::NUM_TABLEAU_LONG_STEPS:
+        return "num_tableau_long_steps";
+    case Statistics::NUM_TABLEAU_BREAKPOINTS_PASSED:
+        return "num_tableau_breakpoints_passed";
+    case Statistics::NUM_COST_FUNCTION_COMPUTATIONS:
+        return "num_cost_function_computations";
+    case Statistics::NUM_COST_FUNCTION_UPDATES:
+        return "num_cost_function_updates";
+    case Statistics::NUM_MAIN_LOOP_HEAP_ALLOCATIONS:
+        return "num_main_loop_heap_allocations";
+    case Statistics::NUM_TIGHTENED_BOUNDS:
+        return "num_tightened_bounds";
+    case Statistics::NUM_TIGHTENINGS_FROM_SYMBOLIC_BOUND_TIGHTENING:
+        return "num_tightenings_from_symbolic_bound_tightening";
+    case Statistics::NUM_INCREMENTAL_SYMBOLIC_BOUND_TIGHTENINGS:
+        return "num_incremental_symbolic_bound_tightenings";
+    case Statistics::NUM_LAYERS_SKIPPED_BY_SYMBOLIC_BOUND_TIGHTENING:
+        return "num_layers_skipped_by_symbolic_bound_tightening";
+    case Statistics::NUM_ROWS_EXAMINED_BY_ROW_TIGHTENER:
+        return "num_rows_examined_by_row_tightener";
+    case Statistics::NUM_TIGHTENINGS_FROM_ROWS:
+        return "num_tightenings_from_rows";
+    case Statistics::NUM_BOUND_TIGHTENINGS_ON_EXPLICIT_BASIS:
+        return "num_bound_tightenings_on_explicit_basis";
+    case Statistics::NUM_TIGHTENINGS_FROM_EXPLICIT_BASIS:
+        return "num_tightenings_from_explicit_basis";
+    case Statistics::NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS:
+        return "num_bound_notifications_to_pl_constraints";
+    case Statistics::NUM_BOUND_NOTIFICATIONS_TO_TRANSCENDENTAL_CONSTRAINTS:
+        return "num_bound_notifications_to_transcendental_constraints";
+    case Statistics::NUM_BOUNDS_PROPOSED_BY_PL_CONSTRAINTS:
+        return "num_bounds_proposed_by_pl_constraints";
+    case Statistics::NUM_BOUND_TIGHTENINGS_ON_CONSTRAINT_MATRIX:
+        return "num_bound_tightenings_on_constraint_matrix";
+    case Statistics::NUM_TIGHTENINGS_FROM_CONSTRAINT_MATRIX:
+        return "num_tightenings_from_constraint_matrix";
+    case Statistics::NUM_BASIS_REFACTORIZATIONS:
+        return "num_basis_refactorizations";
+    case Statistics::PSE_NUM_ITERATIONS:
+        return "pse_num_iterations";
+    case Statistics::PSE_NUM_RESET_REFERENCE_SPACE:
+        return "pse_num_reset_reference_space";
+    case Statistics::TOTAL_TIME_PERFORMING_VALID_CASE_SPLITS_MICRO:
+        return "total_time_performing_valid_case_splits_micro";
+    case Statistics::TOTAL_TIME_PERFORMING_SYMBOLIC_BOUND_TIGHTENING:
+        return "total_time_performing_symbolic_bound_tightening";
+    case Statistics::TOTAL_TIME_HANDLING_STATISTICS_MICRO:
+        return "total_time_handling_statistics_micro";
+    case Statistics::TOTAL_TIME_EXPLICIT_BASIS_BOUND_TIGHTENING_MICRO:
+        return "total_time_explicit_basis_bound_tightening_micro";
+    case Statistics::TOTAL_TIME_DEGRADATION_CHECKING:
+        return "total_time_degradation_checking";
+    case Statistics::TOTAL_TIME_PRECISION_RESTORATION:
+        return "total_time_precision_restoration";
+    case Statistics::TOTAL_TIME_CONSTRAINT_MATRIX_BOUND_TIGHTENING_MICRO:
+        return "total_time_constraint_matrix_bound_tightening_micro";
+    case Statistics::TOTAL_TIME_APPLYING_STORED_TIGHTENINGS_MICRO:
+        return "total_time_applying_stored_tightenings_micro";
+    case Statistics::TOTAL_TIME_SMT_CORE_MICRO:
+        return "total_time_smt_core_micro";
+    case Statistics::TOTAL_TIME_UPDATING_SOI_PHASE_PATTERN_MICRO:
+        return "total_time_updating_soi_phase_pattern_micro";
+    case Statistics::NUM_PROPOSED_PHASE_PATTERN_UPDATE:
+        return "num_proposed_phase_pattern_update";
+    case Statistics::NUM_ACCEPTED_PHASE_PATTERN_UPDATE:
+        return "num_accepted_phase_pattern_update";
+    case Statistics::TOTAL_TIME_OBTAIN_CURRENT_ASSIGNMENT_MICRO:
+        return "total_time_obtain_current_assignment_micro";
+    case Statistics::TOTAL_TIME_LOCAL_SEARCH_MICRO:
+        return "total_time_local_search_micro";
+    case Statistics::TOTAL_TIME_GETTING_SOI_PHASE_PATTERN_MICRO:
+        return "total_time_getting_soi_phase_pattern_micro";
+    case Statistics::TIME_ADDING_CONSTRAINTS_TO_MILP_SOLVER_MICRO:
+        return "time_adding_constraints_to_milp_solver_micro";
+    case Statistics::TIME_CONTEXT_PUSH:
+        return "time_context_push";
+    case Statistics::TIME_CONTEXT_POP:
+        return "time_context_pop";
+    case Statistics::TIME_CONTEXT_PUSH_HOOK:
+        return "time_context_push_hook";
+    case Statistics::TIME_CONTEXT_POP_HOOK:
+        return "time_context_pop_hook";
+    case Statistics::TOTAL_CERTIFICATION_TIME:
+        return "total_certification_time";
+    }
+
+    return "unknown";
+}
+
+static const char *attributeName( Statistics::StatisticsDoubleAttribute attr )
+{
+    switch ( attr )
+    {
+    case Statistics::CURRENT_DEGRADATION:
+        return "current_degradation";
+    case Statistics::MAX_DEGRADATION:
+        return "max_degradation";
+    case Statistics::COST_OF_CURRENT_PHASE_PATTERN:
+        return "cost_of_current_phase_pattern";
+    case Statistics::MIN_COST_OF_PHASE_PATTERN:
+        return "min_cost_of_phase_pattern";
+    }
+
+    return "unknown";
+}
+
 Statistics::Statistics()
     : _timedOut( false )
 {
@@ -35,16 +251,22 @@ Statistics::Statistics()
     _unsignedAttributes[NUM_VISITED_TREE_STATES] = 1;
     _unsignedAttributes[CURRENT_TABLEAU_M] = 0;
     _unsignedAttributes[CURRENT_TABLEAU_N] = 0;
+    _unsignedAttributes[NUM_DEFERRED_ROWS] = 0;
+    _unsignedAttributes[NUM_LAZY_ROWS_ADDED] = 0;
     _unsignedAttributes[PP_NUM_ELIMINATED_VARS] = 0;
     _unsignedAttributes[PP_NUM_TIGHTENING_ITERATIONS] = 0;
     _unsignedAttributes[PP_NUM_CONSTRAINTS_REMOVED] = 0;
     _unsignedAttributes[PP_NUM_EQUATIONS_REMOVED] = 0;
+    _unsignedAttributes[PP_NUM_EQUATIONS_PRESOLVED] = 0;
+    _unsignedAttributes[PP_NUM_BOUND_CACHE_HITS] = 0;
+    _unsignedAttributes[PP_NUM_BOUND_CACHE_TIGHTENINGS] = 0;
     _unsignedAttributes[TOTAL_NUMBER_OF_VALID_CASE_SPLITS] = 0;
     _unsignedAttributes[NUM_CERTIFIED_LEAVES] = 0;
     _unsignedAttributes[NUM_DELEGATED_LEAVES] = 0;
     _unsignedAttributes[NUM_LEMMAS] = 0;
     _unsignedAttributes[CERTIFIED_UNSAT] = 0;
 
+    _longAttributes[NLR_CONSTRUCTION_TIME_MICRO] = 0;
     _longAttributes[NUM_MAIN_LOOP_ITERATIONS] = 0;
     _longAttributes[NUM_SIMPLEX_STEPS] = 0;
     _longAttributes[TIME_SIMPLEX_STEPS_MICRO] = 0;
@@ -60,8 +282,15 @@ Statistics::Statistics()
     _longAttributes[NUM_ADDED_ROWS] = 0;
     _longAttributes[NUM_MERGED_COLUMNS] = 0;
     _longAttributes[NUM_TABLEAU_BOUND_HOPPING] = 0;
+    _longAttributes[NUM_TABLEAU_LONG_STEPS] = 0;
+    _longAttributes[NUM_TABLEAU_BREAKPOINTS_PASSED] = 0;
+    _longAttributes[NUM_COST_FUNCTION_COMPUTATIONS] = 0;
+    _longAttributes[NUM_COST_FUNCTION_UPDATES] = 0;
+    _longAttributes[NUM_MAIN_LOOP_HEAP_ALLOCATIONS] = 0;
     _longAttributes[NUM_TIGHTENED_BOUNDS] = 0;
     _longAttributes[NUM_TIGHTENINGS_FROM_SYMBOLIC_BOUND_TIGHTENING] = 0;
+    _longAttributes[NUM_INCREMENTAL_SYMBOLIC_BOUND_TIGHTENINGS] = 0;
+    _longAttributes[NUM_LAYERS_SKIPPED_BY_SYMBOLIC_BOUND_TIGHTENING] = 0;
     _longAttributes[NUM_ROWS_EXAMINED_BY_ROW_TIGHTENER] = 0;
     _longAttributes[NUM_TIGHTENINGS_FROM_ROWS] = 0;
     _longAttributes[NUM_BOUND_TIGHTENINGS_ON_EXPLICIT_BASIS] = 0;
@@ -250,6 +479,13 @@ void Statistics::print()
             getUnsignedAttribute( Statistics::PP_NUM_CONSTRAINTS_REMOVED ) );
     printf( "\tNumber of equations removed due to variable elimination: %u\n",
             getUnsignedAttribute( Statistics::PP_NUM_EQUATIONS_REMOVED ) );
+    printf( "\tNumber of equations removed by presolve: %u\n",
+            getUnsignedAttribute( Statistics::PP_NUM_EQUATIONS_PRESOLVED ) );
+    printf( "\tNumber of NLR bound cache hits: %u (%u bounds tightened)\n",
+            getUnsignedAttribute( Statistics::PP_NUM_BOUND_CACHE_HITS ),
+            getUnsignedAttribute( Statistics::PP_NUM_BOUND_CACHE_TIGHTENINGS ) );
+    printf( "\tTime constructing the network level reasoner: %llu milli\n",
+            getLongAttribute( Statistics::NLR_CONSTRUCTION_TIME_MICRO ) / 1000 );
 
     unsigned long long numSimplexSteps = getLongAttribute( Statistics::NUM_SIMPLEX_STEPS );
     unsigned long long numConstraintFixingSteps =
@@ -268,6 +504,11 @@ void Statistics::print()
         numConstraintFixingSteps,
         timeConstraintFixingStepsMicro / 1000,
         printAverage( timeConstraintFixingStepsMicro / 1000, numConstraintFixingSteps ) );
+    if ( AllocationCounter::isEnabled() )
+        printf( "\tHeap allocations in the main loop: %llu. Average per simplex step: %.2lf\n",
+                getLongAttribute( Statistics::NUM_MAIN_LOOP_HEAP_ALLOCATIONS ),
+                printAverage( getLongAttribute( Statistics::NUM_MAIN_LOOP_HEAP_ALLOCATIONS ),
+                              numSimplexSteps ) );
     printf( "\tNumber of active piecewise-linear constraints: %u / %u\n"
             "\t\tConstraints disabled by valid splits: %u. "
             "By SMT-originated splits: %u\n",
@@ -307,12 +548,28 @@ void Statistics::print()
 
     printf( "\tTotal number of fake pivots performed: %llu\n",
             getLongAttribute( Statistics::NUM_TABLEAU_BOUND_HOPPING ) );
+    printf( "\tLong steps taken: %llu. Breakpoints passed (pivots saved): %llu\n",
+            getLongAttribute( Statistics::NUM_TABLEAU_LONG_STEPS ),
+            getLongAttribute( Statistics::NUM_TABLEAU_BREAKPOINTS_PASSED ) );
+
+    unsigned long long numCostFunctionComputations =
+        getLongAttribute( NUM_COST_FUNCTION_COMPUTATIONS );
+    unsigned long long numCostFunctionUpdates = getLongAttribute( NUM_COST_FUNCTION_UPDATES );
+    printf( "\tCost function computed from scratch: %llu times. Updated incrementally: %llu "
+            "times (%.2lf%%)\n",
+            numCostFunctionComputations,
+            numCostFunctionUpdates,
+            printPercents( numCostFunctionUpdates,
+                           numCostFunctionComputations + numCostFunctionUpdates ) );
     printf( "\tTotal number of rows added: %llu. Number of merged columns: %llu\n",
             getLongAttribute( Statistics::NUM_ADDED_ROWS ),
             getLongAttribute( Statistics::NUM_MERGED_COLUMNS ) );
     printf( "\tCurrent tableau dimensions: M = %u, N = %u\n",
             getUnsignedAttribute( Statistics::CURRENT_TABLEAU_M ),
             getUnsignedAttribute( Statistics::CURRENT_TABLEAU_N ) );
+    printf( "\tEquations kept out of the tableau: %u. Added lazily since: %u\n",
+            getUnsignedAttribute( Statistics::NUM_DEFERRED_ROWS ),
+            getUnsignedAttribute( Statistics::NUM_LAZY_ROWS_ADDED ) );
 
     printf( "\t--- SMT Core Statistics ---\n" );
     printf(
@@ -363,6 +620,9 @@ void Statistics::print()
     printf( "\t--- SBT ---\n" );
     printf( "\tNumber of tightened bounds: %llu\n",
             getLongAttribute( Statistics::NUM_TIGHTENINGS_FROM_SYMBOLIC_BOUND_TIGHTENING ) );
+    printf( "\tNumber of incremental passes: %llu. Layers skipped: %llu\n",
+            getLongAttribute( Statistics::NUM_INCREMENTAL_SYMBOLIC_BOUND_TIGHTENINGS ),
+            getLongAttribute( Statistics::NUM_LAYERS_SKIPPED_BY_SYMBOLIC_BOUND_TIGHTENING ) );
 
     printf( "\t--- SoI-based local search ---\n" );
     unsigned long long num_proposed_phase_pattern_update =
@@ -443,6 +703,31 @@ unsigned Statistics::getAveragePivotTimeInMicro() const
     return _longAttributes[TIME_PIVOTS_MICRO] / _longAttributes[NUM_TABLEAU_PIVOTS];
 }
 
+String Statistics::toJson() const
+{
+    String json = Stringf( "{\"total_time_micro\":%llu,\"timed_out\":%s",
+                           getTotalTimeInMicro(),
+                           _timedOut ? "true" : "false" );
+
+    for ( const auto &attribute : _unsignedAttributes )
+        json += Stringf( ",\"%s\":%u", attributeName( attribute.first ), attribute.second );
+
+    for ( const auto &attribute : _longAttributes )
+        json += Stringf( ",\"%s\":%llu", attributeName( attribute.first ), attribute.second );
+
+    // JSON has no infinity
+    for ( const auto &attribute : _doubleAttributes )
+    {
+        if ( FloatUtils::isFinite( attribute.second ) )
+            json += Stringf( ",\"%s\":%.10g", attributeName( attribute.first ), attribute.second );
+        else
+            json += Stringf( ",\"%s\":null", attributeName( attribute.first ) );
+    }
+
+    json += "}";
+    return json;
+}
+
 void Statistics::timeout()
 {
     _timedOut = true;
@@ -17,6 +17,7 @@
 #define __Statistics_h__
 
 #include "List.h"
+#include "MString.h"
 #include "Map.h"
 #include "TimeUtils.h"
 
@@ -57,11 +58,22 @@ public:
         CURRENT_TABLEAU_M,
         CURRENT_TABLEAU_N,
 
+        // Number of equations initially kept out of the tableau by lazy row
+        // generation, and number of them added since
+        NUM_DEFERRED_ROWS,
+        NUM_LAZY_ROWS_ADDED,
+
         // Preprocessor counters
         PP_NUM_ELIMINATED_VARS,
         PP_NUM_TIGHTENING_ITERATIONS,
         PP_NUM_CONSTRAINTS_REMOVED,
         PP_NUM_EQUATIONS_REMOVED,
+        PP_NUM_EQUATIONS_PRESOLVED,
+
+        // Number of NLR bound cache entries that were reused, and number of
+        // bounds they tightened
+        PP_NUM_BOUND_CACHE_HITS,
+        PP_NUM_BOUND_CACHE_TIGHTENINGS,
 
         // Total number of valid case splits performed so far (including in other
         // branches of the search tree, that have since been popped)
@@ -83,6 +95,9 @@ public:
         // Calculate output bounds time
         CALCULATE_BOUNDS_TIME_MICRO,
 
+        // Time spent constructing the network level reasoner from the query
+        NLR_CONSTRUCTION_TIME_MICRO,
+
         // Number of iterations of the main loop
         NUM_MAIN_LOOP_ITERATIONS,
 
@@ -129,12 +144,33 @@ public:
         // opposite bound.
         NUM_TABLEAU_BOUND_HOPPING,
 
+        // Number of pivots whose long-step ratio test passed breakpoints of the sum of
+        // infeasibilities, and the total number of breakpoints passed. Each passed breakpoint
+        // saves a pivot.
+        NUM_TABLEAU_LONG_STEPS,
+        NUM_TABLEAU_BREAKPOINTS_PASSED,
+
+        // Number of times the reduced costs were computed from scratch, and number of times they
+        // were updated incrementally from the pivot row
+        NUM_COST_FUNCTION_COMPUTATIONS,
+        NUM_COST_FUNCTION_UPDATES,
+
+        // Number of heap allocations performed since the main loop started. Only counted when
+        // built with ENABLE_ALLOCATION_COUNTING
+        NUM_MAIN_LOOP_HEAP_ALLOCATIONS,
+
         // This combines tightenings from all sources: rows, basis, PL constraints, etc.
         NUM_TIGHTENED_BOUNDS,
 
         // The number of bounds tightened via symbolic bound tightening
         NUM_TIGHTENINGS_FROM_SYMBOLIC_BOUND_TIGHTENING,
 
+        // The number of symbolic bound tightening passes during the search,
+        // and the number of layers they skipped, because neither their
+        // bounds nor those of the layers before them had changed
+        NUM_INCREMENTAL_SYMBOLIC_BOUND_TIGHTENINGS,
+        NUM_LAYERS_SKIPPED_BY_SYMBOLIC_BOUND_TIGHTENING,
+
         // Number of pivot rows examined by the row tightener, and consequent
         // tightenings proposed.
         NUM_ROWS_EXAMINED_BY_ROW_TIGHTENER,
@@ -305,6 +341,11 @@ public:
 
     unsigned getAveragePivotTimeInMicro() const;
 
+    /*
+      All the attributes, plus the total time, as a single-line JSON object
+    */
+    String toJson() const;
+
     /*
       Report a timeout, or check whether a timeout has occurred
     */
@@ -0,0 +1,167 @@
+/*********************                                                        */
+/*! \file StatisticsStream.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "StatisticsStream.h"
+
+#include "CommonError.h"
+#include "File.h"
+#include "MStringf.h"
+#include "Socket.h"
+
+#include <cstdio>
+#include <unistd.h>
+
+std::atomic_bool StatisticsStream::_open( false );
+std::mutex StatisticsStream::_mutex;
+std::unique_ptr<File> StatisticsStream::_file;
+std::unique_ptr<Socket> StatisticsStream::_socket;
+unsigned long long StatisticsStream::_intervalInMicroSeconds = 0;
+struct timespec StatisticsStream::_openTime = TimeUtils::sampleMicro();
+
+void StatisticsStream::open( const String &destination, unsigned intervalInSeconds )
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    closeWithoutLocking();
+
+    if ( destination.length() > 5 && destination.substring( 0, 5 ) == "unix:" )
+    {
+        _socket = std::unique_ptr<Socket>( new Socket( destination ) );
+        if ( !_socket->connect() )
+        {
+            _socket = nullptr;
+            throw CommonError(
+                CommonError::SOCKET_FAILED,
+                Stringf( "Nobody is listening for statistics on %s", destination.ascii() )
+                    .ascii() );
+        }
+    }
+    else
+    {
+        _file = std::unique_ptr<File>( new File( destination ) );
+        _file->open( File::MODE_WRITE_TRUNCATE );
+    }
+
+    _intervalInMicroSeconds = (unsigned long long)intervalInSeconds * 1000000;
+    _openTime = TimeUtils::sampleMicro();
+    _open = true;
+}
+
+void StatisticsStream::close()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    closeWithoutLocking();
+}
+
+void StatisticsStream::closeWithoutLocking()
+{
+    _open = false;
+    _file = nullptr;
+    _socket = nullptr;
+}
+
+bool StatisticsStream::isDue( const struct timespec &lastSnapshotTime )
+{
+    return TimeUtils::timePassed( lastSnapshotTime, TimeUtils::sampleMicro() ) >=
+           _intervalInMicroSeconds;
+}
+
+void StatisticsStream::writeSnapshot( const String &queryId, const Statistics &statistics )
+{
+    writeRecord( "snapshot",
+                 Stringf( "\"query_id\":\"%s\",\"statistics\":%s",
+                          escape( queryId ).ascii(),
+                          statistics.toJson().ascii() ) );
+}
+
+void StatisticsStream::writeDnCProgress( unsigned workerId,
+                                         const String &queryId,
+                                         const String &result,
+                                         int numUnsolvedSubQueries )
+{
+    writeRecord( "dnc_progress",
+                 Stringf( "\"worker\":%u,\"query_id\":\"%s\",\"result\":\"%s\",\"unsolved\":%d",
+                          workerId,
+                          escape( queryId ).ascii(),
+                          escape( result ).ascii(),
+                          numUnsolvedSubQueries ) );
+}
+
+void StatisticsStream::writeSummary( const String &result,
+                                     unsigned long long microSecondsElapsed,
+                                     const Statistics *statistics )
+{
+    String fields = Stringf(
+        "\"result\":\"%s\",\"elapsed_micro\":%llu", escape( result ).ascii(), microSecondsElapsed );
+    if ( statistics )
+        fields += Stringf( ",\"statistics\":%s", statistics->toJson().ascii() );
+
+    writeRecord( "summary", fields );
+}
+
+void StatisticsStream::writeRecord( const String &type, const String &fields )
+{
+    if ( !isOpen() )
+        return;
+
+    std::lock_guard<std::mutex> lock( _mutex );
+    if ( !isOpen() )
+        return;
+
+    String record = Stringf( "{\"type\":\"%s\",\"pid\":%d,\"time_micro\":%llu",
+                             type.ascii(),
+                             (int)getpid(),
+                             TimeUtils::timePassed( _openTime, TimeUtils::sampleMicro() ) );
+    if ( fields.length() > 0 )
+        record += String( "," ) + fields;
+    record += "}\n";
+
+    try
+    {
+        if ( _socket )
+            _socket->sendText( record );
+        else
+            _file->write( record );
+    }
+    catch ( const CommonError &e )
+    {
+        // A monitor that went away should not stop the solver
+        fprintf( stderr, "Statistics stream failed, streaming stopped: %s\n", e.getUserMessage() );
+        closeWithoutLocking();
+    }
+}
+
+String StatisticsStream::escape( const String &text )
+{
+    String escaped;
+    for ( unsigned i = 0; i < text.length(); ++i )
+    {
+        char c = text[i];
+        if ( c == '"' || c == '\\' )
+            escaped += Stringf( "\\%c", c );
+        else if ( (unsigned char)c < 0x20 )
+            escaped += Stringf( "\\u%04x", (unsigned)(unsigned char)c );
+        else
+            escaped += Stringf( "%c", c );
+    }
+    return escaped;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,108 @@
+/*********************                                                        */
+/*! \file StatisticsStream.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A machine-readable stream of the solver's progress, for monitoring many
+ ** runs at once. Every record is a single-line JSON object (JSON lines),
+ ** with a "type" field:
+ **
+ **   snapshot     - all the Statistics attributes of an engine, written
+ **                  periodically by the engine itself
+ **   dnc_progress - a DnC worker finished solving a subquery
+ **   summary      - the final result of the run
+ **
+ ** Each record also holds the process id and the time, in microseconds,
+ ** since the stream was opened. The destination is either a file or a Unix
+ ** domain socket ("unix:<path>") on which a monitor is listening.
+ **
+ ** The stream is shared by all threads. If the destination fails, an error
+ ** is printed and streaming stops, but solving goes on.
+
+ **/
+
+#ifndef __StatisticsStream_h__
+#define __StatisticsStream_h__
+
+#include "MString.h"
+#include "Statistics.h"
+#include "TimeUtils.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+class File;
+class Socket;
+
+class StatisticsStream
+{
+public:
+    /*
+      Start streaming into the destination, with a snapshot every
+      intervalInSeconds seconds
+    */
+    static void open( const String &destination, unsigned intervalInSeconds );
+    static void close();
+
+    static bool isOpen()
+    {
+        return _open.load( std::memory_order_relaxed );
+    }
+
+    /*
+      Whether a snapshot is due, given the time of the previous one
+    */
+    static bool isDue( const struct timespec &lastSnapshotTime );
+
+    static void writeSnapshot( const String &queryId, const Statistics &statistics );
+    static void writeDnCProgress( unsigned workerId,
+                                  const String &queryId,
+                                  const String &result,
+                                  int numUnsolvedSubQueries );
+
+    /*
+      The statistics are omitted if null (e.g., in DnC mode, where each
+      worker has its own)
+    */
+    static void writeSummary( const String &result,
+                              unsigned long long microSecondsElapsed,
+                              const Statistics *statistics );
+
+    /*
+      Write a record of the given type. The fields, if any, are a
+      comma-separated list of JSON members.
+    */
+    static void writeRecord( const String &type, const String &fields );
+
+    /*
+      Escape a string for use as a JSON string value
+    */
+    static String escape( const String &text );
+
+private:
+    static std::atomic_bool _open;
+    static std::mutex _mutex;
+    static std::unique_ptr<File> _file;
+    static std::unique_ptr<Socket> _socket;
+    static unsigned long long _intervalInMicroSeconds;
+    static struct timespec _openTime;
+
+    static void closeWithoutLocking();
+};
+
+#endif // __StatisticsStream_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
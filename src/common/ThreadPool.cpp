@@ -0,0 +1,156 @@
+/*********************                                                        */
+/*! \file ThreadPool.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+ThreadPool *ThreadPool::get()
+{
+    static ThreadPool pool;
+    return &pool;
+}
+
+ThreadPool::ThreadPool()
+    : _stopping( false )
+    , _numberOfThreads( 1 )
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+    std::lock_guard<std::mutex> resizeLock( _resizeMutex );
+    stopHelpers();
+}
+
+void ThreadPool::setNumberOfThreads( unsigned numberOfThreads )
+{
+    numberOfThreads = std::max( numberOfThreads, 1u );
+
+    std::lock_guard<std::mutex> resizeLock( _resizeMutex );
+    if ( numberOfThreads == _numberOfThreads )
+        return;
+
+    // Loops in progress are finished by their calling threads
+    stopHelpers();
+
+    _numberOfThreads = numberOfThreads;
+    for ( unsigned i = 1; i < numberOfThreads; ++i )
+        _helpers.push_back( std::thread( &ThreadPool::work, this ) );
+}
+
+unsigned ThreadPool::getNumberOfThreads() const
+{
+    return _numberOfThreads;
+}
+
+void ThreadPool::parallelFor( unsigned size, unsigned minRangeSize, const RangeFunction &function )
+{
+    unsigned numberOfRanges =
+        std::min<unsigned>( _numberOfThreads, size / std::max( minRangeSize, 1u ) );
+    if ( numberOfRanges <= 1 )
+    {
+        if ( size > 0 )
+            function( 0, size );
+        return;
+    }
+
+    Job job;
+    job._function = &function;
+    job._size = size;
+    job._numberOfRanges = numberOfRanges;
+    job._nextRange = 0;
+    job._finishedRanges = 0;
+
+    std::unique_lock<std::mutex> lock( _mutex );
+    _jobs.append( &job );
+    _jobAvailable.notify_all();
+
+    runRanges( job, lock );
+    _jobFinished.wait( lock, [&job] { return job._finishedRanges == job._numberOfRanges; } );
+    lock.unlock();
+
+    if ( job._exception )
+        std::rethrow_exception( job._exception );
+}
+
+void ThreadPool::work()
+{
+    std::unique_lock<std::mutex> lock( _mutex );
+    while ( true )
+    {
+        _jobAvailable.wait( lock, [this] { return _stopping || !_jobs.empty(); } );
+        if ( _stopping )
+            return;
+
+        runRanges( *_jobs.front(), lock );
+    }
+}
+
+void ThreadPool::runRanges( Job &job, std::unique_lock<std::mutex> &lock )
+{
+    while ( job._nextRange < job._numberOfRanges )
+    {
+        unsigned range = job._nextRange++;
+        if ( job._nextRange == job._numberOfRanges )
+            _jobs.erase( &job );
+
+        unsigned long long size = job._size;
+        unsigned begin = size * range / job._numberOfRanges;
+        unsigned end = size * ( range + 1 ) / job._numberOfRanges;
+
+        lock.unlock();
+        std::exception_ptr exception;
+        try
+        {
+            ( *job._function )( begin, end );
+        }
+        catch ( ... )
+        {
+            exception = std::current_exception();
+        }
+        lock.lock();
+
+        if ( exception && !job._exception )
+            job._exception = exception;
+
+        if ( ++job._finishedRanges == job._numberOfRanges )
+            _jobFinished.notify_all();
+    }
+}
+
+void ThreadPool::stopHelpers()
+{
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _stopping = true;
+    }
+    _jobAvailable.notify_all();
+
+    for ( auto &helper : _helpers )
+        helper.join();
+    _helpers.clear();
+
+    std::lock_guard<std::mutex> lock( _mutex );
+    _stopping = false;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
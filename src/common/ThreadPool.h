@@ -0,0 +1,117 @@
+/*********************                                                        */
+/*! \file ThreadPool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A pool of threads for data-parallel loops. A loop is split into
+ ** ranges, which the calling thread and the helper threads of the pool
+ ** claim one at a time. Since the calling thread keeps claiming ranges of
+ ** its own loop until none are left, a loop completes even if all helpers
+ ** are busy with the loops of other threads, and the helpers can be shared
+ ** by several threads, such as the workers of the DnC mode.
+ **
+ ** The helper threads do not run with the options of the calling thread,
+ ** so the loops should not depend on them.
+
+ **/
+
+#ifndef __ThreadPool_h__
+#define __ThreadPool_h__
+
+#include "List.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+    typedef std::function<void( unsigned begin, unsigned end )> RangeFunction;
+
+    /*
+      The pool shared by the whole process
+    */
+    static ThreadPool *get();
+
+    ThreadPool();
+    ~ThreadPool();
+
+    /*
+      Set the number of threads that work on each loop, including the
+      calling thread. The pool keeps one helper thread fewer than that,
+      shared by all the threads calling parallelFor().
+    */
+    void setNumberOfThreads( unsigned numberOfThreads );
+    unsigned getNumberOfThreads() const;
+
+    /*
+      Call function( begin, end ) on disjoint ranges that cover
+      [0, size), and return once all calls have returned. There are at
+      most as many ranges as threads, and each holds at least minRangeSize
+      elements, unless there is only one. If any of the calls throws, the
+      first exception is rethrown once all ranges are done.
+    */
+    void parallelFor( unsigned size, unsigned minRangeSize, const RangeFunction &function );
+
+private:
+    struct Job
+    {
+        const RangeFunction *_function;
+        unsigned _size;
+        unsigned _numberOfRanges;
+        unsigned _nextRange;
+        unsigned _finishedRanges;
+        std::exception_ptr _exception;
+    };
+
+    /*
+      Guards the jobs, their ranges and the helper threads' stopping flag
+    */
+    std::mutex _mutex;
+    std::condition_variable _jobAvailable;
+    std::condition_variable _jobFinished;
+
+    /*
+      Jobs that have ranges no thread claimed yet
+    */
+    List<Job *> _jobs;
+    bool _stopping;
+
+    /*
+      Serializes changes to the number of threads
+    */
+    std::mutex _resizeMutex;
+    std::vector<std::thread> _helpers;
+    std::atomic_uint _numberOfThreads;
+
+    void work();
+
+    /*
+      Claim the ranges of the job, one at a time, until none are left.
+      The mutex is held when called, and when returning.
+    */
+    void runRanges( Job &job, std::unique_lock<std::mutex> &lock );
+
+    void stopHelpers();
+};
+
+#endif // __ThreadPool_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
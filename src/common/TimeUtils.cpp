@@ -56,6 +56,17 @@ unsigned long long TimeUtils::timePassed( const struct timespec &then, const str
     return secondsAsMicro + nanoAsMicro;
 }
 
+unsigned long long TimeUtils::timePassedInNanoSeconds( const struct timespec &then,
+                                                      const struct timespec &now )
+{
+    enum {
+        NANOSECONDS_IN_SECOND = 1000000000,
+    };
+
+    return ( now.tv_sec - then.tv_sec ) * (unsigned long long)NANOSECONDS_IN_SECOND +
+           ( now.tv_nsec - then.tv_nsec );
+}
+
 String TimeUtils::now()
 {
     time_t secondsSinceEpoch = time( NULL );
@@ -33,6 +33,8 @@ class TimeUtils
 public:
     static struct timespec sampleMicro();
     static unsigned long long timePassed( const struct timespec &then, const struct timespec &now );
+    static unsigned long long timePassedInNanoSeconds( const struct timespec &then,
+                                                       const struct timespec &now );
     static String now();
 };
 
@@ -0,0 +1,315 @@
+/*********************                                                        */
+/*! \file Tracer.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "Tracer.h"
+
+#include "Debug.h"
+#include "File.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+
+#include <algorithm>
+
+std::atomic_bool Tracer::_enabled( false );
+struct timespec Tracer::_epoch = TimeUtils::sampleMicro();
+std::mutex Tracer::_mutex;
+List<Tracer::ThreadBuffer *> Tracer::_buffers;
+unsigned Tracer::_nextThreadId = 0;
+
+/*
+  Owns the thread's pointer to its buffer, and hands the buffer back to the
+  Tracer when the thread exits
+*/
+struct ThreadBufferHandle
+{
+    ThreadBufferHandle()
+        : _buffer( NULL )
+    {
+    }
+
+    ~ThreadBufferHandle()
+    {
+        if ( _buffer )
+            Tracer::detach( _buffer );
+    }
+
+    Tracer::ThreadBuffer *_buffer;
+};
+
+static thread_local ThreadBufferHandle threadBufferHandle;
+static thread_local unsigned threadDecisionLevel = 0;
+
+void Tracer::setEnabled( bool enabled )
+{
+    if ( enabled && !isEnabled() )
+    {
+        clear();
+        _epoch = TimeUtils::sampleMicro();
+    }
+
+    _enabled.store( enabled );
+}
+
+void Tracer::setDecisionLevel( unsigned level )
+{
+    threadDecisionLevel = level;
+}
+
+unsigned Tracer::getDecisionLevel()
+{
+    return threadDecisionLevel;
+}
+
+Tracer::ThreadBuffer *Tracer::getThreadBuffer()
+{
+    if ( !threadBufferHandle._buffer )
+    {
+        ThreadBuffer *buffer = new ThreadBuffer;
+        buffer->_events.resize( GlobalConfiguration::TRACE_BUFFER_CAPACITY );
+        buffer->_next = 0;
+        buffer->_numRecorded = 0;
+        buffer->_detached = false;
+
+        std::lock_guard<std::mutex> lock( _mutex );
+        buffer->_threadId = _nextThreadId++;
+        _buffers.append( buffer );
+        threadBufferHandle._buffer = buffer;
+    }
+
+    return threadBufferHandle._buffer;
+}
+
+void Tracer::detach( ThreadBuffer *buffer )
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    buffer->_detached = true;
+}
+
+void Tracer::record( const char *name, const struct timespec &start, unsigned decisionLevel )
+{
+    struct timespec end = TimeUtils::sampleMicro();
+    ThreadBuffer *buffer = getThreadBuffer();
+
+    Event &event = buffer->_events[buffer->_next];
+    event._name = name;
+    event._start = TimeUtils::timePassedInNanoSeconds( _epoch, start );
+    event._duration = TimeUtils::timePassedInNanoSeconds( start, end );
+    event._decisionLevel = decisionLevel;
+
+    if ( ++buffer->_next == buffer->_events.size() )
+        buffer->_next = 0;
+    ++buffer->_numRecorded;
+}
+
+void Tracer::clear()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    List<ThreadBuffer *> liveBuffers;
+    for ( const auto &buffer : _buffers )
+    {
+        if ( buffer->_detached )
+            delete buffer;
+        else
+        {
+            buffer->_next = 0;
+            buffer->_numRecorded = 0;
+            liveBuffers.append( buffer );
+        }
+    }
+    _buffers = liveBuffers;
+}
+
+void Tracer::nestEvents( const ThreadBuffer &buffer,
+                         std::vector<Event> &events,
+                         std::vector<NestedEvent> &nested )
+{
+    // Collect the events that are still in the ring buffer
+    unsigned capacity = buffer._events.size();
+    if ( buffer._numRecorded < capacity )
+        events.assign( buffer._events.begin(), buffer._events.begin() + buffer._next );
+    else
+    {
+        events.assign( buffer._events.begin() + buffer._next, buffer._events.end() );
+        events.insert(
+            events.end(), buffer._events.begin(), buffer._events.begin() + buffer._next );
+    }
+
+    // A span starts before, and ends after, the spans it contains. Upon
+    // equal starts the longer span is the outer one.
+    std::sort( events.begin(), events.end(), []( const Event &a, const Event &b ) {
+        if ( a._start != b._start )
+            return a._start < b._start;
+        return a._duration > b._duration;
+    } );
+
+    nested.clear();
+    std::vector<unsigned> stack;
+    for ( unsigned i = 0; i < events.size(); ++i )
+    {
+        const Event &event = events[i];
+        while ( !stack.empty() )
+        {
+            const Event &top = events[stack.back()];
+            if ( event._start + event._duration <= top._start + top._duration )
+                break;
+            stack.pop_back();
+        }
+
+        NestedEvent nestedEvent;
+        nestedEvent._event = &event;
+        nestedEvent._parent = stack.empty() ? -1 : (int)stack.back();
+        nestedEvent._selfTime = event._duration;
+        nested.push_back( nestedEvent );
+
+        if ( nestedEvent._parent >= 0 )
+        {
+            NestedEvent &parent = nested[nestedEvent._parent];
+            parent._selfTime -= std::min( parent._selfTime, event._duration );
+        }
+
+        stack.push_back( i );
+    }
+}
+
+String Tracer::exportChromeTrace()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    String output = "{\"traceEvents\":[\n";
+    bool first = true;
+    for ( const auto &buffer : _buffers )
+    {
+        std::vector<Event> events;
+        std::vector<NestedEvent> nested;
+        nestEvents( *buffer, events, nested );
+
+        for ( const auto &event : events )
+        {
+            if ( !first )
+                output += ",\n";
+            first = false;
+
+            // Chrome traces are in microseconds
+            output += Stringf( "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                               "\"ts\":%.3lf,\"dur\":%.3lf,\"args\":{\"level\":%u}}",
+                               event._name,
+                               buffer->_threadId,
+                               event._start / 1000.0,
+                               event._duration / 1000.0,
+                               event._decisionLevel );
+        }
+    }
+    output += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return output;
+}
+
+String Tracer::exportFoldedStacks()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    Map<String, unsigned long long> stackToTime;
+    for ( const auto &buffer : _buffers )
+    {
+        std::vector<Event> events;
+        std::vector<NestedEvent> nested;
+        nestEvents( *buffer, events, nested );
+
+        std::vector<String> paths( nested.size() );
+        for ( unsigned i = 0; i < nested.size(); ++i )
+        {
+            // Parents precede their children
+            int parent = nested[i]._parent;
+            paths[i] = ( parent < 0 ? String( "" ) : paths[parent] + ";" ) +
+                       String( nested[i]._event->_name );
+
+            if ( !stackToTime.exists( paths[i] ) )
+                stackToTime[paths[i]] = 0;
+            stackToTime[paths[i]] += nested[i]._selfTime;
+        }
+    }
+
+    // The weights are in microseconds
+    String output;
+    for ( const auto &entry : stackToTime )
+    {
+        if ( entry.second >= 1000 )
+            output += Stringf( "%s %llu\n", entry.first.ascii(), entry.second / 1000 );
+    }
+
+    return output;
+}
+
+Map<unsigned, unsigned long long> Tracer::computeDecisionLevelHistogram()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    Map<unsigned, unsigned long long> histogram;
+    for ( const auto &buffer : _buffers )
+    {
+        std::vector<Event> events;
+        std::vector<NestedEvent> nested;
+        nestEvents( *buffer, events, nested );
+
+        for ( const auto &nestedEvent : nested )
+        {
+            unsigned level = nestedEvent._event->_decisionLevel;
+            if ( !histogram.exists( level ) )
+                histogram[level] = 0;
+            histogram[level] += nestedEvent._selfTime;
+        }
+    }
+
+    return histogram;
+}
+
+void Tracer::printDecisionLevelHistogram()
+{
+    Map<unsigned, unsigned long long> histogram = computeDecisionLevelHistogram();
+
+    unsigned long long total = 0;
+    for ( const auto &entry : histogram )
+        total += entry.second;
+
+    printf( "Traced time per decision level:\n" );
+    for ( const auto &entry : histogram )
+        printf( "\tLevel %4u: %10.3lf milli (%5.2lf%%)\n",
+                entry.first,
+                entry.second / 1000000.0,
+                total == 0 ? 0 : 100.0 * entry.second / total );
+}
+
+void Tracer::writeChromeTrace( const String &path )
+{
+    File file( path );
+    file.open( File::MODE_WRITE_TRUNCATE );
+    file.write( exportChromeTrace() );
+}
+
+void Tracer::writeFoldedStacks( const String &path )
+{
+    File file( path );
+    file.open( File::MODE_WRITE_TRUNCATE );
+    file.write( exportFoldedStacks() );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
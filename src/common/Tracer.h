@@ -0,0 +1,191 @@
+/*********************                                                        */
+/*! \file Tracer.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Scoped tracing of the hot paths of the solver. Whereas Statistics only
+ ** accumulates total times, the Tracer records every span (one call of an
+ ** instrumented method), together with the SMT decision level at which it
+ ** started. Spans are recorded into a per-thread ring buffer, so recording
+ ** takes no locks, and only the most recent spans are kept.
+ **
+ ** The recorded spans can be exported as a Chrome trace (for
+ ** chrome://tracing or Perfetto), as folded stacks (for flamegraph.pl), or
+ ** summarized as a histogram of the time spent at each decision level.
+ **
+ ** Tracing is off by default and can be toggled at runtime. When it is
+ ** off, a span costs a single relaxed atomic load.
+
+ **/
+
+#ifndef __Tracer_h__
+#define __Tracer_h__
+
+#include "List.h"
+#include "MString.h"
+#include "Map.h"
+#include "TimeUtils.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+class Tracer
+{
+public:
+    struct Event
+    {
+        /*
+          Span names are string literals, and are never copied
+        */
+        const char *_name;
+
+        /*
+          In nanoseconds, the start relative to the moment tracing was
+          enabled
+        */
+        unsigned long long _start;
+        unsigned long long _duration;
+
+        unsigned _decisionLevel;
+    };
+
+    /*
+      Turn tracing on or off. Turning it on discards previously recorded
+      spans, and must not happen while other threads are recording.
+    */
+    static void setEnabled( bool enabled );
+
+    static bool isEnabled()
+    {
+        return _enabled.load( std::memory_order_relaxed );
+    }
+
+    /*
+      The current decision level of the SmtCore running on this thread
+    */
+    static void setDecisionLevel( unsigned level );
+    static unsigned getDecisionLevel();
+
+    /*
+      Record a span that ended just now on this thread
+    */
+    static void record( const char *name, const struct timespec &start, unsigned decisionLevel );
+
+    /*
+      Discard all recorded spans
+    */
+    static void clear();
+
+    /*
+      Export the recorded spans. The spans of all threads are merged in the
+      folded stacks and in the histogram, as the threads of the
+      split-and-conquer mode all run the same code. These must not be
+      called while other threads are recording.
+    */
+    static String exportChromeTrace();
+    static String exportFoldedStacks();
+    static void writeChromeTrace( const String &path );
+    static void writeFoldedStacks( const String &path );
+
+    /*
+      The time, in nanoseconds, spent in spans at each decision level. The
+      time of a span that contains other spans is only counted for its own
+      part.
+    */
+    static Map<unsigned, unsigned long long> computeDecisionLevelHistogram();
+    static void printDecisionLevelHistogram();
+
+private:
+    struct ThreadBuffer
+    {
+        unsigned _threadId;
+        std::vector<Event> _events;
+
+        /*
+          The position of the next event, and the number of events
+          recorded since the last clear. Once the buffer is full, the
+          oldest events are overwritten.
+        */
+        unsigned _next;
+        unsigned long long _numRecorded;
+
+        /*
+          Set once the thread exits. Detached buffers are kept for the
+          export, and are freed upon the next clear.
+        */
+        bool _detached;
+    };
+
+    friend struct ThreadBufferHandle;
+
+    static std::atomic_bool _enabled;
+    static struct timespec _epoch;
+
+    static std::mutex _mutex;
+    static List<ThreadBuffer *> _buffers;
+    static unsigned _nextThreadId;
+
+    static ThreadBuffer *getThreadBuffer();
+    static void detach( ThreadBuffer *buffer );
+
+    /*
+      The events of a buffer sorted by their start, with each event's
+      parent (or -1 for top-level events) and its own (exclusive) time
+    */
+    struct NestedEvent
+    {
+        const Event *_event;
+        int _parent;
+        unsigned long long _selfTime;
+    };
+    static void nestEvents( const ThreadBuffer &buffer,
+                            std::vector<Event> &events,
+                            std::vector<NestedEvent> &nested );
+};
+
+/*
+  RAII span: records the time from its construction to its destruction
+*/
+class TraceSpan
+{
+public:
+    explicit TraceSpan( const char *name )
+        : _name( name )
+        , _active( Tracer::isEnabled() )
+    {
+        if ( _active )
+        {
+            _decisionLevel = Tracer::getDecisionLevel();
+            _start = TimeUtils::sampleMicro();
+        }
+    }
+
+    ~TraceSpan()
+    {
+        if ( _active )
+            Tracer::record( _name, _start, _decisionLevel );
+    }
+
+private:
+    const char *_name;
+    bool _active;
+    unsigned _decisionLevel;
+    struct timespec _start;
+};
+
+#endif // __Tracer_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
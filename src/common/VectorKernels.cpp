@@ -0,0 +1,375 @@
+/*********************                                                        */
+/*! \file VectorKernels.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+// Fused multiply-adds would make the results depend on the instruction set
+#if defined( __clang__ )
+#pragma STDC FP_CONTRACT OFF
+#elif defined( __GNUC__ )
+#pragma GCC optimize( "fp-contract=off" )
+#endif
+
+#include "VectorKernels.h"
+
+#if defined( ENABLE_SIMD ) && defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define VECTOR_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+/*
+  The number of partial sums that dot() accumulates into: one AVX-512
+  register, or two AVX2 registers
+*/
+static const unsigned NUM_PARTIAL_SUMS = 8;
+
+static double reducePartialSums( const double *sums )
+{
+    return ( ( sums[0] + sums[1] ) + ( sums[2] + sums[3] ) ) +
+           ( ( sums[4] + sums[5] ) + ( sums[6] + sums[7] ) );
+}
+
+static double absoluteValue( double x )
+{
+    return x < 0 ? -x : x;
+}
+
+/*
+  Scalar versions
+*/
+
+static void axpyScalar( double alpha, const double *x, double *y, unsigned n )
+{
+    for ( unsigned i = 0; i < n; ++i )
+        y[i] += alpha * x[i];
+}
+
+static void
+maskedAxpyScalar( double alpha, const double *x, double *y, unsigned n, double epsilon )
+{
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        if ( absoluteValue( x[i] ) > epsilon )
+            y[i] += alpha * x[i];
+    }
+}
+
+static double dotScalar( const double *x, const double *y, unsigned n )
+{
+    double sums[NUM_PARTIAL_SUMS] = { 0 };
+
+    unsigned i = 0;
+    for ( ; i + NUM_PARTIAL_SUMS <= n; i += NUM_PARTIAL_SUMS )
+    {
+        for ( unsigned j = 0; j < NUM_PARTIAL_SUMS; ++j )
+            sums[j] += x[i + j] * y[i + j];
+    }
+
+    double result = reducePartialSums( sums );
+    for ( ; i < n; ++i )
+        result += x[i] * y[i];
+
+    return result;
+}
+
+static unsigned countNonZerosScalar( const double *x, unsigned n, double epsilon )
+{
+    unsigned count = 0;
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        if ( absoluteValue( x[i] ) > epsilon )
+            ++count;
+    }
+    return count;
+}
+
+#ifdef VECTOR_KERNELS_X86
+
+/*
+  AVX2 versions
+*/
+
+__attribute__( ( target( "avx2" ) ) ) static void
+axpyAvx2( double alpha, const double *x, double *y, unsigned n )
+{
+    __m256d alphas = _mm256_set1_pd( alpha );
+
+    unsigned i = 0;
+    for ( ; i + 4 <= n; i += 4 )
+    {
+        __m256d products = _mm256_mul_pd( alphas, _mm256_loadu_pd( x + i ) );
+        _mm256_storeu_pd( y + i, _mm256_add_pd( _mm256_loadu_pd( y + i ), products ) );
+    }
+
+    for ( ; i < n; ++i )
+        y[i] += alpha * x[i];
+}
+
+__attribute__( ( target( "avx2" ) ) ) static __m256d absoluteValueAvx2( __m256d x )
+{
+    return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), x );
+}
+
+__attribute__( ( target( "avx2" ) ) ) static void
+maskedAxpyAvx2( double alpha, const double *x, double *y, unsigned n, double epsilon )
+{
+    __m256d alphas = _mm256_set1_pd( alpha );
+    __m256d epsilons = _mm256_set1_pd( epsilon );
+
+    unsigned i = 0;
+    for ( ; i + 4 <= n; i += 4 )
+    {
+        __m256d xs = _mm256_loadu_pd( x + i );
+        __m256d mask = _mm256_cmp_pd( absoluteValueAvx2( xs ), epsilons, _CMP_GT_OQ );
+        if ( _mm256_movemask_pd( mask ) == 0 )
+            continue;
+
+        __m256d ys = _mm256_loadu_pd( y + i );
+        __m256d sums = _mm256_add_pd( ys, _mm256_mul_pd( alphas, xs ) );
+        _mm256_storeu_pd( y + i, _mm256_blendv_pd( ys, sums, mask ) );
+    }
+
+    maskedAxpyScalar( alpha, x + i, y + i, n - i, epsilon );
+}
+
+__attribute__( ( target( "avx2" ) ) ) static double
+dotAvx2( const double *x, const double *y, unsigned n )
+{
+    __m256d lowSums = _mm256_setzero_pd();
+    __m256d highSums = _mm256_setzero_pd();
+
+    unsigned i = 0;
+    for ( ; i + NUM_PARTIAL_SUMS <= n; i += NUM_PARTIAL_SUMS )
+    {
+        lowSums = _mm256_add_pd(
+            lowSums, _mm256_mul_pd( _mm256_loadu_pd( x + i ), _mm256_loadu_pd( y + i ) ) );
+        highSums = _mm256_add_pd(
+            highSums,
+            _mm256_mul_pd( _mm256_loadu_pd( x + i + 4 ), _mm256_loadu_pd( y + i + 4 ) ) );
+    }
+
+    double sums[NUM_PARTIAL_SUMS];
+    _mm256_storeu_pd( sums, lowSums );
+    _mm256_storeu_pd( sums + 4, highSums );
+
+    double result = reducePartialSums( sums );
+    for ( ; i < n; ++i )
+        result += x[i] * y[i];
+
+    return result;
+}
+
+__attribute__( ( target( "avx2,popcnt" ) ) ) static unsigned
+countNonZerosAvx2( const double *x, unsigned n, double epsilon )
+{
+    __m256d epsilons = _mm256_set1_pd( epsilon );
+
+    unsigned count = 0;
+    unsigned i = 0;
+    for ( ; i + 4 <= n; i += 4 )
+    {
+        __m256d mask =
+            _mm256_cmp_pd( absoluteValueAvx2( _mm256_loadu_pd( x + i ) ), epsilons, _CMP_GT_OQ );
+        count += __builtin_popcount( _mm256_movemask_pd( mask ) );
+    }
+
+    return count + countNonZerosScalar( x + i, n - i, epsilon );
+}
+
+/*
+  AVX-512 versions
+*/
+
+__attribute__( ( target( "avx512f" ) ) ) static void
+axpyAvx512( double alpha, const double *x, double *y, unsigned n )
+{
+    __m512d alphas = _mm512_set1_pd( alpha );
+
+    unsigned i = 0;
+    for ( ; i + 8 <= n; i += 8 )
+    {
+        __m512d products = _mm512_mul_pd( alphas, _mm512_loadu_pd( x + i ) );
+        _mm512_storeu_pd( y + i, _mm512_add_pd( _mm512_loadu_pd( y + i ), products ) );
+    }
+
+    // The remainder is handled with a partial mask
+    if ( i < n )
+    {
+        __mmask8 tail = (__mmask8)( ( 1u << ( n - i ) ) - 1 );
+        __m512d products = _mm512_mul_pd( alphas, _mm512_maskz_loadu_pd( tail, x + i ) );
+        __m512d ys = _mm512_maskz_loadu_pd( tail, y + i );
+        _mm512_mask_storeu_pd( y + i, tail, _mm512_add_pd( ys, products ) );
+    }
+}
+
+__attribute__( ( target( "avx512f" ) ) ) static void
+maskedAxpyAvx512( double alpha, const double *x, double *y, unsigned n, double epsilon )
+{
+    __m512d alphas = _mm512_set1_pd( alpha );
+    __m512d epsilons = _mm512_set1_pd( epsilon );
+
+    for ( unsigned i = 0; i < n; i += 8 )
+    {
+        __mmask8 tail = ( n - i >= 8 ) ? (__mmask8)0xFF : (__mmask8)( ( 1u << ( n - i ) ) - 1 );
+        __m512d xs = _mm512_maskz_loadu_pd( tail, x + i );
+        __mmask8 mask = _mm512_mask_cmp_pd_mask( tail, _mm512_abs_pd( xs ), epsilons, _CMP_GT_OQ );
+        if ( mask == 0 )
+            continue;
+
+        __m512d ys = _mm512_maskz_loadu_pd( mask, y + i );
+        _mm512_mask_storeu_pd( y + i, mask, _mm512_add_pd( ys, _mm512_mul_pd( alphas, xs ) ) );
+    }
+}
+
+__attribute__( ( target( "avx512f" ) ) ) static double
+dotAvx512( const double *x, const double *y, unsigned n )
+{
+    __m512d partialSums = _mm512_setzero_pd();
+
+    unsigned i = 0;
+    for ( ; i + NUM_PARTIAL_SUMS <= n; i += NUM_PARTIAL_SUMS )
+        partialSums = _mm512_add_pd(
+            partialSums, _mm512_mul_pd( _mm512_loadu_pd( x + i ), _mm512_loadu_pd( y + i ) ) );
+
+    double sums[NUM_PARTIAL_SUMS];
+    _mm512_storeu_pd( sums, partialSums );
+
+    double result = reducePartialSums( sums );
+    for ( ; i < n; ++i )
+        result += x[i] * y[i];
+
+    return result;
+}
+
+__attribute__( ( target( "avx512f,popcnt" ) ) ) static unsigned
+countNonZerosAvx512( const double *x, unsigned n, double epsilon )
+{
+    __m512d epsilons = _mm512_set1_pd( epsilon );
+
+    unsigned count = 0;
+    for ( unsigned i = 0; i < n; i += 8 )
+    {
+        __mmask8 tail = ( n - i >= 8 ) ? (__mmask8)0xFF : (__mmask8)( ( 1u << ( n - i ) ) - 1 );
+        __m512d xs = _mm512_maskz_loadu_pd( tail, x + i );
+        count += __builtin_popcount(
+            _mm512_mask_cmp_pd_mask( tail, _mm512_abs_pd( xs ), epsilons, _CMP_GT_OQ ) );
+    }
+
+    return count;
+}
+
+#endif // VECTOR_KERNELS_X86
+
+/*
+  Dispatch
+*/
+
+static VectorKernels::InstructionSet detectInstructionSet()
+{
+#ifdef VECTOR_KERNELS_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "avx512f" ) )
+        return VectorKernels::AVX512;
+    if ( __builtin_cpu_supports( "avx2" ) )
+        return VectorKernels::AVX2;
+#endif
+    return VectorKernels::SCALAR;
+}
+
+static const VectorKernels::InstructionSet widestInstructionSet = detectInstructionSet();
+static VectorKernels::InstructionSet currentInstructionSet = widestInstructionSet;
+
+void VectorKernels::axpy( double alpha, const double *x, double *y, unsigned n )
+{
+#ifdef VECTOR_KERNELS_X86
+    if ( currentInstructionSet == AVX512 )
+        return axpyAvx512( alpha, x, y, n );
+    if ( currentInstructionSet == AVX2 )
+        return axpyAvx2( alpha, x, y, n );
+#endif
+    axpyScalar( alpha, x, y, n );
+}
+
+void VectorKernels::maskedAxpy( double alpha,
+                                const double *x,
+                                double *y,
+                                unsigned n,
+                                double epsilon )
+{
+#ifdef VECTOR_KERNELS_X86
+    if ( currentInstructionSet == AVX512 )
+        return maskedAxpyAvx512( alpha, x, y, n, epsilon );
+    if ( currentInstructionSet == AVX2 )
+        return maskedAxpyAvx2( alpha, x, y, n, epsilon );
+#endif
+    maskedAxpyScalar( alpha, x, y, n, epsilon );
+}
+
+double VectorKernels::dot( const double *x, const double *y, unsigned n )
+{
+#ifdef VECTOR_KERNELS_X86
+    if ( currentInstructionSet == AVX512 )
+        return dotAvx512( x, y, n );
+    if ( currentInstructionSet == AVX2 )
+        return dotAvx2( x, y, n );
+#endif
+    return dotScalar( x, y, n );
+}
+
+unsigned VectorKernels::countNonZeros( const double *x, unsigned n, double epsilon )
+{
+#ifdef VECTOR_KERNELS_X86
+    if ( currentInstructionSet == AVX512 )
+        return countNonZerosAvx512( x, n, epsilon );
+    if ( currentInstructionSet == AVX2 )
+        return countNonZerosAvx2( x, n, epsilon );
+#endif
+    return countNonZerosScalar( x, n, epsilon );
+}
+
+VectorKernels::InstructionSet VectorKernels::getInstructionSet()
+{
+    return currentInstructionSet;
+}
+
+void VectorKernels::setInstructionSet( InstructionSet instructionSet )
+{
+    currentInstructionSet =
+        ( instructionSet > widestInstructionSet ) ? widestInstructionSet : instructionSet;
+}
+
+bool VectorKernels::isSupported( InstructionSet instructionSet )
+{
+    return instructionSet <= widestInstructionSet;
+}
+
+const char *VectorKernels::instructionSetName( InstructionSet instructionSet )
+{
+    switch ( instructionSet )
+    {
+    case AVX512:
+        return "AVX-512";
+    case AVX2:
+        return "AVX2";
+    default:
+        return "scalar";
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
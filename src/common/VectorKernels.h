@@ -0,0 +1,76 @@
+/*********************                                                        */
+/*! \file VectorKernels.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Kernels for the dense vector operations on the hot paths of the
+ ** tableau. On x86-64 each kernel has an AVX2 and an AVX-512 version, and
+ ** the widest one supported by the CPU is picked at runtime; elsewhere, or
+ ** when built without ENABLE_SIMD, only the scalar version exists.
+ **
+ ** All versions compute bitwise identical results: products and sums are
+ ** never fused, and dot() accumulates into the same eight partial sums,
+ ** in the same order, regardless of the instruction set.
+
+ **/
+
+#ifndef __VectorKernels_h__
+#define __VectorKernels_h__
+
+class VectorKernels
+{
+public:
+    enum InstructionSet {
+        SCALAR = 0,
+        AVX2 = 1,
+        AVX512 = 2,
+    };
+
+    /*
+      y += alpha * x
+    */
+    static void axpy( double alpha, const double *x, double *y, unsigned n );
+
+    /*
+      y += alpha * x, only for the entries in which x is not zero
+      according to FloatUtils::isZero( x[i], epsilon )
+    */
+    static void maskedAxpy( double alpha, const double *x, double *y, unsigned n, double epsilon );
+
+    /*
+      The inner product of x and y
+    */
+    static double dot( const double *x, const double *y, unsigned n );
+
+    /*
+      The number of entries of x whose absolute value exceeds epsilon.
+      With epsilon = 0, the number of non-zero entries.
+    */
+    static unsigned countNonZeros( const double *x, unsigned n, double epsilon = 0 );
+
+    /*
+      The instruction set in use. By default, the widest one supported by
+      the CPU. Setting an instruction set that is not supported falls back
+      to the widest supported one below it.
+    */
+    static InstructionSet getInstructionSet();
+    static void setInstructionSet( InstructionSet instructionSet );
+    static bool isSupported( InstructionSet instructionSet );
+    static const char *instructionSetName( InstructionSet instructionSet );
+};
+
+#endif // __VectorKernels_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
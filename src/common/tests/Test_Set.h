@@ -193,6 +193,31 @@ public:
         TS_ASSERT_THROWS_NOTHING( set.erase( 5 ) );
     }
 
+    void test_replace()
+    {
+        Set<int> set;
+
+        set.insert( 1 );
+        set.insert( 2 );
+        set.insert( 3 );
+
+        TS_ASSERT_THROWS_NOTHING( set.replace( 2, 5 ) );
+        TS_ASSERT_EQUALS( set.size(), 3U );
+        TS_ASSERT( !set.exists( 2 ) );
+        TS_ASSERT( set.exists( 5 ) );
+
+        // Replacing with an existing value only erases
+        TS_ASSERT_THROWS_NOTHING( set.replace( 1, 3 ) );
+        TS_ASSERT_EQUALS( set.size(), 2U );
+        TS_ASSERT( !set.exists( 1 ) );
+        TS_ASSERT( set.exists( 3 ) );
+
+        // Replacing a missing value only inserts
+        TS_ASSERT_THROWS_NOTHING( set.replace( 7, 8 ) );
+        TS_ASSERT_EQUALS( set.size(), 3U );
+        TS_ASSERT( set.exists( 8 ) );
+    }
+
     void test_find()
     {
         Set<int> set;
@@ -0,0 +1,109 @@
+/*********************                                                        */
+/*! \file Test_StatisticsStream.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "CommonError.h"
+#include "File.h"
+#include "Statistics.h"
+#include "StatisticsStream.h"
+
+#include <cstdio>
+#include <cxxtest/TestSuite.h>
+
+const String STATISTICS_STREAM_TEST_FILE( "StatisticsStreamTest.jsonl" );
+
+class StatisticsStreamTestSuite : public CxxTest::TestSuite
+{
+public:
+    void tearDown()
+    {
+        StatisticsStream::close();
+        std::remove( STATISTICS_STREAM_TEST_FILE.ascii() );
+    }
+
+    List<String> readLines()
+    {
+        List<String> lines;
+        File file( STATISTICS_STREAM_TEST_FILE );
+        file.open( File::MODE_READ );
+        try
+        {
+            while ( true )
+                lines.append( file.readLine() );
+        }
+        catch ( const CommonError & )
+        {
+        }
+        return lines;
+    }
+
+    void test_closed_stream_writes_nothing()
+    {
+        TS_ASSERT( !StatisticsStream::isOpen() );
+        TS_ASSERT_THROWS_NOTHING( StatisticsStream::writeRecord( "snapshot", "" ) );
+        TS_ASSERT( !File::exists( STATISTICS_STREAM_TEST_FILE ) );
+    }
+
+    void test_records()
+    {
+        StatisticsStream::open( STATISTICS_STREAM_TEST_FILE, 10 );
+        TS_ASSERT( StatisticsStream::isOpen() );
+
+        Statistics statistics;
+        statistics.stampStartingTime();
+        statistics.setUnsignedAttribute( Statistics::NUM_SPLITS, 7 );
+        statistics.setLongAttribute( Statistics::NUM_SIMPLEX_STEPS, 1234 );
+        statistics.setDoubleAttribute( Statistics::MAX_DEGRADATION, 0.5 );
+
+        StatisticsStream::writeSnapshot( "1-2", statistics );
+        StatisticsStream::writeDnCProgress( 3, "1-2", "UNSAT", 5 );
+        StatisticsStream::writeSummary( "unsat", 42, &statistics );
+        StatisticsStream::close();
+
+        List<String> lines = readLines();
+        TS_ASSERT_EQUALS( lines.size(), 3U );
+
+        auto line = lines.begin();
+        TS_ASSERT( line->contains( "{\"type\":\"snapshot\",\"pid\":" ) );
+        TS_ASSERT( line->contains( "\"query_id\":\"1-2\"" ) );
+        TS_ASSERT( line->contains( "\"num_splits\":7," ) );
+        TS_ASSERT( line->contains( "\"num_simplex_steps\":1234," ) );
+        TS_ASSERT( line->contains( "\"max_degradation\":0.5," ) );
+        // Infinity is not valid JSON
+        TS_ASSERT( line->contains( "\"min_cost_of_phase_pattern\":null}" ) );
+
+        ++line;
+        TS_ASSERT( line->contains( "{\"type\":\"dnc_progress\"" ) );
+        TS_ASSERT( line->contains(
+            "\"worker\":3,\"query_id\":\"1-2\",\"result\":\"UNSAT\",\"unsolved\":5}" ) );
+
+        ++line;
+        TS_ASSERT( line->contains( "{\"type\":\"summary\"" ) );
+        TS_ASSERT( line->contains( "\"result\":\"unsat\",\"elapsed_micro\":42,\"statistics\":{" ) );
+    }
+
+    void test_snapshot_interval()
+    {
+        StatisticsStream::open( STATISTICS_STREAM_TEST_FILE, 0 );
+        TS_ASSERT( StatisticsStream::isDue( TimeUtils::sampleMicro() ) );
+
+        StatisticsStream::open( STATISTICS_STREAM_TEST_FILE, 10 );
+        TS_ASSERT( !StatisticsStream::isDue( TimeUtils::sampleMicro() ) );
+    }
+
+    void test_escape()
+    {
+        TS_ASSERT_EQUALS( StatisticsStream::escape( "a\"b\\c\n" ), String( "a\\\"b\\\\c\\u000a" ) );
+    }
+};
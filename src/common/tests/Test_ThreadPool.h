@@ -0,0 +1,153 @@
+/*********************                                                        */
+/*! \file Test_ThreadPool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief [[ Add one-line brief description here ]]
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <cxxtest/TestSuite.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class ThreadPoolTestSuite : public CxxTest::TestSuite
+{
+public:
+    /*
+      Run a loop over [0, size), and check that each element was visited
+      exactly once. Return the number of ranges it was split into.
+    */
+    unsigned checkCoverage( ThreadPool &pool, unsigned size, unsigned minRangeSize )
+    {
+        std::vector<std::atomic_uint> visits( size );
+        for ( auto &count : visits )
+            count = 0;
+        std::atomic_uint ranges( 0 );
+
+        pool.parallelFor( size, minRangeSize, [&]( unsigned begin, unsigned end ) {
+            ++ranges;
+            for ( unsigned i = begin; i < end; ++i )
+                ++visits[i];
+        } );
+
+        for ( unsigned i = 0; i < size; ++i )
+            TS_ASSERT_EQUALS( visits[i].load(), 1U );
+
+        return ranges.load();
+    }
+
+    void test_serial_by_default()
+    {
+        ThreadPool pool;
+        TS_ASSERT_EQUALS( pool.getNumberOfThreads(), 1U );
+
+        std::thread::id caller = std::this_thread::get_id();
+        bool onCaller = false;
+        pool.parallelFor( 100, 1, [&]( unsigned begin, unsigned end ) {
+            TS_ASSERT_EQUALS( begin, 0U );
+            TS_ASSERT_EQUALS( end, 100U );
+            onCaller = ( std::this_thread::get_id() == caller );
+        } );
+        TS_ASSERT( onCaller );
+
+        TS_ASSERT_EQUALS( checkCoverage( pool, 0, 1 ), 0U );
+    }
+
+    void test_ranges()
+    {
+        ThreadPool pool;
+        pool.setNumberOfThreads( 4 );
+        TS_ASSERT_EQUALS( pool.getNumberOfThreads(), 4U );
+
+        // One range per thread, if they are long enough
+        TS_ASSERT_EQUALS( checkCoverage( pool, 1000, 1 ), 4U );
+        TS_ASSERT_EQUALS( checkCoverage( pool, 1001, 250 ), 4U );
+        TS_ASSERT_EQUALS( checkCoverage( pool, 999, 250 ), 3U );
+        TS_ASSERT_EQUALS( checkCoverage( pool, 3, 1 ), 3U );
+        TS_ASSERT_EQUALS( checkCoverage( pool, 100, 100 ), 1U );
+        TS_ASSERT_EQUALS( checkCoverage( pool, 99, 100 ), 1U );
+
+        pool.setNumberOfThreads( 2 );
+        TS_ASSERT_EQUALS( checkCoverage( pool, 1000, 1 ), 2U );
+
+        pool.setNumberOfThreads( 0 );
+        TS_ASSERT_EQUALS( pool.getNumberOfThreads(), 1U );
+        TS_ASSERT_EQUALS( checkCoverage( pool, 1000, 1 ), 1U );
+    }
+
+    void test_concurrent_loops()
+    {
+        ThreadPool pool;
+        pool.setNumberOfThreads( 3 );
+
+        // Several threads share the helpers of the pool
+        std::atomic_uint failures( 0 );
+        std::vector<std::thread> callers;
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            callers.push_back( std::thread( [&pool, &failures] {
+                for ( unsigned j = 0; j < 200; ++j )
+                {
+                    std::vector<unsigned> values( 257, 0 );
+                    pool.parallelFor( values.size(), 1, [&]( unsigned begin, unsigned end ) {
+                        for ( unsigned k = begin; k < end; ++k )
+                            values[k] = k;
+                    } );
+
+                    for ( unsigned k = 0; k < values.size(); ++k )
+                        if ( values[k] != k )
+                            ++failures;
+                }
+            } ) );
+        }
+
+        // Resizing the pool does not disturb the loops in progress
+        pool.setNumberOfThreads( 2 );
+        pool.setNumberOfThreads( 4 );
+
+        for ( auto &caller : callers )
+            caller.join();
+
+        TS_ASSERT_EQUALS( failures.load(), 0U );
+    }
+
+    void test_exceptions()
+    {
+        ThreadPool pool;
+        pool.setNumberOfThreads( 4 );
+
+        std::atomic_uint calls( 0 );
+        TS_ASSERT_THROWS( pool.parallelFor( 4,
+                                            1,
+                                            [&]( unsigned begin, unsigned ) {
+                                                ++calls;
+                                                if ( begin == 2 )
+                                                    throw std::runtime_error( "range" );
+                                            } ),
+                          const std::runtime_error & );
+
+        // All ranges ran, and the pool is still usable
+        TS_ASSERT_EQUALS( calls.load(), 4U );
+        TS_ASSERT_EQUALS( checkCoverage( pool, 100, 1 ), 4U );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,112 @@
+/*********************                                                        */
+/*! \file Test_Tracer.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "Tracer.h"
+
+#include <cxxtest/TestSuite.h>
+#include <thread>
+#include <unistd.h>
+
+class TracerTestSuite : public CxxTest::TestSuite
+{
+public:
+    void tearDown()
+    {
+        Tracer::setEnabled( false );
+        Tracer::setDecisionLevel( 0 );
+        Tracer::clear();
+    }
+
+    void test_disabled_tracer_records_nothing()
+    {
+        Tracer::setEnabled( false );
+        Tracer::clear();
+
+        {
+            TraceSpan span( "outer" );
+        }
+
+        TS_ASSERT( !Tracer::exportChromeTrace().contains( "outer" ) );
+        TS_ASSERT( Tracer::computeDecisionLevelHistogram().empty() );
+    }
+
+    void test_chrome_trace()
+    {
+        Tracer::setEnabled( true );
+        Tracer::setDecisionLevel( 3 );
+
+        {
+            TraceSpan span( "outer" );
+        }
+
+        Tracer::setEnabled( false );
+
+        String trace = Tracer::exportChromeTrace();
+        TS_ASSERT( trace.contains( "\"traceEvents\"" ) );
+        TS_ASSERT( trace.contains( "\"name\":\"outer\"" ) );
+        TS_ASSERT( trace.contains( "\"ph\":\"X\"" ) );
+        TS_ASSERT( trace.contains( "\"level\":3" ) );
+    }
+
+    void test_folded_stacks_and_histogram()
+    {
+        Tracer::setEnabled( true );
+        Tracer::setDecisionLevel( 0 );
+
+        {
+            TraceSpan outer( "outer" );
+            usleep( 2000 );
+
+            Tracer::setDecisionLevel( 1 );
+            {
+                TraceSpan inner( "inner" );
+                usleep( 5000 );
+            }
+        }
+
+        Tracer::setEnabled( false );
+
+        String folded = Tracer::exportFoldedStacks();
+        TS_ASSERT( folded.contains( "outer " ) );
+        TS_ASSERT( folded.contains( "outer;inner " ) );
+
+        // The outer span only accounts for its own time
+        Map<unsigned, unsigned long long> histogram = Tracer::computeDecisionLevelHistogram();
+        TS_ASSERT_EQUALS( histogram.size(), 2U );
+        TS_ASSERT( histogram[0] >= 2000000ULL );
+        TS_ASSERT( histogram[0] < histogram[1] );
+        TS_ASSERT( histogram[1] >= 5000000ULL );
+    }
+
+    void test_spans_of_other_threads()
+    {
+        Tracer::setEnabled( true );
+
+        std::thread worker( []() {
+            Tracer::setDecisionLevel( 7 );
+            TraceSpan span( "worker" );
+        } );
+        worker.join();
+
+        Tracer::setEnabled( false );
+
+        // The buffer of an exited thread is kept for the export
+        TS_ASSERT( Tracer::exportChromeTrace().contains( "\"name\":\"worker\"" ) );
+        TS_ASSERT( Tracer::computeDecisionLevelHistogram().exists( 7 ) );
+
+        Tracer::clear();
+        TS_ASSERT( !Tracer::exportChromeTrace().contains( "worker" ) );
+    }
+};
@@ -0,0 +1,140 @@
+/*********************                                                        */
+/*! \file Test_VectorKernels.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief [[ Add one-line brief description here ]]
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include "VectorKernels.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <cxxtest/TestSuite.h>
+
+class VectorKernelsTestSuite : public CxxTest::TestSuite
+{
+public:
+    VectorKernels::InstructionSet _originalInstructionSet;
+
+    void setUp()
+    {
+        _originalInstructionSet = VectorKernels::getInstructionSet();
+    }
+
+    void tearDown()
+    {
+        VectorKernels::setInstructionSet( _originalInstructionSet );
+    }
+
+    void fillRandomly( double *x, unsigned n, bool sparse )
+    {
+        for ( unsigned i = 0; i < n; ++i )
+        {
+            if ( sparse && rand() % 3 == 0 )
+                x[i] = ( rand() % 2 ) ? 0 : 1e-12;
+            else
+                x[i] = ( rand() % 20000 - 10000 ) / 997.0;
+        }
+    }
+
+    void test_small_vectors()
+    {
+        VectorKernels::setInstructionSet( VectorKernels::SCALAR );
+
+        double x[] = { 1, -2, 0, 3, 1e-12 };
+        double y[] = { 1, 1, 1, 1, 1 };
+
+        TS_ASSERT_EQUALS( VectorKernels::dot( x, y, 4 ), 2 );
+        TS_ASSERT_EQUALS( VectorKernels::countNonZeros( x, 5 ), 4U );
+        TS_ASSERT_EQUALS( VectorKernels::countNonZeros( x, 5, 1e-10 ), 3U );
+        TS_ASSERT_EQUALS( VectorKernels::countNonZeros( x, 5, 2 ), 1U );
+
+        VectorKernels::axpy( 2, x, y, 4 );
+        TS_ASSERT_EQUALS( y[0], 3 );
+        TS_ASSERT_EQUALS( y[1], -3 );
+        TS_ASSERT_EQUALS( y[2], 1 );
+        TS_ASSERT_EQUALS( y[3], 7 );
+        TS_ASSERT_EQUALS( y[4], 1 );
+
+        VectorKernels::maskedAxpy( -1, x, y, 5, 1e-10 );
+        TS_ASSERT_EQUALS( y[0], 2 );
+        TS_ASSERT_EQUALS( y[1], -1 );
+        TS_ASSERT_EQUALS( y[2], 1 );
+        TS_ASSERT_EQUALS( y[3], 4 );
+        TS_ASSERT_EQUALS( y[4], 1 );
+
+        // Empty vectors
+        TS_ASSERT_EQUALS( VectorKernels::dot( x, y, 0 ), 0 );
+        TS_ASSERT_EQUALS( VectorKernels::countNonZeros( x, 0 ), 0U );
+    }
+
+    void test_instruction_sets_agree_with_scalar()
+    {
+        srand( 2024 );
+
+        const unsigned maxSize = 67;
+        double x[maxSize];
+        double y[maxSize];
+        double expectedY[maxSize];
+        double actualY[maxSize];
+
+        VectorKernels::InstructionSet instructionSets[] = { VectorKernels::AVX2,
+                                                            VectorKernels::AVX512 };
+
+        for ( const auto &instructionSet : instructionSets )
+        {
+            if ( !VectorKernels::isSupported( instructionSet ) )
+                continue;
+
+            // Every size, to cover all the remainders of the vectorized loops
+            for ( unsigned n = 0; n <= maxSize; ++n )
+            {
+                fillRandomly( x, n, n % 2 == 0 );
+                fillRandomly( y, n, false );
+                double alpha = ( rand() % 200 - 100 ) / 7.0;
+
+                VectorKernels::setInstructionSet( VectorKernels::SCALAR );
+                double expectedDot = VectorKernels::dot( x, y, n );
+                unsigned expectedCount = VectorKernels::countNonZeros( x, n, 1e-10 );
+                memcpy( expectedY, y, sizeof( double ) * n );
+                VectorKernels::axpy( alpha, y, expectedY, n );
+                VectorKernels::maskedAxpy( alpha, x, expectedY, n, 1e-10 );
+
+                VectorKernels::setInstructionSet( instructionSet );
+                TS_ASSERT_EQUALS( VectorKernels::getInstructionSet(), instructionSet );
+
+                // The results must be bitwise identical
+                TS_ASSERT_EQUALS( VectorKernels::dot( x, y, n ), expectedDot );
+                TS_ASSERT_EQUALS( VectorKernels::countNonZeros( x, n, 1e-10 ), expectedCount );
+                memcpy( actualY, y, sizeof( double ) * n );
+                VectorKernels::axpy( alpha, y, actualY, n );
+                VectorKernels::maskedAxpy( alpha, x, actualY, n, 1e-10 );
+                TS_ASSERT_SAME_DATA( actualY, expectedY, sizeof( double ) * n );
+            }
+        }
+    }
+
+    void test_unsupported_instruction_set_falls_back()
+    {
+        VectorKernels::setInstructionSet( VectorKernels::AVX512 );
+        TS_ASSERT( VectorKernels::isSupported( VectorKernels::getInstructionSet() ) );
+        TS_ASSERT( VectorKernels::isSupported( VectorKernels::SCALAR ) );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -58,6 +58,7 @@ const double GlobalConfiguration::DEGRADATION_THRESHOLD = 0.1;
 const double GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD = 0.0001;
 const bool GlobalConfiguration::USE_COLUMN_MERGING_EQUATIONS = false;
 const double GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD = 0.1;
+const unsigned GlobalConfiguration::MARKOWITZ_PIVOT_SEARCH_LIMIT = 4;
 const unsigned GlobalConfiguration::MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS = 5;
 const DivideStrategy GlobalConfiguration::SPLITTING_HEURISTICS = DivideStrategy::ReLUViolation;
 const unsigned GlobalConfiguration::INTERVAL_SPLITTING_FREQUENCY = 10;
@@ -65,13 +66,19 @@ const unsigned GlobalConfiguration::INTERVAL_SPLITTING_THRESHOLD = 10;
 const unsigned GlobalConfiguration::BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY = 100;
 const unsigned GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS = 20;
 const double GlobalConfiguration::COST_FUNCTION_ERROR_THRESHOLD = 0.0000000001;
+const unsigned GlobalConfiguration::COST_FUNCTION_RECOMPUTATION_FREQUENCY = 100;
+const double GlobalConfiguration::ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD = 0.1;
 
 const unsigned GlobalConfiguration::SIMULATION_RANDOM_SEED = 1;
 
 const bool GlobalConfiguration::USE_HARRIS_RATIO_TEST = true;
+const bool GlobalConfiguration::USE_LONG_STEP_RATIO_TEST = true;
 
 const double GlobalConfiguration::SYMBOLIC_TIGHTENING_ROUNDING_CONSTANT = 0.00000000001;
 const double GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT = 0.00000001;
+const bool GlobalConfiguration::INCREMENTAL_SYMBOLIC_BOUND_TIGHTENING = true;
+const unsigned GlobalConfiguration::SYMBOLIC_BOUND_TIGHTENING_MIN_ENTRIES_PER_THREAD = 16384;
+const bool GlobalConfiguration::OUTPUT_SPECIFICATION_BOUND_PROPAGATION = true;
 
 const double GlobalConfiguration::SIGMOID_CUTOFF_CONSTANT = 20;
 
@@ -81,6 +88,7 @@ const bool GlobalConfiguration::PL_CONSTRAINTS_ADD_AUX_EQUATIONS_AFTER_PREPROCES
 const bool GlobalConfiguration::NL_CONSTRAINTS_ADD_AUX_EQUATIONS_AFTER_PREPROCESSING = true;
 const double GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD = 0.00001;
 
+const double GlobalConfiguration::PREPROCESSOR_SUBSTITUTION_PIVOT_THRESHOLD = 0.01;
 const unsigned GlobalConfiguration::PREPROCESSSING_MAX_TIGHTEING_ROUND = 1000;
 
 const bool GlobalConfiguration::WARM_START = false;
@@ -90,6 +98,8 @@ const unsigned GlobalConfiguration::MAX_ITERATIONS_WITHOUT_PROGRESS = 10000;
 const unsigned GlobalConfiguration::PSE_ITERATIONS_BEFORE_RESET = 1000;
 const double GlobalConfiguration::PSE_GAMMA_ERROR_THRESHOLD = 0.001;
 const double GlobalConfiguration::PSE_GAMMA_UPDATE_TOLERANCE = 0.000000001;
+const unsigned GlobalConfiguration::PSE_CANDIDATE_POOL_SIZE = 16;
+const unsigned GlobalConfiguration::PSE_PRICING_SECTION_SIZE = 2000;
 
 const double GlobalConfiguration::CONSTRAINT_COMPARISON_TOLERANCE = 0.00001;
 
@@ -104,6 +114,7 @@ const bool GlobalConfiguration::EXPLICIT_BOUND_TIGHTENING_UNTIL_SATURATION = fal
 const double GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT = 1e-6;
 
 const unsigned GlobalConfiguration::REFACTORIZATION_THRESHOLD = 100;
+const double GlobalConfiguration::REFACTORIZATION_FILL_FACTOR = 2.0;
 const GlobalConfiguration::BasisFactorizationType GlobalConfiguration::BASIS_FACTORIZATION_TYPE =
     GlobalConfiguration::SPARSE_FORREST_TOMLIN_FACTORIZATION;
 
@@ -111,10 +122,15 @@ const unsigned GlobalConfiguration::BABSR_CANDIDATES_THRESHOLD = 5;
 const unsigned GlobalConfiguration::POLARITY_CANDIDATES_THRESHOLD = 5;
 
 const unsigned GlobalConfiguration::DNC_DEPTH_THRESHOLD = 5;
+const unsigned GlobalConfiguration::DNC_WORKER_CONNECTION_TIMEOUT_IN_SECONDS = 60;
+const unsigned GlobalConfiguration::DNC_COORDINATOR_POLLING_INTERVAL_IN_MILLISECONDS = 100;
+
+const unsigned GlobalConfiguration::TRACE_BUFFER_CAPACITY = 1 << 18;
 
 const double GlobalConfiguration::MINIMAL_COEFFICIENT_FOR_TIGHTENING = 0.01;
 const double GlobalConfiguration::LEMMA_CERTIFICATION_TOLERANCE = 0.000001;
 const bool GlobalConfiguration::WRITE_JSON_PROOF = false;
+const unsigned GlobalConfiguration::CERTIFICATE_TASKS_PER_WORKER = 4;
 
 const unsigned GlobalConfiguration::BACKWARD_BOUND_PROPAGATION_DEPTH = 3;
 const unsigned GlobalConfiguration::MAX_ROUNDS_OF_BACKWARD_ANALYSIS = 10;
@@ -173,17 +189,26 @@ void GlobalConfiguration::print()
     printf( "  USE_COLUMN_MERGING_EQUATIONS: %s\n", USE_COLUMN_MERGING_EQUATIONS ? "Yes" : "No" );
     printf( "  GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD: %.15lf\n",
             GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD );
+    printf( "  MARKOWITZ_PIVOT_SEARCH_LIMIT: %u\n", MARKOWITZ_PIVOT_SEARCH_LIMIT );
     printf( "  MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS: %u\n", MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS );
     printf( "  BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY: %u\n",
             BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY );
     printf( "  COST_FUNCTION_ERROR_THRESHOLD: %.15lf\n", COST_FUNCTION_ERROR_THRESHOLD );
+    printf( "  COST_FUNCTION_RECOMPUTATION_FREQUENCY: %u\n", COST_FUNCTION_RECOMPUTATION_FREQUENCY );
+    printf( "  ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD: %.15lf\n",
+            ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD );
     printf( "  USE_HARRIS_RATIO_TEST: %s\n", USE_HARRIS_RATIO_TEST ? "Yes" : "No" );
+    printf( "  USE_LONG_STEP_RATIO_TEST: %s\n", USE_LONG_STEP_RATIO_TEST ? "Yes" : "No" );
 
     printf( "  PREPROCESS_INPUT_QUERY: %s\n", PREPROCESS_INPUT_QUERY ? "Yes" : "No" );
     printf( "  PREPROCESSOR_ELIMINATE_VARIABLES: %s\n",
             PREPROCESSOR_ELIMINATE_VARIABLES ? "Yes" : "No" );
+    printf( "  PREPROCESSOR_SUBSTITUTION_PIVOT_THRESHOLD: %.15lf\n",
+            PREPROCESSOR_SUBSTITUTION_PIVOT_THRESHOLD );
     printf( "  PSE_ITERATIONS_BEFORE_RESET: %u\n", PSE_ITERATIONS_BEFORE_RESET );
     printf( "  PSE_GAMMA_ERROR_THRESHOLD: %.15lf\n", PSE_GAMMA_ERROR_THRESHOLD );
+    printf( "  PSE_CANDIDATE_POOL_SIZE: %u\n", PSE_CANDIDATE_POOL_SIZE );
+    printf( "  PSE_PRICING_SECTION_SIZE: %u\n", PSE_PRICING_SECTION_SIZE );
     printf( "  CONSTRAINT_COMPARISON_TOLERANCE: %.15lf\n", CONSTRAINT_COMPARISON_TOLERANCE );
 
     String basisBoundTighteningType;
@@ -206,7 +231,14 @@ void GlobalConfiguration::print()
             basisBoundTighteningType.ascii() );
     printf( "  EXPLICIT_BOUND_TIGHTENING_UNTIL_SATURATION: %s\n",
             EXPLICIT_BOUND_TIGHTENING_UNTIL_SATURATION ? "Yes" : "No" );
+    printf( "  INCREMENTAL_SYMBOLIC_BOUND_TIGHTENING: %s\n",
+            INCREMENTAL_SYMBOLIC_BOUND_TIGHTENING ? "Yes" : "No" );
+    printf( "  SYMBOLIC_BOUND_TIGHTENING_MIN_ENTRIES_PER_THREAD: %u\n",
+            SYMBOLIC_BOUND_TIGHTENING_MIN_ENTRIES_PER_THREAD );
+    printf( "  OUTPUT_SPECIFICATION_BOUND_PROPAGATION: %s\n",
+            OUTPUT_SPECIFICATION_BOUND_PROPAGATION ? "Yes" : "No" );
     printf( "  REFACTORIZATION_THRESHOLD: %u\n", REFACTORIZATION_THRESHOLD );
+    printf( "  REFACTORIZATION_FILL_FACTOR: %.15lf\n", REFACTORIZATION_FILL_FACTOR );
 
     String basisFactorizationType;
     if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE == GlobalConfiguration::LU_FACTORIZATION )
@@ -217,6 +249,12 @@ void GlobalConfiguration::print()
     else if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
               GlobalConfiguration::FORREST_TOMLIN_FACTORIZATION )
         basisFactorizationType = "FORREST_TOMLIN_FACTORIZATION";
+    else if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
+              GlobalConfiguration::SPARSE_FORREST_TOMLIN_FACTORIZATION )
+        basisFactorizationType = "SPARSE_FORREST_TOMLIN_FACTORIZATION";
+    else if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
+              GlobalConfiguration::MARKOWITZ_FORREST_TOMLIN_FACTORIZATION )
+        basisFactorizationType = "MARKOWITZ_FORREST_TOMLIN_FACTORIZATION";
     else
         basisFactorizationType = "Unknown";
 
@@ -81,6 +81,10 @@ public:
     // Toggle use of Harris' two-pass ratio test for selecting the leaving variable
     static const bool USE_HARRIS_RATIO_TEST;
 
+    // Toggle extending the ratio test's step past breakpoints of the sum of infeasibilities, for
+    // as long as the sum keeps decreasing (a long-step ratio test)
+    static const bool USE_LONG_STEP_RATIO_TEST;
+
     // Toggle query-preprocessing on/off.
     static const bool PREPROCESS_INPUT_QUERY;
 
@@ -97,6 +101,10 @@ public:
     // threshold, the preprocessor will treat it as fixed.
     static const double PREPROCESSOR_ALMOST_FIXED_THRESHOLD;
 
+    // When presolving a doubleton equation a * x + b * y = c, x is only substituted by
+    // ( c - b * y ) / a if |a| is at least this fraction of |b|.
+    static const double PREPROCESSOR_SUBSTITUTION_PIVOT_THRESHOLD;
+
     // Maximal rounds of tightening to perform in the preprocessor to avoid non-termination.
     static const unsigned PREPROCESSSING_MAX_TIGHTEING_ROUND;
 
@@ -126,6 +134,10 @@ public:
     // the largest element in the column, the elimination engine will attempt to pick another pivot.
     static const double GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD;
 
+    // The number of columns of the bump that the Markowitz Gaussian elimination examines before
+    // settling on the sparsest acceptable pivot it has found.
+    static const unsigned MARKOWITZ_PIVOT_SEARCH_LIMIT;
+
     // How many potential pivots should the engine inspect (at most) in every simplex iteration?
     static const unsigned MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS;
 
@@ -148,6 +160,14 @@ public:
     // If the cost function error exceeds this threshold, it is recomputed
     static const double COST_FUNCTION_ERROR_THRESHOLD;
 
+    // The reduced costs are updated incrementally after each pivot. To bound the accumulated
+    // numerical error, they are recomputed from scratch after this many consecutive updates.
+    static const unsigned COST_FUNCTION_RECOMPUTATION_FREQUENCY;
+
+    // A tableau row is computed from the rows of A, rather than from its columns, when the
+    // fraction of non-zero entries in e * inv(B) is below this threshold.
+    static const double ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD;
+
     // Random seed for generating simulation values.
     static const unsigned SIMULATION_RANDOM_SEED;
 
@@ -161,6 +181,14 @@ public:
     // PSE's Gamma function's update tolerance
     static const double PSE_GAMMA_UPDATE_TOLERANCE;
 
+    // The number of best entering candidates that PSE keeps between simplex steps. Should be at
+    // least MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS.
+    static const unsigned PSE_CANDIDATE_POOL_SIZE;
+
+    // The number of non-basic variables that PSE prices in each simplex step. Wider tableaus are
+    // priced partially, one section at a time.
+    static const unsigned PSE_PRICING_SECTION_SIZE;
+
     // The tolerance for checking whether f = Constraint( b ), Constraint \in { ReLU, ABS, Sign}
     static const double CONSTRAINT_COMPARISON_TOLERANCE;
 
@@ -199,6 +227,20 @@ public:
     static const double SYMBOLIC_TIGHTENING_ROUNDING_CONSTANT;
     static const double LP_TIGHTENING_ROUNDING_CONSTANT;
 
+    // During the search, whether symbolic bound tightening only recomputes
+    // the layers from the first one whose bounds have changed since its
+    // previous pass
+    static const bool INCREMENTAL_SYMBOLIC_BOUND_TIGHTENING;
+
+    // When symbolic bound tightening is multi-threaded, the minimal number of
+    // entries of the symbolic bounds (neurons times input neurons) of a layer
+    // that each thread works on
+    static const unsigned SYMBOLIC_BOUND_TIGHTENING_MIN_ENTRIES_PER_THREAD;
+
+    // Whether DeepPoly is followed by back-substituting the linear functions
+    // of the output neurons that the query's equations constrain
+    static const bool OUTPUT_SPECIFICATION_BOUND_PROPAGATION;
+
     static const double SIGMOID_CUTOFF_CONSTANT;
 
     /*
@@ -220,12 +262,17 @@ public:
     // The number of accumualted eta matrices, after which the basis will be refactorized
     static const unsigned REFACTORIZATION_THRESHOLD;
 
+    // For the Markowitz FT factorization: the basis is also refactorized once the factors have
+    // this many times more non-zeros than right after the last refactorization
+    static const double REFACTORIZATION_FILL_FACTOR;
+
     // The kind of basis factorization algorithm in use
     enum BasisFactorizationType {
         LU_FACTORIZATION,
         SPARSE_LU_FACTORIZATION,
         FORREST_TOMLIN_FACTORIZATION,
         SPARSE_FORREST_TOMLIN_FACTORIZATION,
+        MARKOWITZ_FORREST_TOMLIN_FACTORIZATION,
     };
     static const BasisFactorizationType BASIS_FACTORIZATION_TYPE;
 
@@ -243,6 +290,16 @@ public:
      */
     static const unsigned DNC_DEPTH_THRESHOLD;
 
+    /* In distributed DnC mode, how long a remote worker keeps trying to reach the coordinator,
+       and how often the coordinator checks its connections (and the timeout)
+    */
+    static const unsigned DNC_WORKER_CONNECTION_TIMEOUT_IN_SECONDS;
+    static const unsigned DNC_COORDINATOR_POLLING_INTERVAL_IN_MILLISECONDS;
+
+    /* The number of spans kept per thread when tracing (see Tracer). Older spans are overwritten.
+     */
+    static const unsigned TRACE_BUFFER_CAPACITY;
+
     /* Minimal coefficient of a variable in a Tableau row, that is used for bound tightening
      */
     static const double MINIMAL_COEFFICIENT_FOR_TIGHTENING;
@@ -255,6 +312,10 @@ public:
      */
     static const bool WRITE_JSON_PROOF;
 
+    /* When checking proofs in parallel, the number of subtrees to create per worker thread
+     */
+    static const unsigned CERTIFICATE_TASKS_PER_WORKER;
+
     /* How many layers after the current layer do we encode in backward analysis.
      */
     static const unsigned BACKWARD_BOUND_PROPAGATION_DEPTH;
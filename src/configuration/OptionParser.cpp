@@ -136,7 +136,50 @@ void OptionParser::initialize()
         "prove-unsat",
         boost::program_options::bool_switch( &( ( *_boolOptions )[Options::PRODUCE_PROOFS] ) )
             ->default_value( ( *_boolOptions )[Options::PRODUCE_PROOFS] ),
-        "Produce proofs of UNSAT and check them" )
+        "Produce proofs of UNSAT and check them" )(
+        "certificate-file",
+        boost::program_options::value<std::string>(
+            &( ( *_stringOptions )[Options::CERTIFICATE_FILE] ) )
+            ->default_value( ( *_stringOptions )[Options::CERTIFICATE_FILE] ),
+        "With --prove-unsat, write the UNSAT certificate into this file and check it by streaming "
+        "it back, rather than in memory." )(
+        "checkpoint-file",
+        boost::program_options::value<std::string>(
+            &( ( *_stringOptions )[Options::CHECKPOINT_FILE] ) )
+            ->default_value( ( *_stringOptions )[Options::CHECKPOINT_FILE] ),
+        "Periodically save the state of the search into this file." )(
+        "checkpoint-interval",
+        boost::program_options::value<int>( &( ( *_intOptions )[Options::CHECKPOINT_INTERVAL] ) )
+            ->default_value( ( *_intOptions )[Options::CHECKPOINT_INTERVAL] ),
+        "The number of seconds between two checkpoints." )(
+        "resume",
+        boost::program_options::bool_switch( &( ( *_boolOptions )[Options::RESUME] ) )
+            ->default_value( ( *_boolOptions )[Options::RESUME] ),
+        "Resume the search from the checkpoint file. The network, property and solving "
+        "options must be the same as in the run that wrote it." )(
+        "trace-file",
+        boost::program_options::value<std::string>( &( ( *_stringOptions )[Options::TRACE_FILE] ) )
+            ->default_value( ( *_stringOptions )[Options::TRACE_FILE] ),
+        "Trace the solver and write the trace into this file, in the Chrome trace format. Folded "
+        "stacks for flame graphs are written into the same file with a .folded suffix." )(
+        "stats-stream",
+        boost::program_options::value<std::string>(
+            &( ( *_stringOptions )[Options::STATISTICS_STREAM] ) )
+            ->default_value( ( *_stringOptions )[Options::STATISTICS_STREAM] ),
+        "Stream periodic statistics snapshots and a final summary, as JSON lines, into this file "
+        "or into a Unix domain socket (unix:<path>)." )(
+        "stats-stream-interval",
+        boost::program_options::value<int>(
+            &( ( *_intOptions )[Options::STATISTICS_STREAM_INTERVAL] ) )
+            ->default_value( ( *_intOptions )[Options::STATISTICS_STREAM_INTERVAL] ),
+        "The number of seconds between two statistics snapshots in the stream." )(
+        "nlr-bound-cache",
+        boost::program_options::value<std::string>(
+            &( ( *_stringOptions )[Options::NLR_BOUND_CACHE_FILE] ) )
+            ->default_value( ( *_stringOptions )[Options::NLR_BOUND_CACHE_FILE] ),
+        "Cache the bounds of the network's neurons under the input region in this file, and "
+        "reuse them in later runs on the same network whose input region is contained in a "
+        "cached one." )
 #ifdef ENABLE_GUROBI
 #endif // ENABLE_GUROBI
         ;
@@ -180,7 +223,7 @@ void OptionParser::initialize()
         boost::program_options::value<std::string>(
             &( ( *_stringOptions )[Options::SNC_SPLITTING_STRATEGY] ) )
             ->default_value( ( *_stringOptions )[Options::SNC_SPLITTING_STRATEGY] ),
-        "(SnC) The splitting strategy." )(
+        "(SnC) The splitting strategy (auto/largest-interval/interval-propagation/polarity)." )(
         "initial-divides",
         boost::program_options::value<int>( &( ( *_intOptions )[Options::NUM_INITIAL_DIVIDES] ) )
             ->default_value( ( *_intOptions )[Options::NUM_INITIAL_DIVIDES] ),
@@ -201,10 +244,28 @@ void OptionParser::initialize()
         boost::program_options::bool_switch( &( ( *_boolOptions )[Options::RESTORE_TREE_STATES] ) )
             ->default_value( ( *_boolOptions )[Options::RESTORE_TREE_STATES] ),
         "(SnC) Restore tree states in SnC mode.\n" )(
+        "dnc-coordinator",
+        boost::program_options::value<std::string>(
+            &( ( *_stringOptions )[Options::DNC_COORDINATOR_ADDRESS] ) )
+            ->default_value( ( *_stringOptions )[Options::DNC_COORDINATOR_ADDRESS] ),
+        "(SnC) Distribute the subqueries to remote workers that connect to this address "
+        "(unix:<path> or <host>:<port>)." )(
+        "dnc-worker",
+        boost::program_options::value<std::string>(
+            &( ( *_stringOptions )[Options::DNC_WORKER_ADDRESS] ) )
+            ->default_value( ( *_stringOptions )[Options::DNC_WORKER_ADDRESS] ),
+        "(SnC) Run as a remote worker of the coordinator at this address. The network and "
+        "property must be the same as the coordinator's." )(
         "blas-threads",
         boost::program_options::value<int>( &( ( *_intOptions )[Options::NUM_BLAS_THREADS] ) )
             ->default_value( ( *_intOptions )[Options::NUM_BLAS_THREADS] ),
         "Number of threads to use for matrix multiplication with OpenBLAS." )(
+        "sbt-threads",
+        boost::program_options::value<int>(
+            &( ( *_intOptions )[Options::NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS] ) )
+            ->default_value( ( *_intOptions )[Options::NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS] ),
+        "Number of threads to use for symbolic bound tightening on wide layers. In the DnC mode, "
+        "the threads beyond the number of workers are shared by the workers." )(
         "reluplex-split-threshold",
         boost::program_options::value<int>(
             &( ( *_intOptions )[Options::CONSTRAINT_VIOLATION_THRESHOLD] ) )
@@ -241,7 +302,18 @@ void OptionParser::initialize()
             &( *_boolOptions )[Options::DO_NOT_MERGE_CONSECUTIVE_WEIGHTED_SUM_LAYERS] )
             ->default_value(
                 ( *_boolOptions )[Options::DO_NOT_MERGE_CONSECUTIVE_WEIGHTED_SUM_LAYERS] ),
-        "Do no merge consecutive weighted-sum layers." )
+        "Do no merge consecutive weighted-sum layers." )(
+        "no-presolve",
+        boost::program_options::bool_switch(
+            &( *_boolOptions )[Options::DO_NOT_PRESOLVE_EQUATIONS] )
+            ->default_value( ( *_boolOptions )[Options::DO_NOT_PRESOLVE_EQUATIONS] ),
+        "Do not presolve the equations (remove implied-free column singletons and substitute "
+        "variables out of doubleton equations) before constructing the tableau." )(
+        "lazy-rows",
+        boost::program_options::bool_switch( &( *_boolOptions )[Options::LAZY_ROW_GENERATION] )
+            ->default_value( ( *_boolOptions )[Options::LAZY_ROW_GENERATION] ),
+        "Keep equations that define variables occurring nowhere else out of the tableau, and "
+        "add them only once the assignment violates them." )
 #ifdef ENABLE_GUROBI
         ( "lp-solver",
           boost::program_options::value<std::string>( &( ( *_stringOptions )[Options::LP_SOLVER] ) )
@@ -16,11 +16,15 @@
 #include "Options.h"
 
 #include "ConfigurationError.h"
-#include "Debug.h"
 #include "GlobalConfiguration.h"
 
+thread_local Options *Options::_threadOptions = NULL;
+
 Options *Options::get()
 {
+    if ( _threadOptions )
+        return _threadOptions;
+
     static Options singleton;
     return &singleton;
 }
@@ -32,10 +36,25 @@ Options::Options()
     _optionParser.initialize();
 }
 
-Options::Options( const Options & )
+Options::Options( const Options &other )
+    : _optionParser( &_boolOptions, &_intOptions, &_floatOptions, &_stringOptions )
+    , _boolOptions( other._boolOptions )
+    , _intOptions( other._intOptions )
+    , _floatOptions( other._floatOptions )
+    , _stringOptions( other._stringOptions )
+{
+    _optionParser.initialize();
+}
+
+Options::Scope::Scope( Options *options )
+    : _previous( _threadOptions )
+{
+    _threadOptions = options;
+}
+
+Options::Scope::~Scope()
 {
-    // This constructor should never be called
-    ASSERT( false );
+    _threadOptions = _previous;
 }
 
 void Options::initializeDefaultValues()
@@ -55,6 +74,9 @@ void Options::initializeDefaultValues()
     _boolOptions[DEBUG_ASSIGNMENT] = false;
     _boolOptions[PRODUCE_PROOFS] = false;
     _boolOptions[DO_NOT_MERGE_CONSECUTIVE_WEIGHTED_SUM_LAYERS] = false;
+    _boolOptions[DO_NOT_PRESOLVE_EQUATIONS] = false;
+    _boolOptions[LAZY_ROW_GENERATION] = false;
+    _boolOptions[RESUME] = false;
 
     /*
       Int options
@@ -70,7 +92,10 @@ void Options::initializeDefaultValues()
     _intOptions[NUMBER_OF_SIMULATIONS] = 100;
     _intOptions[SEED] = 1;
     _intOptions[NUM_BLAS_THREADS] = 1;
+    _intOptions[NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS] = 1;
     _intOptions[NUM_CONSTRAINTS_TO_REFINE_INC_LIN] = 30;
+    _intOptions[CHECKPOINT_INTERVAL] = 600;
+    _intOptions[STATISTICS_STREAM_INTERVAL] = 10;
 
     /*
       Float options
@@ -100,6 +125,13 @@ void Options::initializeDefaultValues()
     _stringOptions[SOI_INITIALIZATION_STRATEGY] = "input-assignment";
     _stringOptions[LP_SOLVER] = gurobiEnabled() ? "gurobi" : "native";
     _stringOptions[SOFTMAX_BOUND_TYPE] = "lse";
+    _stringOptions[DNC_COORDINATOR_ADDRESS] = "";
+    _stringOptions[DNC_WORKER_ADDRESS] = "";
+    _stringOptions[CHECKPOINT_FILE] = "";
+    _stringOptions[TRACE_FILE] = "";
+    _stringOptions[STATISTICS_STREAM] = "";
+    _stringOptions[CERTIFICATE_FILE] = "";
+    _stringOptions[NLR_BOUND_CACHE_FILE] = "";
 }
 
 void Options::parseOptions( int argc, char **argv )
@@ -178,6 +210,8 @@ SnCDivideStrategy Options::getSnCDivideStrategy() const
         return SnCDivideStrategy::Polarity;
     else if ( strategyString == "largest-interval" )
         return SnCDivideStrategy::LargestInterval;
+    else if ( strategyString == "interval-propagation" )
+        return SnCDivideStrategy::IntervalPropagation;
     else
         return SnCDivideStrategy::Auto;
 }
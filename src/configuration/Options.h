@@ -83,6 +83,18 @@ public:
         // logically-consecutive weighted sum layers into a single
         // weighted sum layer, to reduce the number of variables
         DO_NOT_MERGE_CONSECUTIVE_WEIGHTED_SUM_LAYERS,
+
+        // If the flag is false, the preprocessor will remove equations
+        // with implied-free column singletons, and substitute variables
+        // out of doubleton equations
+        DO_NOT_PRESOLVE_EQUATIONS,
+
+        // Keep equations that define variables occurring nowhere else out of
+        // the tableau, and add them only once the assignment violates them
+        LAZY_ROW_GENERATION,
+
+        // Resume the search from the checkpoint file
+        RESUME,
     };
 
     enum IntOptions {
@@ -113,8 +125,18 @@ public:
         // The number of threads to use for OpenBLAS matrix multiplication.
         NUM_BLAS_THREADS,
 
+        // The number of threads to use for symbolic bound tightening. In the
+        // DnC mode, the threads beyond the number of workers are shared by them.
+        NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS,
+
         // Maximal number of constraints to refine in incremental linearization
         NUM_CONSTRAINTS_TO_REFINE_INC_LIN,
+
+        // The number of seconds between two checkpoints
+        CHECKPOINT_INTERVAL,
+
+        // The number of seconds between two statistics snapshots in the stream
+        STATISTICS_STREAM_INTERVAL,
     };
 
     enum FloatOptions {
@@ -155,14 +177,57 @@ public:
         SOI_INITIALIZATION_STRATEGY,
 
         // The procedure/solver for solving the LP
-        LP_SOLVER
+        LP_SOLVER,
+
+        // Distributed SnC: the address on which the coordinator listens, or the
+        // address of the coordinator that a remote worker connects to
+        DNC_COORDINATOR_ADDRESS,
+        DNC_WORKER_ADDRESS,
+
+        // Periodically checkpoint the search into this file
+        CHECKPOINT_FILE,
+
+        // Trace the hot paths of the solver, and export the trace into this file
+        TRACE_FILE,
+
+        // Stream JSON-lines statistics into this file or Unix domain socket
+        STATISTICS_STREAM,
+
+        // Write the UNSAT certificate into this file, and check it from there
+        CERTIFICATE_FILE,
+
+        // Reuse the bounds of the network computed in previous runs, stored
+        // in this file
+        NLR_BOUND_CACHE_FILE,
     };
 
     /*
-      The singleton instance
+      The options in effect on the current thread: those installed by a
+      Scope, if any, and otherwise the singleton instance
     */
     static Options *get();
 
+    /*
+      A copy of other's option values, e.g. to give a single solve its own
+      options when several solves run concurrently in one process
+    */
+    Options( const Options &other );
+
+    /*
+      Installs a set of options on the current thread for the lifetime of
+      the scope. Threads spawned by the solver install the options of the
+      thread that spawned them.
+    */
+    class Scope
+    {
+    public:
+        explicit Scope( Options *options );
+        ~Scope();
+
+    private:
+        Options *_previous;
+    };
+
     /*
       Parse the command line arguments and extract the option values.
     */
@@ -211,10 +276,14 @@ public:
 
 private:
     /*
-      Disable default constructor and copy constructor
+      Disable default constructor
     */
     Options();
-    Options( const Options & );
+
+    /*
+      The options installed on the current thread, if any
+    */
+    static thread_local Options *_threadOptions;
 
     /*
       Initialize the default option values
@@ -35,6 +35,8 @@ BoundManager::BoundManager( Context &context )
     , _firstInconsistentTightening( 0, 0.0, Tightening::LB )
     , _lowerBounds( nullptr )
     , _upperBounds( nullptr )
+    , _numTighteningClearings( 0 )
+    , _cdNumTighteningClearings( &_context, 0 )
     , _boundExplainer( nullptr )
 {
     _consistentBounds = true;
@@ -113,13 +115,13 @@ unsigned BoundManager::registerNewVariable()
 
     if ( _allocated < _size )
     {
-        double *oldLowerBounds = _upperBounds;
-        double *oldUpperBounds = _lowerBounds;
+        double *oldLowerBounds = _lowerBounds;
+        double *oldUpperBounds = _upperBounds;
+        unsigned oldAllocated = _allocated;
 
-        allocateLocalBounds( 2 * _allocated );
-        std::memcpy( _lowerBounds, oldLowerBounds, _allocated );
-        std::memcpy( _upperBounds, oldUpperBounds, _allocated );
-        _allocated *= 2;
+        allocateLocalBounds( 2 * oldAllocated );
+        std::memcpy( _lowerBounds, oldLowerBounds, sizeof( double ) * oldAllocated );
+        std::memcpy( _upperBounds, oldUpperBounds, sizeof( double ) * oldAllocated );
 
         delete[] oldLowerBounds;
         delete[] oldUpperBounds;
@@ -138,6 +140,13 @@ unsigned BoundManager::registerNewVariable()
     return newVar;
 }
 
+void BoundManager::resetBounds( unsigned variable )
+{
+    ASSERT( variable < _size );
+    _lowerBounds[variable] = FloatUtils::negativeInfinity();
+    _upperBounds[variable] = FloatUtils::infinity();
+}
+
 unsigned BoundManager::getNumberOfVariables() const
 {
     return _size;
@@ -176,7 +185,7 @@ bool BoundManager::setLowerBound( unsigned variable, double value )
     if ( value > _lowerBounds[variable] )
     {
         _lowerBounds[variable] = value;
-        *_tightenedLower[variable] = true;
+        markTightened( _tightenedLower, variable );
         if ( !consistentBounds( variable ) )
             recordInconsistentBound( variable, value, Tightening::LB );
         return true;
@@ -191,7 +200,7 @@ bool BoundManager::setUpperBound( unsigned variable, double value )
     if ( value < _upperBounds[variable] )
     {
         _upperBounds[variable] = value;
-        *_tightenedUpper[variable] = true;
+        markTightened( _tightenedUpper, variable );
         if ( !consistentBounds( variable ) )
             recordInconsistentBound( variable, value, Tightening::UB );
         return true;
@@ -239,8 +248,38 @@ void BoundManager::restoreLocalBounds()
     }
 }
 
+void BoundManager::markTightened( Vector<CVC4::context::CDO<bool> *> &flags, unsigned variable )
+{
+    // Writing a context-dependent flag is costly, so it is only done on changes
+    if ( *flags[variable] )
+        return;
+
+    if ( !*_tightenedLower[variable] && !*_tightenedUpper[variable] )
+        _tightenedVariables.append( variable );
+
+    *flags[variable] = true;
+}
+
+void BoundManager::prepareToClearTightenings()
+{
+    if ( _cdNumTighteningClearings.get() != _numTighteningClearings )
+    {
+        _tightenedVariables.clear();
+        for ( unsigned i = 0; i < _size; ++i )
+        {
+            if ( *_tightenedLower[i] || *_tightenedUpper[i] )
+                _tightenedVariables.append( i );
+        }
+    }
+
+    ++_numTighteningClearings;
+    _cdNumTighteningClearings = _numTighteningClearings;
+}
+
 void BoundManager::getTightenings( List<Tightening> &tightenings )
 {
+    prepareToClearTightenings();
+
     for ( unsigned i = 0; i < _size; ++i )
     {
         if ( *_tightenedLower[i] )
@@ -255,33 +294,52 @@ void BoundManager::getTightenings( List<Tightening> &tightenings )
             *_tightenedUpper[i] = false;
         }
     }
+
+    _tightenedVariables.clear();
 }
 
 void BoundManager::clearTightenings()
 {
-    for ( unsigned i = 0; i < _size; ++i )
+    prepareToClearTightenings();
+
+    for ( unsigned variable : _tightenedVariables )
     {
-        *_tightenedLower[i] = false;
-        *_tightenedUpper[i] = false;
+        if ( *_tightenedLower[variable] )
+            *_tightenedLower[variable] = false;
+        if ( *_tightenedUpper[variable] )
+            *_tightenedUpper[variable] = false;
     }
+
+    _tightenedVariables.clear();
 }
 
 void BoundManager::propagateTightenings()
 {
-    for ( unsigned i = 0; i < _size; ++i )
-    {
-        if ( *_tightenedLower[i] )
-        {
-            _tableau->notifyLowerBound( i, getLowerBound( i ) );
-            *_tightenedLower[i] = false;
-        }
+    prepareToClearTightenings();
 
-        if ( *_tightenedUpper[i] )
-        {
-            _tableau->notifyUpperBound( i, getUpperBound( i ) );
-            *_tightenedUpper[i] = false;
-        }
+    /*
+      Flags are cleared before the watchers are informed, so that
+      variables tightened again by the watchers are queued again.
+      The queue may grow while it is traversed.
+    */
+    for ( unsigned i = 0; i < _tightenedVariables.size(); ++i )
+    {
+        unsigned variable = _tightenedVariables[i];
+        bool lowerTightened = *_tightenedLower[variable];
+        bool upperTightened = *_tightenedUpper[variable];
+
+        if ( lowerTightened )
+            *_tightenedLower[variable] = false;
+        if ( upperTightened )
+            *_tightenedUpper[variable] = false;
+
+        if ( lowerTightened )
+            _tableau->notifyLowerBound( variable, getLowerBound( variable ) );
+        if ( upperTightened )
+            _tableau->notifyUpperBound( variable, getUpperBound( variable ) );
     }
+
+    _tightenedVariables.clear();
 }
 
 bool BoundManager::consistentBounds() const
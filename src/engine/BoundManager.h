@@ -71,6 +71,12 @@ public:
      */
     unsigned registerNewVariable();
 
+    /*
+       Sets the bounds of a registered variable back to +/-inf, for when
+       its index is taken by a fresh variable.
+     */
+    void resetBounds( unsigned variable );
+
     /*
        Returns number of registered variables
      */
@@ -119,7 +125,9 @@ public:
     void clearTightenings();
 
     /*
-       Inform variable watchers of new tightenings.
+       Inform variable watchers of new tightenings. Only the variables
+       whose bounds were tightened are visited, and tightenings made by
+       the watchers while being informed are propagated in the same round.
      */
     void propagateTightenings();
 
@@ -236,6 +244,30 @@ private:
     Vector<CVC4::context::CDO<bool> *> _tightenedLower;
     Vector<CVC4::context::CDO<bool> *> _tightenedUpper;
 
+    /*
+       The variables with a pending tightening, each appearing once.
+       A context pop restores tightened flags which were cleared after
+       the corresponding push, but not the queue: this is detected by
+       comparing the number of times flags were cleared with its
+       context-dependent copy, in which case the queue is rebuilt.
+     */
+    Vector<unsigned> _tightenedVariables;
+    unsigned _numTighteningClearings;
+    CVC4::context::CDO<unsigned> _cdNumTighteningClearings;
+
+    /*
+       Queue a variable whose bound is tightened, unless it already has
+       a pending tightening.
+     */
+    void markTightened( Vector<CVC4::context::CDO<bool> *> &flags, unsigned variable );
+
+    /*
+       Rebuild the queue of tightened variables if a context pop has
+       restored flags that it does not hold, and record that the flags
+       are about to be cleared.
+     */
+    void prepareToClearTightenings();
+
     /*
        Record first tightening that violates bounds
      */
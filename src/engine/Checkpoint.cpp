@@ -0,0 +1,234 @@
+/*********************                                                        */
+/*! \file Checkpoint.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Checkpoint.h"
+
+#include "Debug.h"
+#include "File.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "SmtStackEntry.h"
+#include "SubQuerySerializer.h"
+#include "TimeUtils.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+static void freeStackEntries( SmtState &smtState )
+{
+    for ( auto &stackEntry : smtState._stack )
+        delete stackEntry;
+    smtState._stack.clear();
+}
+
+Checkpoint::Checkpoint( const String &filePath,
+                        const String &queryFingerprint,
+                        unsigned intervalInSeconds )
+    : _filePath( filePath )
+    , _queryFingerprint( queryFingerprint )
+    , _intervalInMicroSeconds( (unsigned long long)intervalInSeconds * 1000000 )
+    , _previousElapsedMicroSeconds( 0 )
+    , _startTime( TimeUtils::sampleMicro() )
+    , _lastSaveTime( _startTime )
+    , _numSolvedSubQueries( 0 )
+{
+}
+
+void Checkpoint::load()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    if ( !File::exists( _filePath ) )
+        throw MarabouError( MarabouError::FILE_DOESNT_EXIST, _filePath.ascii() );
+
+    File file( _filePath );
+    file.open( File::MODE_READ );
+
+    SubQuerySerializer::TokenReader header( file.readLine() );
+    header.expect( "checkpoint" );
+    String fingerprint = header.next();
+    if ( fingerprint != _queryFingerprint )
+        throw MarabouError(
+            MarabouError::CHECKPOINT_MISMATCH,
+            Stringf( "The checkpoint (%s) was written for a different query (%s), or with "
+                     "options that change the preprocessing",
+                     fingerprint.ascii(),
+                     _queryFingerprint.ascii() )
+                .ascii() );
+
+    SubQuerySerializer::TokenReader statistics( file.readLine() );
+    statistics.expect( "elapsed" );
+    _previousElapsedMicroSeconds = strtoull( statistics.next().ascii(), NULL, 10 );
+    statistics.expect( "solved" );
+    _numSolvedSubQueries = statistics.nextUnsigned();
+
+    SubQuerySerializer::TokenReader count( file.readLine() );
+    count.expect( "subqueries" );
+    unsigned numSubQueries = count.nextUnsigned();
+
+    _subQueries.clear();
+    for ( unsigned i = 0; i < numSubQueries; ++i )
+    {
+        // Each subquery is preceded by its id and number of lines
+        SubQuerySerializer::TokenReader subQueryHeader( file.readLine() );
+        String idToken = subQueryHeader.next();
+        unsigned numLines = subQueryHeader.nextUnsigned();
+
+        String serialized;
+        for ( unsigned j = 0; j < numLines; ++j )
+            serialized += file.readLine() + "\n";
+
+        _subQueries[idToken.substring( 3, idToken.length() - 3 )] = serialized;
+    }
+}
+
+void Checkpoint::getSubQueries( SubQueries &subQueries ) const
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    for ( const auto &subQuery : _subQueries )
+        subQueries.append( SubQuerySerializer::deserializeSubQuery( subQuery.second ) );
+}
+
+unsigned Checkpoint::getNumSubQueries() const
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _subQueries.size();
+}
+
+void Checkpoint::addSubQuery( const SubQuery &subQuery )
+{
+    addSubQuery( subQuery._queryId, SubQuerySerializer::serializeSubQuery( subQuery ) );
+}
+
+void Checkpoint::addSubQuery( const String &queryId, const String &serializedSubQuery )
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    _subQueries[queryId] = serializedSubQuery;
+}
+
+void Checkpoint::markSubQuerySolved( const String &queryId )
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+
+    if ( _subQueries.exists( queryId ) )
+    {
+        _subQueries.erase( queryId );
+        ++_numSolvedSubQueries;
+    }
+}
+
+void Checkpoint::updateSmtState( const String &queryId, const SmtState &smtState )
+{
+    String serialized;
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        if ( !_subQueries.exists( queryId ) )
+            return;
+        serialized = _subQueries[queryId];
+    }
+
+    // The (de)serialization happens outside of the lock, as it may take a
+    // while for deep stacks
+    std::unique_ptr<SubQuery> subQuery( SubQuerySerializer::deserializeSubQuery( serialized ) );
+    if ( subQuery->_smtState )
+        freeStackEntries( *subQuery->_smtState );
+    serialized = SubQuerySerializer::serializeSubQuery( *subQuery, &smtState );
+
+    std::lock_guard<std::mutex> lock( _mutex );
+    if ( _subQueries.exists( queryId ) )
+        _subQueries[queryId] = serialized;
+}
+
+void Checkpoint::save()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    saveWithoutLocking();
+}
+
+void Checkpoint::saveIfDue()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    if ( TimeUtils::timePassed( _lastSaveTime, TimeUtils::sampleMicro() ) >=
+         _intervalInMicroSeconds )
+        saveWithoutLocking();
+}
+
+bool Checkpoint::isDue( const struct timespec &lastTime ) const
+{
+    return TimeUtils::timePassed( lastTime, TimeUtils::sampleMicro() ) >= _intervalInMicroSeconds;
+}
+
+void Checkpoint::saveWithoutLocking()
+{
+    _lastSaveTime = TimeUtils::sampleMicro();
+
+    String temporaryFilePath = _filePath + ".tmp";
+    {
+        File file( temporaryFilePath );
+        file.open( File::MODE_WRITE_TRUNCATE );
+
+        file.write( Stringf( "checkpoint %s\n", _queryFingerprint.ascii() ) );
+        file.write( Stringf( "elapsed %llu solved %u\n",
+                             _previousElapsedMicroSeconds +
+                                 TimeUtils::timePassed( _startTime, _lastSaveTime ),
+                             _numSolvedSubQueries ) );
+        file.write( Stringf( "subqueries %u\n", _subQueries.size() ) );
+
+        for ( const auto &subQuery : _subQueries )
+        {
+            unsigned numLines = 0;
+            for ( unsigned i = 0; i < subQuery.second.length(); ++i )
+            {
+                if ( subQuery.second[i] == '\n' )
+                    ++numLines;
+            }
+
+            file.write( Stringf( "id:%s %u\n", subQuery.first.ascii(), numLines ) );
+            file.write( subQuery.second );
+        }
+    }
+
+    if ( std::rename( temporaryFilePath.ascii(), _filePath.ascii() ) != 0 )
+        throw MarabouError( MarabouError::CHECKPOINT_WRITE_FAILED,
+                            Stringf( "Cannot write checkpoint %s", _filePath.ascii() ).ascii() );
+}
+
+void Checkpoint::remove()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    std::remove( _filePath.ascii() );
+}
+
+unsigned long long Checkpoint::getTotalElapsedMicroSeconds() const
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _previousElapsedMicroSeconds +
+           TimeUtils::timePassed( _startTime, TimeUtils::sampleMicro() );
+}
+
+unsigned Checkpoint::getNumSolvedSubQueries() const
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _numSolvedSubQueries;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
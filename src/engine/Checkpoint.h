@@ -0,0 +1,130 @@
+/*********************                                                        */
+/*! \file Checkpoint.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A checkpoint of a (possibly split-and-conquer) search: the subqueries
+ ** that are not solved yet, each with the latest known SmtCore state of the
+ ** search on it, plus some accumulated statistics. The checkpoint is
+ ** written to disk periodically, and a later run can resume from it.
+ **
+ ** Without snc, the search is represented as a single root subquery with an
+ ** empty split.
+ **
+ ** All methods are thread-safe.
+
+ **/
+
+#ifndef __Checkpoint_h__
+#define __Checkpoint_h__
+
+#include "Map.h"
+#include "MString.h"
+#include "SmtState.h"
+#include "SubQuery.h"
+
+#include <mutex>
+
+class Checkpoint
+{
+public:
+    Checkpoint( const String &filePath,
+                const String &queryFingerprint,
+                unsigned intervalInSeconds );
+
+    /*
+      Read the checkpoint file, which must belong to the same query. The
+      subqueries it holds become the unsolved subqueries.
+    */
+    void load();
+
+    /*
+      The unsolved subqueries. The caller owns the returned subqueries.
+    */
+    void getSubQueries( SubQueries &subQueries ) const;
+    unsigned getNumSubQueries() const;
+
+    /*
+      Keep track of the unsolved subqueries: subqueries are added when they
+      are created, and are marked solved once they are solved or replaced
+      by their children.
+    */
+    void addSubQuery( const SubQuery &subQuery );
+    void addSubQuery( const String &queryId, const String &serializedSubQuery );
+    void markSubQuerySolved( const String &queryId );
+
+    /*
+      Record the current SmtCore state of the search on an unsolved
+      subquery, so that resuming does not start the subquery over.
+    */
+    void updateSmtState( const String &queryId, const SmtState &smtState );
+
+    /*
+      Write the checkpoint file. The file is replaced atomically, so a run
+      that is killed while saving leaves the previous checkpoint intact.
+    */
+    void save();
+
+    /*
+      Save, if the checkpoint interval has passed since the last save
+    */
+    void saveIfDue();
+
+    /*
+      Whether the checkpoint interval has passed since the given time. Used
+      by the engines to decide when to record their SmtCore state.
+    */
+    bool isDue( const struct timespec &lastTime ) const;
+
+    /*
+      Remove the checkpoint file, once the query is settled
+    */
+    void remove();
+
+    /*
+      Statistics accumulated over all the runs that contributed to the
+      checkpoint
+    */
+    unsigned long long getTotalElapsedMicroSeconds() const;
+    unsigned getNumSolvedSubQueries() const;
+
+private:
+    String _filePath;
+    String _queryFingerprint;
+    unsigned long long _intervalInMicroSeconds;
+
+    /*
+      Serialized unsolved subqueries, by query id
+    */
+    Map<String, String> _subQueries;
+
+    /*
+      Time spent by the runs that contributed to the loaded checkpoint, and
+      the start time of the current run
+    */
+    unsigned long long _previousElapsedMicroSeconds;
+    struct timespec _startTime;
+    struct timespec _lastSaveTime;
+
+    unsigned _numSolvedSubQueries;
+
+    mutable std::mutex _mutex;
+
+    void saveWithoutLocking();
+};
+
+#endif // __Checkpoint_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
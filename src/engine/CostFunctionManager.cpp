@@ -19,7 +19,9 @@
 #include "FloatUtils.h"
 #include "ITableau.h"
 #include "MarabouError.h"
+#include "Statistics.h"
 #include "TableauRow.h"
+#include "VectorKernels.h"
 
 CostFunctionManager::CostFunctionManager( ITableau *tableau )
     : _tableau( tableau )
@@ -29,6 +31,8 @@ CostFunctionManager::CostFunctionManager( ITableau *tableau )
     , _n( 0 )
     , _m( 0 )
     , _costFunctionStatus( COST_FUNCTION_INVALID )
+    , _numUpdatesSinceComputation( 0 )
+    , _statistics( NULL )
     , _ANColumn( NULL )
 {
 }
@@ -303,6 +307,10 @@ void CostFunctionManager::computeMultipliers()
 
 void CostFunctionManager::computeReducedCosts()
 {
+    _numUpdatesSinceComputation = 0;
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_COST_FUNCTION_COMPUTATIONS );
+
     for ( unsigned i = 0; i < _n - _m; ++i )
         computeReducedCost( i );
 }
@@ -378,14 +386,16 @@ double CostFunctionManager::updateCostFunctionForPivot( unsigned enteringVariabl
     ASSERT( _tableau->getM() == _m );
     ASSERT( _tableau->getN() == _n );
 
+    // There is nothing to update if the cost function is going to be recomputed anyway
+    if ( costFunctionInvalid() )
+        return 0;
+
     /*
       The current reduced cost of the entering variable is stored in
       _costFunction, but since we have the change column we can compute a
       more accurate version from scratch
     */
-    double enteringVariableCost = 0;
-    for ( unsigned i = 0; i < _m; ++i )
-        enteringVariableCost -= _basicCosts[i] * changeColumn[i];
+    double enteringVariableCost = -VectorKernels::dot( _basicCosts, changeColumn, _m );
 
     double normalizedError =
         FloatUtils::abs( enteringVariableCost - _costFunction[enteringVariableIndex] ) /
@@ -409,7 +419,14 @@ double CostFunctionManager::updateCostFunctionForPivot( unsigned enteringVariabl
     // The entering varibale is non-basic, so it is within bounds.
     _basicCosts[leavingVariableIndex] = 0;
 
-    _costFunctionStatus = ICostFunctionManager::COST_FUNCTION_UPDATED;
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_COST_FUNCTION_UPDATES );
+
+    if ( ++_numUpdatesSinceComputation >= GlobalConfiguration::COST_FUNCTION_RECOMPUTATION_FREQUENCY )
+        _costFunctionStatus = ICostFunctionManager::COST_FUNCTION_INVALID;
+    else
+        _costFunctionStatus = ICostFunctionManager::COST_FUNCTION_UPDATED;
+
     return normalizedError;
 }
 
@@ -456,6 +473,11 @@ const SparseUnsortedList *CostFunctionManager::createRowOfCostFunction() const
     return costRow;
 }
 
+void CostFunctionManager::setStatistics( Statistics *statistics )
+{
+    _statistics = statistics;
+}
+
 //
 // Local Variables:
 // compile-command: "make -C ../.. "
@@ -21,6 +21,7 @@
 #include "SparseUnsortedList.h"
 
 class ITableau;
+class Statistics;
 
 class CostFunctionManager : public ICostFunctionManager
 {
@@ -68,7 +69,9 @@ public:
 
     /*
       Update the cost fucntion just before a coming pivot step, to avoid having to compute
-      it from scratch afterwards.
+      it from scratch afterwards. An invalid cost function is not updated, and after
+      COST_FUNCTION_RECOMPUTATION_FREQUENCY consecutive updates the cost function is
+      invalidated, so that the accumulated numerical error is discarded.
     */
     double updateCostFunctionForPivot( unsigned enteringVariableIndex,
                                        unsigned leavingVariableIndex,
@@ -98,6 +101,11 @@ public:
     */
     const SparseUnsortedList *createRowOfCostFunction() const;
 
+    /*
+      Have the cost function manager start reporting statistics.
+    */
+    void setStatistics( Statistics *statistics );
+
 private:
     /*
       The tableau.
@@ -122,6 +130,17 @@ private:
     */
     CostFunctionStatus _costFunctionStatus;
 
+    /*
+      The number of incremental updates since the reduced costs were last
+      computed from scratch.
+    */
+    unsigned _numUpdatesSinceComputation;
+
+    /*
+      Statistics collection
+    */
+    Statistics *_statistics;
+
     /*
       Work memeory
     */
@@ -0,0 +1,394 @@
+/*********************                                                        */
+/*! \file DnCCoordinator.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "DnCCoordinator.h"
+
+#include "CommonError.h"
+#include "Debug.h"
+#include "DnCWorker.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "SubQuerySerializer.h"
+#include "TimeUtils.h"
+
+const char *DnCCoordinator::HELLO = "HELLO";
+const char *DnCCoordinator::WELCOME = "WELCOME";
+const char *DnCCoordinator::REJECT = "REJECT";
+const char *DnCCoordinator::SUBQUERY = "SUBQUERY";
+const char *DnCCoordinator::RESULT = "RESULT";
+const char *DnCCoordinator::QUIT = "QUIT";
+
+DnCCoordinator::DnCCoordinator( const String &address,
+                                const String &queryFingerprint,
+                                SnCDivideStrategy divideStrategy,
+                                unsigned onlineDivides,
+                                float timeoutFactor,
+                                bool restoreTreeStates,
+                                unsigned verbosity )
+    : _address( address )
+    , _queryFingerprint( queryFingerprint )
+    , _divideStrategy( divideStrategy )
+    , _onlineDivides( onlineDivides )
+    , _timeoutFactor( timeoutFactor )
+    , _restoreTreeStates( restoreTreeStates )
+    , _verbosity( verbosity )
+    , _listener( NULL )
+    , _nextWorkerId( 0 )
+    , _numUnsolvedSubQueries( 0 )
+    , _checkpoint( NULL )
+{
+}
+
+DnCCoordinator::~DnCCoordinator()
+{
+    freeMemoryIfNeeded();
+}
+
+void DnCCoordinator::freeMemoryIfNeeded()
+{
+    for ( auto &worker : _workers )
+    {
+        delete worker->_socket;
+        delete worker;
+    }
+    _workers.clear();
+
+    if ( _listener )
+    {
+        delete _listener;
+        _listener = NULL;
+    }
+}
+
+void DnCCoordinator::setCheckpoint( Checkpoint *checkpoint )
+{
+    _checkpoint = checkpoint;
+}
+
+void DnCCoordinator::listen()
+{
+    _listener = new Socket( _address );
+    _listener->listen();
+
+    if ( _verbosity > 0 )
+        printf( "DnCCoordinator: waiting for workers on %s\n", _address.ascii() );
+}
+
+String DnCCoordinator::composeMessage( const String &type, const String &body )
+{
+    return type + "\n" + body;
+}
+
+void DnCCoordinator::decomposeMessage( const String &message, String &type, String &body )
+{
+    size_t separator = message.find( "\n" );
+    if ( separator == std::string::npos )
+    {
+        type = message;
+        body = "";
+        return;
+    }
+
+    type = message.substring( 0, separator );
+    body = message.substring( separator + 1, message.length() - separator - 1 );
+}
+
+DnCManager::DnCExitCode DnCCoordinator::solve( SubQueries &subQueries,
+                                                unsigned long long timeoutInMicroSeconds )
+{
+    ASSERT( _listener );
+
+    for ( auto &subQuery : subQueries )
+    {
+        _pendingSubQueries.append( SubQuerySerializer::serializeSubQuery( *subQuery ) );
+        delete subQuery;
+    }
+    subQueries.clear();
+    _numUnsolvedSubQueries = _pendingSubQueries.size();
+
+    struct timespec startTime = TimeUtils::sampleMicro();
+    DnCManager::DnCExitCode exitCode = DnCManager::NOT_DONE;
+
+    while ( exitCode == DnCManager::NOT_DONE )
+    {
+        if ( _numUnsolvedSubQueries <= 0 )
+        {
+            exitCode = DnCManager::UNSAT;
+            break;
+        }
+
+        if ( timeoutInMicroSeconds > 0 &&
+             TimeUtils::timePassed( startTime, TimeUtils::sampleMicro() ) >=
+                 timeoutInMicroSeconds )
+        {
+            exitCode = DnCManager::TIMEOUT;
+            break;
+        }
+
+        if ( _checkpoint )
+            _checkpoint->saveIfDue();
+
+        dispatchPendingSubQueries();
+
+        List<Socket *> sockets;
+        sockets.append( _listener );
+        for ( const auto &worker : _workers )
+            sockets.append( worker->_socket );
+
+        List<Socket *> readySockets;
+        Socket::waitForInput(
+            sockets,
+            GlobalConfiguration::DNC_COORDINATOR_POLLING_INTERVAL_IN_MILLISECONDS,
+            readySockets );
+
+        for ( const auto &socket : readySockets )
+        {
+            if ( socket == _listener )
+            {
+                acceptWorker();
+                continue;
+            }
+
+            WorkerConnection *worker = NULL;
+            for ( const auto &candidate : _workers )
+            {
+                if ( candidate->_socket == socket )
+                    worker = candidate;
+            }
+            ASSERT( worker );
+
+            String message;
+            bool received = false;
+            try
+            {
+                received = worker->_socket->receiveMessage( message );
+            }
+            catch ( const CommonError & )
+            {
+                received = false;
+            }
+
+            if ( !received )
+            {
+                disconnectWorker( worker );
+                continue;
+            }
+
+            exitCode = handleMessage( worker, message );
+            if ( exitCode != DnCManager::NOT_DONE )
+                break;
+        }
+    }
+
+    sendQuitToAllWorkers();
+    freeMemoryIfNeeded();
+
+    return exitCode;
+}
+
+void DnCCoordinator::acceptWorker()
+{
+    Socket *socket = _listener->accept();
+    WorkerConnection *worker = new WorkerConnection( socket, _nextWorkerId++ );
+    _workers.append( worker );
+
+    DNC_COORDINATOR_LOG( Stringf( "Worker %u connected", worker->_id ).ascii() );
+}
+
+void DnCCoordinator::disconnectWorker( WorkerConnection *worker )
+{
+    if ( _verbosity > 0 )
+        printf( "DnCCoordinator: worker %u disconnected\n", worker->_id );
+
+    // Nobody is going to report on this subquery, so it has to be solved again
+    if ( worker->_busy )
+        _pendingSubQueries.appendHead( worker->_currentSubQuery );
+
+    _workers.erase( worker );
+    delete worker->_socket;
+    delete worker;
+}
+
+void DnCCoordinator::dispatchPendingSubQueries()
+{
+    for ( auto &worker : _workers )
+    {
+        if ( _pendingSubQueries.empty() )
+            return;
+
+        if ( !worker->_welcomed || worker->_busy )
+            continue;
+
+        String subQuery = _pendingSubQueries.front();
+        _pendingSubQueries.erase( _pendingSubQueries.begin() );
+
+        worker->_busy = true;
+        worker->_currentSubQuery = subQuery;
+
+        try
+        {
+            worker->_socket->sendMessage( composeMessage( SUBQUERY, subQuery ) );
+        }
+        catch ( const CommonError & )
+        {
+            // The worker is gone, the subquery is put back into the queue
+            // when the hang-up is noticed
+        }
+    }
+}
+
+DnCManager::DnCExitCode DnCCoordinator::handleMessage( WorkerConnection *worker,
+                                                        const String &message )
+{
+    String type;
+    String body;
+    decomposeMessage( message, type, body );
+
+    if ( type == HELLO )
+    {
+        if ( body.trim() != _queryFingerprint )
+        {
+            printf( "DnCCoordinator: rejecting worker %u, its query (%s) differs from the "
+                    "coordinator's (%s)\n",
+                    worker->_id,
+                    body.trim().ascii(),
+                    _queryFingerprint.ascii() );
+            worker->_socket->sendMessage( composeMessage( REJECT, "query mismatch" ) );
+            disconnectWorker( worker );
+            return DnCManager::NOT_DONE;
+        }
+
+        worker->_welcomed = true;
+        worker->_socket->sendMessage(
+            composeMessage( WELCOME,
+                            Stringf( "%u %u %s %u",
+                                     (unsigned)_divideStrategy,
+                                     _onlineDivides,
+                                     SubQuerySerializer::serializeDouble( _timeoutFactor ).ascii(),
+                                     _restoreTreeStates ? 1 : 0 ) ) );
+
+        if ( _verbosity > 0 )
+            printf( "DnCCoordinator: worker %u joined\n", worker->_id );
+        return DnCManager::NOT_DONE;
+    }
+
+    if ( !worker->_welcomed )
+        throw MarabouError( MarabouError::DNC_PROTOCOL_ERROR,
+                            Stringf( "Unexpected %s message before handshake", type.ascii() )
+                                .ascii() );
+
+    if ( type == SUBQUERY )
+    {
+        // A new subquery created by a worker that timed out
+        _pendingSubQueries.append( body );
+        ++_numUnsolvedSubQueries;
+
+        if ( _checkpoint )
+        {
+            SubQuerySerializer::TokenReader reader( body );
+            reader.expect( "subquery" );
+            String queryIdToken = reader.next();
+            _checkpoint->addSubQuery( queryIdToken.substring( 3, queryIdToken.length() - 3 ),
+                                      body );
+        }
+        return DnCManager::NOT_DONE;
+    }
+
+    if ( type != RESULT )
+        throw MarabouError( MarabouError::DNC_PROTOCOL_ERROR,
+                            Stringf( "Unexpected message type %s", type.ascii() ).ascii() );
+
+    SubQuerySerializer::TokenReader reader( body );
+    IEngine::ExitCode result = (IEngine::ExitCode)reader.nextUnsigned();
+    String queryIdToken = reader.next();
+    String queryId = queryIdToken.substring( 3, queryIdToken.length() - 3 );
+
+    worker->_busy = false;
+    worker->_currentSubQuery = "";
+
+    if ( _verbosity > 0 )
+        printf( "Worker %u: Query %s %s, %d tasks remaining\n",
+                worker->_id,
+                queryId.ascii(),
+                DnCWorker::exitCodeToString( result ).ascii(),
+                _numUnsolvedSubQueries - 1 );
+
+    switch ( result )
+    {
+    case IEngine::UNSAT:
+    case IEngine::TIMEOUT:
+        // Upon a timeout, the children have already been received
+        --_numUnsolvedSubQueries;
+        if ( _checkpoint )
+            _checkpoint->markSubQuerySolved( queryId );
+        return DnCManager::NOT_DONE;
+
+    case IEngine::SAT:
+        --_numUnsolvedSubQueries;
+        parseSolution( body );
+        return DnCManager::SAT;
+
+    case IEngine::QUIT_REQUESTED:
+        return DnCManager::QUIT_REQUESTED;
+
+    default:
+        return DnCManager::ERROR;
+    }
+}
+
+void DnCCoordinator::parseSolution( const String &body )
+{
+    SubQuerySerializer::TokenReader reader( body );
+
+    // Skip the exit code and the query id
+    reader.next();
+    reader.next();
+
+    unsigned numberOfVariables = reader.nextUnsigned();
+    for ( unsigned i = 0; i < numberOfVariables; ++i )
+    {
+        unsigned variable = reader.nextUnsigned();
+        _solution[variable] = reader.nextDouble();
+    }
+}
+
+const Map<unsigned, double> &DnCCoordinator::getSolution() const
+{
+    return _solution;
+}
+
+void DnCCoordinator::sendQuitToAllWorkers()
+{
+    for ( auto &worker : _workers )
+    {
+        try
+        {
+            worker->_socket->sendMessage( composeMessage( QUIT, "" ) );
+        }
+        catch ( const CommonError & )
+        {
+            // The worker is already gone
+        }
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,172 @@
+/*********************                                                        */
+/*! \file DnCCoordinator.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The coordinator side of distributed split-and-conquer solving. Remote
+ ** worker processes (see DnCRemoteWorker) connect to the coordinator over a
+ ** TCP or Unix domain socket. The coordinator hands out serialized
+ ** subqueries, one at a time, and collects results and newly created
+ ** subqueries.
+ **
+ ** Every message is a single line holding the message type, optionally
+ ** followed by a body:
+ **
+ **   worker -> coordinator:  HELLO <query fingerprint>
+ **                           SUBQUERY <serialized subquery>
+ **                           RESULT <exit code> <query id> [<solution>]
+ **   coordinator -> worker:  WELCOME <solving parameters>
+ **                           REJECT <reason>
+ **                           SUBQUERY <serialized subquery>
+ **                           QUIT
+
+ **/
+
+#ifndef __DnCCoordinator_h__
+#define __DnCCoordinator_h__
+
+#include "Checkpoint.h"
+#include "DnCManager.h"
+#include "List.h"
+#include "MString.h"
+#include "Map.h"
+#include "SnCDivideStrategy.h"
+#include "Socket.h"
+#include "SubQuery.h"
+
+#define DNC_COORDINATOR_LOG( x, ... )                                                              \
+    LOG( GlobalConfiguration::DNC_MANAGER_LOGGING, "DnCCoordinator: %s\n", x )
+
+class DnCCoordinator
+{
+public:
+    /*
+      Message types
+    */
+    static const char *HELLO;
+    static const char *WELCOME;
+    static const char *REJECT;
+    static const char *SUBQUERY;
+    static const char *RESULT;
+    static const char *QUIT;
+
+    DnCCoordinator( const String &address,
+                    const String &queryFingerprint,
+                    SnCDivideStrategy divideStrategy,
+                    unsigned onlineDivides,
+                    float timeoutFactor,
+                    bool restoreTreeStates,
+                    unsigned verbosity );
+    ~DnCCoordinator();
+
+    /*
+      Start listening for remote workers.
+    */
+    void listen();
+
+    /*
+      Hand the subqueries out to the remote workers until all of them are
+      solved, a satisfying assignment is found, an error occurs or the
+      timeout (0 means no timeout) is reached. Takes ownership of the
+      subqueries.
+    */
+    DnCManager::DnCExitCode solve( SubQueries &subQueries,
+                                   unsigned long long timeoutInMicroSeconds );
+
+    /*
+      Keep the given checkpoint up to date with the subqueries reported by
+      the workers, and save it periodically
+    */
+    void setCheckpoint( Checkpoint *checkpoint );
+
+    /*
+      The satisfying assignment reported by a remote worker, in terms of
+      the variables of the original input query
+    */
+    const Map<unsigned, double> &getSolution() const;
+
+    /*
+      Compose and decompose messages
+    */
+    static String composeMessage( const String &type, const String &body );
+    static void decomposeMessage( const String &message, String &type, String &body );
+
+private:
+    struct WorkerConnection
+    {
+        WorkerConnection( Socket *socket, unsigned id )
+            : _socket( socket )
+            , _id( id )
+            , _welcomed( false )
+            , _busy( false )
+        {
+        }
+
+        Socket *_socket;
+        unsigned _id;
+        bool _welcomed;
+        bool _busy;
+
+        /*
+          The subquery the worker is currently solving. It is put back into
+          the queue if the worker disconnects before reporting a result.
+        */
+        String _currentSubQuery;
+    };
+
+    String _address;
+    String _queryFingerprint;
+    SnCDivideStrategy _divideStrategy;
+    unsigned _onlineDivides;
+    float _timeoutFactor;
+    bool _restoreTreeStates;
+    unsigned _verbosity;
+
+    Socket *_listener;
+    List<WorkerConnection *> _workers;
+    unsigned _nextWorkerId;
+
+    /*
+      Serialized subqueries that have not been handed out yet
+    */
+    List<String> _pendingSubQueries;
+    int _numUnsolvedSubQueries;
+
+    Map<unsigned, double> _solution;
+
+    /*
+      The checkpoint of the search, if checkpointing is enabled (not owned)
+    */
+    Checkpoint *_checkpoint;
+
+    void acceptWorker();
+    void dispatchPendingSubQueries();
+    void disconnectWorker( WorkerConnection *worker );
+
+    /*
+      Handle one message from a worker. Returns NOT_DONE unless the message
+      settles the query.
+    */
+    DnCManager::DnCExitCode handleMessage( WorkerConnection *worker, const String &message );
+
+    void parseSolution( const String &solution );
+
+    void sendQuitToAllWorkers();
+    void freeMemoryIfNeeded();
+};
+
+#endif // __DnCCoordinator_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
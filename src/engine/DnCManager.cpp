@@ -16,9 +16,11 @@
 #include "DnCManager.h"
 
 #include "Debug.h"
+#include "DnCCoordinator.h"
 #include "DnCWorker.h"
 #include "GetCPUData.h"
 #include "GlobalConfiguration.h"
+#include "IntervalPropagationDivider.h"
 #include "LargestIntervalDivider.h"
 #include "MStringf.h"
 #include "MarabouError.h"
@@ -28,9 +30,12 @@
 #include "Query.h"
 #include "QueryDivider.h"
 #include "SnCDivideStrategy.h"
+#include "SubQuerySerializer.h"
+#include "ThreadPool.h"
 #include "TimeUtils.h"
 #include "Vector.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -52,8 +57,13 @@ void DnCManager::dncSolve( WorkerQueue *workload,
                            bool restoreTreeStates,
                            unsigned verbosity,
                            unsigned seed,
-                           bool parallelDeepSoI )
+                           bool parallelDeepSoI,
+                           Checkpoint *checkpoint,
+                           Options *options )
 {
+    // Run with the options of the thread that spawned the worker
+    Options::Scope optionsScope( options );
+
     unsigned cpuId = 0;
     (void)threadId;
     (void)cpuId;
@@ -75,6 +85,12 @@ void DnCManager::dncSolve( WorkerQueue *workload,
                       divideStrategy,
                       verbosity,
                       parallelDeepSoI );
+    if ( checkpoint )
+    {
+        engine->setCheckpoint( checkpoint );
+        worker.setCheckpoint( checkpoint );
+    }
+
     while ( !shouldQuitSolving.load() )
     {
         worker.popOneSubQueryAndSolve( restoreTreeStates );
@@ -90,6 +106,9 @@ DnCManager::DnCManager( IQuery *inputQuery )
     , _verbosity( Options::get()->getInt( Options::VERBOSITY ) )
     , _runParallelDeepSoI( Options::get()->getBool( Options::PARALLEL_DEEPSOI ) )
     , _sncSplittingStrategy( Options::get()->getSnCDivideStrategy() )
+    , _solvedByRemoteWorkers( false )
+    , _quitRequested( false )
+    , _progressReporter( NULL )
 {
 }
 
@@ -127,12 +146,22 @@ void DnCManager::solve()
 
     struct timespec startTime = TimeUtils::sampleMicro();
 
+    String coordinatorAddress = Options::get()->getString( Options::DNC_COORDINATOR_ADDRESS );
+    if ( coordinatorAddress.length() > 0 )
+    {
+        solveWithRemoteWorkers( coordinatorAddress, timeoutInMicroSeconds );
+        return;
+    }
+
     unsigned numWorkers = Options::get()->getInt( Options::NUM_WORKERS );
+    unsigned numSbtThreads =
+        Options::get()->getInt( Options::NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS );
 
 #ifdef ENABLE_OPENBLAS
     // When preprocess the input query with SBT, we leverage multi-threading.
     openblas_set_num_threads( numWorkers );
 #endif
+    ThreadPool::get()->setNumberOfThreads( std::max( numWorkers, numSbtThreads ) );
 
     // Preprocess the input query and create an engine for each of the threads
     if ( !createEngines( numWorkers ) )
@@ -141,11 +170,28 @@ void DnCManager::solve()
         return;
     }
 
+    if ( _quitRequested )
+    {
+        _exitCode = DnCManager::QUIT_REQUESTED;
+        return;
+    }
+
+    if ( _progressReporter )
+    {
+        _baseEngine->resolveProgressVariables( *_progressReporter );
+        for ( auto &engine : _engines )
+            engine->setProgressReporter( _progressReporter );
+    }
+
 #ifdef ENABLE_OPENBLAS
     // Now each worker occupies one thread. So SBT performed during the search
     // will be single-threaded.
     openblas_set_num_threads( 1 );
 #endif
+    // Symbolic bound tightening may still use the threads beyond the
+    // workers, which they share
+    ThreadPool::get()->setNumberOfThreads(
+        numSbtThreads > numWorkers ? numSbtThreads - numWorkers + 1 : 1 );
 
     // Prepare the mechanism through which we can ask the engines to quit
     List<std::atomic_bool *> quitThreads;
@@ -160,7 +206,10 @@ void DnCManager::solve()
 
     SubQueries subQueries;
     if ( !_runParallelDeepSoI )
-        initialDivide( subQueries );
+    {
+        createCheckpointIfNeeded();
+        createInitialSubQueries( subQueries );
+    }
     else
     {
         for ( unsigned i = 0; i < numWorkers; ++i )
@@ -176,6 +225,14 @@ void DnCManager::solve()
         }
     }
 
+    if ( subQueries.empty() )
+    {
+        // The previous run solved all subqueries right before it stopped
+        _exitCode = DnCManager::UNSAT;
+        finalizeCheckpoint();
+        return;
+    }
+
     // Create objects shared across workers
     _numUnsolvedSubQueries = _runParallelDeepSoI ? 1 : subQueries.size();
     std::atomic_bool shouldQuitSolving( false );
@@ -218,7 +275,9 @@ void DnCManager::solve()
                                         restoreTreeStates,
                                         _verbosity,
                                         _runParallelDeepSoI ? seed + threadId : seed,
-                                        _runParallelDeepSoI ) );
+                                        _runParallelDeepSoI,
+                                        _checkpoint.get(),
+                                        Options::get() ) );
     }
 
     // Wait until either all subQueries are solved or a satisfying assignment is
@@ -226,13 +285,16 @@ void DnCManager::solve()
     while ( !shouldQuitSolving.load() )
     {
         updateTimeoutReached( startTime, timeoutInMicroSeconds );
-        if ( _timeoutReached )
+        if ( _timeoutReached || _quitRequested )
             shouldQuitSolving = true;
         else
+        {
+            if ( _checkpoint )
+                _checkpoint->saveIfDue();
             std::this_thread::sleep_for( std::chrono::milliseconds( numWorkers ) );
+        }
     }
 
-
     // Now that we are done, tell all workers to quit
     for ( auto &quitThread : quitThreads )
         *quitThread = true;
@@ -241,9 +303,63 @@ void DnCManager::solve()
         thread.join();
 
     updateDnCExitCode();
+    finalizeCheckpoint();
     return;
 }
 
+void DnCManager::quitSignal()
+{
+    _quitRequested = true;
+}
+
+void DnCManager::setProgressReporter( ProgressReporter *reporter )
+{
+    _progressReporter = reporter;
+}
+
+void DnCManager::solveWithRemoteWorkers( const String &coordinatorAddress,
+                                         unsigned long long timeoutInMicroSeconds )
+{
+    if ( _runParallelDeepSoI )
+        throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                            "Parallel DeepSoI with remote workers" );
+
+    // Only the base engine is needed locally: it performs the initial divide,
+    // and the remote workers reproduce its preprocessing
+    if ( !createEngines( 1 ) )
+    {
+        _exitCode = DnCManager::UNSAT;
+        return;
+    }
+
+    createCheckpointIfNeeded();
+
+    // Divide first, as this settles the splitting strategy the workers use
+    SubQueries subQueries;
+    createInitialSubQueries( subQueries );
+
+    String queryFingerprint =
+        SubQuerySerializer::computeQueryFingerprint( *_baseEngine->getQuery() );
+    DnCCoordinator coordinator( coordinatorAddress,
+                                queryFingerprint,
+                                _sncSplittingStrategy,
+                                Options::get()->getInt( Options::NUM_ONLINE_DIVIDES ),
+                                Options::get()->getFloat( Options::TIMEOUT_FACTOR ),
+                                Options::get()->getBool( Options::RESTORE_TREE_STATES ),
+                                _verbosity );
+    coordinator.setCheckpoint( _checkpoint.get() );
+    coordinator.listen();
+
+    _exitCode = coordinator.solve( subQueries, timeoutInMicroSeconds );
+    if ( _exitCode == DnCManager::SAT )
+    {
+        _solvedByRemoteWorkers = true;
+        _remoteSolution = coordinator.getSolution();
+    }
+
+    finalizeCheckpoint();
+}
+
 DnCManager::DnCExitCode DnCManager::getExitCode() const
 {
     return _exitCode;
@@ -274,7 +390,7 @@ void DnCManager::updateDnCExitCode()
         _exitCode = DnCManager::TIMEOUT;
     else if ( _numUnsolvedSubQueries.load() <= 0 )
         _exitCode = DnCManager::UNSAT;
-    else if ( hasQuitRequested )
+    else if ( hasQuitRequested || _quitRequested )
         _exitCode = DnCManager::QUIT_REQUESTED;
     else if ( hasError )
         _exitCode = DnCManager::ERROR;
@@ -309,6 +425,13 @@ String DnCManager::getResultString()
 
 void DnCManager::extractSolution( IQuery &inputQuery )
 {
+    if ( _solvedByRemoteWorkers )
+    {
+        for ( const auto &assignment : _remoteSolution )
+            inputQuery.setSolutionValue( assignment.first, assignment.second );
+        return;
+    }
+
     ASSERT( _engineWithSATAssignment != nullptr );
     _engineWithSATAssignment->extractSolution( inputQuery, _baseEngine->getPreprocessor() );
 }
@@ -394,7 +517,69 @@ bool DnCManager::createEngines( unsigned numberOfEngines )
     return true;
 }
 
-void DnCManager::initialDivide( SubQueries &subQueries )
+void DnCManager::createCheckpointIfNeeded()
+{
+    String checkpointFile = Options::get()->getString( Options::CHECKPOINT_FILE );
+    if ( checkpointFile.length() == 0 )
+        return;
+
+    _checkpoint = std::unique_ptr<Checkpoint>(
+        new Checkpoint( checkpointFile,
+                        SubQuerySerializer::computeQueryFingerprint( *_baseEngine->getQuery() ),
+                        Options::get()->getInt( Options::CHECKPOINT_INTERVAL ) ) );
+}
+
+void DnCManager::createInitialSubQueries( SubQueries &subQueries )
+{
+    if ( !_checkpoint || !Options::get()->getBool( Options::RESUME ) )
+    {
+        initialDivide( subQueries );
+        if ( _checkpoint )
+        {
+            for ( const auto &subQuery : subQueries )
+                _checkpoint->addSubQuery( *subQuery );
+            _checkpoint->save();
+        }
+        return;
+    }
+
+    _checkpoint->load();
+    _checkpoint->getSubQueries( subQueries );
+
+    for ( const auto &subQuery : subQueries )
+    {
+        if ( subQuery->_queryId == "" )
+        {
+            for ( auto &other : subQueries )
+                delete other;
+            subQueries.clear();
+            throw MarabouError( MarabouError::CHECKPOINT_MISMATCH,
+                                "The checkpoint was written without snc" );
+        }
+    }
+
+    // The online divides need the splitting strategy of the initial divide
+    decideSplittingStrategy();
+
+    printf( "Resuming from checkpoint: %u subqueries left, %u solved, %.2lf seconds spent so "
+            "far\n",
+            subQueries.size(),
+            _checkpoint->getNumSolvedSubQueries(),
+            _checkpoint->getTotalElapsedMicroSeconds() / 1000000.0 );
+}
+
+void DnCManager::finalizeCheckpoint()
+{
+    if ( !_checkpoint )
+        return;
+
+    if ( _exitCode == DnCManager::SAT || _exitCode == DnCManager::UNSAT )
+        _checkpoint->remove();
+    else
+        _checkpoint->save();
+}
+
+void DnCManager::decideSplittingStrategy()
 {
     if ( _sncSplittingStrategy == SnCDivideStrategy::Auto )
     {
@@ -413,6 +598,11 @@ void DnCManager::initialDivide( SubQueries &subQueries )
             _sncSplittingStrategy = SnCDivideStrategy::Polarity;
         }
     }
+}
+
+void DnCManager::initialDivide( SubQueries &subQueries )
+{
+    decideSplittingStrategy();
 
     auto split = std::unique_ptr<PiecewiseLinearCaseSplit>( new PiecewiseLinearCaseSplit() );
     std::unique_ptr<QueryDivider> queryDivider = nullptr;
@@ -423,8 +613,12 @@ void DnCManager::initialDivide( SubQueries &subQueries )
     else // Default is LargestInterval
     {
         const List<unsigned> inputVariables( _baseEngine->getInputVariables() );
-        queryDivider =
-            std::unique_ptr<QueryDivider>( new LargestIntervalDivider( inputVariables ) );
+        if ( _sncSplittingStrategy == SnCDivideStrategy::IntervalPropagation )
+            queryDivider = std::unique_ptr<QueryDivider>( new IntervalPropagationDivider(
+                inputVariables, _baseEngine->getNetworkLevelReasoner() ) );
+        else
+            queryDivider =
+                std::unique_ptr<QueryDivider>( new LargestIntervalDivider( inputVariables ) );
         Query *inputQuery = _baseEngine->getQuery();
         // Add bound as equations for each input variable
         for ( const auto &variable : inputVariables )
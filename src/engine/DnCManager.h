@@ -16,8 +16,10 @@
 #ifndef __DnCManager_h__
 #define __DnCManager_h__
 
+#include "Checkpoint.h"
 #include "Engine.h"
 #include "IQuery.h"
+#include "Map.h"
 #include "SnCDivideStrategy.h"
 #include "SubQuery.h"
 #include "Vector.h"
@@ -27,6 +29,7 @@
 #define DNC_MANAGER_LOG( x, ... )                                                                  \
     LOG( GlobalConfiguration::DNC_MANAGER_LOGGING, "DnCManager: %s\n", x )
 
+class Options;
 class Query;
 
 class DnCManager
@@ -80,6 +83,18 @@ public:
     */
     void extractSolution( IQuery &inputQuery );
 
+    /*
+      Ask the workers to stop solving. May be called from any thread,
+      before or during solve().
+    */
+    void quitSignal();
+
+    /*
+      Report the progress of every worker through the given reporter. Its
+      variables are resolved against the preprocessing of the base engine.
+    */
+    void setProgressReporter( ProgressReporter *reporter );
+
 private:
     /*
       Create and run a DnCWorker
@@ -96,7 +111,9 @@ private:
                           bool restoreTreeStates,
                           unsigned verbosity,
                           unsigned seed,
-                          bool parallelDeepSoI );
+                          bool parallelDeepSoI,
+                          Checkpoint *checkpoint,
+                          Options *options );
 
     /*
       Create the base engine from the network and property files,
@@ -104,12 +121,42 @@ private:
     */
     bool createEngines( unsigned numberOfEngines );
 
+    /*
+      Invoked when a coordinator address is given: perform the initial
+      divide locally and hand the subqueries to remote worker processes
+    */
+    void solveWithRemoteWorkers( const String &coordinatorAddress,
+                                 unsigned long long timeoutInMicroSeconds );
+
     /*
       Invoked in SnC mode.
       Divide up the input region and store them in subqueries
     */
     void initialDivide( SubQueries &subQueries );
 
+    /*
+      Resolve the Auto splitting strategy based on the processed query
+    */
+    void decideSplittingStrategy();
+
+    /*
+      If a checkpoint file is given, create the checkpoint of the search.
+      The checkpoint is identified by the processed query.
+    */
+    void createCheckpointIfNeeded();
+
+    /*
+      Obtain the subqueries to start from: either those stored in the
+      checkpoint when resuming, or those of the initial divide
+    */
+    void createInitialSubQueries( SubQueries &subQueries );
+
+    /*
+      Once solving ends, remove the checkpoint if the query is settled, and
+      save it otherwise
+    */
+    void finalizeCheckpoint();
+
     /*
       Read the exitCode of the engine of each thread, and update the manager's
       exitCode.
@@ -176,6 +223,28 @@ private:
       The strategy for dividing a query
     */
     SnCDivideStrategy _sncSplittingStrategy;
+
+    /*
+      When a remote worker found the satisfying assignment, the assignment
+      to the variables of the input query
+    */
+    bool _solvedByRemoteWorkers;
+    Map<unsigned, double> _remoteSolution;
+
+    /*
+      The checkpoint of the search, if checkpointing is enabled
+    */
+    std::unique_ptr<Checkpoint> _checkpoint;
+
+    /*
+      Whether quitting was requested through quitSignal()
+    */
+    std::atomic_bool _quitRequested;
+
+    /*
+      Reporting the progress of the workers, if requested
+    */
+    ProgressReporter *_progressReporter;
 };
 
 #endif // __DnCManager_h__
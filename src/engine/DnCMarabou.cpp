@@ -18,6 +18,7 @@
 
 #include "AcasParser.h"
 #include "DnCManager.h"
+#include "DnCRemoteWorker.h"
 #include "File.h"
 #include "MStringf.h"
 #include "MarabouError.h"
@@ -25,6 +26,7 @@
 #include "Options.h"
 #include "PropertyParser.h"
 #include "QueryLoader.h"
+#include "StatisticsStream.h"
 #include "VnnLibParser.h"
 
 DnCMarabou::DnCMarabou()
@@ -106,6 +108,14 @@ void DnCMarabou::run()
         exit( 0 );
     }
 
+    String coordinatorAddress = Options::get()->getString( Options::DNC_WORKER_ADDRESS );
+    if ( coordinatorAddress.length() > 0 )
+    {
+        // Serve subqueries for a coordinator, which reports the result
+        DnCRemoteWorker( coordinatorAddress, &_inputQuery ).run();
+        return;
+    }
+
     /*
       Step 3: initialize the DNC core
     */
@@ -125,6 +135,8 @@ void DnCMarabou::displayResults( unsigned long long microSecondsElapsed ) const
 {
     _dncManager->printResult();
     String resultString = _dncManager->getResultString();
+    StatisticsStream::writeSummary( resultString, microSecondsElapsed, NULL );
+
     // Create a summary file, if requested
     String summaryFilePath = Options::get()->getString( Options::SUMMARY_FILE );
     if ( summaryFilePath != "" )
@@ -0,0 +1,281 @@
+/*********************                                                        */
+/*! \file DnCRemoteWorker.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "DnCRemoteWorker.h"
+
+#include "CommonError.h"
+#include "Debug.h"
+#include "DnCCoordinator.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "Options.h"
+#include "SubQuerySerializer.h"
+#include "TimeUtils.h"
+
+#include <chrono>
+#include <thread>
+
+DnCRemoteWorker::DnCRemoteWorker( const String &coordinatorAddress, IQuery *inputQuery )
+    : _coordinatorAddress( coordinatorAddress )
+    , _inputQuery( inputQuery )
+    , _verbosity( Options::get()->getInt( Options::VERBOSITY ) )
+    , _workload( NULL )
+    , _numUnsolvedSubQueries( 0 )
+    , _shouldQuitSolving( false )
+{
+}
+
+DnCRemoteWorker::~DnCRemoteWorker()
+{
+    freeMemoryIfNeeded();
+}
+
+void DnCRemoteWorker::run()
+{
+    // Preprocess exactly like the coordinator's base engine does, so that
+    // variable indices and bounds in the subqueries line up
+    _engine = std::make_shared<Engine>();
+    if ( !_engine->processInputQuery( *_inputQuery ) )
+    {
+        // The coordinator reaches the same conclusion, and does not wait for
+        // any workers
+        printf( "DnCRemoteWorker: query solved by preprocessing, nothing to do\n" );
+        return;
+    }
+    _engine->setVerbosity( 0 );
+    _engine->setRandomSeed( Options::get()->getInt( Options::SEED ) );
+
+    SnCDivideStrategy divideStrategy = SnCDivideStrategy::LargestInterval;
+    unsigned onlineDivides = 0;
+    float timeoutFactor = 0;
+    bool restoreTreeStates = false;
+    if ( !connectToCoordinator( divideStrategy, onlineDivides, timeoutFactor, restoreTreeStates ) )
+        return;
+
+    _workload = new WorkerQueue( 0 );
+    DnCWorker worker( _workload,
+                      _engine,
+                      std::ref( _numUnsolvedSubQueries ),
+                      std::ref( _shouldQuitSolving ),
+                      0,
+                      onlineDivides,
+                      timeoutFactor,
+                      divideStrategy,
+                      _verbosity,
+                      false );
+
+    try
+    {
+        String message;
+        while ( _socket->receiveMessage( message ) )
+        {
+            String type;
+            String body;
+            DnCCoordinator::decomposeMessage( message, type, body );
+
+            if ( type == DnCCoordinator::QUIT )
+                break;
+
+            if ( type != DnCCoordinator::SUBQUERY )
+                throw MarabouError(
+                    MarabouError::DNC_PROTOCOL_ERROR,
+                    Stringf( "Unexpected message type %s", type.ascii() ).ascii() );
+
+            // If the solving is interrupted, the QUIT message is read next
+            handleSubQuery( worker, body, restoreTreeStates );
+        }
+    }
+    catch ( const CommonError &e )
+    {
+        // The coordinator may finish, and go away, while we are still
+        // reporting on a subquery
+        if ( e.getCode() != CommonError::SOCKET_FAILED )
+            throw;
+    }
+
+    if ( _verbosity > 0 )
+        printf( "DnCRemoteWorker: disconnected from %s\n", _coordinatorAddress.ascii() );
+
+    freeMemoryIfNeeded();
+}
+
+void DnCRemoteWorker::freeMemoryIfNeeded()
+{
+    if ( _workload )
+    {
+        SubQuery *subQuery = NULL;
+        while ( _workload->pop( subQuery ) )
+            delete subQuery;
+
+        delete _workload;
+        _workload = NULL;
+    }
+
+    if ( _socket )
+        _socket->close();
+}
+
+bool DnCRemoteWorker::connectToCoordinator( SnCDivideStrategy &divideStrategy,
+                                            unsigned &onlineDivides,
+                                            float &timeoutFactor,
+                                            bool &restoreTreeStates )
+{
+    enum {
+        MICROSECONDS_IN_SECOND = 1000000
+    };
+
+    _socket = std::unique_ptr<Socket>( new Socket( _coordinatorAddress ) );
+
+    struct timespec startTime = TimeUtils::sampleMicro();
+    unsigned long long connectionTimeout =
+        (unsigned long long)GlobalConfiguration::DNC_WORKER_CONNECTION_TIMEOUT_IN_SECONDS *
+        MICROSECONDS_IN_SECOND;
+
+    while ( !_socket->connect() )
+    {
+        if ( TimeUtils::timePassed( startTime, TimeUtils::sampleMicro() ) >= connectionTimeout )
+            throw CommonError( CommonError::SOCKET_FAILED,
+                               Stringf( "Cannot connect to coordinator at %s",
+                                        _coordinatorAddress.ascii() )
+                                   .ascii() );
+
+        std::this_thread::sleep_for( std::chrono::milliseconds(
+            GlobalConfiguration::DNC_COORDINATOR_POLLING_INTERVAL_IN_MILLISECONDS ) );
+    }
+
+    if ( _verbosity > 0 )
+        printf( "DnCRemoteWorker: connected to %s\n", _coordinatorAddress.ascii() );
+
+    _socket->sendMessage( DnCCoordinator::composeMessage(
+        DnCCoordinator::HELLO,
+        SubQuerySerializer::computeQueryFingerprint( *_engine->getQuery() ) ) );
+
+    String message;
+    if ( !_socket->receiveMessage( message ) )
+        throw MarabouError( MarabouError::DNC_PROTOCOL_ERROR,
+                            "Coordinator closed the connection during the handshake" );
+
+    String type;
+    String body;
+    DnCCoordinator::decomposeMessage( message, type, body );
+    if ( type == DnCCoordinator::REJECT )
+    {
+        printf( "DnCRemoteWorker: rejected by the coordinator (%s)\n", body.ascii() );
+        return false;
+    }
+
+    if ( type != DnCCoordinator::WELCOME )
+        throw MarabouError( MarabouError::DNC_PROTOCOL_ERROR,
+                            Stringf( "Expected WELCOME, got %s", type.ascii() ).ascii() );
+
+    SubQuerySerializer::TokenReader reader( body );
+    divideStrategy = (SnCDivideStrategy)reader.nextUnsigned();
+    onlineDivides = reader.nextUnsigned();
+    timeoutFactor = (float)reader.nextDouble();
+    restoreTreeStates = reader.nextUnsigned() == 1;
+
+    return true;
+}
+
+void DnCRemoteWorker::handleSubQuery( DnCWorker &worker,
+                                      const String &serialized,
+                                      bool restoreTreeStates )
+{
+    SubQuery *subQuery = SubQuerySerializer::deserializeSubQuery( serialized );
+    String queryId = subQuery->_queryId;
+
+    _numUnsolvedSubQueries = 1;
+    _shouldQuitSolving = false;
+    *_engine->getQuitRequested() = false;
+
+    std::atomic_bool solvingDone( false );
+    std::thread watcher( &DnCRemoteWorker::watchConnection, this, std::ref( solvingDone ) );
+
+    IEngine::ExitCode result = IEngine::ERROR;
+    try
+    {
+        result = worker.solveSubQuery( subQuery, restoreTreeStates );
+    }
+    catch ( ... )
+    {
+        solvingDone = true;
+        watcher.join();
+        throw;
+    }
+
+    solvingDone = true;
+    watcher.join();
+
+    if ( result == IEngine::QUIT_REQUESTED )
+        return;
+
+    // New subqueries must reach the coordinator before the result, which
+    // marks the parent as solved
+    SubQuery *newSubQuery = NULL;
+    while ( _workload->pop( newSubQuery ) )
+    {
+        _socket->sendMessage( DnCCoordinator::composeMessage(
+            DnCCoordinator::SUBQUERY, SubQuerySerializer::serializeSubQuery( *newSubQuery ) ) );
+        delete newSubQuery;
+    }
+
+    _socket->sendMessage( DnCCoordinator::composeMessage( DnCCoordinator::RESULT,
+                                                          composeResult( result, queryId ) ) );
+}
+
+void DnCRemoteWorker::watchConnection( std::atomic_bool &solvingDone )
+{
+    while ( !solvingDone.load() )
+    {
+        if ( _socket->waitForInput(
+                 GlobalConfiguration::DNC_COORDINATOR_POLLING_INTERVAL_IN_MILLISECONDS ) )
+        {
+            _shouldQuitSolving = true;
+            *_engine->getQuitRequested() = true;
+            return;
+        }
+    }
+}
+
+String DnCRemoteWorker::composeResult( IEngine::ExitCode result, const String &queryId )
+{
+    String body = Stringf( "%u id:%s\n", (unsigned)result, queryId.ascii() );
+
+    if ( result == IEngine::SAT )
+    {
+        // Report the assignment in terms of the original variables, which
+        // the coordinator shares with us
+        _engine->extractSolution( *_inputQuery );
+        unsigned numberOfVariables = _inputQuery->getNumberOfVariables();
+        body += Stringf( "%u\n", numberOfVariables );
+        for ( unsigned i = 0; i < numberOfVariables; ++i )
+            body += Stringf( "%u %s\n",
+                             i,
+                             SubQuerySerializer::serializeDouble(
+                                 _inputQuery->getSolutionValue( i ) )
+                                 .ascii() );
+    }
+
+    return body;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
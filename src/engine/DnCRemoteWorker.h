@@ -0,0 +1,94 @@
+/*********************                                                        */
+/*! \file DnCRemoteWorker.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A worker process in distributed split-and-conquer solving. The worker
+ ** preprocesses the same query as the coordinator (see DnCCoordinator),
+ ** connects to it, and then solves the subqueries it receives until it is
+ ** told to quit.
+
+ **/
+
+#ifndef __DnCRemoteWorker_h__
+#define __DnCRemoteWorker_h__
+
+#include "DnCWorker.h"
+#include "Engine.h"
+#include "IQuery.h"
+#include "MString.h"
+#include "Socket.h"
+
+#include <atomic>
+
+class DnCRemoteWorker
+{
+public:
+    DnCRemoteWorker( const String &coordinatorAddress, IQuery *inputQuery );
+    ~DnCRemoteWorker();
+
+    /*
+      Connect to the coordinator and serve subqueries until the coordinator
+      asks us to quit or closes the connection
+    */
+    void run();
+
+private:
+    String _coordinatorAddress;
+    IQuery *_inputQuery;
+    unsigned _verbosity;
+
+    std::shared_ptr<Engine> _engine;
+    std::unique_ptr<Socket> _socket;
+
+    /*
+      A local queue that collects the subqueries created upon a timeout,
+      before they are sent back to the coordinator
+    */
+    WorkerQueue *_workload;
+    std::atomic_int _numUnsolvedSubQueries;
+    std::atomic_bool _shouldQuitSolving;
+
+    /*
+      Connect to the coordinator, retrying until it comes up or the
+      connection timeout expires, and perform the handshake. Returns false
+      if the coordinator rejected us.
+    */
+    bool connectToCoordinator( SnCDivideStrategy &divideStrategy,
+                               unsigned &onlineDivides,
+                               float &timeoutFactor,
+                               bool &restoreTreeStates );
+
+    /*
+      Solve one subquery and report the outcome, including any new
+      subqueries, to the coordinator
+    */
+    void handleSubQuery( DnCWorker &worker, const String &serialized, bool restoreTreeStates );
+
+    /*
+      While a subquery is being solved, watch the connection: any message
+      from the coordinator (in practice, QUIT) or a hang-up interrupts the
+      engine.
+    */
+    void watchConnection( std::atomic_bool &solvingDone );
+
+    String composeResult( IEngine::ExitCode result, const String &queryId );
+
+    void freeMemoryIfNeeded();
+};
+
+#endif // __DnCRemoteWorker_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -18,12 +18,14 @@
 #include "Debug.h"
 #include "EngineState.h"
 #include "IEngine.h"
+#include "IntervalPropagationDivider.h"
 #include "LargestIntervalDivider.h"
 #include "MStringf.h"
 #include "MarabouError.h"
 #include "PiecewiseLinearCaseSplit.h"
 #include "PolarityBasedDivider.h"
 #include "SnCDivideStrategy.h"
+#include "StatisticsStream.h"
 #include "SubQuery.h"
 #include "TableauStateStorageLevel.h"
 
@@ -46,6 +48,7 @@ DnCWorker::DnCWorker( WorkerQueue *workload,
     , _engine( engine )
     , _numUnsolvedSubQueries( &numUnsolvedSubQueries )
     , _shouldQuitSolving( &shouldQuitSolving )
+    , _checkpoint( NULL )
     , _threadId( threadId )
     , _onlineDivides( onlineDivides )
     , _timeoutFactor( timeoutFactor )
@@ -62,10 +65,21 @@ DnCWorker::DnCWorker( WorkerQueue *workload,
     }
 }
 
+void DnCWorker::setCheckpoint( Checkpoint *checkpoint )
+{
+    _checkpoint = checkpoint;
+}
+
 void DnCWorker::setQueryDivider( SnCDivideStrategy divideStrategy )
 {
     if ( divideStrategy == SnCDivideStrategy::Polarity )
         _queryDivider = std::unique_ptr<QueryDivider>( new PolarityBasedDivider( _engine ) );
+    else if ( divideStrategy == SnCDivideStrategy::IntervalPropagation )
+    {
+        const List<unsigned> &inputVariables = _engine->getInputVariables();
+        _queryDivider = std::unique_ptr<IntervalPropagationDivider>(
+            new IntervalPropagationDivider( inputVariables, _engine->getNetworkLevelReasoner() ) );
+    }
     else
     {
         const List<unsigned> &inputVariables = _engine->getInputVariables();
@@ -81,133 +95,152 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
     // and returns true if the pop is successful (aka, the queue is not empty
     // in most cases)
     if ( _workload->pop( subQuery ) )
+        solveSubQuery( subQuery, restoreTreeStates );
+    else
     {
-        String queryId = subQuery->_queryId;
-        unsigned depth = subQuery->_depth;
-        auto split = std::move( subQuery->_split );
-        std::unique_ptr<SmtState> smtState = nullptr;
-        if ( restoreTreeStates && subQuery->_smtState )
-            smtState = std::move( subQuery->_smtState );
-        unsigned timeoutInSeconds = subQuery->_timeoutInSeconds;
-
-        // Reset the engine state
-        _engine->restoreState( *_initialState );
-        _engine->reset();
-
-        // TODO: each worker is going to keep a map from *CaseSplit to an
-        // object of class DnCStatistics, which contains some basic
-        // statistics. The maps are owned by the DnCManager.
-
-        // Apply the split and solve
-        _engine->applySnCSplit( *split, queryId );
-
-        bool fullSolveNeeded = true; // denotes whether we need to solve the subquery
-        if ( restoreTreeStates && smtState )
-            fullSolveNeeded = _engine->restoreSmtState( *smtState );
-        IEngine::ExitCode result = IEngine::NOT_DONE;
-        if ( fullSolveNeeded )
-        {
-            _engine->solve( timeoutInSeconds );
-            result = _engine->getExitCode();
-        }
-        else
-        {
-            // UNSAT is proven when replaying stack-entries
-            result = IEngine::UNSAT;
-        }
+        // If the queue is empty but the pop fails, wait and retry
+        std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+    }
+}
 
-        if ( _verbosity > 0 )
-            printProgress( queryId, result );
-        // Switch on the result
-        if ( result == IEngine::UNSAT )
+IEngine::ExitCode DnCWorker::solveSubQuery( SubQuery *subQuery, bool restoreTreeStates )
+{
+    String queryId = subQuery->_queryId;
+    unsigned depth = subQuery->_depth;
+    auto split = std::move( subQuery->_split );
+    // Subqueries only carry an SmtState if tree states are restored, or if
+    // the search is resumed from a checkpoint
+    std::unique_ptr<SmtState> smtState = nullptr;
+    if ( subQuery->_smtState )
+        smtState = std::move( subQuery->_smtState );
+    unsigned timeoutInSeconds = subQuery->_timeoutInSeconds;
+
+    // Reset the engine state
+    _engine->restoreState( *_initialState );
+    _engine->reset();
+
+    // TODO: each worker is going to keep a map from *CaseSplit to an
+    // object of class DnCStatistics, which contains some basic
+    // statistics. The maps are owned by the DnCManager.
+
+    // Apply the split and solve
+    _engine->applySnCSplit( *split, queryId );
+
+    bool fullSolveNeeded = true; // denotes whether we need to solve the subquery
+    if ( smtState )
+        fullSolveNeeded = _engine->restoreSmtState( *smtState );
+    IEngine::ExitCode result = IEngine::NOT_DONE;
+    if ( fullSolveNeeded )
+    {
+        _engine->solve( timeoutInSeconds );
+        result = _engine->getExitCode();
+    }
+    else
+    {
+        // UNSAT is proven when replaying stack-entries
+        result = IEngine::UNSAT;
+    }
+
+    if ( _verbosity > 0 )
+        printProgress( queryId, result );
+    // Switch on the result
+    if ( result == IEngine::UNSAT )
+    {
+        // If UNSAT, continue to solve
+        if ( _checkpoint )
+            _checkpoint->markSubQuerySolved( queryId );
+        *_numUnsolvedSubQueries -= 1;
+        if ( _numUnsolvedSubQueries->load() == 0 || _parallelDeepSoI )
+            *_shouldQuitSolving = true;
+        delete subQuery;
+    }
+    else if ( result == IEngine::TIMEOUT )
+    {
+        // If TIMEOUT, split the current input region and add the
+        // new subQueries to the current queue
+        SubQueries subQueries;
+        unsigned newTimeout = ( depth >= GlobalConfiguration::DNC_DEPTH_THRESHOLD - 1
+                                    ? 0
+                                    : (unsigned)timeoutInSeconds * _timeoutFactor );
+        unsigned numNewSubQueries = pow( 2, _onlineDivides );
+        std::vector<std::unique_ptr<SmtState>> newSmtStates;
+        if ( restoreTreeStates )
         {
-            // If UNSAT, continue to solve
-            *_numUnsolvedSubQueries -= 1;
-            if ( _numUnsolvedSubQueries->load() == 0 || _parallelDeepSoI )
-                *_shouldQuitSolving = true;
-            delete subQuery;
+            // create |numNewSubQueries| copies of the current SmtState
+            for ( unsigned i = 0; i < numNewSubQueries; ++i )
+            {
+                newSmtStates.push_back( std::unique_ptr<SmtState>( new SmtState() ) );
+                _engine->storeSmtState( *( newSmtStates[i] ) );
+            }
         }
-        else if ( result == IEngine::TIMEOUT )
+
+        _queryDivider->createSubQueries(
+            numNewSubQueries, queryId, depth, *split, newTimeout, subQueries );
+
+        unsigned i = 0;
+        for ( auto &newSubQuery : subQueries )
         {
-            // If TIMEOUT, split the current input region and add the
-            // new subQueries to the current queue
-            SubQueries subQueries;
-            unsigned newTimeout = ( depth >= GlobalConfiguration::DNC_DEPTH_THRESHOLD - 1
-                                        ? 0
-                                        : (unsigned)timeoutInSeconds * _timeoutFactor );
-            unsigned numNewSubQueries = pow( 2, _onlineDivides );
-            std::vector<std::unique_ptr<SmtState>> newSmtStates;
+            // Store the SmtCore state
             if ( restoreTreeStates )
             {
-                // create |numNewSubQueries| copies of the current SmtState
-                for ( unsigned i = 0; i < numNewSubQueries; ++i )
-                {
-                    newSmtStates.push_back( std::unique_ptr<SmtState>( new SmtState() ) );
-                    _engine->storeSmtState( *( newSmtStates[i] ) );
-                }
+                newSubQuery->_smtState = std::move( newSmtStates[i++] );
             }
 
-            _queryDivider->createSubQueries(
-                numNewSubQueries, queryId, depth, *split, newTimeout, subQueries );
+            // The children must be in the checkpoint before the parent
+            // leaves it
+            if ( _checkpoint )
+                _checkpoint->addSubQuery( *newSubQuery );
 
-            unsigned i = 0;
-            for ( auto &newSubQuery : subQueries )
+            if ( !_workload->push( std::move( newSubQuery ) ) )
             {
-                // Store the SmtCore state
-                if ( restoreTreeStates )
-                {
-                    newSubQuery->_smtState = std::move( newSmtStates[i++] );
-                }
-
-                if ( !_workload->push( std::move( newSubQuery ) ) )
-                {
-                    throw MarabouError( MarabouError::UNSUCCESSFUL_QUEUE_PUSH );
-                }
-
-                *_numUnsolvedSubQueries += 1;
+                throw MarabouError( MarabouError::UNSUCCESSFUL_QUEUE_PUSH );
             }
+
+            *_numUnsolvedSubQueries += 1;
+        }
+        if ( _checkpoint )
+            _checkpoint->markSubQuerySolved( queryId );
+        *_numUnsolvedSubQueries -= 1;
+        delete subQuery;
+    }
+    else if ( result == IEngine::QUIT_REQUESTED )
+    {
+        // If engine was asked to quit, quit
+        std::cout << "Quit requested by manager!" << std::endl;
+        delete subQuery;
+        ASSERT( _shouldQuitSolving->load() );
+    }
+    else
+    {
+        // We must set the quit flag to true  if the result is not UNSAT or
+        // TIMEOUT. This way, the DnCManager will kill all the DnCWorkers.
+
+        *_shouldQuitSolving = true;
+        if ( result == IEngine::SAT )
+        {
+            // case SAT
             *_numUnsolvedSubQueries -= 1;
             delete subQuery;
         }
-        else if ( result == IEngine::QUIT_REQUESTED )
+        else if ( result == IEngine::ERROR )
         {
-            // If engine was asked to quit, quit
-            std::cout << "Quit requested by manager!" << std::endl;
+            // case ERROR
+            std::cout << "Error!" << std::endl;
             delete subQuery;
-            ASSERT( _shouldQuitSolving->load() );
         }
-        else
+        else // result == IEngine::NOT_DONE
         {
-            // We must set the quit flag to true  if the result is not UNSAT or
-            // TIMEOUT. This way, the DnCManager will kill all the DnCWorkers.
-
-            *_shouldQuitSolving = true;
-            if ( result == IEngine::SAT )
-            {
-                // case SAT
-                *_numUnsolvedSubQueries -= 1;
-                delete subQuery;
-            }
-            else if ( result == IEngine::ERROR )
-            {
-                // case ERROR
-                std::cout << "Error!" << std::endl;
-                delete subQuery;
-            }
-            else // result == IEngine::NOT_DONE
-            {
-                // case NOT_DONE
-                ASSERT( false );
-                std::cout << "Not done! This should not happen." << std::endl;
-                delete subQuery;
-            }
+            // case NOT_DONE
+            ASSERT( false );
+            std::cout << "Not done! This should not happen." << std::endl;
+            delete subQuery;
         }
     }
-    else
-    {
-        // If the queue is empty but the pop fails, wait and retry
-        std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
-    }
+
+    StatisticsStream::writeDnCProgress(
+        _threadId, queryId, exitCodeToString( result ), _numUnsolvedSubQueries->load() );
+
+    return result;
 }
 
 void DnCWorker::printProgress( String queryId, IEngine::ExitCode result ) const
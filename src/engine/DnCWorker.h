@@ -16,6 +16,7 @@
 #ifndef __DnCWorker_h__
 #define __DnCWorker_h__
 
+#include "Checkpoint.h"
 #include "Engine.h"
 #include "PiecewiseLinearCaseSplit.h"
 #include "QueryDivider.h"
@@ -43,17 +44,30 @@ public:
     */
     void popOneSubQueryAndSolve( bool restoreTreeStates = false );
 
-private:
     /*
-      Initiate the query-divider object
+      Solve the given subQuery and handle the result: new subqueries created
+      upon a timeout are pushed to the workload. Takes ownership of the
+      subQuery, and returns the result of solving it.
     */
-    void setQueryDivider( SnCDivideStrategy divideStrategy );
+    IEngine::ExitCode solveSubQuery( SubQuery *subQuery, bool restoreTreeStates = false );
+
+    /*
+      Keep the given checkpoint up to date with the subqueries that are
+      solved and created by this worker
+    */
+    void setCheckpoint( Checkpoint *checkpoint );
 
     /*
       Convert the exitCode to string
     */
     static String exitCodeToString( IEngine::ExitCode result );
 
+private:
+    /*
+      Initiate the query-divider object
+    */
+    void setQueryDivider( SnCDivideStrategy divideStrategy );
+
     /*
       Print the current progress
     */
@@ -82,6 +96,11 @@ private:
     */
     std::shared_ptr<EngineState> _initialState;
 
+    /*
+      The checkpoint of the search, if checkpointing is enabled (not owned)
+    */
+    Checkpoint *_checkpoint;
+
     unsigned _threadId;
     unsigned _onlineDivides;
     float _timeoutFactor;
@@ -16,7 +16,10 @@
 
 #include "Engine.h"
 
+#include "AllocationCounter.h"
 #include "AutoConstraintMatrixAnalyzer.h"
+#include "BoundCache.h"
+#include "Checkpoint.h"
 #include "Debug.h"
 #include "DisjunctionConstraint.h"
 #include "EngineState.h"
@@ -28,8 +31,10 @@
 #include "PiecewiseLinearConstraint.h"
 #include "Preprocessor.h"
 #include "Query.h"
+#include "StatisticsStream.h"
 #include "TableauRow.h"
 #include "TimeUtils.h"
+#include "Tracer.h"
 #include "VariableOutOfBoundDuringOptimizationException.h"
 #include "Vector.h"
 
@@ -67,20 +72,27 @@ Engine::Engine()
     , _performLpTighteningAfterSplit(
           Options::get()->getBool( Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT ) )
     , _milpSolverBoundTighteningType( Options::get()->getMILPSolverBoundTighteningType() )
+    , _lazyRowGeneration( Options::get()->getBool( Options::LAZY_ROW_GENERATION ) )
     , _sncMode( false )
     , _queryId( "" )
+    , _checkpoint( NULL )
+    , _progressReporter( NULL )
     , _produceUNSATProofs( Options::get()->getBool( Options::PRODUCE_PROOFS ) )
     , _groundBoundManager( _context )
     , _UNSATCertificate( NULL )
 {
     _smtCore.setStatistics( &_statistics );
     _tableau->setStatistics( &_statistics );
+    _tableau->toggleLongStepRatioTest( GlobalConfiguration::USE_LONG_STEP_RATIO_TEST );
     _rowBoundTightener->setStatistics( &_statistics );
+    _costFunctionManager->setStatistics( &_statistics );
     _preprocessor.setStatistics( &_statistics );
 
     _activeEntryStrategy = _projectedSteepestEdgeRule;
     _activeEntryStrategy->setStatistics( &_statistics );
     _statistics.stampStartingTime();
+    _lastStatisticsSnapshotTime = TimeUtils::sampleMicro();
+    _lastProgressReportTime = _lastStatisticsSnapshotTime;
     setRandomSeed( Options::get()->getInt( Options::SEED ) );
 
     _boundManager.registerEngine( this );
@@ -88,6 +100,7 @@ Engine::Engine()
     _statisticsPrintingFrequency = ( _lpSolverType == LPSolverType::NATIVE )
                                      ? GlobalConfiguration::STATISTICS_PRINTING_FREQUENCY
                                      : GlobalConfiguration::STATISTICS_PRINTING_FREQUENCY_GUROBI;
+    _numAllocationsBeforeMainLoop = 0;
 
     _UNSATCertificateCurrentPointer =
         _produceUNSATProofs ? new ( true )
@@ -97,6 +110,8 @@ Engine::Engine()
 
 Engine::~Engine()
 {
+    SignalHandler::getInstance()->unregisterClient( this );
+
     if ( _work )
     {
         delete[] _work;
@@ -142,6 +157,118 @@ void Engine::applySnCSplit( PiecewiseLinearCaseSplit sncSplit, String queryId )
     _boundManager.propagateTightenings();
 }
 
+void Engine::setCheckpoint( Checkpoint *checkpoint )
+{
+    _checkpoint = checkpoint;
+    _lastCheckpointTime = TimeUtils::sampleMicro();
+}
+
+void Engine::checkpointIfNeeded( bool force )
+{
+    if ( !_checkpoint || ( !force && !_checkpoint->isDue( _lastCheckpointTime ) ) )
+        return;
+
+    _lastCheckpointTime = TimeUtils::sampleMicro();
+
+    SmtState smtState;
+    _smtCore.storeSmtState( smtState );
+    _checkpoint->updateSmtState( _queryId, smtState );
+    for ( auto &stackEntry : smtState._stack )
+        delete stackEntry;
+
+    _checkpoint->saveIfDue();
+}
+
+void Engine::streamStatisticsIfNeeded()
+{
+    if ( !StatisticsStream::isOpen() || !StatisticsStream::isDue( _lastStatisticsSnapshotTime ) )
+        return;
+
+    _lastStatisticsSnapshotTime = TimeUtils::sampleMicro();
+    StatisticsStream::writeSnapshot( _queryId, _statistics );
+}
+
+void Engine::setProgressReporter( ProgressReporter *reporter )
+{
+    _progressReporter = reporter;
+}
+
+void Engine::resolveProgressVariables( ProgressReporter &reporter ) const
+{
+    for ( unsigned variable : reporter.getVariables() )
+    {
+        if ( !_preprocessingEnabled )
+        {
+            reporter.resolveVariable( variable, variable );
+            continue;
+        }
+
+        if ( _preprocessor.variableIsUnusedAndSymbolicallyFixed( variable ) )
+            continue;
+
+        unsigned mergedVariable = variable;
+        while ( _preprocessor.variableIsMerged( mergedVariable ) )
+            mergedVariable = _preprocessor.getMergedIndex( mergedVariable );
+
+        if ( _preprocessor.variableIsFixed( mergedVariable ) )
+            reporter.resolveFixedVariable( variable,
+                                           _preprocessor.getFixedValue( mergedVariable ) );
+        else
+            reporter.resolveVariable( variable, _preprocessor.getNewIndex( mergedVariable ) );
+    }
+}
+
+void Engine::startProgressReports()
+{
+    if ( !_progressReporter )
+        return;
+
+    // The bounds of a previous (sub)query no longer hold
+    _progress._lowerBounds.clear();
+    _progress._upperBounds.clear();
+    for ( const auto &fixedValue : _progressReporter->getFixedValues() )
+    {
+        _progress._lowerBounds[fixedValue.first] = fixedValue.second;
+        _progress._upperBounds[fixedValue.first] = fixedValue.second;
+    }
+
+    updateProgressBounds();
+}
+
+void Engine::updateProgressBounds()
+{
+    // Once a case split is in effect, the current bounds only hold for
+    // part of the (sub)query. The bounds of the preprocessed query are
+    // used until the search is back at the root.
+    bool atRoot = ( _smtCore.getStackDepth() == 0 );
+    for ( const auto &pair : _progressReporter->getPreprocessedVariables() )
+    {
+        unsigned variable = pair.second;
+        if ( atRoot )
+        {
+            _progress._lowerBounds[pair.first] = _boundManager.getLowerBound( variable );
+            _progress._upperBounds[pair.first] = _boundManager.getUpperBound( variable );
+        }
+        else if ( !_progress._lowerBounds.exists( pair.first ) )
+        {
+            _progress._lowerBounds[pair.first] = _preprocessedQuery->getLowerBound( variable );
+            _progress._upperBounds[pair.first] = _preprocessedQuery->getUpperBound( variable );
+        }
+    }
+}
+
+void Engine::reportProgressIfNeeded()
+{
+    if ( !_progressReporter || !_progressReporter->isDue( _lastProgressReportTime ) )
+        return;
+
+    _lastProgressReportTime = TimeUtils::sampleMicro();
+    updateProgressBounds();
+    _progress._queryId = _queryId;
+    _progress._statistics = _statistics;
+    _progressReporter->report( _progress );
+}
+
 bool Engine::inSnCMode() const
 {
     return _sncMode;
@@ -161,6 +288,11 @@ Query Engine::prepareSnCQuery()
     for ( auto &equation : equations )
         sncIPQ.addEquation( equation );
 
+    // The deferred equations are not part of the preprocessed query, even
+    // once added to the tableau
+    for ( const auto &lazyRow : _lazyRows )
+        sncIPQ.addEquation( lazyRow._equation );
+
     for ( auto &bound : bounds )
     {
         switch ( bound._type )
@@ -189,6 +321,8 @@ void Engine::exportQueryWithError( String errorMessage )
 
 bool Engine::solve( double timeoutInSeconds )
 {
+    TraceSpan span( "Engine::solve" );
+
     SignalHandler::getInstance()->initialize();
     SignalHandler::getInstance()->registerClient( this );
 
@@ -200,6 +334,7 @@ bool Engine::solve( double timeoutInSeconds )
 
     // Before encoding, make sure all valid constraints are applied.
     applyAllValidConstraintCaseSplits();
+    startProgressReports();
 
     if ( _solveWithMILP )
         return solveWithMILPEncoding( timeoutInSeconds );
@@ -218,6 +353,7 @@ bool Engine::solve( double timeoutInSeconds )
         ENGINE_LOG( "Encoding convex relaxation into Gurobi - done" );
     }
 
+    _numAllocationsBeforeMainLoop = AllocationCounter::getNumAllocations();
     mainLoopStatistics();
     if ( _verbosity > 0 )
     {
@@ -244,6 +380,9 @@ bool Engine::solve( double timeoutInSeconds )
                 _statistics.print();
             }
 
+            // In snc mode, the subquery is divided upon a timeout, so its
+            // state need not be recorded
+            checkpointIfNeeded( !_sncMode );
             _exitCode = Engine::TIMEOUT;
             _statistics.timeout();
             return false;
@@ -258,15 +397,20 @@ bool Engine::solve( double timeoutInSeconds )
                 _statistics.print();
             }
 
+            checkpointIfNeeded( true );
             _exitCode = Engine::QUIT_REQUESTED;
             return false;
         }
 
+        checkpointIfNeeded( false );
+
         try
         {
             DEBUG( _tableau->verifyInvariants() );
 
             mainLoopStatistics();
+            streamStatisticsIfNeeded();
+            reportProgressIfNeeded();
             if ( _verbosity > 1 &&
                  _statistics.getLongAttribute( Statistics::NUM_MAIN_LOOP_ITERATIONS ) %
                          _statisticsPrintingFrequency ==
@@ -327,6 +471,10 @@ bool Engine::solve( double timeoutInSeconds )
                 {
                     if ( allNonlinearConstraintsHold() )
                     {
+                        // The equations kept out of the tableau must hold too
+                        if ( addViolatedLazyRows() )
+                            continue;
+
                         mainLoopEnd = TimeUtils::sampleMicro();
                         _statistics.incLongAttribute(
                             Statistics::TIME_MAIN_LOOP_MICRO,
@@ -472,6 +620,9 @@ void Engine::mainLoopStatistics()
                                           _numPlConstraintsDisabledByValidSplits );
 
     _statistics.incLongAttribute( Statistics::NUM_MAIN_LOOP_ITERATIONS );
+    _statistics.setLongAttribute( Statistics::NUM_MAIN_LOOP_HEAP_ALLOCATIONS,
+                                  AllocationCounter::getNumAllocations() -
+                                      _numAllocationsBeforeMainLoop );
 
     struct timespec end = TimeUtils::sampleMicro();
     _statistics.incLongAttribute( Statistics::TOTAL_TIME_HANDLING_STATISTICS_MICRO,
@@ -480,6 +631,8 @@ void Engine::mainLoopStatistics()
 
 void Engine::performBoundTighteningAfterCaseSplit()
 {
+    TraceSpan span( "Engine::performBoundTighteningAfterCaseSplit" );
+
     // Tighten bounds of a first hidden layer with MILP solver
     performMILPSolverBoundedTighteningForSingleLayer( 1 );
     do
@@ -606,6 +759,8 @@ bool Engine::handleMalformedBasisException()
 
 void Engine::performConstraintFixingStep()
 {
+    TraceSpan span( "Engine::performConstraintFixingStep" );
+
     // Statistics
     _statistics.incLongAttribute( Statistics::NUM_CONSTRAINT_FIXING_STEPS );
     struct timespec start = TimeUtils::sampleMicro();
@@ -626,6 +781,8 @@ void Engine::performConstraintFixingStep()
 
 bool Engine::performSimplexStep()
 {
+    TraceSpan span( "Engine::performSimplexStep" );
+
     // Statistics
     _statistics.incLongAttribute( Statistics::NUM_SIMPLEX_STEPS );
     struct timespec start = TimeUtils::sampleMicro();
@@ -677,25 +834,27 @@ bool Engine::performSimplexStep()
         }
     } );
 
-    // Obtain all eligible entering variables
-    List<unsigned> enteringVariableCandidates;
-    _tableau->getEntryCandidates( enteringVariableCandidates );
-
     unsigned bestLeaving = 0;
     double bestChangeRatio = 0.0;
     Set<unsigned> excludedEnteringVariables;
     bool haveCandidate = false;
     unsigned bestEntering = 0;
     double bestPivotEntry = 0.0;
+    unsigned bestBreakpointsPassed = 0;
     unsigned tries = GlobalConfiguration::MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS;
 
     while ( tries > 0 )
     {
         --tries;
 
+        // We don't want to re-consider the previous candidate. The set is
+        // only populated here, so that the common case of accepting the
+        // first candidate does not allocate memory
+        if ( haveCandidate )
+            excludedEnteringVariables.insert( _tableau->getEnteringVariableIndex() );
+
         // Attempt to pick the best entering variable from the available candidates
-        if ( !_activeEntryStrategy->select(
-                 _tableau, enteringVariableCandidates, excludedEnteringVariables ) )
+        if ( !_activeEntryStrategy->select( _tableau, excludedEnteringVariables ) )
         {
             // No additional candidates can be found.
             break;
@@ -704,10 +863,6 @@ bool Engine::performSimplexStep()
         // We have a candidate!
         haveCandidate = true;
 
-        // We don't want to re-consider this candidate in future
-        // iterations
-        excludedEnteringVariables.insert( _tableau->getEnteringVariableIndex() );
-
         // Pick a leaving variable
         _tableau->computeChangeColumn();
         _tableau->pickLeavingVariable();
@@ -718,6 +873,7 @@ bool Engine::performSimplexStep()
             bestEntering = _tableau->getEnteringVariableIndex();
             bestLeaving = _tableau->getLeavingVariableIndex();
             bestChangeRatio = _tableau->getChangeRatio();
+            bestBreakpointsPassed = _tableau->getNumBreakpointsPassed();
             memcpy( _work, _tableau->getChangeColumn(), sizeof( double ) * _tableau->getM() );
             break;
         }
@@ -731,6 +887,7 @@ bool Engine::performSimplexStep()
             bestPivotEntry = pivotEntry;
             bestLeaving = leavingIndex;
             bestChangeRatio = _tableau->getChangeRatio();
+            bestBreakpointsPassed = _tableau->getNumBreakpointsPassed();
             memcpy( _work, _tableau->getChangeColumn(), sizeof( double ) * _tableau->getM() );
         }
 
@@ -817,7 +974,13 @@ bool Engine::performSimplexStep()
     _tableau->performPivot();
     _activeEntryStrategy->postPivotHook( _tableau, fakePivot );
     _boundManager.propagateTightenings();
-    _costFunctionManager->invalidateCostFunction();
+
+    if ( bestBreakpointsPassed > 0 )
+    {
+        _statistics.incLongAttribute( Statistics::NUM_TABLEAU_LONG_STEPS );
+        _statistics.incLongAttribute( Statistics::NUM_TABLEAU_BREAKPOINTS_PASSED,
+                                      bestBreakpointsPassed );
+    }
 
     struct timespec end = TimeUtils::sampleMicro();
     _statistics.incLongAttribute( Statistics::TIME_SIMPLEX_STEPS_MICRO,
@@ -988,6 +1151,7 @@ void Engine::invokePreprocessor( const IQuery &inputQuery, bool preprocess )
     else
     {
         _preprocessedQuery = std::unique_ptr<Query>( inputQuery.generateQuery() );
+        _preprocessedQuery->encodePrebuiltNetworkLevelReasoner();
         Preprocessor().informConstraintsOfInitialBounds( *_preprocessedQuery );
     }
 
@@ -1322,6 +1486,121 @@ void Engine::augmentInitialBasisIfNeeded( List<unsigned> &initialBasis,
     }
 }
 
+void Engine::deferLazyRows()
+{
+    unsigned n = _preprocessedQuery->getNumberOfVariables();
+    List<Equation> &equations( _preprocessedQuery->getEquations() );
+
+    // Variables that occur in a single equation, and in no constraint, are
+    // determined by that equation
+    Vector<unsigned> occurrences( n, 0 );
+    for ( const auto &equation : equations )
+        for ( const auto &addend : equation._addends )
+            ++occurrences[addend._variable];
+
+    for ( const auto &plConstraint : _preprocessedQuery->getPiecewiseLinearConstraints() )
+        for ( const auto &variable : plConstraint->getParticipatingVariables() )
+            occurrences[variable] = 0;
+
+    for ( const auto &nlConstraint : _preprocessedQuery->getNonlinearConstraints() )
+        for ( const auto &variable : nlConstraint->getParticipatingVariables() )
+            occurrences[variable] = 0;
+
+    auto equation = equations.begin();
+    while ( equation != equations.end() )
+    {
+        LazyRow lazyRow;
+        lazyRow._coefficient = 0;
+
+        if ( equation->_type == Equation::EQ )
+        {
+            // Prefer the largest coefficient, for numerical stability
+            for ( const auto &addend : equation->_addends )
+            {
+                if ( occurrences[addend._variable] == 1 &&
+                     FloatUtils::abs( addend._coefficient ) >
+                         FloatUtils::abs( lazyRow._coefficient ) )
+                {
+                    lazyRow._variable = addend._variable;
+                    lazyRow._coefficient = addend._coefficient;
+                }
+            }
+        }
+
+        if ( FloatUtils::isZero( lazyRow._coefficient ) )
+        {
+            ++equation;
+            continue;
+        }
+
+        lazyRow._equation = *equation;
+        lazyRow._inTableau = false;
+        _lazyRows.append( lazyRow );
+        equation = equations.erase( equation );
+    }
+
+    ENGINE_LOG( Stringf( "Lazy row generation: %u equations kept out of the tableau",
+                         _lazyRows.size() )
+                    .ascii() );
+    _statistics.setUnsignedAttribute( Statistics::NUM_DEFERRED_ROWS, _lazyRows.size() );
+}
+
+bool Engine::addViolatedLazyRows()
+{
+    List<unsigned> violatedRows;
+    for ( unsigned i = 0; i < _lazyRows.size(); ++i )
+    {
+        const LazyRow &lazyRow = _lazyRows[i];
+        if ( lazyRow._inTableau )
+            continue;
+
+        double value = lazyRow._equation._scalar;
+        for ( const auto &addend : lazyRow._equation._addends )
+        {
+            if ( addend._variable != lazyRow._variable )
+                value -= addend._coefficient * _tableau->getValue( addend._variable );
+        }
+        value /= lazyRow._coefficient;
+
+        double lb = _tableau->getLowerBound( lazyRow._variable );
+        double ub = _tableau->getUpperBound( lazyRow._variable );
+        if ( FloatUtils::lt( value, lb, GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE ) ||
+             FloatUtils::gt( value, ub, GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE ) )
+        {
+            violatedRows.append( i );
+            continue;
+        }
+
+        // The variable occurs in no row of the tableau, so it is non-basic
+        // and its value does not affect any other variable
+        ASSERT( !_tableau->isBasic( lazyRow._variable ) );
+        if ( value < lb )
+            value = lb;
+        else if ( value > ub )
+            value = ub;
+        _tableau->setNonBasicAssignment( lazyRow._variable, value, false );
+    }
+
+    for ( const auto &index : violatedRows )
+        addLazyRowToTableau( index );
+
+    return !violatedRows.empty();
+}
+
+void Engine::addLazyRowToTableau( unsigned index )
+{
+    ENGINE_LOG( Stringf( "Adding a lazily generated row for x%u", _lazyRows[index]._variable )
+                    .ascii() );
+
+    PiecewiseLinearCaseSplit split;
+    split.addEquation( _lazyRows[index]._equation );
+    applySplit( split );
+
+    _lazyRows[index]._inTableau = true;
+    _lazyRowsInTableau.append( index );
+    _statistics.incUnsignedAttribute( Statistics::NUM_LAZY_ROWS_ADDED );
+}
+
 void Engine::initializeTableau( const double *constraintMatrix, const List<unsigned> &initialBasis )
 {
     const List<Equation> &equations( _preprocessedQuery->getEquations() );
@@ -1342,7 +1621,6 @@ void Engine::initializeTableau( const double *constraintMatrix, const List<unsig
     // Populate constriant matrix
     _tableau->setConstraintMatrix( constraintMatrix );
 
-    _tableau->registerToWatchAllVariables( _rowBoundTightener );
     _tableau->registerResizeWatcher( _rowBoundTightener );
 
     _rowBoundTightener->setDimensions();
@@ -1398,6 +1676,9 @@ void Engine::initializeNetworkLevelReasoning()
     {
         _networkLevelReasoner->computeSuccessorLayers();
         _networkLevelReasoner->setTableau( _tableau );
+        if ( GlobalConfiguration::OUTPUT_SPECIFICATION_BOUND_PROPAGATION &&
+             _symbolicBoundTighteningType == SymbolicBoundTighteningType::DEEP_POLY )
+            _networkLevelReasoner->setOutputSpecifications( _preprocessedQuery->getEquations() );
         if ( Options::get()->getBool( Options::DUMP_TOPOLOGY ) )
         {
             _networkLevelReasoner->dumpTopology( false );
@@ -1408,6 +1689,8 @@ void Engine::initializeNetworkLevelReasoning()
 
 bool Engine::processInputQuery( const IQuery &inputQuery, bool preprocess )
 {
+    TraceSpan span( "Engine::processInputQuery" );
+
     ENGINE_LOG( "processInputQuery starting\n" );
     struct timespec start = TimeUtils::sampleMicro();
 
@@ -1419,6 +1702,7 @@ bool Engine::processInputQuery( const IQuery &inputQuery, bool preprocess )
         initializeNetworkLevelReasoning();
         if ( preprocess )
         {
+            useNetworkBoundCache( *_preprocessedQuery );
             performSymbolicBoundTightening( &( *_preprocessedQuery ) );
             performSimulation();
             performMILPSolverBoundedTightening( &( *_preprocessedQuery ) );
@@ -1454,6 +1738,9 @@ bool Engine::processInputQuery( const IQuery &inputQuery, bool preprocess )
 
         if ( _lpSolverType == LPSolverType::NATIVE )
         {
+            if ( _lazyRowGeneration && !_produceUNSATProofs && !_solveWithMILP )
+                deferLazyRows();
+
             double *constraintMatrix = createConstraintMatrix();
             removeRedundantEquations( constraintMatrix );
 
@@ -1713,6 +2000,14 @@ void Engine::extractSolution( IQuery &inputQuery, Preprocessor *preprocessor )
 
     for ( unsigned i = 0; i < inputQuery.getNumberOfVariables(); ++i )
     {
+        // Variables added by refinements are not known to the preprocessor
+        if ( _refinementVariableToTableauVariable.exists( i ) )
+        {
+            inputQuery.setSolutionValue(
+                i, _tableau->getValue( _refinementVariableToTableauVariable.get( i ) ) );
+            continue;
+        }
+
         if ( preprocessorInUse )
         {
             // Symbolically fixed variables are skipped. They will be re-constructed in the end.
@@ -1753,6 +2048,332 @@ void Engine::extractSolution( IQuery &inputQuery, Preprocessor *preprocessor )
     }
 }
 
+bool Engine::addRefinement( Query &refinement, unsigned firstNewVariable )
+{
+    if ( _lpSolverType != LPSolverType::NATIVE || _solveWithMILP || _produceUNSATProofs ||
+         _sncMode || !_initialStateStored )
+        return false;
+
+    TraceSpan span( "Engine::addRefinement" );
+    ENGINE_LOG( "Adding a refinement..." );
+
+    restartSearchFromRoot();
+
+    /*
+      Translate the refinement to the variables of the tableau. Its new
+      variables are numbered from the first index not in the tableau.
+    */
+    unsigned firstTableauVariable = _tableau->getN();
+    unsigned numberOfNewVariables = refinement.getNumberOfVariables() - firstNewVariable;
+
+    Query tableauRefinement;
+    tableauRefinement.setNumberOfVariables( firstTableauVariable + numberOfNewVariables );
+
+    for ( const auto &equation : refinement.getEquations() )
+    {
+        Equation translated( equation._type );
+        translated.setScalar( equation._scalar );
+
+        for ( const auto &addend : equation._addends )
+        {
+            unsigned variable = firstTableauVariable + addend._variable - firstNewVariable;
+            if ( addend._variable < firstNewVariable )
+            {
+                double fixedValue = 0;
+                InputVariableMapping mapping =
+                    mapInputVariable( addend._variable, variable, fixedValue );
+
+                if ( mapping == ELIMINATED_BY_PREPROCESSOR )
+                    return false;
+
+                if ( mapping == FIXED_BY_PREPROCESSOR )
+                {
+                    translated._scalar -= addend._coefficient * fixedValue;
+                    continue;
+                }
+
+                tableauRefinement.setLowerBound( variable, _tableau->getLowerBound( variable ) );
+                tableauRefinement.setUpperBound( variable, _tableau->getUpperBound( variable ) );
+            }
+
+            translated.addAddend( addend._coefficient, variable );
+        }
+
+        translated.removeRedundantAddends();
+        tableauRefinement.addEquation( translated );
+    }
+
+    // Indices past both numberings, through which constraints are renamed
+    // without any two of their variables colliding
+    unsigned temporaryVariable =
+        std::max( refinement.getNumberOfVariables(), tableauRefinement.getNumberOfVariables() );
+
+    for ( const auto &plConstraint : refinement.getPiecewiseLinearConstraints() )
+    {
+        PiecewiseLinearConstraint *constraint = plConstraint->duplicateConstraint();
+        tableauRefinement.addPiecewiseLinearConstraint( constraint );
+
+        List<unsigned> variables = constraint->getParticipatingVariables();
+        unsigned index = 0;
+        for ( const auto &variable : variables )
+            constraint->updateVariableIndex( variable, temporaryVariable + index++ );
+
+        index = 0;
+        for ( const auto &variable : variables )
+        {
+            unsigned tableauVariable = firstTableauVariable + variable - firstNewVariable;
+            if ( variable < firstNewVariable )
+            {
+                double fixedValue = 0;
+                if ( mapInputVariable( variable, tableauVariable, fixedValue ) !=
+                     MAPPED_TO_TABLEAU_VARIABLE )
+                    return false;
+
+                tableauRefinement.setLowerBound( tableauVariable,
+                                                 _tableau->getLowerBound( tableauVariable ) );
+                tableauRefinement.setUpperBound( tableauVariable,
+                                                 _tableau->getUpperBound( tableauVariable ) );
+            }
+
+            constraint->updateVariableIndex( temporaryVariable + index++, tableauVariable );
+        }
+    }
+
+    // As in preprocessing, the constraints may introduce auxiliary variables
+    for ( auto &constraint : tableauRefinement.getPiecewiseLinearConstraints() )
+        constraint->transformToUseAuxVariables( tableauRefinement );
+    tightenBoundsOfNewVariables( tableauRefinement, firstTableauVariable );
+
+    if ( GlobalConfiguration::PL_CONSTRAINTS_ADD_AUX_EQUATIONS_AFTER_PREPROCESSING )
+    {
+        for ( auto &constraint : tableauRefinement.getPiecewiseLinearConstraints() )
+            constraint->addAuxiliaryEquationsAfterPreprocessing( tableauRefinement );
+        tightenBoundsOfNewVariables( tableauRefinement, firstTableauVariable );
+    }
+
+    unsigned n = tableauRefinement.getNumberOfVariables();
+    for ( unsigned variable = firstTableauVariable; variable < n; ++variable )
+    {
+        if ( !FloatUtils::isFinite( tableauRefinement.getLowerBound( variable ) ) ||
+             !FloatUtils::isFinite( tableauRefinement.getUpperBound( variable ) ) )
+            return false;
+    }
+
+    // Add the refinement to the tableau
+    _preprocessedQuery->setNumberOfVariables( n );
+    for ( unsigned variable = firstTableauVariable; variable < n; ++variable )
+    {
+        double lb = tableauRefinement.getLowerBound( variable );
+        double ub = tableauRefinement.getUpperBound( variable );
+        _tableau->addVariable( lb, ub );
+        _preprocessedQuery->setLowerBound( variable, lb );
+        _preprocessedQuery->setUpperBound( variable, ub );
+    }
+
+    for ( unsigned variable = firstNewVariable; variable < refinement.getNumberOfVariables();
+          ++variable )
+        _refinementVariableToTableauVariable[variable] =
+            firstTableauVariable + variable - firstNewVariable;
+
+    PiecewiseLinearCaseSplit split;
+    for ( const auto &equation : tableauRefinement.getEquations() )
+        split.addEquation( equation );
+    applySplit( split );
+    _activeEntryStrategy->resizeHook( _tableau );
+
+    // The preprocessed query takes ownership of the new constraints
+    for ( const auto &constraint : tableauRefinement.getPiecewiseLinearConstraints() )
+    {
+        constraint->registerAsWatcher( _tableau );
+        constraint->setStatistics( &_statistics );
+        constraint->registerTableau( _tableau );
+        _plConstraints.append( constraint );
+        _preprocessedQuery->addPiecewiseLinearConstraint( constraint );
+    }
+    tableauRefinement.getPiecewiseLinearConstraints().clear();
+
+    _preprocessedQuery->setNumberOfVariables( _tableau->getN() );
+    _boundManager.storeLocalBounds();
+    _statistics.setUnsignedAttribute( Statistics::NUM_PL_CONSTRAINTS, _plConstraints.size() );
+
+    if ( _soiManager )
+    {
+        _soiManager = std::unique_ptr<SumOfInfeasibilitiesManager>(
+            new SumOfInfeasibilitiesManager( *_preprocessedQuery, *_tableau ) );
+        _soiManager->setStatistics( &_statistics );
+    }
+    _smtCore.initializeScoreTrackerIfNeeded( _plConstraints );
+
+    // The initial state is stored again, with the refinement, by solve()
+    _initialStateStored = false;
+    resetExitCode();
+
+    if ( !_tableau->allBoundsValid() )
+        _exitCode = Engine::UNSAT;
+
+    ENGINE_LOG( Stringf( "Adding a refinement - done. Added %u variables and %u equations",
+                         n - firstTableauVariable,
+                         tableauRefinement.getEquations().size() )
+                    .ascii() );
+    return true;
+}
+
+void Engine::restartSearchFromRoot()
+{
+    /*
+      A refinement holds everywhere in the search tree, but the bounds of
+      variables added above the root would be lost when backtracking past
+      the level they were added at. The tableau is restored to the state
+      it had when the search started, since rows added by splits do not
+      hold at the root.
+    */
+    Set<unsigned> basicVariables = _tableau->getBasicVariables();
+    unsigned m = _tableau->getM();
+    unsigned n = _tableau->getN();
+
+    clearViolatedPLConstraints();
+    _smtCore.reset();
+    _precisionRestorer.restoreInitialEngineState( *this );
+
+    if ( _tableau->getM() == m && _tableau->getN() == n )
+    {
+        List<unsigned> basics;
+        for ( const auto &basic : basicVariables )
+            basics.append( basic );
+
+        try
+        {
+            _tableau->initializeTableau( basics );
+        }
+        catch ( MalformedBasisException & )
+        {
+            ENGINE_LOG( "restartSearchFromRoot: could not keep the basis" );
+            _precisionRestorer.restoreInitialEngineState( *this );
+        }
+    }
+
+    _tableau->updateVariablesToComplyWithBounds();
+}
+
+Engine::InputVariableMapping
+Engine::mapInputVariable( unsigned variable, unsigned &tableauVariable, double &fixedValue ) const
+{
+    if ( _refinementVariableToTableauVariable.exists( variable ) )
+    {
+        tableauVariable = _refinementVariableToTableauVariable.get( variable );
+        return MAPPED_TO_TABLEAU_VARIABLE;
+    }
+
+    tableauVariable = variable;
+    if ( _preprocessingEnabled )
+    {
+        if ( _preprocessor.variableIsUnusedAndSymbolicallyFixed( variable ) )
+            return ELIMINATED_BY_PREPROCESSOR;
+
+        while ( _preprocessor.variableIsMerged( tableauVariable ) )
+            tableauVariable = _preprocessor.getMergedIndex( tableauVariable );
+
+        if ( _preprocessor.variableIsFixed( tableauVariable ) )
+        {
+            fixedValue = _preprocessor.getFixedValue( tableauVariable );
+            return FIXED_BY_PREPROCESSOR;
+        }
+
+        tableauVariable = _preprocessor.getNewIndex( tableauVariable );
+    }
+
+    tableauVariable = _tableau->getVariableAfterMerging( tableauVariable );
+    return MAPPED_TO_TABLEAU_VARIABLE;
+}
+
+void Engine::tightenBoundsOfNewVariables( Query &query, unsigned firstNewVariable )
+{
+    // Each round that tightens a bound may enable another tightening. The
+    // number of rounds is limited, in case the tightenings converge slowly
+    unsigned numberOfRounds = 2 * ( query.getNumberOfVariables() - firstNewVariable ) + 1;
+
+    for ( unsigned round = 0; round < numberOfRounds; ++round )
+    {
+        bool tightened = false;
+
+        for ( const auto &equation : query.getEquations() )
+        {
+            for ( const auto &addend : equation._addends )
+            {
+                if ( addend._variable < firstNewVariable )
+                    continue;
+
+                // The range of the rest of the equation
+                double min = 0;
+                double max = 0;
+                bool minIsFinite = true;
+                bool maxIsFinite = true;
+                for ( const auto &other : equation._addends )
+                {
+                    if ( other._variable == addend._variable )
+                        continue;
+
+                    double lb = query.getLowerBound( other._variable );
+                    double ub = query.getUpperBound( other._variable );
+                    if ( FloatUtils::isNegative( other._coefficient ) )
+                        std::swap( lb, ub );
+
+                    minIsFinite = minIsFinite && FloatUtils::isFinite( lb );
+                    maxIsFinite = maxIsFinite && FloatUtils::isFinite( ub );
+                    if ( minIsFinite )
+                        min += other._coefficient * lb;
+                    if ( maxIsFinite )
+                        max += other._coefficient * ub;
+                }
+
+                // The product coefficient * variable is at least
+                // scalar - max, unless the equation is LE, and at most
+                // scalar - min, unless it is GE
+                double coefficient = addend._coefficient;
+                bool boundedBelow = ( equation._type != Equation::LE ) && maxIsFinite;
+                bool boundedAbove = ( equation._type != Equation::GE ) && minIsFinite;
+                double fromMax = ( equation._scalar - max ) / coefficient;
+                double fromMin = ( equation._scalar - min ) / coefficient;
+
+                if ( FloatUtils::isPositive( coefficient ) )
+                {
+                    if ( boundedBelow && query.tightenLowerBound( addend._variable, fromMax ) )
+                        tightened = true;
+                    if ( boundedAbove && query.tightenUpperBound( addend._variable, fromMin ) )
+                        tightened = true;
+                }
+                else
+                {
+                    if ( boundedBelow && query.tightenUpperBound( addend._variable, fromMax ) )
+                        tightened = true;
+                    if ( boundedAbove && query.tightenLowerBound( addend._variable, fromMin ) )
+                        tightened = true;
+                }
+            }
+        }
+
+        Preprocessor::informConstraintsOfInitialBounds( query );
+        for ( const auto &constraint : query.getPiecewiseLinearConstraints() )
+        {
+            List<Tightening> tightenings;
+            constraint->getEntailedTightenings( tightenings );
+            for ( const auto &tightening : tightenings )
+            {
+                if ( tightening._variable < firstNewVariable )
+                    continue;
+
+                if ( tightening._type == Tightening::LB
+                         ? query.tightenLowerBound( tightening._variable, tightening._value )
+                         : query.tightenUpperBound( tightening._variable, tightening._value ) )
+                    tightened = true;
+            }
+        }
+
+        if ( !tightened )
+            return;
+    }
+}
+
 bool Engine::allVarsWithinBounds() const
 {
     if ( _lpSolverType == LPSolverType::GUROBI )
@@ -1822,6 +2443,7 @@ void Engine::storeState( EngineState &state, TableauStateStorageLevel level ) co
         state._plConstraintToState[constraint] = constraint->duplicateConstraint();
 
     state._numPlConstraintsDisabledByValidSplits = _numPlConstraintsDisabledByValidSplits;
+    state._numLazyRowsInTableau = _lazyRowsInTableau.size();
 }
 
 void Engine::restoreState( const EngineState &state )
@@ -1845,6 +2467,19 @@ void Engine::restoreState( const EngineState &state )
 
     _numPlConstraintsDisabledByValidSplits = state._numPlConstraintsDisabledByValidSplits;
 
+    if ( state._tableauStateStorageLevel == TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE )
+    {
+        // Lazily generated rows are valid everywhere, so rows added since the
+        // state was stored are put back, in the same order
+        ENGINE_LOG( "\tRestoring lazily generated rows" );
+        for ( unsigned i = state._numLazyRowsInTableau; i < _lazyRowsInTableau.size(); ++i )
+        {
+            PiecewiseLinearCaseSplit split;
+            split.addEquation( _lazyRows[_lazyRowsInTableau[i]]._equation );
+            applySplit( split );
+        }
+    }
+
     if ( _lpSolverType == LPSolverType::NATIVE )
     {
         // Make sure the data structures are initialized to the correct size
@@ -2235,6 +2870,8 @@ void Engine::tightenBoundsOnConstraintMatrix()
 
 void Engine::explicitBasisBoundTightening()
 {
+    TraceSpan span( "Engine::explicitBasisBoundTightening" );
+
     struct timespec start = TimeUtils::sampleMicro();
 
     bool saturation = GlobalConfiguration::EXPLICIT_BOUND_TIGHTENING_UNTIL_SATURATION;
@@ -2262,6 +2899,8 @@ void Engine::explicitBasisBoundTightening()
 
 void Engine::performPrecisionRestoration( PrecisionRestorer::RestoreBasics restoreBasics )
 {
+    TraceSpan span( "Engine::performPrecisionRestoration" );
+
     struct timespec start = TimeUtils::sampleMicro();
 
     // debug
@@ -2387,6 +3026,11 @@ List<unsigned> Engine::getInputVariables() const
     return _preprocessedQuery->getInputVariables();
 }
 
+const NLR::NetworkLevelReasoner *Engine::getNetworkLevelReasoner() const
+{
+    return _networkLevelReasoner;
+}
+
 void Engine::performSimulation()
 {
     if ( _simulationSize == 0 || !_networkLevelReasoner ||
@@ -2419,6 +3063,8 @@ void Engine::performSimulation()
 
 unsigned Engine::performSymbolicBoundTightening( Query *inputQuery )
 {
+    TraceSpan span( "Engine::performSymbolicBoundTightening" );
+
     if ( _symbolicBoundTighteningType == SymbolicBoundTighteningType::NONE ||
          ( !_networkLevelReasoner ) || _produceUNSATProofs )
         return 0;
@@ -2427,23 +3073,43 @@ unsigned Engine::performSymbolicBoundTightening( Query *inputQuery )
 
     unsigned numTightenedBounds = 0;
 
-    // Step 1: tell the NLR about the current bounds
-    if ( inputQuery )
+    if ( !inputQuery && GlobalConfiguration::INCREMENTAL_SYMBOLIC_BOUND_TIGHTENING )
     {
-        // Obtain from and store bounds into inputquery if it is not null.
-        _networkLevelReasoner->obtainCurrentBounds( *inputQuery );
+        // Steps 1 and 2: get bounds from the Tableau, and perform SBT from
+        // the first layer whose bounds have changed since the previous time
+        unsigned numSkippedLayers =
+            _networkLevelReasoner->incrementalSymbolicBoundPropagation(
+                _symbolicBoundTighteningType );
+        _statistics.incLongAttribute( Statistics::NUM_INCREMENTAL_SYMBOLIC_BOUND_TIGHTENINGS );
+        _statistics.incLongAttribute( Statistics::NUM_LAYERS_SKIPPED_BY_SYMBOLIC_BOUND_TIGHTENING,
+                                      numSkippedLayers );
     }
     else
     {
-        // Get bounds from Tableau.
-        _networkLevelReasoner->obtainCurrentBounds();
+        // Step 1: tell the NLR about the current bounds
+        if ( inputQuery )
+        {
+            // Obtain from and store bounds into inputquery if it is not null.
+            _networkLevelReasoner->obtainCurrentBounds( *inputQuery );
+        }
+        else
+        {
+            // Get bounds from Tableau.
+            _networkLevelReasoner->obtainCurrentBounds();
+        }
+
+        // Step 2: perform SBT
+        if ( _symbolicBoundTighteningType ==
+             SymbolicBoundTighteningType::SYMBOLIC_BOUND_TIGHTENING )
+            _networkLevelReasoner->symbolicBoundPropagation();
+        else if ( _symbolicBoundTighteningType == SymbolicBoundTighteningType::DEEP_POLY )
+            _networkLevelReasoner->deepPolyPropagation();
     }
 
-    // Step 2: perform SBT
-    if ( _symbolicBoundTighteningType == SymbolicBoundTighteningType::SYMBOLIC_BOUND_TIGHTENING )
-        _networkLevelReasoner->symbolicBoundPropagation();
-    else if ( _symbolicBoundTighteningType == SymbolicBoundTighteningType::DEEP_POLY )
-        _networkLevelReasoner->deepPolyPropagation();
+    // Then bound the output specifications through the relaxations of
+    // DeepPoly
+    if ( _symbolicBoundTighteningType == SymbolicBoundTighteningType::DEEP_POLY )
+        _networkLevelReasoner->outputSpecificationPropagation();
 
     // Step 3: Extract the bounds
     List<Tightening> tightenings;
@@ -2500,6 +3166,55 @@ unsigned Engine::performSymbolicBoundTightening( Query *inputQuery )
     return numTightenedBounds;
 }
 
+void Engine::useNetworkBoundCache( Query &inputQuery )
+{
+    String path = Options::get()->getString( Options::NLR_BOUND_CACHE_FILE );
+    if ( path.length() == 0 || !_networkLevelReasoner || _produceUNSATProofs )
+        return;
+
+    TraceSpan span( "Engine::useNetworkBoundCache" );
+
+    _networkLevelReasoner->obtainCurrentBounds( inputQuery );
+
+    Vector<double> lowerBounds;
+    Vector<double> upperBounds;
+    NLR::BoundCache boundCache( path );
+    if ( boundCache.getBounds( *_networkLevelReasoner, lowerBounds, upperBounds ) )
+        _statistics.incUnsignedAttribute( Statistics::PP_NUM_BOUND_CACHE_HITS );
+
+    unsigned numTightenedBounds = 0;
+    unsigned index = 0;
+    for ( unsigned i = 0; i < _networkLevelReasoner->getNumberOfLayers(); ++i )
+    {
+        const NLR::Layer *layer = _networkLevelReasoner->getLayer( i );
+        for ( unsigned neuron = 0; neuron < layer->getSize(); ++neuron, ++index )
+        {
+            if ( layer->neuronEliminated( neuron ) )
+                continue;
+
+            unsigned variable = layer->neuronToVariable( neuron );
+            if ( FloatUtils::gt( lowerBounds[index], inputQuery.getLowerBound( variable ) ) )
+            {
+                inputQuery.setLowerBound( variable, lowerBounds[index] );
+                ++numTightenedBounds;
+            }
+
+            if ( FloatUtils::lt( upperBounds[index], inputQuery.getUpperBound( variable ) ) )
+            {
+                inputQuery.setUpperBound( variable, upperBounds[index] );
+                ++numTightenedBounds;
+            }
+
+            if ( FloatUtils::gt( inputQuery.getLowerBound( variable ),
+                                 inputQuery.getUpperBound( variable ) ) )
+                throw InfeasibleQueryException();
+        }
+    }
+
+    _statistics.incUnsignedAttribute( Statistics::PP_NUM_BOUND_CACHE_TIGHTENINGS,
+                                      numTightenedBounds );
+}
+
 bool Engine::shouldExitDueToTimeout( double timeout ) const
 {
     // A timeout value of 0 means no time limit
@@ -2553,6 +3268,7 @@ void Engine::resetStatistics()
     _smtCore.setStatistics( &_statistics );
     _tableau->setStatistics( &_statistics );
     _rowBoundTightener->setStatistics( &_statistics );
+    _costFunctionManager->setStatistics( &_statistics );
     _preprocessor.setStatistics( &_statistics );
     _activeEntryStrategy->setStatistics( &_statistics );
 
@@ -3063,6 +3779,8 @@ Preprocessor *Engine::getPreprocessor()
 
 bool Engine::performDeepSoILocalSearch()
 {
+    TraceSpan span( "Engine::performDeepSoILocalSearch" );
+
     ENGINE_LOG( "Performing local search..." );
     struct timespec start = TimeUtils::sampleMicro();
     ASSERT( allVarsWithinBounds() );
@@ -3723,7 +4441,29 @@ bool Engine::certifyUNSATCertificate()
                                      groundUpperBounds,
                                      groundLowerBounds,
                                      _plConstraints );
-    bool certificationSucceeded = unsatCertificateChecker.check();
+    bool certificationSucceeded;
+
+    String certificateFile = Options::get()->getString( Options::CERTIFICATE_FILE );
+    if ( certificateFile.length() > 0 )
+    {
+        // Write the certificate, and check it while reading it back
+        {
+            File file( certificateFile );
+            file.open( File::MODE_WRITE_TRUNCATE );
+            UnsatCertificateStream::write( _UNSATCertificate, file );
+        }
+
+        File file( certificateFile );
+        file.open( File::MODE_READ );
+        UnsatCertificateStream stream( file );
+        certificationSucceeded = unsatCertificateChecker.checkStream( stream );
+    }
+    else
+    {
+        unsatCertificateChecker.setNumberOfWorkers(
+            std::max( Options::get()->getInt( Options::NUM_WORKERS ), 1 ) );
+        certificationSucceeded = unsatCertificateChecker.check();
+    }
 
     _statistics.setLongAttribute(
         Statistics::TOTAL_CERTIFICATION_TIME,
@@ -3833,6 +4573,14 @@ void Engine::extractBounds( IQuery &inputQuery )
 {
     for ( unsigned i = 0; i < inputQuery.getNumberOfVariables(); ++i )
     {
+        if ( _refinementVariableToTableauVariable.exists( i ) )
+        {
+            unsigned variable = _refinementVariableToTableauVariable.get( i );
+            inputQuery.tightenLowerBound( i, _preprocessedQuery->getLowerBound( variable ) );
+            inputQuery.tightenUpperBound( i, _preprocessedQuery->getUpperBound( variable ) );
+            continue;
+        }
+
         if ( _preprocessingEnabled )
         {
             // Has the variable been merged into another?
@@ -3869,6 +4617,10 @@ void Engine::extractBounds( IQuery &inputQuery )
             inputQuery.tightenUpperBound( i, _preprocessedQuery->getUpperBound( i ) );
         }
     }
+
+    // Variables removed by the presolve are bounded by the expressions they were fixed to
+    if ( _preprocessingEnabled )
+        _preprocessor.setBoundsOfPresolvedVariables( inputQuery );
 }
 
 void Engine::addPLCLemma( std::shared_ptr<PLCLemma> &explanation )
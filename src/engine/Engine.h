@@ -38,6 +38,7 @@
 #include "Options.h"
 #include "PrecisionRestorer.h"
 #include "Preprocessor.h"
+#include "ProgressReporter.h"
 #include "Query.h"
 #include "SignalHandler.h"
 #include "SmtCore.h"
@@ -59,6 +60,7 @@
 
 #define ENGINE_LOG( x, ... ) LOG( GlobalConfiguration::ENGINE_LOGGING, "Engine: %s\n", x )
 
+class Checkpoint;
 class EngineState;
 class Query;
 class PiecewiseLinearConstraint;
@@ -122,6 +124,21 @@ public:
      */
     void extractSolution( IQuery &inputQuery, Preprocessor *preprocessor = nullptr );
 
+    /*
+      Add a refinement of the input query to the engine, without
+      processing the query again: the equations and piecewise-linear
+      constraints of the given query, over the variables of the input
+      query and the new variables numbered firstNewVariable and up. The
+      constraints are copied. The search restarts from the root, keeping
+      the tableau and, when possible, the current basis; solve() can then
+      be called again.
+
+      Returns false if the refinement cannot be added in place (e.g., if
+      the bounds of a new variable cannot be derived), in which case the
+      engine should be rebuilt from the refined input query.
+    */
+    bool addRefinement( Query &refinement, unsigned firstNewVariable );
+
     /*
       Methods for storing and restoring the state of the engine.
     */
@@ -161,6 +178,11 @@ public:
     */
     List<unsigned> getInputVariables() const;
 
+    /*
+      Get the network level reasoner of the preprocessed query, if any
+    */
+    const NLR::NetworkLevelReasoner *getNetworkLevelReasoner() const;
+
     /*
       Add equations and tightenings from a split.
     */
@@ -228,6 +250,25 @@ public:
      */
     void applySnCSplit( PiecewiseLinearCaseSplit sncSplit, String queryId );
 
+    /*
+      Periodically record the state of the search on the current (sub)query
+      in the given checkpoint.
+    */
+    void setCheckpoint( Checkpoint *checkpoint );
+
+    /*
+      Periodically report the progress of solve() through the given
+      reporter, whose variables must already be resolved (e.g., by
+      resolveProgressVariables).
+    */
+    void setProgressReporter( ProgressReporter *reporter );
+
+    /*
+      Resolve the reported variables of the input query against the
+      preprocessing of this engine. Called after processInputQuery.
+    */
+    void resolveProgressVariables( ProgressReporter &reporter ) const;
+
     bool inSnCMode() const;
 
     /*
@@ -523,6 +564,26 @@ private:
     bool _isGurobyEnabled;
     bool _performLpTighteningAfterSplit;
     MILPSolverBoundTighteningType _milpSolverBoundTighteningType;
+    bool _lazyRowGeneration;
+
+    /*
+      Lazy row generation: equations kept out of the tableau until the
+      assignment violates them. Each equation determines a variable that
+      occurs in no other equation and in no constraint, so that the
+      variable's value can be computed from the rest of the assignment.
+      Rows are never removed once added; _lazyRowsInTableau lists them in
+      the order in which they were added.
+    */
+    struct LazyRow
+    {
+        Equation _equation;
+        unsigned _variable;
+        double _coefficient;
+        bool _inTableau;
+    };
+
+    Vector<LazyRow> _lazyRows;
+    Vector<unsigned> _lazyRowsInTableau;
 
     /*
       SnC Split
@@ -535,11 +596,36 @@ private:
      */
     String _queryId;
 
+    /*
+      Checkpointing of the search, and the time the SmtCore state was last
+      recorded
+    */
+    Checkpoint *_checkpoint;
+    struct timespec _lastCheckpointTime;
+
+    /*
+      The time the statistics were last written to the statistics stream
+    */
+    struct timespec _lastStatisticsSnapshotTime;
+
+    /*
+      Reporting the progress of the search, the time of the last report,
+      and the bounds that were last known to hold for the whole (sub)query
+    */
+    ProgressReporter *_progressReporter;
+    struct timespec _lastProgressReportTime;
+    SolveProgress _progress;
+
     /*
       Frequency to print the statistics.
     */
     unsigned _statisticsPrintingFrequency;
 
+    /*
+      The number of heap allocations made before the main loop started
+    */
+    unsigned long long _numAllocationsBeforeMainLoop;
+
     LinearExpression _heuristicCost;
 
     /*
@@ -613,6 +699,27 @@ private:
     */
     void mainLoopStatistics();
 
+    /*
+      Record the current SmtCore state in the checkpoint, if the checkpoint
+      interval has passed (or unconditionally, if forced).
+    */
+    void checkpointIfNeeded( bool force );
+
+    /*
+      Write a statistics snapshot to the statistics stream, if it is open
+      and the snapshot interval has passed.
+    */
+    void streamStatisticsIfNeeded();
+
+    /*
+      Report the progress of the search, if there is a progress reporter
+      and the report interval has passed. The bounds in the report are
+      only refreshed when no case split is in effect.
+    */
+    void reportProgressIfNeeded();
+    void startProgressReports();
+    void updateProgressBounds();
+
     /*
       Perform bound tightening after performing a case split.
     */
@@ -690,6 +797,12 @@ private:
     */
     unsigned performSymbolicBoundTightening( Query *inputQuery = nullptr );
 
+    /*
+      Tighten the bounds of the input query with bounds of the network
+      cached in previous runs, computing and caching them if needed.
+    */
+    void useNetworkBoundCache( Query &inputQuery );
+
     /*
       Perform a simulation which calculates concrete values of each layer with
       randomly generated input values.
@@ -731,6 +844,52 @@ private:
     void addAuxiliaryVariables();
     void augmentInitialBasisIfNeeded( List<unsigned> &initialBasis,
                                       const List<unsigned> &basicRows );
+
+    /*
+      Move the equations that can be generated lazily out of the
+      preprocessed query
+    */
+    void deferLazyRows();
+
+    /*
+      Compute the variables determined by the deferred equations from the
+      current assignment. The equations whose variables fall out of bounds
+      are added to the tableau. Returns true iff any equation was added.
+    */
+    bool addViolatedLazyRows();
+    void addLazyRowToTableau( unsigned index );
+
+    /*
+      Variables of the input query that were added by refinements, and
+      their variables in the tableau
+    */
+    Map<unsigned, unsigned> _refinementVariableToTableauVariable;
+
+    /*
+      How a variable of the input query is represented in the tableau
+    */
+    enum InputVariableMapping {
+        MAPPED_TO_TABLEAU_VARIABLE = 0,
+        FIXED_BY_PREPROCESSOR = 1,
+        ELIMINATED_BY_PREPROCESSOR = 2,
+    };
+
+    InputVariableMapping
+    mapInputVariable( unsigned variable, unsigned &tableauVariable, double &fixedValue ) const;
+
+    /*
+      Backtrack to the root of the search tree, and restore the tableau
+      to its state there. The current basis is kept if the dimensions
+      of the tableau allow it.
+    */
+    void restartSearchFromRoot();
+
+    /*
+      Derive bounds for the variables of the query numbered
+      firstNewVariable and up, from its equations and piecewise-linear
+      constraints and from the bounds of the other variables.
+    */
+    static void tightenBoundsOfNewVariables( Query &query, unsigned firstNewVariable );
     void performMILPSolverBoundedTightening( Query *inputQuery = nullptr );
 
     void performAdditionalBackwardAnalysisIfNeeded();
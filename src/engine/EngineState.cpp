@@ -16,6 +16,7 @@
 #include "EngineState.h"
 
 EngineState::EngineState()
+    : _numLazyRowsInTableau( 0 )
 {
 }
 
@@ -40,6 +40,11 @@ public:
     Map<PiecewiseLinearConstraint *, PiecewiseLinearConstraint *> _plConstraintToState;
     unsigned _numPlConstraintsDisabledByValidSplits;
 
+    /*
+      The number of lazily generated rows in the tableau
+    */
+    unsigned _numLazyRowsInTableau;
+
     /*
       A unique ID allocated to every state that is stored, for
       debugging purposes. These are assigned by the SMT core.
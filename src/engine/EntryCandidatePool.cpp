@@ -0,0 +1,170 @@
+/*********************                                                        */
+/*! \file EntryCandidatePool.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz, Duligur Ibeling
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "EntryCandidatePool.h"
+
+#include "Debug.h"
+#include "MarabouError.h"
+
+#include <algorithm>
+#include <cstring>
+
+EntryCandidatePool::EntryCandidatePool()
+    : _candidates( NULL )
+    , _size( 0 )
+    , _capacity( 0 )
+    , _inPool( NULL )
+    , _numberOfIndices( 0 )
+{
+}
+
+EntryCandidatePool::~EntryCandidatePool()
+{
+    freeMemoryIfNeeded();
+}
+
+void EntryCandidatePool::freeMemoryIfNeeded()
+{
+    if ( _candidates )
+    {
+        delete[] _candidates;
+        _candidates = NULL;
+    }
+
+    if ( _inPool )
+    {
+        delete[] _inPool;
+        _inPool = NULL;
+    }
+}
+
+void EntryCandidatePool::initialize( unsigned capacity, unsigned numberOfIndices )
+{
+    freeMemoryIfNeeded();
+
+    _capacity = capacity;
+    _numberOfIndices = numberOfIndices;
+    _size = 0;
+
+    _candidates = new Candidate[_capacity];
+    if ( !_candidates )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "EntryCandidatePool::candidates" );
+
+    _inPool = new bool[_numberOfIndices];
+    if ( !_inPool )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "EntryCandidatePool::inPool" );
+
+    std::fill_n( _inPool, _numberOfIndices, false );
+}
+
+bool EntryCandidatePool::isBetter( const Candidate &a, const Candidate &b )
+{
+    if ( a._score != b._score )
+        return a._score > b._score;
+    return a._index < b._index;
+}
+
+void EntryCandidatePool::offer( unsigned index, double score )
+{
+    ASSERT( index < _numberOfIndices );
+
+    if ( _capacity == 0 || _inPool[index] )
+        return;
+
+    Candidate candidate;
+    candidate._index = index;
+    candidate._score = score;
+
+    if ( _size < _capacity )
+    {
+        _candidates[_size++] = candidate;
+        std::push_heap( _candidates, _candidates + _size, isBetter );
+        _inPool[index] = true;
+    }
+    else if ( isBetter( candidate, _candidates[0] ) )
+    {
+        // Evict the worst candidate
+        std::pop_heap( _candidates, _candidates + _size, isBetter );
+        _inPool[_candidates[_size - 1]._index] = false;
+
+        _candidates[_size - 1] = candidate;
+        std::push_heap( _candidates, _candidates + _size, isBetter );
+        _inPool[index] = true;
+    }
+}
+
+bool EntryCandidatePool::popBest( unsigned &index )
+{
+    if ( _size == 0 )
+        return false;
+
+    // The pool is small, so the best candidate is found by a linear scan
+    unsigned best = 0;
+    for ( unsigned i = 1; i < _size; ++i )
+    {
+        if ( isBetter( _candidates[i], _candidates[best] ) )
+            best = i;
+    }
+
+    index = _candidates[best]._index;
+    _inPool[index] = false;
+
+    _candidates[best] = _candidates[_size - 1];
+    --_size;
+    std::make_heap( _candidates, _candidates + _size, isBetter );
+
+    return true;
+}
+
+unsigned EntryCandidatePool::removeAll( unsigned *indices )
+{
+    for ( unsigned i = 0; i < _size; ++i )
+    {
+        indices[i] = _candidates[i]._index;
+        _inPool[indices[i]] = false;
+    }
+
+    unsigned size = _size;
+    _size = 0;
+    return size;
+}
+
+bool EntryCandidatePool::contains( unsigned index ) const
+{
+    return index < _numberOfIndices && _inPool[index];
+}
+
+unsigned EntryCandidatePool::getSize() const
+{
+    return _size;
+}
+
+unsigned EntryCandidatePool::getCapacity() const
+{
+    return _capacity;
+}
+
+bool EntryCandidatePool::empty() const
+{
+    return _size == 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,92 @@
+/*********************                                                        */
+/*! \file EntryCandidatePool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz, Duligur Ibeling
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A bounded pool of the best candidates for entering the basis, by their
+ ** pricing score. The pool is a min-heap: the worst candidate is at the
+ ** top, and is evicted when a better one is offered and the pool is full.
+ ** Ties are broken in favor of the lower index. All storage is allocated
+ ** upon initialization, so offering and removing candidates never
+ ** allocates memory.
+ **/
+
+#ifndef __EntryCandidatePool_h__
+#define __EntryCandidatePool_h__
+
+class EntryCandidatePool
+{
+public:
+    EntryCandidatePool();
+    ~EntryCandidatePool();
+
+    /*
+      Allocate the pool, for candidates with indices in [0, numberOfIndices).
+    */
+    void initialize( unsigned capacity, unsigned numberOfIndices );
+
+    /*
+      Offer a candidate. It is kept if the pool is not full, or if it is
+      better than the worst candidate in the pool. Candidates already in
+      the pool are ignored.
+    */
+    void offer( unsigned index, double score );
+
+    /*
+      Remove the best candidate from the pool. Return false if the pool is
+      empty.
+    */
+    bool popBest( unsigned &index );
+
+    /*
+      Remove all candidates, storing their indices into the given array,
+      which must have room for getCapacity() entries. Return their number.
+    */
+    unsigned removeAll( unsigned *indices );
+
+    bool contains( unsigned index ) const;
+    unsigned getSize() const;
+    unsigned getCapacity() const;
+    bool empty() const;
+
+private:
+    struct Candidate
+    {
+        unsigned _index;
+        double _score;
+    };
+
+    /*
+      Used as the heap order, so that the root of the heap is the worst
+      candidate
+    */
+    static bool isBetter( const Candidate &a, const Candidate &b );
+
+    Candidate *_candidates;
+    unsigned _size;
+    unsigned _capacity;
+
+    /*
+      Whether each index is in the pool
+    */
+    bool *_inPool;
+    unsigned _numberOfIndices;
+
+    void freeMemoryIfNeeded();
+};
+
+#endif // __EntryCandidatePool_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
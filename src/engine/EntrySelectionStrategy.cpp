@@ -15,6 +15,8 @@
 
 #include "EntrySelectionStrategy.h"
 
+#include "ITableau.h"
+
 #include <cstring>
 
 EntrySelectionStrategy::EntrySelectionStrategy()
@@ -22,6 +24,14 @@ EntrySelectionStrategy::EntrySelectionStrategy()
 {
 }
 
+bool EntrySelectionStrategy::select( ITableau &tableau, const Set<unsigned> &excluded )
+{
+    if ( excluded.empty() )
+        tableau.getEntryCandidates( _candidates );
+
+    return select( tableau, _candidates, excluded );
+}
+
 void EntrySelectionStrategy::setStatistics( Statistics *statistics )
 {
     _statistics = statistics;
@@ -42,6 +42,15 @@ public:
                          const List<unsigned> &candidates,
                          const Set<unsigned> &excluded ) = 0;
 
+    /*
+      Choose the entering variable, pricing the non-basic variables of the
+      tableau. By default, the eligible candidates are collected upon the
+      first attempt of each simplex step, when nothing is excluded yet, and
+      passed to the method above. Strategies may override this to price
+      only some of the non-basic variables.
+    */
+    virtual bool select( ITableau &tableau, const Set<unsigned> &excluded );
+
     /*
       This hook gets called after the entering and leaving variables
       have been selected, but before the actual pivot.
@@ -68,6 +77,12 @@ protected:
       Statistics collection
     */
     Statistics *_statistics;
+
+private:
+    /*
+      The eligible candidates of the current simplex step
+    */
+    List<unsigned> _candidates;
 };
 
 #endif // __EntrySelectionStrategy_h__
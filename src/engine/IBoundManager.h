@@ -52,6 +52,12 @@ public:
      */
     virtual unsigned registerNewVariable() = 0;
 
+    /*
+       Sets the bounds of a registered variable back to +/-inf, for when
+       its index is taken by a fresh variable.
+     */
+    virtual void resetBounds( unsigned variable ) = 0;
+
     /*
        Initialize BoundManager to a given number of variables;
      */
@@ -19,6 +19,7 @@
 #include "Map.h"
 #include "SparseUnsortedList.h"
 
+class Statistics;
 class TableauRow;
 
 class ICostFunctionManager
@@ -55,6 +56,8 @@ public:
     virtual void invalidateCostFunction() = 0;
 
     virtual const SparseUnsortedList *createRowOfCostFunction() const = 0;
+
+    virtual void setStatistics( Statistics *statistics ) = 0;
 };
 
 #endif // __ICostFunctionManager_h__
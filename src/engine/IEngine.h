@@ -38,6 +38,10 @@ class String;
 class PiecewiseLinearConstraint;
 class UnsatCertificateNode;
 
+namespace NLR {
+class NetworkLevelReasoner;
+}
+
 class IEngine
 {
 public:
@@ -105,6 +109,7 @@ public:
     */
     virtual void reset() = 0;
     virtual List<unsigned> getInputVariables() const = 0;
+    virtual const NLR::NetworkLevelReasoner *getNetworkLevelReasoner() const = 0;
 
     /*
       Pick the piecewise linear constraint for internal splitting
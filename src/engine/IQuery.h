@@ -59,6 +59,13 @@ public:
     virtual List<unsigned> getInputVariables() const = 0;
     virtual List<unsigned> getOutputVariables() const = 0;
 
+    /*
+      Include a network level reasoner built directly by a network parser,
+      whose weighted sum layers are not encoded as equations of the query.
+      The query takes ownership of it.
+    */
+    virtual void setPrebuiltNetworkLevelReasoner( NLR::NetworkLevelReasoner *nlr ) = 0;
+
     /*
       Methods for setting and getting the solution.
     */
@@ -136,6 +136,7 @@ public:
     virtual unsigned getLeavingVariableIndex() const = 0;
     virtual double getChangeRatio() const = 0;
     virtual void setChangeRatio( double changeRatio ) = 0;
+    virtual unsigned getNumBreakpointsPassed() const = 0;
     virtual bool performingFakePivot() const = 0;
     virtual void performPivot() = 0;
     virtual double
@@ -160,6 +161,7 @@ public:
     virtual void assignIndexToBasicVariable( unsigned variable, unsigned index ) = 0;
     virtual unsigned variableToIndex( unsigned index ) const = 0;
     virtual unsigned addEquation( const Equation &equation ) = 0;
+    virtual unsigned addVariable( double lowerBound, double upperBound ) = 0;
     virtual unsigned getM() const = 0;
     virtual unsigned getN() const = 0;
     virtual void getTableauRow( unsigned index, TableauRow *row ) = 0;
@@ -207,11 +209,22 @@ public:
         _optimizing = optimizing;
     }
 
+    bool usingLongStepRatioTest() const
+    {
+        return _longStepRatioTest;
+    }
+
+    void toggleLongStepRatioTest( bool longStep )
+    {
+        _longStepRatioTest = longStep;
+    }
+
     virtual void tightenUpperBoundNaively( unsigned variable, double value ) = 0;
     virtual void tightenLowerBoundNaively( unsigned variable, double value ) = 0;
 
 protected:
     bool _optimizing = false;
+    bool _longStepRatioTest = false;
 };
 
 #endif // __ITableau_h__
@@ -47,11 +47,17 @@ InputQuery::InputQuery()
     , _outputIndexToVariable( &_userContext )
     , _solution( &_userContext )
     , _debuggingSolution( &_userContext )
+    , _prebuiltNetworkLevelReasoner( NULL )
 {
 }
 
 InputQuery::~InputQuery()
 {
+    if ( _prebuiltNetworkLevelReasoner )
+    {
+        delete _prebuiltNetworkLevelReasoner;
+        _prebuiltNetworkLevelReasoner = NULL;
+    }
 }
 
 void InputQuery::setNumberOfVariables( unsigned numberOfVariables )
@@ -346,6 +352,15 @@ void InputQuery::saveQueryAsSmtLib( const String &fileName ) const
     delete query;
 }
 
+void InputQuery::setPrebuiltNetworkLevelReasoner( NLR::NetworkLevelReasoner *nlr )
+{
+    ASSERT( getLevel() == 0 );
+
+    if ( _prebuiltNetworkLevelReasoner && _prebuiltNetworkLevelReasoner != nlr )
+        delete _prebuiltNetworkLevelReasoner;
+    _prebuiltNetworkLevelReasoner = nlr;
+}
+
 Query *InputQuery::generateQuery() const
 {
     Query *query = new Query();
@@ -361,12 +376,28 @@ Query *InputQuery::generateQuery() const
     for ( const auto &pair : _upperBounds )
         query->setUpperBound( pair.first, pair.second );
 
+    Map<PiecewiseLinearConstraint *, PiecewiseLinearConstraint *> plConstraintToDuplicate;
     for ( const auto &c : _plConstraints )
-        query->addPiecewiseLinearConstraint( c->duplicateConstraint() );
+    {
+        PiecewiseLinearConstraint *duplicate = c->duplicateConstraint();
+        query->addPiecewiseLinearConstraint( duplicate );
+        if ( _prebuiltNetworkLevelReasoner )
+            plConstraintToDuplicate[c] = duplicate;
+    }
 
     for ( const auto &c : _nlConstraints )
         query->addNonlinearConstraint( c->duplicateConstraint() );
 
+    if ( _prebuiltNetworkLevelReasoner )
+    {
+        // The copy refers to the duplicated constraints
+        NLR::NetworkLevelReasoner *nlr = new NLR::NetworkLevelReasoner;
+        _prebuiltNetworkLevelReasoner->storeIntoOther( *nlr );
+        for ( const auto &c : _prebuiltNetworkLevelReasoner->getConstraintsInTopologicalOrder() )
+            nlr->addConstraintInTopologicalOrder( plConstraintToDuplicate[c] );
+        query->setPrebuiltNetworkLevelReasoner( nlr );
+    }
+
     for ( const auto &pair : _variableToInputIndex )
     {
         query->markInputVariable( pair.first, pair.second );
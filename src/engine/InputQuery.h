@@ -120,6 +120,13 @@ public:
     List<unsigned> getInputVariables() const;
     List<unsigned> getOutputVariables() const;
 
+    /*
+      Unlike the rest of the query, the prebuilt network level reasoner is
+      not context-dependent. It is meant to be set once, by the network
+      parser, before anything is pushed.
+    */
+    void setPrebuiltNetworkLevelReasoner( NLR::NetworkLevelReasoner *nlr );
+
     /*
       Methods for setting and getting the solution.
     */
@@ -198,6 +205,11 @@ private:
     */
     VariableValueMap _debuggingSolution;
 
+    /*
+      A network level reasoner built by the network parser, if any
+    */
+    NLR::NetworkLevelReasoner *_prebuiltNetworkLevelReasoner;
+
     /*
       Free any stored pl constraints.
     */
@@ -0,0 +1,173 @@
+/*********************                                                        */
+/*! \file IntervalPropagationDivider.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "IntervalPropagationDivider.h"
+
+#include "Debug.h"
+#include "FloatUtils.h"
+
+IntervalPropagationDivider::IntervalPropagationDivider(
+    const List<unsigned> &inputVariables,
+    const NLR::NetworkLevelReasoner *networkLevelReasoner )
+    : LargestIntervalDivider( inputVariables )
+    , _networkLevelReasoner( networkLevelReasoner )
+    , _propagator( networkLevelReasoner )
+{
+    if ( !_networkLevelReasoner || _networkLevelReasoner->getNumberOfLayers() == 0 )
+    {
+        _networkLevelReasoner = NULL;
+        return;
+    }
+
+    const NLR::Layer *inputLayer = _networkLevelReasoner->getLayer( 0 );
+    for ( unsigned i = 0; i < inputLayer->getSize(); ++i )
+    {
+        if ( inputLayer->neuronHasVariable( i ) )
+            _variableToInputNeuron[inputLayer->neuronToVariable( i )] = i;
+    }
+}
+
+void IntervalPropagationDivider::chooseDimensionsToSplit( const List<InputRegion> &inputRegions,
+                                                          Vector<unsigned> &dimensionsToSplit )
+{
+    if ( !_networkLevelReasoner )
+    {
+        LargestIntervalDivider::chooseDimensionsToSplit( inputRegions, dimensionsToSplit );
+        return;
+    }
+
+    for ( const auto &inputRegion : inputRegions )
+        dimensionsToSplit.append( chooseDimensionToSplit( inputRegion ) );
+}
+
+unsigned IntervalPropagationDivider::chooseDimensionToSplit( const InputRegion &inputRegion )
+{
+    // The candidates are the input variables that can still be bisected
+    List<unsigned> candidates;
+    for ( const auto &variable : _inputVariables )
+    {
+        if ( _variableToInputNeuron.exists( variable ) &&
+             FloatUtils::gt( inputRegion._upperBounds[variable],
+                             inputRegion._lowerBounds[variable] ) )
+            candidates.append( variable );
+    }
+
+    if ( candidates.empty() )
+        return getLargestInterval( inputRegion );
+
+    /*
+      Two boxes per candidate: the lower half of the region first, and
+      then its upper half
+    */
+    unsigned inputSize = _networkLevelReasoner->getLayer( 0 )->getSize();
+    unsigned batchSize = 2 * candidates.size();
+    Vector<double> lowerBounds( batchSize * inputSize, 0 );
+    Vector<double> upperBounds( batchSize * inputSize, 0 );
+
+    unsigned box = 0;
+    for ( const auto &variable : candidates )
+    {
+        unsigned neuron = _variableToInputNeuron[variable];
+        double mid = ( inputRegion._lowerBounds[variable] + inputRegion._upperBounds[variable] ) / 2;
+
+        double *lowerHalfLbs = lowerBounds.data() + box * inputSize;
+        double *lowerHalfUbs = upperBounds.data() + box * inputSize;
+        storeInputRegion( inputRegion, lowerHalfLbs, lowerHalfUbs );
+        lowerHalfUbs[neuron] = mid;
+        ++box;
+
+        double *upperHalfLbs = lowerBounds.data() + box * inputSize;
+        double *upperHalfUbs = upperBounds.data() + box * inputSize;
+        storeInputRegion( inputRegion, upperHalfLbs, upperHalfUbs );
+        upperHalfLbs[neuron] = mid;
+        ++box;
+    }
+
+    _propagator.run( batchSize, lowerBounds.data(), upperBounds.data() );
+
+    unsigned outputIndex = _networkLevelReasoner->getNumberOfLayers() - 1;
+    unsigned outputSize = _networkLevelReasoner->getLayer( outputIndex )->getSize();
+    const double *outputLbs = _propagator.getLowerBounds( outputIndex );
+    const double *outputUbs = _propagator.getUpperBounds( outputIndex );
+
+    unsigned dimensionToSplit = candidates.front();
+    unsigned fewestUnstable = 0;
+    double smallestOutputWidth = 0;
+    double largestInterval = 0;
+
+    box = 0;
+    for ( const auto &variable : candidates )
+    {
+        unsigned unstable = 0;
+        double outputWidth = 0;
+        for ( unsigned half = 0; half < 2; ++half, ++box )
+        {
+            unstable += _propagator.getNumberOfUnstableNeurons( box );
+            for ( unsigned i = 0; i < outputSize; ++i )
+                outputWidth +=
+                    outputUbs[box * outputSize + i] - outputLbs[box * outputSize + i];
+        }
+
+        double interval = inputRegion._upperBounds[variable] - inputRegion._lowerBounds[variable];
+
+        bool better = false;
+        if ( variable == candidates.front() )
+            better = true;
+        else if ( unstable != fewestUnstable )
+            better = unstable < fewestUnstable;
+        else if ( !FloatUtils::areEqual( outputWidth, smallestOutputWidth ) )
+            better = outputWidth < smallestOutputWidth;
+        else
+            better = interval > largestInterval;
+
+        if ( better )
+        {
+            dimensionToSplit = variable;
+            fewestUnstable = unstable;
+            smallestOutputWidth = outputWidth;
+            largestInterval = interval;
+        }
+    }
+
+    return dimensionToSplit;
+}
+
+void IntervalPropagationDivider::storeInputRegion( const InputRegion &inputRegion,
+                                                   double *lowerBounds,
+                                                   double *upperBounds ) const
+{
+    const NLR::Layer *inputLayer = _networkLevelReasoner->getLayer( 0 );
+    for ( unsigned i = 0; i < inputLayer->getSize(); ++i )
+    {
+        lowerBounds[i] = inputLayer->getLb( i );
+        upperBounds[i] = inputLayer->getUb( i );
+    }
+
+    for ( const auto &pair : _variableToInputNeuron )
+    {
+        if ( inputRegion._lowerBounds.exists( pair.first ) )
+            lowerBounds[pair.second] = inputRegion._lowerBounds[pair.first];
+        if ( inputRegion._upperBounds.exists( pair.first ) )
+            upperBounds[pair.second] = inputRegion._upperBounds[pair.first];
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,71 @@
+/*********************                                                        */
+/*! \file IntervalPropagationDivider.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** An input splitting divider that tries every possible bisection of an
+ ** input region at once: the two halves of each candidate dimension are
+ ** propagated through the network in a single batch, and the dimension
+ ** whose halves leave the fewest unstable neurons is picked. Ties are
+ ** broken by the total width of the output bounds, and then by the width
+ ** of the dimension itself.
+
+**/
+
+#ifndef __IntervalPropagationDivider_h__
+#define __IntervalPropagationDivider_h__
+
+#include "BatchedIntervalPropagator.h"
+#include "LargestIntervalDivider.h"
+#include "Map.h"
+#include "NetworkLevelReasoner.h"
+
+class IntervalPropagationDivider : public LargestIntervalDivider
+{
+public:
+    /*
+      Without a network level reasoner, the divider falls back to
+      splitting the largest interval
+    */
+    IntervalPropagationDivider( const List<unsigned> &inputVariables,
+                                const NLR::NetworkLevelReasoner *networkLevelReasoner );
+
+protected:
+    void chooseDimensionsToSplit( const List<InputRegion> &inputRegions,
+                                  Vector<unsigned> &dimensionsToSplit );
+
+private:
+    const NLR::NetworkLevelReasoner *_networkLevelReasoner;
+    NLR::BatchedIntervalPropagator _propagator;
+
+    /*
+      The input neuron of each input variable of the network
+    */
+    Map<unsigned, unsigned> _variableToInputNeuron;
+
+    unsigned chooseDimensionToSplit( const InputRegion &inputRegion );
+
+    /*
+      Write the bounds of the input layer in the given region into one
+      box of the batch
+    */
+    void storeInputRegion( const InputRegion &inputRegion,
+                           double *lowerBounds,
+                           double *upperBounds ) const;
+};
+
+#endif // __IntervalPropagationDivider_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
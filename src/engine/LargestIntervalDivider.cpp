@@ -53,15 +53,17 @@ void LargestIntervalDivider::createSubQueries( unsigned numNewSubqueries,
     }
     inputRegions.append( region );
 
-    // Repeatedly bisect the dimension with the largest interval
+    // Repeatedly bisect each input region at its chosen dimension
     for ( unsigned i = 0; i < numBisects; ++i )
     {
+        Vector<unsigned> dimensionsToSplit;
+        chooseDimensionsToSplit( inputRegions, dimensionsToSplit );
+        ASSERT( dimensionsToSplit.size() == inputRegions.size() );
+
         List<InputRegion> newInputRegions;
+        unsigned regionIndex = 0;
         for ( const auto &inputRegion : inputRegions )
-        {
-            unsigned dimensionToSplit = getLargestInterval( inputRegion );
-            bisectInputRegion( inputRegion, dimensionToSplit, newInputRegions );
-        }
+            bisectInputRegion( inputRegion, dimensionsToSplit[regionIndex++], newInputRegions );
         inputRegions = newInputRegions;
     }
 
@@ -97,6 +99,13 @@ void LargestIntervalDivider::createSubQueries( unsigned numNewSubqueries,
     }
 }
 
+void LargestIntervalDivider::chooseDimensionsToSplit( const List<InputRegion> &inputRegions,
+                                                      Vector<unsigned> &dimensionsToSplit )
+{
+    for ( const auto &inputRegion : inputRegions )
+        dimensionsToSplit.append( getLargestInterval( inputRegion ) );
+}
+
 unsigned LargestIntervalDivider::getLargestInterval( const InputRegion &inputRegion )
 {
     ASSERT( inputRegion._lowerBounds.size() == inputRegion._upperBounds.size() );
@@ -18,6 +18,7 @@
 
 #include "List.h"
 #include "QueryDivider.h"
+#include "Vector.h"
 
 #include <math.h>
 
@@ -38,11 +39,18 @@ public:
     */
     unsigned getLargestInterval( const InputRegion &inputRegion );
 
-private:
+protected:
     /*
       All input variables of the network
     */
     const List<unsigned> _inputVariables;
+
+    /*
+      Pick the dimension to bisect for each of the given input regions,
+      in order. By default, this is the one with the largest interval.
+    */
+    virtual void chooseDimensionsToSplit( const List<InputRegion> &inputRegions,
+                                          Vector<unsigned> &dimensionsToSplit );
 };
 
 #endif // __LargestIntervalDivider_h__
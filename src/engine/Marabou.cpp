@@ -26,6 +26,8 @@
 #include "Options.h"
 #include "PropertyParser.h"
 #include "QueryLoader.h"
+#include "StatisticsStream.h"
+#include "SubQuerySerializer.h"
 #include "VnnLibParser.h"
 
 #ifdef _WIN32
@@ -219,12 +221,13 @@ void Marabou::solveQuery()
 
     struct timespec start = TimeUtils::sampleMicro();
     unsigned timeoutInSeconds = Options::get()->getInt( Options::TIMEOUT );
-    if ( _engine->processInputQuery( _inputQuery ) )
+    if ( _engine->processInputQuery( _inputQuery ) && prepareCheckpoint() )
     {
         _engine->solve( timeoutInSeconds );
         if ( _engine->shouldProduceProofs() && _engine->getExitCode() == Engine::UNSAT )
             _engine->certifyUNSATCertificate();
     }
+    finalizeCheckpoint();
 
     if ( _engine->getExitCode() == Engine::UNKNOWN )
     {
@@ -249,6 +252,65 @@ void Marabou::solveQuery()
         _engine->extractSolution( _inputQuery );
 }
 
+bool Marabou::prepareCheckpoint()
+{
+    String checkpointFile = Options::get()->getString( Options::CHECKPOINT_FILE );
+    if ( checkpointFile.length() == 0 )
+        return true;
+
+    _checkpoint = std::unique_ptr<Checkpoint>(
+        new Checkpoint( checkpointFile,
+                        SubQuerySerializer::computeQueryFingerprint( *_engine->getQuery() ),
+                        Options::get()->getInt( Options::CHECKPOINT_INTERVAL ) ) );
+    _engine->setCheckpoint( _checkpoint.get() );
+
+    if ( !Options::get()->getBool( Options::RESUME ) )
+    {
+        // Without snc, the search is a single root subquery
+        SubQuery root;
+        root._queryId = "";
+        root._split = std::unique_ptr<PiecewiseLinearCaseSplit>( new PiecewiseLinearCaseSplit );
+        root._timeoutInSeconds = 0;
+        root._depth = 0;
+        _checkpoint->addSubQuery( root );
+        _checkpoint->save();
+        return true;
+    }
+
+    _checkpoint->load();
+    SubQueries subQueries;
+    _checkpoint->getSubQueries( subQueries );
+
+    if ( subQueries.size() != 1 || ( *subQueries.begin() )->_queryId != "" )
+    {
+        for ( auto &subQuery : subQueries )
+            delete subQuery;
+        throw MarabouError( MarabouError::CHECKPOINT_MISMATCH,
+                            "The checkpoint was written in snc mode" );
+    }
+
+    std::unique_ptr<SubQuery> root( *subQueries.begin() );
+    printf( "Resuming from checkpoint: %.2lf seconds spent so far\n",
+            _checkpoint->getTotalElapsedMicroSeconds() / 1000000.0 );
+
+    // The engine takes ownership of the stack entries
+    if ( root->_smtState )
+        return _engine->restoreSmtState( *root->_smtState );
+    return true;
+}
+
+void Marabou::finalizeCheckpoint()
+{
+    if ( !_checkpoint )
+        return;
+
+    Engine::ExitCode result = _engine->getExitCode();
+    if ( result == Engine::SAT || result == Engine::UNSAT )
+        _checkpoint->remove();
+    else
+        _checkpoint->save();
+}
+
 void Marabou::displayResults( unsigned long long microSecondsElapsed ) const
 {
     Engine::ExitCode result = _engine->getExitCode();
@@ -299,6 +361,8 @@ void Marabou::displayResults( unsigned long long microSecondsElapsed ) const
         printf( "Unexpected exit code! (this should not happen)" );
     }
 
+    StatisticsStream::writeSummary( resultString, microSecondsElapsed, _engine->getStatistics() );
+
     // Create a summary file, if requested
     String summaryFilePath = Options::get()->getString( Options::SUMMARY_FILE );
     if ( summaryFilePath != "" )
@@ -17,6 +17,7 @@
 #define __Marabou_h__
 
 #include "AcasParser.h"
+#include "Checkpoint.h"
 #include "Engine.h"
 #include "IncrementalLinearization.h"
 #include "InputQuery.h"
@@ -48,6 +49,19 @@ private:
     */
     void solveQuery();
 
+    /*
+      If a checkpoint file is given, create the checkpoint of the search
+      and, when resuming, bring the engine back to the checkpointed search
+      state. Returns false if replaying that state already proves UNSAT.
+    */
+    bool prepareCheckpoint();
+
+    /*
+      Once solving ends, remove the checkpoint if the query is settled, and
+      save it otherwise
+    */
+    void finalizeCheckpoint();
+
     /*
       Display the results
     */
@@ -82,6 +96,11 @@ private:
       The solver
     */
     std::unique_ptr<Engine> _engine;
+
+    /*
+      The checkpoint of the search, if checkpointing is enabled
+    */
+    std::unique_ptr<Checkpoint> _checkpoint;
 };
 
 #endif // __Marabou_h__
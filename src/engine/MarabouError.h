@@ -55,6 +55,10 @@ public:
         UNABLE_TO_RECONSTRUCT_SOLUTION_FOR_ELIMINATED_NEURONS = 30,
 
         INPUT_QUERY_VARIABLE_BOUND_ALREADY_SET = 31,
+        MALFORMED_SERIALIZED_OBJECT = 32,
+        DNC_PROTOCOL_ERROR = 33,
+        CHECKPOINT_MISMATCH = 34,
+        CHECKPOINT_WRITE_FAILED = 35,
 
         // Error codes for Query Loader
         FILE_DOES_NOT_EXIST = 100,
@@ -19,6 +19,9 @@
 #include "LPSolverType.h"
 #include "Marabou.h"
 #include "Options.h"
+#include "StatisticsStream.h"
+#include "ThreadPool.h"
+#include "Tracer.h"
 
 #ifdef ENABLE_OPENBLAS
 #include "cblas.h"
@@ -85,6 +88,18 @@ int marabouMain( int argc, char **argv )
                     "off.\n" );
         }
 
+        if ( options->getString( Options::DNC_COORDINATOR_ADDRESS ).length() > 0 ||
+             options->getString( Options::DNC_WORKER_ADDRESS ).length() > 0 )
+        {
+            if ( options->getBool( Options::PRODUCE_PROOFS ) )
+                throw ConfigurationError( ConfigurationError::INCOMPTATIBLE_OPTIONS,
+                                          "Proof production is not supported with distributed snc "
+                                          "solving..." );
+
+            // Distributed solving is a flavor of snc mode
+            options->setBool( Options::DNC_MODE, true );
+        }
+
         if ( options->getBool( Options::PRODUCE_PROOFS ) &&
              ( options->getBool( Options::DNC_MODE ) ) )
         {
@@ -108,6 +123,24 @@ int marabouMain( int argc, char **argv )
                     "engine.\n" );
         }
 
+        if ( options->getBool( Options::RESUME ) &&
+             options->getString( Options::CHECKPOINT_FILE ).length() == 0 )
+            throw ConfigurationError( ConfigurationError::INCOMPTATIBLE_OPTIONS,
+                                      "--resume requires a --checkpoint-file..." );
+
+        if ( options->getString( Options::CHECKPOINT_FILE ).length() > 0 &&
+             ( options->getBool( Options::PRODUCE_PROOFS ) ||
+               options->getBool( Options::PARALLEL_DEEPSOI ) ) )
+        {
+            if ( options->getBool( Options::RESUME ) )
+                throw ConfigurationError( ConfigurationError::INCOMPTATIBLE_OPTIONS,
+                                          "Cannot resume with --prove-unsat or --poi..." );
+
+            options->setString( Options::CHECKPOINT_FILE, "" );
+            printf( "Checkpoints are not yet supported with proof production or --poi, turning "
+                    "checkpoints off.\n" );
+        }
+
         if ( options->getBool( Options::DNC_MODE ) &&
              options->getBool( Options::PARALLEL_DEEPSOI ) )
         {
@@ -122,6 +155,15 @@ int marabouMain( int argc, char **argv )
             printf( "Cannot set both --poi and --milp to true, turning --milp off.\n" );
         }
 
+        String statisticsStream = options->getString( Options::STATISTICS_STREAM );
+        if ( statisticsStream.length() > 0 )
+            StatisticsStream::open( statisticsStream,
+                                    options->getInt( Options::STATISTICS_STREAM_INTERVAL ) );
+
+        String traceFile = options->getString( Options::TRACE_FILE );
+        if ( traceFile.length() > 0 )
+            Tracer::setEnabled( true );
+
         if ( options->getBool( Options::DNC_MODE ) ||
              ( options->getBool( Options::PARALLEL_DEEPSOI ) &&
                options->getInt( Options::NUM_WORKERS ) > 1 ) )
@@ -131,8 +173,20 @@ int marabouMain( int argc, char **argv )
 #ifdef ENABLE_OPENBLAS
             openblas_set_num_threads( options->getInt( Options::NUM_BLAS_THREADS ) );
 #endif
+            ThreadPool::get()->setNumberOfThreads(
+                options->getInt( Options::NUM_SYMBOLIC_BOUND_TIGHTENING_THREADS ) );
             Marabou().run();
         }
+
+        if ( traceFile.length() > 0 )
+        {
+            Tracer::setEnabled( false );
+            Tracer::writeChromeTrace( traceFile );
+            Tracer::writeFoldedStacks( traceFile + ".folded" );
+            Tracer::printDecisionLevelHistogram();
+        }
+
+        StatisticsStream::close();
     }
     catch ( const Error &e )
     {
@@ -0,0 +1,271 @@
+/*********************                                                        */
+/*! \file NLRConstructionFrontier.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "NLRConstructionFrontier.h"
+
+#include "AbsoluteValueConstraint.h"
+#include "BilinearConstraint.h"
+#include "Debug.h"
+#include "LeakyReluConstraint.h"
+#include "MaxConstraint.h"
+#include "ReluConstraint.h"
+#include "RoundConstraint.h"
+#include "SigmoidConstraint.h"
+#include "SignConstraint.h"
+#include "SoftmaxConstraint.h"
+
+NLRConstructionFrontier::NLRConstructionFrontier(
+    const List<Equation> &equations,
+    const List<PiecewiseLinearConstraint *> &plConstraints,
+    const List<NonlinearConstraint *> &nlConstraints )
+{
+    for ( const auto &equation : equations )
+    {
+        unsigned position = _equations.size();
+        _equations.append( &equation );
+
+        // Only equalities can become weighted sum neurons
+        if ( equation._type != Equation::EQ )
+        {
+            _unhandledAddends.append( 0 );
+            continue;
+        }
+
+        _unhandledAddends.append( equation._addends.size() );
+        for ( const auto &addend : equation._addends )
+            _variableToEquations[addend._variable].append( position );
+
+        if ( equation._addends.size() == 1 )
+            _readyEquations.insert( position );
+    }
+
+    for ( const auto &constraint : plConstraints )
+    {
+        _plConstraints.append( constraint );
+
+        List<unsigned> sources;
+        List<unsigned> outputs;
+        if ( !getSourcesAndOutputs( constraint, sources, outputs ) )
+            _plIndex._retired.insert( _plConstraints.size() - 1 );
+        _plIndex.addConstraint( constraint->getType(), sources, outputs );
+    }
+
+    for ( const auto &constraint : nlConstraints )
+    {
+        _nlConstraints.append( constraint );
+
+        List<unsigned> sources;
+        List<unsigned> outputs;
+        if ( !getSourcesAndOutputs( constraint, sources, outputs ) )
+            _nlIndex._retired.insert( _nlConstraints.size() - 1 );
+        _nlIndex.addConstraint( constraint->getType(), sources, outputs );
+    }
+}
+
+void NLRConstructionFrontier::handle( unsigned variable, unsigned layer )
+{
+    bool alreadyHandled = _variableToLayer.exists( variable );
+    _variableToLayer[variable] = layer;
+
+    if ( alreadyHandled )
+        return;
+
+    if ( _variableToEquations.exists( variable ) )
+    {
+        // One entry per addend, so repeated variables are counted correctly
+        for ( const auto &position : _variableToEquations[variable] )
+        {
+            ASSERT( _unhandledAddends[position] > 0 );
+            --_unhandledAddends[position];
+
+            if ( _unhandledAddends[position] == 1 )
+                _readyEquations.insert( position );
+            else if ( _unhandledAddends[position] == 0 )
+                _readyEquations.erase( position );
+        }
+    }
+
+    _plIndex.handle( variable );
+    _nlIndex.handle( variable );
+}
+
+bool NLRConstructionFrontier::isHandled( unsigned variable ) const
+{
+    return _variableToLayer.exists( variable );
+}
+
+unsigned NLRConstructionFrontier::getLayer( unsigned variable ) const
+{
+    return _variableToLayer.at( variable );
+}
+
+const Set<unsigned> &NLRConstructionFrontier::getReadyEquations() const
+{
+    return _readyEquations;
+}
+
+const Set<unsigned> &
+NLRConstructionFrontier::getReadyPLConstraints( PiecewiseLinearFunctionType type )
+{
+    return _plIndex.getReady( type );
+}
+
+const Set<unsigned> &NLRConstructionFrontier::getReadyNLConstraints( NonlinearFunctionType type )
+{
+    return _nlIndex.getReady( type );
+}
+
+const Equation &NLRConstructionFrontier::getEquation( unsigned position ) const
+{
+    return *_equations[position];
+}
+
+PiecewiseLinearConstraint *NLRConstructionFrontier::getPLConstraint( unsigned position ) const
+{
+    return _plConstraints[position];
+}
+
+NonlinearConstraint *NLRConstructionFrontier::getNLConstraint( unsigned position ) const
+{
+    return _nlConstraints[position];
+}
+
+bool NLRConstructionFrontier::getSourcesAndOutputs( const PiecewiseLinearConstraint *constraint,
+                                                    List<unsigned> &sources,
+                                                    List<unsigned> &outputs )
+{
+    switch ( constraint->getType() )
+    {
+    case RELU:
+        sources.append( ( (const ReluConstraint *)constraint )->getB() );
+        outputs.append( ( (const ReluConstraint *)constraint )->getF() );
+        return true;
+
+    case LEAKY_RELU:
+        sources.append( ( (const LeakyReluConstraint *)constraint )->getB() );
+        outputs.append( ( (const LeakyReluConstraint *)constraint )->getF() );
+        return true;
+
+    case ABSOLUTE_VALUE:
+        sources.append( ( (const AbsoluteValueConstraint *)constraint )->getB() );
+        outputs.append( ( (const AbsoluteValueConstraint *)constraint )->getF() );
+        return true;
+
+    case SIGN:
+        sources.append( ( (const SignConstraint *)constraint )->getB() );
+        outputs.append( ( (const SignConstraint *)constraint )->getF() );
+        return true;
+
+    case MAX:
+        sources = ( (const MaxConstraint *)constraint )->getElements();
+        outputs.append( ( (const MaxConstraint *)constraint )->getF() );
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool NLRConstructionFrontier::getSourcesAndOutputs( const NonlinearConstraint *constraint,
+                                                    List<unsigned> &sources,
+                                                    List<unsigned> &outputs )
+{
+    switch ( constraint->getType() )
+    {
+    case SIGMOID:
+        sources.append( ( (const SigmoidConstraint *)constraint )->getB() );
+        outputs.append( ( (const SigmoidConstraint *)constraint )->getF() );
+        return true;
+
+    case ROUND:
+        sources.append( ( (const RoundConstraint *)constraint )->getB() );
+        outputs.append( ( (const RoundConstraint *)constraint )->getF() );
+        return true;
+
+    case BILINEAR:
+        for ( const auto &b : ( (const BilinearConstraint *)constraint )->getBs() )
+            sources.append( b );
+        outputs.append( ( (const BilinearConstraint *)constraint )->getF() );
+        return true;
+
+    case SOFTMAX:
+        for ( const auto &input : ( (const SoftmaxConstraint *)constraint )->getInputs() )
+            sources.append( input );
+        for ( const auto &output : ( (const SoftmaxConstraint *)constraint )->getOutputs() )
+            outputs.append( output );
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void NLRConstructionFrontier::ConstraintIndex::addConstraint( unsigned type,
+                                                              const List<unsigned> &sources,
+                                                              const List<unsigned> &outputs )
+{
+    unsigned position = _type.size();
+    _type.append( type );
+    _unhandledSources.append( sources.size() );
+
+    for ( const auto &source : sources )
+        _variableToSources[source].append( position );
+    for ( const auto &output : outputs )
+        _variableToOutputs[output].append( position );
+
+    if ( sources.empty() && !_retired.exists( position ) )
+        _ready[type].insert( position );
+}
+
+void NLRConstructionFrontier::ConstraintIndex::handle( unsigned variable )
+{
+    /*
+      A constraint whose output is already handled can no longer be
+      added to the network, so it is retired for good
+    */
+    if ( _variableToOutputs.exists( variable ) )
+    {
+        for ( const auto &position : _variableToOutputs[variable] )
+        {
+            _retired.insert( position );
+            _ready[_type[position]].erase( position );
+        }
+    }
+
+    if ( _variableToSources.exists( variable ) )
+    {
+        for ( const auto &position : _variableToSources[variable] )
+        {
+            ASSERT( _unhandledSources[position] > 0 );
+            --_unhandledSources[position];
+
+            if ( _unhandledSources[position] == 0 && !_retired.exists( position ) )
+                _ready[_type[position]].insert( position );
+        }
+    }
+}
+
+const Set<unsigned> &NLRConstructionFrontier::ConstraintIndex::getReady( unsigned type )
+{
+    return _ready[type];
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
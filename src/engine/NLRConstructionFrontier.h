@@ -0,0 +1,126 @@
+/*********************                                                        */
+/*! \file NLRConstructionFrontier.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The bookkeeping of Query::constructNetworkLevelReasoner. It records
+ ** the layer of every handled variable, and keeps track of the equations
+ ** and constraints that are ready to become neurons of the next layer:
+ **
+ **   * An equality is ready when exactly one of its addends is over an
+ **     unhandled variable.
+ **   * A constraint that the NLR can represent is ready when all of its
+ **     source variables are handled and none of its outputs is.
+ **
+ ** Readiness is updated through an index from each variable to the
+ ** equations and constraints it participates in, whenever a variable
+ ** is handled. This way, constructing the NLR takes time linear in the
+ ** size of the query, instead of rescanning all equations and
+ ** constraints for every layer.
+ **
+ ** Ready equations and constraints are reported by their positions in
+ ** the query's lists, so layers are filled in the same order as before.
+ **/
+
+#ifndef __NLRConstructionFrontier_h__
+#define __NLRConstructionFrontier_h__
+
+#include "Equation.h"
+#include "HashMap.h"
+#include "List.h"
+#include "Map.h"
+#include "NonlinearConstraint.h"
+#include "PiecewiseLinearConstraint.h"
+#include "Set.h"
+#include "Vector.h"
+
+class NLRConstructionFrontier
+{
+public:
+    NLRConstructionFrontier( const List<Equation> &equations,
+                             const List<PiecewiseLinearConstraint *> &plConstraints,
+                             const List<NonlinearConstraint *> &nlConstraints );
+
+    /*
+      Mark a variable as a neuron of the given layer, and update the
+      equations and constraints it participates in. Handling an already
+      handled variable only moves it to the new layer.
+    */
+    void handle( unsigned variable, unsigned layer );
+    bool isHandled( unsigned variable ) const;
+    unsigned getLayer( unsigned variable ) const;
+
+    /*
+      Positions of the ready equations, and of the ready constraints of
+      each type, in ascending order.
+    */
+    const Set<unsigned> &getReadyEquations() const;
+    const Set<unsigned> &getReadyPLConstraints( PiecewiseLinearFunctionType type );
+    const Set<unsigned> &getReadyNLConstraints( NonlinearFunctionType type );
+
+    const Equation &getEquation( unsigned position ) const;
+    PiecewiseLinearConstraint *getPLConstraint( unsigned position ) const;
+    NonlinearConstraint *getNLConstraint( unsigned position ) const;
+
+    /*
+      The variables a constraint reads from and the variables it
+      defines, as laid out in the NLR. Returns false for constraints
+      that the NLR cannot represent.
+    */
+    static bool getSourcesAndOutputs( const PiecewiseLinearConstraint *constraint,
+                                      List<unsigned> &sources,
+                                      List<unsigned> &outputs );
+    static bool getSourcesAndOutputs( const NonlinearConstraint *constraint,
+                                      List<unsigned> &sources,
+                                      List<unsigned> &outputs );
+
+private:
+    /*
+      The bookkeeping of one kind of constraint (piecewise-linear or
+      nonlinear), indexed by the constraints' positions
+    */
+    struct ConstraintIndex
+    {
+        Vector<unsigned> _type;
+        Vector<unsigned> _unhandledSources;
+        Set<unsigned> _retired;
+        HashMap<unsigned, List<unsigned>> _variableToSources;
+        HashMap<unsigned, List<unsigned>> _variableToOutputs;
+        Map<unsigned, Set<unsigned>> _ready;
+
+        void addConstraint( unsigned type,
+                            const List<unsigned> &sources,
+                            const List<unsigned> &outputs );
+        void handle( unsigned variable );
+        const Set<unsigned> &getReady( unsigned type );
+    };
+
+    HashMap<unsigned, unsigned> _variableToLayer;
+
+    Vector<const Equation *> _equations;
+    Vector<unsigned> _unhandledAddends;
+    HashMap<unsigned, List<unsigned>> _variableToEquations;
+    Set<unsigned> _readyEquations;
+
+    Vector<PiecewiseLinearConstraint *> _plConstraints;
+    ConstraintIndex _plIndex;
+
+    Vector<NonlinearConstraint *> _nlConstraints;
+    ConstraintIndex _nlIndex;
+};
+
+#endif // __NLRConstructionFrontier_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
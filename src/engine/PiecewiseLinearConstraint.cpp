@@ -68,7 +68,7 @@ bool PiecewiseLinearConstraint::isActive() const
 
 void PiecewiseLinearConstraint::registerBoundManager( IBoundManager *boundManager )
 {
-    ASSERT( _boundManager == nullptr );
+    ASSERT( _boundManager == nullptr || _boundManager == boundManager );
     _boundManager = boundManager;
 }
 
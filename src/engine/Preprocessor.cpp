@@ -20,11 +20,14 @@
 #include "InfeasibleQueryException.h"
 #include "MStringf.h"
 #include "Map.h"
+#include "Layer.h"
 #include "MarabouError.h"
+#include "NetworkLevelReasoner.h"
 #include "Options.h"
 #include "PiecewiseLinearFunctionType.h"
 #include "Query.h"
 #include "Statistics.h"
+#include "TimeUtils.h"
 #include "Tightening.h"
 
 #ifdef _WIN32
@@ -62,6 +65,7 @@ std::unique_ptr<Query> Preprocessor::preprocess( const IQuery &query,
                                                  bool attemptVariableElimination )
 {
     _preprocessed = std::unique_ptr<Query>( query.generateQuery() );
+    _numberOfInputQueryVariables = _preprocessed->getNumberOfVariables();
 
     informConstraintsOfInitialBounds( *_preprocessed );
 
@@ -76,7 +80,12 @@ std::unique_ptr<Query> Preprocessor::preprocess( const IQuery &query,
     */
     List<Equation> unhandledEquations;
     Set<unsigned> varsInUnhandledConstraints;
+    struct timespec start = TimeUtils::sampleMicro();
     _preprocessed->constructNetworkLevelReasoner( unhandledEquations, varsInUnhandledConstraints );
+    struct timespec end = TimeUtils::sampleMicro();
+    if ( _statistics )
+        _statistics->setLongAttribute( Statistics::NLR_CONSTRUCTION_TIME_MICRO,
+                                       TimeUtils::timePassed( start, end ) );
 
     /*
       Merge consecutive WS layers
@@ -87,6 +96,12 @@ std::unique_ptr<Query> Preprocessor::preprocess( const IQuery &query,
             unhandledEquations, varsInUnhandledConstraints, _unusedSymbolicallyFixedVariables );
     }
 
+    /*
+      An NLR built directly by the network parser only now contributes
+      the equations of its (merged) weighted sum layers
+    */
+    _preprocessed->encodePrebuiltNetworkLevelReasoner();
+
     removeRedundantAddendsInAllEquations();
 
     /*
@@ -136,6 +151,7 @@ std::unique_ptr<Query> Preprocessor::preprocess( const IQuery &query,
       Until saturation:
         1. Tighten bounds using equations
         2. Tighten bounds using pl constraints
+        3. Merge identical variables, and presolve the equations
 
       Then, eliminate fixed variables.
     */
@@ -152,6 +168,9 @@ std::unique_ptr<Query> Preprocessor::preprocess( const IQuery &query,
         continueTightening = processConstraints() || continueTightening;
         if ( attemptVariableElimination )
             continueTightening = processIdenticalVariables() || continueTightening;
+        if ( attemptVariableElimination &&
+             !Options::get()->getBool( Options::DO_NOT_PRESOLVE_EQUATIONS ) )
+            continueTightening = presolveEquations() || continueTightening;
 
         if ( _statistics )
             _statistics->incUnsignedAttribute( Statistics::PP_NUM_TIGHTENING_ITERATIONS );
@@ -649,6 +668,269 @@ bool Preprocessor::processIdenticalVariables()
     return found;
 }
 
+bool Preprocessor::presolveEquations()
+{
+    List<Equation> &equations( _preprocessed->getEquations() );
+
+    Set<unsigned> unremovableVariables = _uneliminableVariables;
+    for ( const auto &constraint : _preprocessed->getPiecewiseLinearConstraints() )
+    {
+        for ( const auto &var : constraint->getParticipatingVariables() )
+            unremovableVariables.insert( var );
+    }
+    for ( const auto &constraint : _preprocessed->getNonlinearConstraints() )
+    {
+        for ( const auto &var : constraint->getParticipatingVariables() )
+            unremovableVariables.insert( var );
+    }
+    for ( const auto &merged : _mergedVariables )
+        unremovableVariables.insert( merged.second );
+    if ( _preprocessed->_networkLevelReasoner )
+    {
+        for ( const auto &layer :
+              _preprocessed->_networkLevelReasoner->getLayerIndexToLayer() )
+        {
+            for ( unsigned neuron = 0; neuron < layer.second->getSize(); ++neuron )
+            {
+                if ( layer.second->neuronHasVariable( neuron ) )
+                    unremovableVariables.insert( layer.second->neuronToVariable( neuron ) );
+            }
+        }
+    }
+
+    // The number of equations each variable appears in
+    Map<unsigned, unsigned> occurrences;
+    for ( const auto &equation : equations )
+    {
+        for ( const auto &addend : equation._addends )
+            ++occurrences[addend._variable];
+    }
+
+    bool equationRemoved = false;
+    List<Equation>::iterator equation = equations.begin();
+    while ( equation != equations.end() )
+    {
+        ASSERT( equation->_type == Equation::EQ );
+
+        if ( !removeImpliedFreeColumnSingleton( *equation, unremovableVariables, occurrences ) &&
+             !( equation->_addends.size() == 2 &&
+                substituteDoubletonEquation( equation, unremovableVariables, occurrences ) ) )
+        {
+            ++equation;
+            continue;
+        }
+
+        for ( const auto &addend : equation->_addends )
+            --occurrences[addend._variable];
+        equation = equations.erase( equation );
+        equationRemoved = true;
+
+        if ( _statistics )
+            _statistics->incUnsignedAttribute( Statistics::PP_NUM_EQUATIONS_PRESOLVED );
+    }
+
+    return equationRemoved;
+}
+
+bool Preprocessor::removeImpliedFreeColumnSingleton( const Equation &equation,
+                                                     const Set<unsigned> &unremovableVariables,
+                                                     const Map<unsigned, unsigned> &occurrences )
+{
+    // The equation is of the form sum (ci * xi) = b
+    for ( const auto &candidate : equation._addends )
+    {
+        unsigned x = candidate._variable;
+        if ( unremovableVariables.exists( x ) || occurrences.at( x ) != 1 )
+            continue;
+
+        // Compute the range of b - sum_{i != x} (ci * xi)
+        double min = equation._scalar;
+        double max = equation._scalar;
+        bool reconstructible = true;
+        for ( const auto &addend : equation._addends )
+        {
+            if ( addend._variable == x )
+                continue;
+
+            if ( !variableCanBeReconstructedFrom( addend._variable ) )
+            {
+                reconstructible = false;
+                break;
+            }
+
+            double ci = addend._coefficient;
+            if ( ci > 0 )
+            {
+                min -= ci * getUpperBound( addend._variable );
+                max -= ci * getLowerBound( addend._variable );
+            }
+            else
+            {
+                min -= ci * getLowerBound( addend._variable );
+                max -= ci * getUpperBound( addend._variable );
+            }
+        }
+
+        if ( !reconstructible )
+            return false;
+
+        // The bounds that the equation implies for x
+        double cx = candidate._coefficient;
+        double impliedLb = cx > 0 ? min / cx : max / cx;
+        double impliedUb = cx > 0 ? max / cx : min / cx;
+
+        // If these are within x's bounds, x never restricts the other variables
+        if ( FloatUtils::isFinite( getLowerBound( x ) ) &&
+             !FloatUtils::gte( impliedLb, getLowerBound( x ) ) )
+            continue;
+        if ( FloatUtils::isFinite( getUpperBound( x ) ) &&
+             !FloatUtils::lte( impliedUb, getUpperBound( x ) ) )
+            continue;
+
+        // x = ( b - sum_{i != x} (ci * xi) ) / cx
+        Map<unsigned, double> addends;
+        for ( const auto &addend : equation._addends )
+        {
+            if ( addend._variable != x )
+                addends[addend._variable] = -addend._coefficient / cx;
+        }
+        symbolicallyFixVariable( x, LinearExpression( addends, equation._scalar / cx ) );
+
+        return true;
+    }
+
+    return false;
+}
+
+bool Preprocessor::substituteDoubletonEquation( List<Equation>::iterator doubleton,
+                                                const Set<unsigned> &unremovableVariables,
+                                                Map<unsigned, unsigned> &occurrences )
+{
+    // The equation is of the form a * x + b * y = c, and x is to be removed
+    const Equation::Addend &first = doubleton->_addends.front();
+    const Equation::Addend &second = doubleton->_addends.back();
+
+    bool firstRemovable = !unremovableVariables.exists( first._variable ) &&
+                          variableCanBeReconstructedFrom( second._variable );
+    bool secondRemovable = !unremovableVariables.exists( second._variable ) &&
+                           variableCanBeReconstructedFrom( first._variable );
+
+    if ( !firstRemovable && !secondRemovable )
+        return false;
+
+    // Prefer removing the variable with the larger coefficient, for numerical stability
+    bool removeFirst = firstRemovable;
+    if ( firstRemovable && secondRemovable )
+        removeFirst = FloatUtils::abs( first._coefficient ) >= FloatUtils::abs( second._coefficient );
+
+    unsigned x = removeFirst ? first._variable : second._variable;
+    unsigned y = removeFirst ? second._variable : first._variable;
+    double a = removeFirst ? first._coefficient : second._coefficient;
+    double b = removeFirst ? second._coefficient : first._coefficient;
+    double c = doubleton->_scalar;
+
+    if ( FloatUtils::abs( a ) <
+         FloatUtils::abs( b ) * GlobalConfiguration::PREPROCESSOR_SUBSTITUTION_PIVOT_THRESHOLD )
+        return false;
+
+    /*
+      Move the bounds of x onto y = ( c - a * x ) / b
+    */
+    double axMin = a > 0 ? a * getLowerBound( x ) : a * getUpperBound( x );
+    double axMax = a > 0 ? a * getUpperBound( x ) : a * getLowerBound( x );
+    double yLb = b > 0 ? ( c - axMax ) / b : ( c - axMin ) / b;
+    double yUb = b > 0 ? ( c - axMin ) / b : ( c - axMax ) / b;
+
+    if ( FloatUtils::gt( yLb, getLowerBound( y ) ) )
+        setLowerBound( y, yLb );
+    if ( FloatUtils::lt( yUb, getUpperBound( y ) ) )
+        setUpperBound( y, yUb );
+
+    if ( FloatUtils::gt( getLowerBound( y ),
+                         getUpperBound( y ),
+                         GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
+        throw InfeasibleQueryException();
+
+    /*
+      Replace d * x with d * ( c - b * y ) / a in all other equations
+    */
+    List<Equation> &equations( _preprocessed->getEquations() );
+    List<Equation>::iterator equation = equations.begin();
+    while ( equation != equations.end() )
+    {
+        if ( equation == doubleton || !equation->getParticipatingVariables().exists( x ) )
+        {
+            ++equation;
+            continue;
+        }
+
+        for ( const auto &addend : equation->_addends )
+            --occurrences[addend._variable];
+
+        for ( auto &addend : equation->_addends )
+        {
+            if ( addend._variable != x )
+                continue;
+
+            double d = addend._coefficient;
+            equation->_scalar -= d * c / a;
+            addend._variable = y;
+            addend._coefficient = -d * b / a;
+        }
+        equation->removeRedundantAddends();
+
+        for ( const auto &addend : equation->_addends )
+            ++occurrences[addend._variable];
+
+        if ( !equation->_addends.empty() )
+        {
+            ++equation;
+            continue;
+        }
+
+        // y cancelled out, so the equation is either trivial or infeasible
+        if ( FloatUtils::areDisequal(
+                 equation->_scalar, 0, GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
+            throw InfeasibleQueryException();
+
+        equation = equations.erase( equation );
+
+        if ( _statistics )
+            _statistics->incUnsignedAttribute( Statistics::PP_NUM_EQUATIONS_PRESOLVED );
+    }
+
+    // x = ( c - b * y ) / a
+    Map<unsigned, double> addends;
+    addends[y] = -b / a;
+    symbolicallyFixVariable( x, LinearExpression( addends, c / a ) );
+
+    return true;
+}
+
+bool Preprocessor::variableCanBeReconstructedFrom( unsigned variable ) const
+{
+    /*
+      The values of the input query's variables are obtained from the
+      tableau (or from the preprocessor), and the values of symbolically
+      fixed variables are reconstructed from them. Other auxiliary
+      variables are not reported, so they cannot be used.
+    */
+    return variable < _numberOfInputQueryVariables ||
+           _unusedSymbolicallyFixedVariables.exists( variable );
+}
+
+void Preprocessor::symbolicallyFixVariable( unsigned variable, const LinearExpression &expression )
+{
+    PREPROCESSOR_LOG( Stringf( "Presolve: variable x%u is symbolically fixed", variable ).ascii() );
+
+    _unusedSymbolicallyFixedVariables[variable] = expression;
+    _presolvedVariables.insert( variable );
+
+    // The variable is now unused, so it is arbitrarily fixed later on
+    if ( _preprocessed->_debuggingSolution.exists( variable ) )
+        _preprocessed->_debuggingSolution.erase( variable );
+}
+
 void Preprocessor::collectFixedValues()
 {
     // Compute all used variables:
@@ -1095,6 +1377,76 @@ void Preprocessor::setSolutionValuesOfEliminatedNeurons( IQuery &inputQuery )
     }
 }
 
+void Preprocessor::setBoundsOfPresolvedVariables( IQuery &inputQuery ) const
+{
+    Map<unsigned, double> lowerBounds;
+    Map<unsigned, double> upperBounds;
+    for ( unsigned i = 0; i < inputQuery.getNumberOfVariables(); ++i )
+    {
+        if ( !_unusedSymbolicallyFixedVariables.exists( i ) )
+        {
+            lowerBounds[i] = inputQuery.getLowerBound( i );
+            upperBounds[i] = inputQuery.getUpperBound( i );
+        }
+    }
+
+    // Presolved variables may depend on each other, so evaluate them until saturation
+    Set<unsigned> remaining = _presolvedVariables;
+    bool progressMade = true;
+    while ( progressMade && !remaining.empty() )
+    {
+        List<unsigned> boundedVariables;
+        for ( unsigned variable : remaining )
+        {
+            const LinearExpression &expression = _unusedSymbolicallyFixedVariables.at( variable );
+
+            double lb = expression._constant;
+            double ub = expression._constant;
+            bool known = true;
+            for ( const auto &addend : expression._addends )
+            {
+                if ( !lowerBounds.exists( addend.first ) )
+                {
+                    known = false;
+                    break;
+                }
+
+                double coefficient = addend.second;
+                if ( coefficient > 0 )
+                {
+                    lb += coefficient * lowerBounds[addend.first];
+                    ub += coefficient * upperBounds[addend.first];
+                }
+                else
+                {
+                    lb += coefficient * upperBounds[addend.first];
+                    ub += coefficient * lowerBounds[addend.first];
+                }
+            }
+
+            if ( !known )
+                continue;
+
+            lowerBounds[variable] = lb;
+            upperBounds[variable] = ub;
+            boundedVariables.append( variable );
+        }
+
+        for ( unsigned variable : boundedVariables )
+            remaining.erase( variable );
+        progressMade = !boundedVariables.empty();
+    }
+
+    for ( unsigned variable : _presolvedVariables )
+    {
+        if ( variable < inputQuery.getNumberOfVariables() && lowerBounds.exists( variable ) )
+        {
+            inputQuery.tightenLowerBound( variable, lowerBounds[variable] );
+            inputQuery.tightenUpperBound( variable, upperBounds[variable] );
+        }
+    }
+}
+
 void Preprocessor::setMissingBoundsToInfinity()
 {
     for ( unsigned i = 0; i < _preprocessed->getNumberOfVariables(); ++i )
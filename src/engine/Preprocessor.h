@@ -24,6 +24,9 @@
 #include "Query.h"
 #include "Set.h"
 
+#define PREPROCESSOR_LOG( x, ... )                                                                 \
+    LOG( GlobalConfiguration::PREPROCESSOR_LOGGING, "Preprocessor: %s\n", x )
+
 class Preprocessor
 {
 public:
@@ -71,6 +74,13 @@ public:
     */
     void setSolutionValuesOfEliminatedNeurons( IQuery &inputQuery );
 
+    /*
+      Given an inputQuery with the bounds of all variables other than the
+      ones removed by the presolve, compute the bounds of those from the
+      expressions they were symbolically fixed to.
+    */
+    void setBoundsOfPresolvedVariables( IQuery &inputQuery ) const;
+
     static void informConstraintsOfInitialBounds( Query &query );
 
 private:
@@ -135,6 +145,44 @@ private:
     */
     bool processIdenticalVariables();
 
+    /*
+      LP presolve: remove equations that can be dropped from the tableau,
+      together with one of their variables. A removed variable is
+      symbolically fixed to the expression the equation gives for it, so
+      that its value is reconstructed from the solution of the rest.
+
+      Only variables that participate in no constraint, are not
+      input/output variables or neurons of the network level reasoner,
+      and have no other variable merged into them, are removed:
+
+        1. Implied-free column singletons: if x appears only in a single
+           equation, and the bounds the equation implies for x are within
+           x's bounds, the equation and x are removed.
+
+        2. Doubleton equations: if ax + by = c, x is substituted by
+           (c - by) / a in all other equations, x's bounds are moved onto
+           y, and the equation and x are removed.
+    */
+    bool presolveEquations();
+
+    bool removeImpliedFreeColumnSingleton( const Equation &equation,
+                                           const Set<unsigned> &unremovableVariables,
+                                           const Map<unsigned, unsigned> &occurrences );
+    bool substituteDoubletonEquation( List<Equation>::iterator doubleton,
+                                      const Set<unsigned> &unremovableVariables,
+                                      Map<unsigned, unsigned> &occurrences );
+
+    /*
+      Whether the value of a variable will be known when reconstructing
+      the values of symbolically fixed variables
+    */
+    bool variableCanBeReconstructedFrom( unsigned variable ) const;
+
+    /*
+      Symbolically fix a variable removed by the presolve
+    */
+    void symbolicallyFixVariable( unsigned variable, const LinearExpression &expression );
+
     /*
       Collect all variables whose lower and upper bounds are equal, or
       which do not appear anywhere in the input query.
@@ -158,6 +206,12 @@ private:
     */
     Set<unsigned> _uneliminableVariables;
 
+    /*
+      The number of variables in the query before preprocessing, i.e.
+      of the variables whose values are reported in the solution
+    */
+    unsigned _numberOfInputQueryVariables;
+
     /*
       The preprocessed query
     */
@@ -194,6 +248,11 @@ private:
     */
     Map<unsigned, LinearExpression> _unusedSymbolicallyFixedVariables;
 
+    /*
+      The symbolically fixed variables that were removed by the presolve
+    */
+    Set<unsigned> _presolvedVariables;
+
     /*
       Mapping of old variable indices to new varibale indices, if
       indices were changed during preprocessing.
@@ -0,0 +1,70 @@
+/*********************                                                        */
+/*! \file ProgressReporter.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "ProgressReporter.h"
+
+ProgressReporter::ProgressReporter( const Callback &callback,
+                                    unsigned intervalInMilliseconds,
+                                    const List<unsigned> &variables )
+    : _callback( callback )
+    , _intervalInMicroSeconds( (unsigned long long)intervalInMilliseconds * 1000 )
+    , _variables( variables )
+{
+}
+
+const List<unsigned> &ProgressReporter::getVariables() const
+{
+    return _variables;
+}
+
+void ProgressReporter::resolveVariable( unsigned variable, unsigned preprocessedVariable )
+{
+    _preprocessedVariables[variable] = preprocessedVariable;
+}
+
+void ProgressReporter::resolveFixedVariable( unsigned variable, double value )
+{
+    _fixedValues[variable] = value;
+}
+
+const Map<unsigned, unsigned> &ProgressReporter::getPreprocessedVariables() const
+{
+    return _preprocessedVariables;
+}
+
+const Map<unsigned, double> &ProgressReporter::getFixedValues() const
+{
+    return _fixedValues;
+}
+
+bool ProgressReporter::isDue( const struct timespec &lastReportTime ) const
+{
+    return TimeUtils::timePassed( lastReportTime, TimeUtils::sampleMicro() ) >=
+           _intervalInMicroSeconds;
+}
+
+void ProgressReporter::report( const SolveProgress &progress )
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    _callback( progress );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,105 @@
+/*********************                                                        */
+/*! \file ProgressReporter.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Periodic reports of the progress of a search to a user callback. Each
+ ** report holds a snapshot of the statistics of an engine, and the bounds
+ ** of some variables of the input query that are known to hold: for the
+ ** whole query, or in SnC mode, for the whole subquery being solved.
+ **
+ ** The variables are given in terms of the input query, and are resolved
+ ** against the preprocessing of the engine that processed it. The engines
+ ** of DnC workers share the resolution of the base engine, as they solve
+ ** its preprocessed query.
+ **
+ ** Reports of different engines (e.g., DnC workers) are serialized.
+
+ **/
+
+#ifndef __ProgressReporter_h__
+#define __ProgressReporter_h__
+
+#include "List.h"
+#include "MString.h"
+#include "Map.h"
+#include "Statistics.h"
+#include "TimeUtils.h"
+
+#include <functional>
+#include <mutex>
+
+struct SolveProgress
+{
+    /*
+      The id of the subquery being solved, or "" when not in SnC mode
+    */
+    String _queryId;
+
+    Statistics _statistics;
+
+    /*
+      Bounds of the reported variables of the input query
+    */
+    Map<unsigned, double> _lowerBounds;
+    Map<unsigned, double> _upperBounds;
+};
+
+class ProgressReporter
+{
+public:
+    typedef std::function<void( const SolveProgress & )> Callback;
+
+    ProgressReporter( const Callback &callback,
+                      unsigned intervalInMilliseconds,
+                      const List<unsigned> &variables );
+
+    /*
+      The variables of the input query whose bounds are reported
+    */
+    const List<unsigned> &getVariables() const;
+
+    /*
+      Record what a variable of the input query became after
+      preprocessing: either a variable of the preprocessed query, or a
+      constant. Variables that are neither (e.g., eliminated symbolically)
+      are not reported.
+    */
+    void resolveVariable( unsigned variable, unsigned preprocessedVariable );
+    void resolveFixedVariable( unsigned variable, double value );
+    const Map<unsigned, unsigned> &getPreprocessedVariables() const;
+    const Map<unsigned, double> &getFixedValues() const;
+
+    /*
+      Whether a report is due, given the time of the previous one
+    */
+    bool isDue( const struct timespec &lastReportTime ) const;
+
+    void report( const SolveProgress &progress );
+
+private:
+    Callback _callback;
+    unsigned long long _intervalInMicroSeconds;
+    List<unsigned> _variables;
+
+    Map<unsigned, unsigned> _preprocessedVariables;
+    Map<unsigned, double> _fixedValues;
+
+    std::mutex _mutex;
+};
+
+#endif // __ProgressReporter_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
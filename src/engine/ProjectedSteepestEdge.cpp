@@ -29,6 +29,8 @@ ProjectedSteepestEdgeRule::ProjectedSteepestEdgeRule()
     , _work1( NULL )
     , _work2( NULL )
     , _AColumn( NULL )
+    , _nextPricingIndex( 0 )
+    , _pooledCandidates( NULL )
     , _iterationsUntilReset( GlobalConfiguration::PSE_ITERATIONS_BEFORE_RESET )
     , _errorInGamma( 0.0 )
 {
@@ -64,6 +66,12 @@ void ProjectedSteepestEdgeRule::freeIfNeeded()
         delete[] _work2;
         _work2 = NULL;
     }
+
+    if ( _pooledCandidates )
+    {
+        delete[] _pooledCandidates;
+        _pooledCandidates = NULL;
+    }
 }
 
 void ProjectedSteepestEdgeRule::initialize( const ITableau &tableau )
@@ -90,6 +98,14 @@ void ProjectedSteepestEdgeRule::initialize( const ITableau &tableau )
     if ( !_work2 )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "ProjectedSteepestEdgeRule::work2" );
 
+    _candidatePool.initialize( GlobalConfiguration::PSE_CANDIDATE_POOL_SIZE, _n - _m );
+    _nextPricingIndex = 0;
+
+    _pooledCandidates = new unsigned[GlobalConfiguration::PSE_CANDIDATE_POOL_SIZE];
+    if ( !_pooledCandidates )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED,
+                            "ProjectedSteepestEdgeRule::pooledCandidates" );
+
     resetReferenceSpace( tableau );
 }
 
@@ -178,6 +194,71 @@ bool ProjectedSteepestEdgeRule::select( ITableau &tableau,
     return true;
 }
 
+bool ProjectedSteepestEdgeRule::select( ITableau &tableau, const Set<unsigned> &excluded )
+{
+    const double *costFunction = tableau.getCostFunction();
+
+    if ( excluded.empty() )
+        priceCandidates( tableau, costFunction );
+
+    unsigned candidate;
+    while ( _candidatePool.popBest( candidate ) )
+    {
+        if ( excluded.exists( candidate ) )
+            continue;
+
+        tableau.setEnteringVariableIndex( candidate );
+
+        if ( _statistics )
+            _statistics->incLongAttribute( Statistics::PSE_NUM_ITERATIONS );
+
+        return true;
+    }
+
+    PSE_LOG( "No candidates, select returning false" );
+    return false;
+}
+
+double ProjectedSteepestEdgeRule::computeScore( unsigned nonBasicIndex,
+                                                const double *costFunction ) const
+{
+    double gammaValue = _gamma[nonBasicIndex];
+    if ( gammaValue < DBL_EPSILON )
+        return 0;
+
+    return ( costFunction[nonBasicIndex] * costFunction[nonBasicIndex] ) / gammaValue;
+}
+
+void ProjectedSteepestEdgeRule::priceCandidates( const ITableau &tableau,
+                                                 const double *costFunction )
+{
+    unsigned numberOfNonBasics = tableau.getN() - tableau.getM();
+    ASSERT( numberOfNonBasics == _n - _m );
+
+    // The reduced costs and gammas of the kept candidates have changed since they were priced
+    unsigned numberOfPooledCandidates = _candidatePool.removeAll( _pooledCandidates );
+    for ( unsigned i = 0; i < numberOfPooledCandidates; ++i )
+    {
+        unsigned index = _pooledCandidates[i];
+        if ( tableau.eligibleForEntry( index, costFunction ) )
+            _candidatePool.offer( index, computeScore( index, costFunction ) );
+    }
+
+    // Price sections of the non-basic variables, continuing from where the previous step stopped
+    unsigned priced = 0;
+    while ( priced < numberOfNonBasics &&
+            ( priced < GlobalConfiguration::PSE_PRICING_SECTION_SIZE || _candidatePool.empty() ) )
+    {
+        unsigned index = _nextPricingIndex;
+        if ( ++_nextPricingIndex == numberOfNonBasics )
+            _nextPricingIndex = 0;
+        ++priced;
+
+        if ( tableau.eligibleForEntry( index, costFunction ) )
+            _candidatePool.offer( index, computeScore( index, costFunction ) );
+    }
+}
+
 void ProjectedSteepestEdgeRule::prePivotHook( const ITableau &tableau, bool fakePivot )
 {
     PSE_LOG( "PrePivotHook called" );
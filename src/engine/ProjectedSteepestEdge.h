@@ -16,6 +16,7 @@
 #ifndef __ProjectedSteepestEdge_h__
 #define __ProjectedSteepestEdge_h__
 
+#include "EntryCandidatePool.h"
 #include "IProjectedSteepestEdge.h"
 #include "SparseUnsortedList.h"
 
@@ -39,6 +40,17 @@ public:
     bool
     select( ITableau &tableau, const List<unsigned> &candidates, const Set<unsigned> &excluded );
 
+    /*
+      Apply the projected steepest edge rule with partial and multiple
+      pricing. Upon the first attempt of each simplex step, the candidates
+      kept from previous steps are re-priced, and then the non-basic
+      variables are priced one section at a time, until at least a section
+      has been priced and some candidate has been found. The best
+      candidates are kept in a bounded pool, from which the following
+      attempts of the step, and later steps, choose.
+    */
+    bool select( ITableau &tableau, const Set<unsigned> &excluded );
+
     /*
       We use this hook to update gamma according to the entering
       and leaving variables.
@@ -84,6 +96,15 @@ private:
     unsigned _m;
     unsigned _n;
 
+    /*
+      The best entering candidates found so far, the non-basic index at
+      which the next pricing section starts, and work space for re-pricing
+      the candidates.
+    */
+    EntryCandidatePool _candidatePool;
+    unsigned _nextPricingIndex;
+    unsigned *_pooledCandidates;
+
     /*
       Remaining iterations before resetting the reference space.
     */
@@ -105,6 +126,16 @@ private:
     */
     double computeAccurateGamma( double &accurateGamma, const ITableau &tableau );
 
+    /*
+      The steepest edge score of a non-basic variable (by index).
+    */
+    double computeScore( unsigned nonBasicIndex, const double *costFunction ) const;
+
+    /*
+      Fill the candidate pool for a new simplex step.
+    */
+    void priceCandidates( const ITableau &tableau, const double *costFunction );
+
     /*
       Free all data structures.
     */
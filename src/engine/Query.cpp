@@ -23,6 +23,7 @@
 #include "MStringf.h"
 #include "MarabouError.h"
 #include "MaxConstraint.h"
+#include "NLRConstructionFrontier.h"
 #include "Options.h"
 #include "RoundConstraint.h"
 #include "SoftmaxConstraint.h"
@@ -34,6 +35,7 @@
 Query::Query()
     : _ensureSameSourceLayerInNLR( Options::get()->getSymbolicBoundTighteningType() ==
                                    SymbolicBoundTighteningType::DEEP_POLY )
+    , _networkLevelReasonerIsPrebuilt( false )
     , _networkLevelReasoner( NULL )
 {
 }
@@ -356,6 +358,7 @@ Query &Query::operator=( const Query &other )
     INPUT_QUERY_LOG( "Calling deep copy constructor..." );
 
     _ensureSameSourceLayerInNLR = other._ensureSameSourceLayerInNLR;
+    _networkLevelReasonerIsPrebuilt = other._networkLevelReasonerIsPrebuilt;
 
     _numberOfVariables = other._numberOfVariables;
     _equations = other._equations;
@@ -485,6 +488,14 @@ void Query::storeDebuggingSolution( unsigned variable, double value )
 
 void Query::saveQuery( const String &fileName )
 {
+    if ( _networkLevelReasonerIsPrebuilt )
+    {
+        Query encodedQuery( *this );
+        encodedQuery.encodePrebuiltNetworkLevelReasoner();
+        encodedQuery.saveQuery( fileName );
+        return;
+    }
+
     AutoFile queryFile( fileName );
     queryFile->open( IFile::MODE_WRITE_TRUNCATE );
 
@@ -583,6 +594,14 @@ void Query::saveQuery( const String &fileName )
 
 void Query::saveQueryAsSmtLib( const String &fileName ) const
 {
+    if ( _networkLevelReasonerIsPrebuilt )
+    {
+        Query encodedQuery( *this );
+        encodedQuery.encodePrebuiltNetworkLevelReasoner();
+        encodedQuery.saveQueryAsSmtLib( fileName );
+        return;
+    }
+
     if ( !_nlConstraints.empty() )
     {
         printf( "SMTLIB conversion does not support nonlinear constraints yet. Aborting "
@@ -711,6 +730,14 @@ void Query::printInputOutputBounds() const
 
 void Query::dump() const
 {
+    if ( _networkLevelReasonerIsPrebuilt )
+    {
+        Query encodedQuery( *this );
+        encodedQuery.encodePrebuiltNetworkLevelReasoner();
+        encodedQuery.dump();
+        return;
+    }
+
     printf( "Total number of variables: %u\n", _numberOfVariables );
     printf( "Input variables:\n" );
     for ( const auto &input : _inputIndexToVariable )
@@ -809,6 +836,7 @@ Query *Query::generateQuery() const
 void Query::setNetworkLevelReasoner( NLR::NetworkLevelReasoner *nlr )
 {
     _networkLevelReasoner = nlr;
+    _networkLevelReasonerIsPrebuilt = false;
 }
 
 NLR::NetworkLevelReasoner *Query::getNetworkLevelReasoner() const
@@ -816,16 +844,49 @@ NLR::NetworkLevelReasoner *Query::getNetworkLevelReasoner() const
     return _networkLevelReasoner;
 }
 
+void Query::setPrebuiltNetworkLevelReasoner( NLR::NetworkLevelReasoner *nlr )
+{
+    if ( _networkLevelReasoner && _networkLevelReasoner != nlr )
+        delete _networkLevelReasoner;
+
+    _networkLevelReasoner = nlr;
+    _networkLevelReasonerIsPrebuilt = ( nlr != NULL );
+}
+
+bool Query::hasPrebuiltNetworkLevelReasoner() const
+{
+    return _networkLevelReasonerIsPrebuilt;
+}
+
+void Query::encodePrebuiltNetworkLevelReasoner()
+{
+    if ( !_networkLevelReasonerIsPrebuilt )
+        return;
+
+    _networkLevelReasoner->encodeAffineLayers( *this );
+    _networkLevelReasonerIsPrebuilt = false;
+}
+
 bool Query::constructNetworkLevelReasoner( List<Equation> &unhandledEquations,
                                            Set<unsigned> &varsInUnhandledConstraints )
 {
+    if ( _networkLevelReasonerIsPrebuilt )
+    {
+        if ( !_ensureSameSourceLayerInNLR || prebuiltActivationLayersHaveSingleSources() )
+            return adoptPrebuiltNetworkLevelReasoner( unhandledEquations,
+                                                      varsInUnhandledConstraints );
+
+        // Otherwise, reconstruct the NLR from the equations
+        encodePrebuiltNetworkLevelReasoner();
+    }
+
     INPUT_QUERY_LOG( "PP: constructing an NLR... " );
 
     if ( _networkLevelReasoner )
         delete _networkLevelReasoner;
     NLR::NetworkLevelReasoner *nlr = new NLR::NetworkLevelReasoner;
 
-    Map<unsigned, unsigned> handledVariableToLayer;
+    NLRConstructionFrontier frontier( _equations, _plConstraints, _nlConstraints );
 
     // First, put all the input neurons in layer 0
     List<unsigned> inputs = getInputVariables();
@@ -844,7 +905,7 @@ bool Query::constructNetworkLevelReasoner( List<Equation> &unhandledEquations,
     for ( const auto &inputVariable : inputs )
     {
         nlr->setNeuronVariable( NLR::NeuronIndex( 0, index ), inputVariable );
-        handledVariableToLayer[inputVariable] = 0;
+        frontier.handle( inputVariable, 0 );
 
         inputLayer->setLb( index,
                            _lowerBounds.exists( inputVariable ) ? _lowerBounds[inputVariable]
@@ -861,23 +922,13 @@ bool Query::constructNetworkLevelReasoner( List<Equation> &unhandledEquations,
     Set<PiecewiseLinearConstraint *> handledPLConstraints;
     Set<NonlinearConstraint *> handledNLConstraints;
     // Now, repeatedly attempt to construct additional layers
-    while (
-        constructWeighedSumLayer( nlr, handledVariableToLayer, newLayerIndex, handledEquations ) ||
-        constructReluLayer( nlr, handledVariableToLayer, newLayerIndex, handledPLConstraints ) ||
-        constructRoundLayer( nlr, handledVariableToLayer, newLayerIndex, handledNLConstraints ) ||
-        constructLeakyReluLayer(
-            nlr, handledVariableToLayer, newLayerIndex, handledPLConstraints ) ||
-        constructAbsoluteValueLayer(
-            nlr, handledVariableToLayer, newLayerIndex, handledPLConstraints ) ||
-        constructSignLayer( nlr, handledVariableToLayer, newLayerIndex, handledPLConstraints ) ||
-        constructSigmoidLayer( nlr, handledVariableToLayer, newLayerIndex, handledNLConstraints ) ||
-        constructMaxLayer( nlr, handledVariableToLayer, newLayerIndex, handledPLConstraints ) ||
-        constructBilinearLayer(
-            nlr, handledVariableToLayer, newLayerIndex, handledNLConstraints ) ||
-        constructSoftmaxLayer( nlr, handledVariableToLayer, newLayerIndex, handledNLConstraints ) )
-    {
+    while ( constructNextLayer( nlr,
+                                frontier,
+                                newLayerIndex,
+                                handledEquations,
+                                handledPLConstraints,
+                                handledNLConstraints ) )
         ++newLayerIndex;
-    }
 
     bool success = ( newLayerIndex > 1 );
 
@@ -887,29 +938,11 @@ bool Query::constructNetworkLevelReasoner( List<Equation> &unhandledEquations,
         for ( unsigned i = 0; i < nlr->getNumberOfLayers(); ++i )
             count += nlr->getLayer( i )->getSize();
 
-        // Collect 1) equations unaccounted for by the NLR; 2) variables that
-        // participate in constraints unhandled by the NLR.
-        unsigned index = 0;
-        for ( const auto &e : _equations )
-        {
-            if ( !handledEquations.exists( index++ ) )
-            {
-                unhandledEquations.append( e );
-                varsInUnhandledConstraints.insert( e.getParticipatingVariables() );
-            }
-        }
-
-        for ( const auto &c : _plConstraints )
-        {
-            if ( !handledPLConstraints.exists( c ) )
-                varsInUnhandledConstraints.insert( c->getParticipatingVariables() );
-        }
-
-        for ( const auto &c : _nlConstraints )
-        {
-            if ( !handledNLConstraints.exists( c ) )
-                varsInUnhandledConstraints.insert( c->getParticipatingVariables() );
-        }
+        collectUnhandledEquationsAndConstraints( handledEquations,
+                                                 handledPLConstraints,
+                                                 handledNLConstraints,
+                                                 unhandledEquations,
+                                                 varsInUnhandledConstraints );
 
         INPUT_QUERY_LOG(
             Stringf( "successful. Constructed %u layers with %u neurons (out of %u)."
@@ -937,6 +970,173 @@ bool Query::constructNetworkLevelReasoner( List<Equation> &unhandledEquations,
     return success;
 }
 
+bool Query::adoptPrebuiltNetworkLevelReasoner( List<Equation> &unhandledEquations,
+                                               Set<unsigned> &varsInUnhandledConstraints )
+{
+    INPUT_QUERY_LOG( "PP: adopting a prebuilt NLR... " );
+
+    NLR::NetworkLevelReasoner *nlr = _networkLevelReasoner;
+    NLRConstructionFrontier frontier( _equations, _plConstraints, _nlConstraints );
+
+    // Store the current bounds in the NLR, and collect the activation neurons
+    Set<unsigned> activationVariables;
+    for ( const auto &pair : nlr->getLayerIndexToLayer() )
+    {
+        NLR::Layer *layer = pair.second;
+        for ( unsigned i = 0; i < layer->getSize(); ++i )
+        {
+            unsigned variable = layer->neuronToVariable( i );
+            frontier.handle( variable, pair.first );
+
+            layer->setLb( i,
+                          _lowerBounds.exists( variable ) ? _lowerBounds[variable]
+                                                          : FloatUtils::negativeInfinity() );
+            layer->setUb( i,
+                          _upperBounds.exists( variable ) ? _upperBounds[variable]
+                                                          : FloatUtils::infinity() );
+
+            if ( layer->getLayerType() != NLR::Layer::INPUT &&
+                 layer->getLayerType() != NLR::Layer::WEIGHTED_SUM )
+                activationVariables.insert( variable );
+        }
+    }
+
+    Set<PiecewiseLinearConstraint *> handledPLConstraints;
+    for ( const auto &c : nlr->getConstraintsInTopologicalOrder() )
+        handledPLConstraints.insert( c );
+
+    // Nonlinear constraints are not tracked by the NLR, so a constraint is
+    // handled if all of its outputs are activation neurons
+    Set<NonlinearConstraint *> handledNLConstraints;
+    for ( const auto &c : _nlConstraints )
+    {
+        List<unsigned> sources;
+        List<unsigned> outputs;
+        bool handled = NLRConstructionFrontier::getSourcesAndOutputs( c, sources, outputs );
+        for ( const auto &output : outputs )
+        {
+            if ( !activationVariables.exists( output ) )
+                handled = false;
+        }
+
+        if ( handled )
+            handledNLConstraints.insert( c );
+    }
+
+    // Extend the NLR with the layers that the remaining equations and
+    // constraints define on top of it, e.g. the property's output layer
+    unsigned numberOfPrebuiltLayers = nlr->getNumberOfLayers();
+    unsigned newLayerIndex = numberOfPrebuiltLayers;
+    Set<unsigned> handledEquations;
+    while ( constructNextLayer( nlr,
+                                frontier,
+                                newLayerIndex,
+                                handledEquations,
+                                handledPLConstraints,
+                                handledNLConstraints ) )
+        ++newLayerIndex;
+
+    collectUnhandledEquationsAndConstraints( handledEquations,
+                                             handledPLConstraints,
+                                             handledNLConstraints,
+                                             unhandledEquations,
+                                             varsInUnhandledConstraints );
+
+    // The new weighted sum layers are now part of the NLR, and are encoded
+    // along with the prebuilt ones
+    if ( !handledEquations.empty() )
+    {
+        List<Equation> remainingEquations;
+        unsigned index = 0;
+        for ( const auto &e : _equations )
+        {
+            if ( !handledEquations.exists( index++ ) )
+                remainingEquations.append( e );
+        }
+        _equations = remainingEquations;
+    }
+
+    INPUT_QUERY_LOG(
+        Stringf( "successful. Adopted %u layers and constructed %u more."
+                 " %u out of %u equations, %u out of %u piecewise-linear constraints,"
+                 " %u out of %u nonlinear constraints accounted for.",
+                 numberOfPrebuiltLayers,
+                 newLayerIndex - numberOfPrebuiltLayers,
+                 handledEquations.size(),
+                 _equations.size(),
+                 handledPLConstraints.size(),
+                 _plConstraints.size(),
+                 handledNLConstraints.size(),
+                 _nlConstraints.size() )
+            .ascii() );
+
+    return true;
+}
+
+bool Query::constructNextLayer( NLR::NetworkLevelReasoner *nlr,
+                                NLRConstructionFrontier &frontier,
+                                unsigned newLayerIndex,
+                                Set<unsigned> &handledEquations,
+                                Set<PiecewiseLinearConstraint *> &handledPLConstraints,
+                                Set<NonlinearConstraint *> &handledNLConstraints )
+{
+    return constructWeighedSumLayer( nlr, frontier, newLayerIndex, handledEquations ) ||
+           constructReluLayer( nlr, frontier, newLayerIndex, handledPLConstraints ) ||
+           constructRoundLayer( nlr, frontier, newLayerIndex, handledNLConstraints ) ||
+           constructLeakyReluLayer( nlr, frontier, newLayerIndex, handledPLConstraints ) ||
+           constructAbsoluteValueLayer( nlr, frontier, newLayerIndex, handledPLConstraints ) ||
+           constructSignLayer( nlr, frontier, newLayerIndex, handledPLConstraints ) ||
+           constructSigmoidLayer( nlr, frontier, newLayerIndex, handledNLConstraints ) ||
+           constructMaxLayer( nlr, frontier, newLayerIndex, handledPLConstraints ) ||
+           constructBilinearLayer( nlr, frontier, newLayerIndex, handledNLConstraints ) ||
+           constructSoftmaxLayer( nlr, frontier, newLayerIndex, handledNLConstraints );
+}
+
+void Query::collectUnhandledEquationsAndConstraints(
+    const Set<unsigned> &handledEquations,
+    const Set<PiecewiseLinearConstraint *> &handledPLConstraints,
+    const Set<NonlinearConstraint *> &handledNLConstraints,
+    List<Equation> &unhandledEquations,
+    Set<unsigned> &varsInUnhandledConstraints ) const
+{
+    // Collect 1) equations unaccounted for by the NLR; 2) variables that
+    // participate in constraints unhandled by the NLR.
+    unsigned index = 0;
+    for ( const auto &e : _equations )
+    {
+        if ( !handledEquations.exists( index++ ) )
+        {
+            unhandledEquations.append( e );
+            varsInUnhandledConstraints.insert( e.getParticipatingVariables() );
+        }
+    }
+
+    for ( const auto &c : _plConstraints )
+    {
+        if ( !handledPLConstraints.exists( c ) )
+            varsInUnhandledConstraints.insert( c->getParticipatingVariables() );
+    }
+
+    for ( const auto &c : _nlConstraints )
+    {
+        if ( !handledNLConstraints.exists( c ) )
+            varsInUnhandledConstraints.insert( c->getParticipatingVariables() );
+    }
+}
+
+bool Query::prebuiltActivationLayersHaveSingleSources() const
+{
+    for ( const auto &pair : _networkLevelReasoner->getLayerIndexToLayer() )
+    {
+        const NLR::Layer *layer = pair.second;
+        if ( layer->getLayerType() != NLR::Layer::INPUT &&
+             layer->getLayerType() != NLR::Layer::WEIGHTED_SUM &&
+             layer->getSourceLayers().size() > 1 )
+            return false;
+    }
+    return true;
+}
+
 void Query::mergeConsecutiveWeightedSumLayers( const List<Equation> &unhandledEquations,
                                                const Set<unsigned> &varsInUnhandledConstraints,
                                                Map<unsigned, LinearExpression> &eliminatedNeurons )
@@ -955,6 +1155,7 @@ void Query::mergeConsecutiveWeightedSumLayers( const List<Equation> &unhandledEq
             // Re-encode the affine connections if there are merged layers
             _equations = unhandledEquations;
             _networkLevelReasoner->encodeAffineLayers( *this );
+            _networkLevelReasonerIsPrebuilt = false;
         }
 
         INPUT_QUERY_LOG( "Attempting to merge consecutive weighted sum layers - done" );
@@ -962,7 +1163,7 @@ void Query::mergeConsecutiveWeightedSumLayers( const List<Equation> &unhandledEq
 }
 
 bool Query::constructWeighedSumLayer( NLR::NetworkLevelReasoner *nlr,
-                                      Map<unsigned, unsigned> &handledVariableToLayer,
+                                      NLRConstructionFrontier &frontier,
                                       unsigned newLayerIndex,
                                       Set<unsigned> &handledEquations )
 {
@@ -990,33 +1191,20 @@ bool Query::constructWeighedSumLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for equations where all variables except one have already been handled
-    const List<Equation> &equations = getEquations();
-    unsigned index = 0;
-    for ( const auto &eq : equations )
+    for ( const auto &index : frontier.getReadyEquations() )
     {
-        if ( handledEquations.exists( index++ ) )
-            continue;
+        const Equation &eq = frontier.getEquation( index );
 
-        // Only consider equalities
-        if ( eq._type != Equation::EQ )
-            continue;
-
-        List<unsigned> eqVariables = eq.getListParticipatingVariables();
-        auto it = eqVariables.begin();
-        while ( it != eqVariables.end() )
-        {
-            if ( handledVariableToLayer.exists( *it ) )
-                it = eqVariables.erase( it );
-            else
-                ++it;
-        }
-
-        if ( eqVariables.size() == 1 )
+        // Add the surviving variable to the new layer
+        for ( const auto &addend : eq._addends )
         {
-            // Add the surviving variable to the new layer
-            newNeurons.append( NeuronInformation( *eqVariables.begin(), newNeurons.size(), &eq ) );
-            handledEquations.insert( index - 1 );
+            if ( !frontier.isHandled( addend._variable ) )
+            {
+                newNeurons.append( NeuronInformation( addend._variable, newNeurons.size(), &eq ) );
+                break;
+            }
         }
+        handledEquations.insert( index );
     }
 
     // No neurons found for the new layer
@@ -1031,7 +1219,7 @@ bool Query::constructWeighedSumLayer( NLR::NetworkLevelReasoner *nlr,
     NLR::Layer *layer = nlr->getLayer( newLayerIndex );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -1065,7 +1253,7 @@ bool Query::constructWeighedSumLayer( NLR::NetworkLevelReasoner *nlr,
             if ( addend._variable == newNeuron._variable )
                 continue;
 
-            unsigned sourceLayer = handledVariableToLayer[addend._variable];
+            unsigned sourceLayer = frontier.getLayer( addend._variable );
             unsigned sourceNeuron =
                 nlr->getLayer( sourceLayer )->variableToNeuron( addend._variable );
 
@@ -1085,7 +1273,7 @@ bool Query::constructWeighedSumLayer( NLR::NetworkLevelReasoner *nlr,
 }
 
 bool Query::constructReluLayer( NLR::NetworkLevelReasoner *nlr,
-                                Map<unsigned, unsigned> &handledVariableToLayer,
+                                NLRConstructionFrontier &frontier,
                                 unsigned newLayerIndex,
                                 Set<PiecewiseLinearConstraint *> &handledPLConstraints )
 {
@@ -1108,35 +1296,28 @@ bool Query::constructReluLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for ReLUs where all b variables have already been handled
-    const List<PiecewiseLinearConstraint *> &plConstraints = getPiecewiseLinearConstraints();
-
     unsigned currentSourceLayer = 0;
-    for ( const auto &plc : plConstraints )
+    for ( const auto &position : frontier.getReadyPLConstraints( RELU ) )
     {
-        if ( handledPLConstraints.exists( plc ) )
-            continue;
-
-        // Only consider ReLUs
-        if ( plc->getType() != RELU )
-            continue;
+        PiecewiseLinearConstraint *plc = frontier.getPLConstraint( position );
 
         const ReluConstraint *relu = (const ReluConstraint *)plc;
 
         // Has the b variable been handled?
         unsigned b = relu->getB();
-        if ( !handledVariableToLayer.exists( b ) ||
+        if ( !frontier.isHandled( b ) ||
              ( _ensureSameSourceLayerInNLR && !newNeurons.empty() &&
-               handledVariableToLayer[b] != currentSourceLayer ) )
+               frontier.getLayer( b ) != currentSourceLayer ) )
             continue;
 
         // If the f variable has also been handled, ignore this constraint
         unsigned f = relu->getF();
-        if ( handledVariableToLayer.exists( f ) )
+        if ( frontier.isHandled( f ) )
             continue;
 
         // B has been handled, f hasn't. Add f
         if ( _ensureSameSourceLayerInNLR && newNeurons.empty() )
-            currentSourceLayer = handledVariableToLayer[b];
+            currentSourceLayer = frontier.getLayer( b );
         newNeurons.append( NeuronInformation( f, newNeurons.size(), b ) );
         nlr->addConstraintInTopologicalOrder( plc );
         handledPLConstraints.insert( plc );
@@ -1154,7 +1335,7 @@ bool Query::constructReluLayer( NLR::NetworkLevelReasoner *nlr,
     NLR::Layer *layer = nlr->getLayer( newLayerIndex );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -1163,7 +1344,7 @@ bool Query::constructReluLayer( NLR::NetworkLevelReasoner *nlr,
                       _upperBounds.exists( newNeuron._variable ) ? _upperBounds[newNeuron._variable]
                                                                  : FloatUtils::infinity() );
 
-        unsigned sourceLayer = handledVariableToLayer[newNeuron._sourceVariable];
+        unsigned sourceLayer = frontier.getLayer( newNeuron._sourceVariable );
         unsigned sourceNeuron =
             nlr->getLayer( sourceLayer )->variableToNeuron( newNeuron._sourceVariable );
 
@@ -1183,7 +1364,7 @@ bool Query::constructReluLayer( NLR::NetworkLevelReasoner *nlr,
 }
 
 bool Query::constructLeakyReluLayer( NLR::NetworkLevelReasoner *nlr,
-                                     Map<unsigned, unsigned> &handledVariableToLayer,
+                                     NLRConstructionFrontier &frontier,
                                      unsigned newLayerIndex,
                                      Set<PiecewiseLinearConstraint *> &handledPLConstraints )
 {
@@ -1206,26 +1387,19 @@ bool Query::constructLeakyReluLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for LeakyReLUs where all b variables have already been handled
-    const List<PiecewiseLinearConstraint *> &plConstraints = getPiecewiseLinearConstraints();
-
     unsigned currentSourceLayer = 0;
     double alpha = -1;
-    for ( const auto &plc : plConstraints )
+    for ( const auto &position : frontier.getReadyPLConstraints( LEAKY_RELU ) )
     {
-        if ( handledPLConstraints.exists( plc ) )
-            continue;
-
-        // Only consider Leaky ReLUs
-        if ( plc->getType() != LEAKY_RELU )
-            continue;
+        PiecewiseLinearConstraint *plc = frontier.getPLConstraint( position );
 
         const LeakyReluConstraint *leakyRelu = (const LeakyReluConstraint *)plc;
 
         // Has the b variable been handled?
         unsigned b = leakyRelu->getB();
-        if ( !handledVariableToLayer.exists( b ) ||
+        if ( !frontier.isHandled( b ) ||
              ( _ensureSameSourceLayerInNLR && !newNeurons.empty() &&
-               handledVariableToLayer[b] != currentSourceLayer ) )
+               frontier.getLayer( b ) != currentSourceLayer ) )
             continue;
 
         // Is the slope uniform?
@@ -1237,11 +1411,11 @@ bool Query::constructLeakyReluLayer( NLR::NetworkLevelReasoner *nlr,
 
         // If the f variable has also been handled, ignore this constraint
         unsigned f = leakyRelu->getF();
-        if ( handledVariableToLayer.exists( f ) )
+        if ( frontier.isHandled( f ) )
             continue;
         // B has been handled, f hasn't. Add f
         if ( _ensureSameSourceLayerInNLR && newNeurons.empty() )
-            currentSourceLayer = handledVariableToLayer[b];
+            currentSourceLayer = frontier.getLayer( b );
         if ( alpha == -1 )
             alpha = alphaTemp;
         newNeurons.append( NeuronInformation( f, newNeurons.size(), b ) );
@@ -1262,7 +1436,7 @@ bool Query::constructLeakyReluLayer( NLR::NetworkLevelReasoner *nlr,
     layer->setAlpha( alpha );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -1271,7 +1445,7 @@ bool Query::constructLeakyReluLayer( NLR::NetworkLevelReasoner *nlr,
                       _upperBounds.exists( newNeuron._variable ) ? _upperBounds[newNeuron._variable]
                                                                  : FloatUtils::infinity() );
 
-        unsigned sourceLayer = handledVariableToLayer[newNeuron._sourceVariable];
+        unsigned sourceLayer = frontier.getLayer( newNeuron._sourceVariable );
         unsigned sourceNeuron =
             nlr->getLayer( sourceLayer )->variableToNeuron( newNeuron._sourceVariable );
 
@@ -1291,7 +1465,7 @@ bool Query::constructLeakyReluLayer( NLR::NetworkLevelReasoner *nlr,
 }
 
 bool Query::constructRoundLayer( NLR::NetworkLevelReasoner *nlr,
-                                 Map<unsigned, unsigned> &handledVariableToLayer,
+                                 NLRConstructionFrontier &frontier,
                                  unsigned newLayerIndex,
                                  Set<NonlinearConstraint *> &handledNLConstraints )
 {
@@ -1314,35 +1488,28 @@ bool Query::constructRoundLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for ReLUs where all b variables have already been handled
-    const List<NonlinearConstraint *> &nlConstraints = getNonlinearConstraints();
-
     unsigned currentSourceLayer = 0;
-    for ( const auto &nlc : nlConstraints )
+    for ( const auto &position : frontier.getReadyNLConstraints( ROUND ) )
     {
-        if ( handledNLConstraints.exists( nlc ) )
-            continue;
-
-        // Only consider Rounds
-        if ( nlc->getType() != ROUND )
-            continue;
+        NonlinearConstraint *nlc = frontier.getNLConstraint( position );
 
         const RoundConstraint *round = (const RoundConstraint *)nlc;
 
         // Has the b variable been handled?
         unsigned b = round->getB();
-        if ( !handledVariableToLayer.exists( b ) ||
+        if ( !frontier.isHandled( b ) ||
              ( _ensureSameSourceLayerInNLR && !newNeurons.empty() &&
-               handledVariableToLayer[b] != currentSourceLayer ) )
+               frontier.getLayer( b ) != currentSourceLayer ) )
             continue;
 
         // If the f variable has also been handled, ignore this constraint
         unsigned f = round->getF();
-        if ( handledVariableToLayer.exists( f ) )
+        if ( frontier.isHandled( f ) )
             continue;
 
         // B has been handled, f hasn't. Add f
         if ( _ensureSameSourceLayerInNLR && newNeurons.empty() )
-            currentSourceLayer = handledVariableToLayer[b];
+            currentSourceLayer = frontier.getLayer( b );
         newNeurons.append( NeuronInformation( f, newNeurons.size(), b ) );
         handledNLConstraints.insert( nlc );
     }
@@ -1359,7 +1526,7 @@ bool Query::constructRoundLayer( NLR::NetworkLevelReasoner *nlr,
     NLR::Layer *layer = nlr->getLayer( newLayerIndex );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -1368,7 +1535,7 @@ bool Query::constructRoundLayer( NLR::NetworkLevelReasoner *nlr,
                       _upperBounds.exists( newNeuron._variable ) ? _upperBounds[newNeuron._variable]
                                                                  : FloatUtils::infinity() );
 
-        unsigned sourceLayer = handledVariableToLayer[newNeuron._sourceVariable];
+        unsigned sourceLayer = frontier.getLayer( newNeuron._sourceVariable );
         unsigned sourceNeuron =
             nlr->getLayer( sourceLayer )->variableToNeuron( newNeuron._sourceVariable );
 
@@ -1388,7 +1555,7 @@ bool Query::constructRoundLayer( NLR::NetworkLevelReasoner *nlr,
 }
 
 bool Query::constructSigmoidLayer( NLR::NetworkLevelReasoner *nlr,
-                                   Map<unsigned, unsigned> &handledVariableToLayer,
+                                   NLRConstructionFrontier &frontier,
                                    unsigned newLayerIndex,
                                    Set<NonlinearConstraint *> &handledNLConstraints )
 {
@@ -1411,35 +1578,28 @@ bool Query::constructSigmoidLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for Sigmoids where all b variables have already been handled
-    const List<NonlinearConstraint *> &nlConstraints = getNonlinearConstraints();
-
     unsigned currentSourceLayer = 0;
-    for ( const auto &nlc : nlConstraints )
+    for ( const auto &position : frontier.getReadyNLConstraints( SIGMOID ) )
     {
-        if ( handledNLConstraints.exists( nlc ) )
-            continue;
-
-        // Only consider Sigmoids
-        if ( nlc->getType() != SIGMOID )
-            continue;
+        NonlinearConstraint *nlc = frontier.getNLConstraint( position );
 
         const SigmoidConstraint *sigmoid = (const SigmoidConstraint *)nlc;
 
         // Has the b variable been handled?
         unsigned b = sigmoid->getB();
-        if ( !handledVariableToLayer.exists( b ) ||
+        if ( !frontier.isHandled( b ) ||
              ( _ensureSameSourceLayerInNLR && !newNeurons.empty() &&
-               handledVariableToLayer[b] != currentSourceLayer ) )
+               frontier.getLayer( b ) != currentSourceLayer ) )
             continue;
 
         // If the f variable has also been handled, ignore this constraint
         unsigned f = sigmoid->getF();
-        if ( handledVariableToLayer.exists( f ) )
+        if ( frontier.isHandled( f ) )
             continue;
 
         // B has been handled, f hasn't. Add f
         if ( _ensureSameSourceLayerInNLR && newNeurons.empty() )
-            currentSourceLayer = handledVariableToLayer[b];
+            currentSourceLayer = frontier.getLayer( b );
         newNeurons.append( NeuronInformation( f, newNeurons.size(), b ) );
 
         handledNLConstraints.insert( nlc );
@@ -1457,7 +1617,7 @@ bool Query::constructSigmoidLayer( NLR::NetworkLevelReasoner *nlr,
     NLR::Layer *layer = nlr->getLayer( newLayerIndex );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -1466,7 +1626,7 @@ bool Query::constructSigmoidLayer( NLR::NetworkLevelReasoner *nlr,
                       _upperBounds.exists( newNeuron._variable ) ? _upperBounds[newNeuron._variable]
                                                                  : FloatUtils::infinity() );
 
-        unsigned sourceLayer = handledVariableToLayer[newNeuron._sourceVariable];
+        unsigned sourceLayer = frontier.getLayer( newNeuron._sourceVariable );
         unsigned sourceNeuron =
             nlr->getLayer( sourceLayer )->variableToNeuron( newNeuron._sourceVariable );
 
@@ -1486,7 +1646,7 @@ bool Query::constructSigmoidLayer( NLR::NetworkLevelReasoner *nlr,
 }
 
 bool Query::constructAbsoluteValueLayer( NLR::NetworkLevelReasoner *nlr,
-                                         Map<unsigned, unsigned> &handledVariableToLayer,
+                                         NLRConstructionFrontier &frontier,
                                          unsigned newLayerIndex,
                                          Set<PiecewiseLinearConstraint *> &handledPLConstraints )
 {
@@ -1509,35 +1669,28 @@ bool Query::constructAbsoluteValueLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for ABSOLUTE_VALUEs where all b variables have already been handled
-    const List<PiecewiseLinearConstraint *> &plConstraints = getPiecewiseLinearConstraints();
-
     unsigned currentSourceLayer = 0;
-    for ( const auto &plc : plConstraints )
+    for ( const auto &position : frontier.getReadyPLConstraints( ABSOLUTE_VALUE ) )
     {
-        if ( handledPLConstraints.exists( plc ) )
-            continue;
-
-        // Only consider ABSOLUTE_VALUE
-        if ( plc->getType() != ABSOLUTE_VALUE )
-            continue;
+        PiecewiseLinearConstraint *plc = frontier.getPLConstraint( position );
 
         const AbsoluteValueConstraint *abs = (const AbsoluteValueConstraint *)plc;
 
         // Has the b variable been handled?
         unsigned b = abs->getB();
-        if ( !handledVariableToLayer.exists( b ) ||
+        if ( !frontier.isHandled( b ) ||
              ( _ensureSameSourceLayerInNLR && !newNeurons.empty() &&
-               handledVariableToLayer[b] != currentSourceLayer ) )
+               frontier.getLayer( b ) != currentSourceLayer ) )
             continue;
 
         // If the f variable has also been handled, ignore this constraint
         unsigned f = abs->getF();
-        if ( handledVariableToLayer.exists( f ) )
+        if ( frontier.isHandled( f ) )
             continue;
 
         // B has been handled, f hasn't. Add f
         if ( _ensureSameSourceLayerInNLR && newNeurons.empty() )
-            currentSourceLayer = handledVariableToLayer[b];
+            currentSourceLayer = frontier.getLayer( b );
         newNeurons.append( NeuronInformation( f, newNeurons.size(), b ) );
         nlr->addConstraintInTopologicalOrder( plc );
         handledPLConstraints.insert( plc );
@@ -1555,7 +1708,7 @@ bool Query::constructAbsoluteValueLayer( NLR::NetworkLevelReasoner *nlr,
     NLR::Layer *layer = nlr->getLayer( newLayerIndex );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -1564,7 +1717,7 @@ bool Query::constructAbsoluteValueLayer( NLR::NetworkLevelReasoner *nlr,
                       _upperBounds.exists( newNeuron._variable ) ? _upperBounds[newNeuron._variable]
                                                                  : FloatUtils::infinity() );
 
-        unsigned sourceLayer = handledVariableToLayer[newNeuron._sourceVariable];
+        unsigned sourceLayer = frontier.getLayer( newNeuron._sourceVariable );
         unsigned sourceNeuron =
             nlr->getLayer( sourceLayer )->variableToNeuron( newNeuron._sourceVariable );
 
@@ -1584,7 +1737,7 @@ bool Query::constructAbsoluteValueLayer( NLR::NetworkLevelReasoner *nlr,
 }
 
 bool Query::constructSignLayer( NLR::NetworkLevelReasoner *nlr,
-                                Map<unsigned, unsigned> &handledVariableToLayer,
+                                NLRConstructionFrontier &frontier,
                                 unsigned newLayerIndex,
                                 Set<PiecewiseLinearConstraint *> &handledPLConstraints )
 {
@@ -1607,35 +1760,28 @@ bool Query::constructSignLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for Signs where the b variables have already been handled
-    const List<PiecewiseLinearConstraint *> &plConstraints = getPiecewiseLinearConstraints();
-
     unsigned currentSourceLayer = 0;
-    for ( const auto &plc : plConstraints )
+    for ( const auto &position : frontier.getReadyPLConstraints( SIGN ) )
     {
-        if ( handledPLConstraints.exists( plc ) )
-            continue;
-
-        // Only consider Signs
-        if ( plc->getType() != SIGN )
-            continue;
+        PiecewiseLinearConstraint *plc = frontier.getPLConstraint( position );
 
         const SignConstraint *sign = (const SignConstraint *)plc;
 
         // Has the b variable been handled?
         unsigned b = sign->getB();
-        if ( !handledVariableToLayer.exists( b ) ||
+        if ( !frontier.isHandled( b ) ||
              ( _ensureSameSourceLayerInNLR && !newNeurons.empty() &&
-               handledVariableToLayer[b] != currentSourceLayer ) )
+               frontier.getLayer( b ) != currentSourceLayer ) )
             continue;
 
         // If the f variable has also been handled, ignore this constraint
         unsigned f = sign->getF();
-        if ( handledVariableToLayer.exists( f ) )
+        if ( frontier.isHandled( f ) )
             continue;
 
         // B has been handled, f hasn't. Add f
         if ( _ensureSameSourceLayerInNLR && newNeurons.empty() )
-            currentSourceLayer = handledVariableToLayer[b];
+            currentSourceLayer = frontier.getLayer( b );
         newNeurons.append( NeuronInformation( f, newNeurons.size(), b ) );
         nlr->addConstraintInTopologicalOrder( plc );
         handledPLConstraints.insert( plc );
@@ -1653,7 +1799,7 @@ bool Query::constructSignLayer( NLR::NetworkLevelReasoner *nlr,
     NLR::Layer *layer = nlr->getLayer( newLayerIndex );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -1662,7 +1808,7 @@ bool Query::constructSignLayer( NLR::NetworkLevelReasoner *nlr,
                       _upperBounds.exists( newNeuron._variable ) ? _upperBounds[newNeuron._variable]
                                                                  : FloatUtils::infinity() );
 
-        unsigned sourceLayer = handledVariableToLayer[newNeuron._sourceVariable];
+        unsigned sourceLayer = frontier.getLayer( newNeuron._sourceVariable );
         unsigned sourceNeuron =
             nlr->getLayer( sourceLayer )->variableToNeuron( newNeuron._sourceVariable );
 
@@ -1682,7 +1828,7 @@ bool Query::constructSignLayer( NLR::NetworkLevelReasoner *nlr,
 }
 
 bool Query::constructMaxLayer( NLR::NetworkLevelReasoner *nlr,
-                               Map<unsigned, unsigned> &handledVariableToLayer,
+                               NLRConstructionFrontier &frontier,
                                unsigned newLayerIndex,
                                Set<PiecewiseLinearConstraint *> &handledPLConstraints )
 {
@@ -1707,17 +1853,10 @@ bool Query::constructMaxLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for Maxes where all the element variables have already been handled
-    const List<PiecewiseLinearConstraint *> &plConstraints = getPiecewiseLinearConstraints();
-
     unsigned currentSourceLayer = 0;
-    for ( const auto &plc : plConstraints )
+    for ( const auto &position : frontier.getReadyPLConstraints( MAX ) )
     {
-        if ( handledPLConstraints.exists( plc ) )
-            continue;
-
-        // Only consider Max
-        if ( plc->getType() != MAX )
-            continue;
+        PiecewiseLinearConstraint *plc = frontier.getPLConstraint( position );
 
         const MaxConstraint *max = (const MaxConstraint *)plc;
 
@@ -1727,13 +1866,13 @@ bool Query::constructMaxLayer( NLR::NetworkLevelReasoner *nlr,
         bool sourceLayerDiffers = false;
         for ( const auto &input : max->getElements() )
         {
-            if ( !handledVariableToLayer.exists( input ) )
+            if ( !frontier.isHandled( input ) )
             {
                 missingInput = true;
                 break;
             }
             else if ( _ensureSameSourceLayerInNLR && newNeurons.size() &&
-                      handledVariableToLayer[input] != currentSourceLayer )
+                      frontier.getLayer( input ) != currentSourceLayer )
             {
                 sourceLayerDiffers = true;
                 break;
@@ -1745,12 +1884,12 @@ bool Query::constructMaxLayer( NLR::NetworkLevelReasoner *nlr,
 
         // If the f variable has also been handled, ignore this constraint
         unsigned f = max->getF();
-        if ( handledVariableToLayer.exists( f ) )
+        if ( frontier.isHandled( f ) )
             continue;
 
         // Elements have been handled, f hasn't. Add f
         if ( _ensureSameSourceLayerInNLR && newNeurons.empty() )
-            currentSourceLayer = handledVariableToLayer[*max->getElements().begin()];
+            currentSourceLayer = frontier.getLayer( *max->getElements().begin() );
         newNeurons.append( NeuronInformation( f, newNeurons.size(), max->getElements() ) );
         nlr->addConstraintInTopologicalOrder( plc );
         handledPLConstraints.insert( plc );
@@ -1768,7 +1907,7 @@ bool Query::constructMaxLayer( NLR::NetworkLevelReasoner *nlr,
     NLR::Layer *layer = nlr->getLayer( newLayerIndex );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -1783,7 +1922,7 @@ bool Query::constructMaxLayer( NLR::NetworkLevelReasoner *nlr,
 
         for ( const auto &sourceVariable : newNeuron._sourceVariables )
         {
-            unsigned sourceLayer = handledVariableToLayer[sourceVariable];
+            unsigned sourceLayer = frontier.getLayer( sourceVariable );
             unsigned sourceNeuron =
                 nlr->getLayer( sourceLayer )->variableToNeuron( sourceVariable );
 
@@ -1800,7 +1939,7 @@ bool Query::constructMaxLayer( NLR::NetworkLevelReasoner *nlr,
 }
 
 bool Query::constructBilinearLayer( NLR::NetworkLevelReasoner *nlr,
-                                    Map<unsigned, unsigned> &handledVariableToLayer,
+                                    NLRConstructionFrontier &frontier,
                                     unsigned newLayerIndex,
                                     Set<NonlinearConstraint *> &handledNLConstraints )
 {
@@ -1825,16 +1964,9 @@ bool Query::constructBilinearLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for Bilinear constaints where all the element variables have already been handled
-    const List<NonlinearConstraint *> &nlConstraints = getNonlinearConstraints();
-
-    for ( const auto &nlc : nlConstraints )
+    for ( const auto &position : frontier.getReadyNLConstraints( BILINEAR ) )
     {
-        if ( handledNLConstraints.exists( nlc ) )
-            continue;
-
-        // Only consider bilinear
-        if ( nlc->getType() != BILINEAR )
-            continue;
+        NonlinearConstraint *nlc = frontier.getNLConstraint( position );
 
         const BilinearConstraint *bilinear = (const BilinearConstraint *)nlc;
 
@@ -1842,7 +1974,7 @@ bool Query::constructBilinearLayer( NLR::NetworkLevelReasoner *nlr,
         bool missingElement = false;
         for ( const auto &element : bilinear->getBs() )
         {
-            if ( !handledVariableToLayer.exists( element ) )
+            if ( !frontier.isHandled( element ) )
             {
                 missingElement = true;
                 break;
@@ -1854,7 +1986,7 @@ bool Query::constructBilinearLayer( NLR::NetworkLevelReasoner *nlr,
 
         // If the f variable has also been handled, ignore this constraint
         unsigned f = bilinear->getF();
-        if ( handledVariableToLayer.exists( f ) )
+        if ( frontier.isHandled( f ) )
             continue;
 
         // Elements have been handled, f hasn't. Add f
@@ -1875,7 +2007,7 @@ bool Query::constructBilinearLayer( NLR::NetworkLevelReasoner *nlr,
     NLR::Layer *layer = nlr->getLayer( newLayerIndex );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -1890,7 +2022,7 @@ bool Query::constructBilinearLayer( NLR::NetworkLevelReasoner *nlr,
 
         for ( const auto &sourceVariable : newNeuron._sourceVariables )
         {
-            unsigned sourceLayer = handledVariableToLayer[sourceVariable];
+            unsigned sourceLayer = frontier.getLayer( sourceVariable );
             unsigned sourceNeuron =
                 nlr->getLayer( sourceLayer )->variableToNeuron( sourceVariable );
 
@@ -1907,7 +2039,7 @@ bool Query::constructBilinearLayer( NLR::NetworkLevelReasoner *nlr,
 }
 
 bool Query::constructSoftmaxLayer( NLR::NetworkLevelReasoner *nlr,
-                                   Map<unsigned, unsigned> &handledVariableToLayer,
+                                   NLRConstructionFrontier &frontier,
                                    unsigned newLayerIndex,
                                    Set<NonlinearConstraint *> &handledNLConstraints )
 {
@@ -1932,17 +2064,10 @@ bool Query::constructSoftmaxLayer( NLR::NetworkLevelReasoner *nlr,
     List<NeuronInformation> newNeurons;
 
     // Look for Softmaxes where all the element variables have already been handled
-    const List<NonlinearConstraint *> &nlConstraints = getNonlinearConstraints();
-
     unsigned currentSourceLayer = 0;
-    for ( const auto &nlc : nlConstraints )
+    for ( const auto &position : frontier.getReadyNLConstraints( SOFTMAX ) )
     {
-        if ( handledNLConstraints.exists( nlc ) )
-            continue;
-
-        // Only consider Softmax
-        if ( nlc->getType() != SOFTMAX )
-            continue;
+        NonlinearConstraint *nlc = frontier.getNLConstraint( position );
 
         const SoftmaxConstraint *softmax = (const SoftmaxConstraint *)nlc;
 
@@ -1951,13 +2076,13 @@ bool Query::constructSoftmaxLayer( NLR::NetworkLevelReasoner *nlr,
         bool sourceLayerDiffers = false;
         for ( const auto &input : softmax->getInputs() )
         {
-            if ( !handledVariableToLayer.exists( input ) )
+            if ( !frontier.isHandled( input ) )
             {
                 missingInput = true;
                 break;
             }
             else if ( _ensureSameSourceLayerInNLR && newNeurons.size() &&
-                      handledVariableToLayer[input] != currentSourceLayer )
+                      frontier.getLayer( input ) != currentSourceLayer )
             {
                 sourceLayerDiffers = true;
                 break;
@@ -1971,7 +2096,7 @@ bool Query::constructSoftmaxLayer( NLR::NetworkLevelReasoner *nlr,
         bool outputHandled = false;
         for ( const auto &output : softmax->getOutputs() )
         {
-            if ( handledVariableToLayer.exists( output ) )
+            if ( frontier.isHandled( output ) )
             {
                 outputHandled = true;
                 break;
@@ -1988,7 +2113,7 @@ bool Query::constructSoftmaxLayer( NLR::NetworkLevelReasoner *nlr,
 
         Map<unsigned, unsigned> neuronToVariable;
         Vector<unsigned> neurons;
-        currentSourceLayer = handledVariableToLayer[*softmax->getInputs().begin()];
+        currentSourceLayer = frontier.getLayer( *softmax->getInputs().begin() );
         NLR::Layer *layer = nlr->getLayer( currentSourceLayer );
         for ( const auto &input : softmax->getInputs() )
         {
@@ -2019,7 +2144,7 @@ bool Query::constructSoftmaxLayer( NLR::NetworkLevelReasoner *nlr,
     NLR::Layer *layer = nlr->getLayer( newLayerIndex );
     for ( const auto &newNeuron : newNeurons )
     {
-        handledVariableToLayer[newNeuron._variable] = newLayerIndex;
+        frontier.handle( newNeuron._variable, newLayerIndex );
 
         layer->setLb( newNeuron._neuron,
                       _lowerBounds.exists( newNeuron._variable ) ? _lowerBounds[newNeuron._variable]
@@ -2034,7 +2159,7 @@ bool Query::constructSoftmaxLayer( NLR::NetworkLevelReasoner *nlr,
 
         for ( const auto &sourceVariable : newNeuron._sourceVariables )
         {
-            unsigned sourceLayer = handledVariableToLayer[sourceVariable];
+            unsigned sourceLayer = frontier.getLayer( sourceVariable );
             unsigned sourceNeuron =
                 nlr->getLayer( sourceLayer )->variableToNeuron( sourceVariable );
 
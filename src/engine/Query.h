@@ -27,6 +27,7 @@
 #include "PiecewiseLinearConstraint.h"
 
 class InputQuery;
+class NLRConstructionFrontier;
 
 class Query : public IQuery
 {
@@ -167,6 +168,19 @@ public:
     void setNetworkLevelReasoner( NLR::NetworkLevelReasoner *nlr );
     NLR::NetworkLevelReasoner *getNetworkLevelReasoner() const;
 
+    /*
+      Include a network level reasoner that was built directly by a
+      network parser. The query takes ownership of it. The weighted sum
+      layers of a prebuilt NLR are not part of the query's equations:
+      constructNetworkLevelReasoner adopts the NLR instead of
+      reconstructing it, and the equations are only generated by
+      encodePrebuiltNetworkLevelReasoner, once the layers have been
+      merged. Encoding does nothing if there is no prebuilt NLR.
+    */
+    void setPrebuiltNetworkLevelReasoner( NLR::NetworkLevelReasoner *nlr );
+    bool hasPrebuiltNetworkLevelReasoner() const;
+    void encodePrebuiltNetworkLevelReasoner();
+
     // A map for storing the tableau aux variable assigned to each PLC
     Map<unsigned, unsigned> _lastAddendToAux;
 
@@ -189,52 +203,80 @@ private:
     */
     bool _ensureSameSourceLayerInNLR;
 
+    /*
+      True if _networkLevelReasoner was built by a network parser, and
+      its weighted sum layers are not yet encoded as equations
+    */
+    bool _networkLevelReasonerIsPrebuilt;
+
     /*
       Free any stored pl constraints.
     */
     void freeConstraintsIfNeeded();
 
+    /*
+      Called by constructNetworkLevelReasoner for a prebuilt NLR. None of
+      the query's equations belong to it, as its own weighted sum layers
+      are not yet encoded; but the remaining equations and constraints
+      (e.g., those of the property) may still extend it with new layers.
+    */
+    bool adoptPrebuiltNetworkLevelReasoner( List<Equation> &unhandledEquations,
+                                            Set<unsigned> &varsInUnhandledConstraints );
+    bool prebuiltActivationLayersHaveSingleSources() const;
+
     /*
       Methods called by constructNetworkLevelReasoner
     */
+    bool constructNextLayer( NLR::NetworkLevelReasoner *nlr,
+                             NLRConstructionFrontier &frontier,
+                             unsigned newLayerIndex,
+                             Set<unsigned> &handledEquations,
+                             Set<PiecewiseLinearConstraint *> &handledPLConstraints,
+                             Set<NonlinearConstraint *> &handledNLConstraints );
+    void collectUnhandledEquationsAndConstraints(
+        const Set<unsigned> &handledEquations,
+        const Set<PiecewiseLinearConstraint *> &handledPLConstraints,
+        const Set<NonlinearConstraint *> &handledNLConstraints,
+        List<Equation> &unhandledEquations,
+        Set<unsigned> &varsInUnhandledConstraints ) const;
     bool constructWeighedSumLayer( NLR::NetworkLevelReasoner *nlr,
-                                   Map<unsigned, unsigned> &handledVariableToLayer,
+                                   NLRConstructionFrontier &frontier,
                                    unsigned newLayerIndex,
                                    Set<unsigned> &handledEquations );
     bool constructRoundLayer( NLR::NetworkLevelReasoner *nlr,
-                              Map<unsigned, unsigned> &handledVariableToLayer,
+                              NLRConstructionFrontier &frontier,
                               unsigned newLayerIndex,
                               Set<NonlinearConstraint *> &handledNLConstraints );
     bool constructReluLayer( NLR::NetworkLevelReasoner *nlr,
-                             Map<unsigned, unsigned> &handledVariableToLayer,
+                             NLRConstructionFrontier &frontier,
                              unsigned newLayerIndex,
                              Set<PiecewiseLinearConstraint *> &handledPLConstraints );
     bool constructLeakyReluLayer( NLR::NetworkLevelReasoner *nlr,
-                                  Map<unsigned, unsigned> &handledVariableToLayer,
+                                  NLRConstructionFrontier &frontier,
                                   unsigned newLayerIndex,
                                   Set<PiecewiseLinearConstraint *> &handledPLConstraints );
     bool constructSigmoidLayer( NLR::NetworkLevelReasoner *nlr,
-                                Map<unsigned, unsigned> &handledVariableToLayer,
+                                NLRConstructionFrontier &frontier,
                                 unsigned newLayerIndex,
                                 Set<NonlinearConstraint *> &handledNLConstraints );
     bool constructAbsoluteValueLayer( NLR::NetworkLevelReasoner *nlr,
-                                      Map<unsigned, unsigned> &handledVariableToLayer,
+                                      NLRConstructionFrontier &frontier,
                                       unsigned newLayerIndex,
                                       Set<PiecewiseLinearConstraint *> &handledPLConstraints );
     bool constructSignLayer( NLR::NetworkLevelReasoner *nlr,
-                             Map<unsigned, unsigned> &handledVariableToLayer,
+                             NLRConstructionFrontier &frontier,
                              unsigned newLayerIndex,
                              Set<PiecewiseLinearConstraint *> &handledPLConstraints );
     bool constructMaxLayer( NLR::NetworkLevelReasoner *nlr,
-                            Map<unsigned, unsigned> &handledVariableToLayer,
+                            NLRConstructionFrontier &frontier,
                             unsigned newLayerIndex,
                             Set<PiecewiseLinearConstraint *> &handledPLConstraints );
     bool constructBilinearLayer( NLR::NetworkLevelReasoner *nlr,
-                                 Map<unsigned, unsigned> &handledVariableToLayer,
+                                 NLRConstructionFrontier &frontier,
                                  unsigned newLayerIndex,
                                  Set<NonlinearConstraint *> &handledNLConstraints );
     bool constructSoftmaxLayer( NLR::NetworkLevelReasoner *nlr,
-                                Map<unsigned, unsigned> &handledVariableToLayer,
+                                NLRConstructionFrontier &frontier,
                                 unsigned newLayerIndex,
                                 Set<NonlinearConstraint *> &handledNLConstraints );
 
@@ -37,6 +37,12 @@ RowBoundTightener::RowBoundTightener( const ITableau &tableau )
 
 void RowBoundTightener::setDimensions()
 {
+    // The work memory, and in particular the rows, can be kept if the
+    // dimensions of the tableau have not changed (e.g., when a state
+    // is restored)
+    if ( _ciTimesLb && _n == _tableau.getN() && _m == _tableau.getM() )
+        return;
+
     freeMemoryIfNeeded();
 
     _n = _tableau.getN();
@@ -64,6 +70,11 @@ void RowBoundTightener::setDimensions()
     _ciSign = new char[_n];
 }
 
+void RowBoundTightener::notifyDimensionChange( unsigned /* m */, unsigned /* n */ )
+{
+    setDimensions();
+}
+
 RowBoundTightener::~RowBoundTightener()
 {
     freeMemoryIfNeeded();
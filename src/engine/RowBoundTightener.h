@@ -35,6 +35,11 @@ public:
     */
     void setDimensions();
 
+    /*
+      Reallocate the work memory when rows are added to the tableau
+    */
+    void notifyDimensionChange( unsigned m, unsigned n );
+
     /*
        Method obtains lower bound of *var*.
      */
@@ -26,6 +26,7 @@
 #include "Options.h"
 #include "PseudoImpactTracker.h"
 #include "ReluConstraint.h"
+#include "Tracer.h"
 #include "UnsatCertificateNode.h"
 
 SmtCore::SmtCore( IEngine *engine )
@@ -71,6 +72,7 @@ void SmtCore::reset()
     _stateId = 0;
     _constraintToViolationCount.clear();
     _numRejectedPhasePatternProposal = 0;
+    Tracer::setDecisionLevel( 0 );
 }
 
 void SmtCore::reportViolatedConstraint( PiecewiseLinearConstraint *constraint )
@@ -134,6 +136,7 @@ bool SmtCore::needToSplit() const
 void SmtCore::performSplit()
 {
     ASSERT( _needToSplit );
+    TraceSpan span( "SmtCore::performSplit" );
 
     _numRejectedPhasePatternProposal = 0;
     // Maybe the constraint has already become inactive - if so, ignore
@@ -210,6 +213,7 @@ void SmtCore::performSplit()
     }
 
     _stack.append( stackEntry );
+    Tracer::setDecisionLevel( _stack.size() );
 
     if ( _statistics )
     {
@@ -267,6 +271,7 @@ bool SmtCore::popSplit()
     if ( _stack.empty() )
         return false;
 
+    TraceSpan span( "SmtCore::popSplit" );
     struct timespec start = TimeUtils::sampleMicro();
 
     if ( _statistics )
@@ -375,6 +380,7 @@ bool SmtCore::popSplit()
                                        TimeUtils::timePassed( start, end ) );
     }
 
+    Tracer::setDecisionLevel( _stack.size() );
     checkSkewFromDebuggingSolution();
 
     return true;
@@ -556,6 +562,7 @@ PiecewiseLinearConstraint *SmtCore::chooseViolatedConstraintForFixing(
 
 void SmtCore::replaySmtStackEntry( SmtStackEntry *stackEntry )
 {
+    TraceSpan span( "SmtCore::replaySmtStackEntry" );
     struct timespec start = TimeUtils::sampleMicro();
 
     if ( _statistics )
@@ -571,12 +578,19 @@ void SmtCore::replaySmtStackEntry( SmtStackEntry *stackEntry )
     _engine->storeState( *stateBeforeSplits, TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE );
     stackEntry->_engineState = stateBeforeSplits;
 
+    // Every stack entry has its own context level, just like when the split
+    // was originally performed, so that popping the entry later on undoes
+    // exactly its splits
+    _engine->preContextPushHook();
+    pushContext();
+
     // Apply all the splits
     _engine->applySplit( stackEntry->_activeSplit );
     for ( const auto &impliedSplit : stackEntry->_impliedValidSplits )
         _engine->applySplit( impliedSplit );
 
     _stack.append( stackEntry );
+    Tracer::setDecisionLevel( _stack.size() );
 
     if ( _statistics )
     {
@@ -19,6 +19,7 @@
 enum class SnCDivideStrategy {
     // Input splitting
     LargestInterval = 0,
+    IntervalPropagation, // Pick the dimension whose halves leave the fewest unstable neurons
 
     // Relu splitting
     Polarity, // Pick the ReLU with the polarity closest to 0 among the first K nodes
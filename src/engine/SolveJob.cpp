@@ -0,0 +1,240 @@
+/*********************                                                        */
+/*! \file SolveJob.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "SolveJob.h"
+
+#include "DnCManager.h"
+#include "Engine.h"
+#include "MarabouError.h"
+
+#include <chrono>
+#include <cstdio>
+
+SolveJob::SolveJob( IQuery &inputQuery )
+    : _inputQuery( inputQuery )
+    , _options( *Options::get() )
+    , _done( false )
+    , _cancelRequested( false )
+    , _engine( NULL )
+    , _dncManager( NULL )
+    , _exitCode( IEngine::NOT_DONE )
+{
+    start();
+}
+
+SolveJob::SolveJob( IQuery &inputQuery,
+                    const ProgressReporter::Callback &callback,
+                    unsigned intervalInMilliseconds )
+    : SolveJob( inputQuery, callback, intervalInMilliseconds, inputQuery.getOutputVariables() )
+{
+}
+
+SolveJob::SolveJob( IQuery &inputQuery,
+                    const ProgressReporter::Callback &callback,
+                    unsigned intervalInMilliseconds,
+                    const List<unsigned> &variables )
+    : _inputQuery( inputQuery )
+    , _options( *Options::get() )
+    , _progressReporter( new ProgressReporter( callback, intervalInMilliseconds, variables ) )
+    , _done( false )
+    , _cancelRequested( false )
+    , _engine( NULL )
+    , _dncManager( NULL )
+    , _exitCode( IEngine::NOT_DONE )
+{
+    start();
+}
+
+SolveJob::~SolveJob()
+{
+    cancel();
+    if ( _thread.joinable() )
+        _thread.join();
+}
+
+void SolveJob::start()
+{
+    _thread = std::thread( &SolveJob::run, this );
+}
+
+void SolveJob::cancel()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    _cancelRequested = true;
+    if ( _engine )
+        _engine->quitSignal();
+    if ( _dncManager )
+        _dncManager->quitSignal();
+}
+
+bool SolveJob::poll() const
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _done;
+}
+
+bool SolveJob::wait( double timeoutInSeconds )
+{
+    std::unique_lock<std::mutex> lock( _mutex );
+    if ( timeoutInSeconds <= 0 )
+        _doneCondition.wait( lock, [this] { return _done; } );
+    else
+        _doneCondition.wait_for( lock, std::chrono::duration<double>( timeoutInSeconds ), [this] {
+            return _done;
+        } );
+
+    return _done;
+}
+
+IEngine::ExitCode SolveJob::getExitCode() const
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _exitCode;
+}
+
+const Statistics &SolveJob::getStatistics() const
+{
+    return _statistics;
+}
+
+void SolveJob::run()
+{
+    // The job runs with the options it was created with, whatever the
+    // spawning thread does in the meantime
+    Options::Scope optionsScope( &_options );
+
+    IEngine::ExitCode exitCode = IEngine::ERROR;
+    try
+    {
+        if ( _options.getBool( Options::DNC_MODE ) )
+            exitCode = solveWithDnCManager();
+        else
+            exitCode = solveWithEngine();
+    }
+    catch ( const MarabouError &e )
+    {
+        fprintf( stderr,
+                 "Caught a MarabouError. Code: %u. Message: %s\n",
+                 e.getCode(),
+                 e.getUserMessage() );
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _exitCode = exitCode;
+        _done = true;
+    }
+    _doneCondition.notify_all();
+}
+
+IEngine::ExitCode SolveJob::solveWithEngine()
+{
+    Engine engine;
+    if ( !attach( &engine, NULL ) )
+        return IEngine::QUIT_REQUESTED;
+
+    try
+    {
+        if ( engine.processInputQuery( _inputQuery ) )
+        {
+            if ( _progressReporter )
+            {
+                engine.resolveProgressVariables( *_progressReporter );
+                engine.setProgressReporter( _progressReporter.get() );
+            }
+
+            engine.solve( _options.getInt( Options::TIMEOUT ) );
+            if ( engine.getExitCode() == IEngine::SAT )
+                engine.extractSolution( _inputQuery );
+        }
+    }
+    catch ( ... )
+    {
+        detach();
+        throw;
+    }
+
+    detach();
+    _statistics = *engine.getStatistics();
+    return engine.getExitCode();
+}
+
+IEngine::ExitCode SolveJob::solveWithDnCManager()
+{
+    DnCManager dncManager( &_inputQuery );
+    if ( !attach( NULL, &dncManager ) )
+        return IEngine::QUIT_REQUESTED;
+
+    try
+    {
+        dncManager.setProgressReporter( _progressReporter.get() );
+        dncManager.solve();
+    }
+    catch ( ... )
+    {
+        detach();
+        throw;
+    }
+
+    detach();
+    switch ( dncManager.getExitCode() )
+    {
+    case DnCManager::SAT:
+        dncManager.extractSolution( _inputQuery );
+        return IEngine::SAT;
+
+    case DnCManager::UNSAT:
+        return IEngine::UNSAT;
+
+    case DnCManager::TIMEOUT:
+        _statistics.timeout();
+        return IEngine::TIMEOUT;
+
+    case DnCManager::QUIT_REQUESTED:
+        return IEngine::QUIT_REQUESTED;
+
+    case DnCManager::ERROR:
+        return IEngine::ERROR;
+
+    default:
+        return IEngine::UNKNOWN;
+    }
+}
+
+bool SolveJob::attach( Engine *engine, DnCManager *dncManager )
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    if ( _cancelRequested )
+        return false;
+
+    _engine = engine;
+    _dncManager = dncManager;
+    return true;
+}
+
+void SolveJob::detach()
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    _engine = NULL;
+    _dncManager = NULL;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
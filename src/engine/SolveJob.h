@@ -0,0 +1,131 @@
+/*********************                                                        */
+/*! \file SolveJob.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Solving a query on a background thread. The job runs with a copy of
+ ** the options of the thread that created it, with either a single engine
+ ** or, in DnC mode, a DnCManager. It can be cancelled, polled and waited
+ ** for, and can report its progress periodically to a callback, which is
+ ** invoked on the solving threads.
+ **
+ ** The query must outlive the job, and must not be accessed until the job
+ ** is done. If the query is satisfiable, the satisfying assignment is
+ ** stored in it.
+
+ **/
+
+#ifndef __SolveJob_h__
+#define __SolveJob_h__
+
+#include "IEngine.h"
+#include "IQuery.h"
+#include "Options.h"
+#include "ProgressReporter.h"
+#include "Statistics.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+class DnCManager;
+class Engine;
+
+class SolveJob
+{
+public:
+    /*
+      Start solving the query. If a callback is given, it receives a report
+      of the progress every intervalInMilliseconds, with the bounds of the
+      given variables of the query (by default, its output variables).
+    */
+    SolveJob( IQuery &inputQuery );
+    SolveJob( IQuery &inputQuery,
+              const ProgressReporter::Callback &callback,
+              unsigned intervalInMilliseconds );
+    SolveJob( IQuery &inputQuery,
+              const ProgressReporter::Callback &callback,
+              unsigned intervalInMilliseconds,
+              const List<unsigned> &variables );
+
+    /*
+      Cancel the job if it is still running, and wait for it
+    */
+    ~SolveJob();
+
+    /*
+      Ask the job to stop. The job then finishes with QUIT_REQUESTED,
+      unless it was already done.
+    */
+    void cancel();
+
+    /*
+      Whether the job is done
+    */
+    bool poll() const;
+
+    /*
+      Wait until the job is done, or until the timeout has passed. A zero
+      timeout waits indefinitely. Return true iff the job is done.
+    */
+    bool wait( double timeoutInSeconds = 0 );
+
+    /*
+      The result of the job, NOT_DONE until it is done. The statistics are
+      those of the engine, are empty in DnC mode, and may only be accessed
+      once the job is done.
+    */
+    IEngine::ExitCode getExitCode() const;
+    const Statistics &getStatistics() const;
+
+private:
+    IQuery &_inputQuery;
+    Options _options;
+    std::unique_ptr<ProgressReporter> _progressReporter;
+
+    /*
+      Protects the fields below. The engine and the DnCManager are set
+      while they are running, so that they can be asked to quit.
+    */
+    mutable std::mutex _mutex;
+    std::condition_variable _doneCondition;
+    bool _done;
+    bool _cancelRequested;
+    Engine *_engine;
+    DnCManager *_dncManager;
+
+    IEngine::ExitCode _exitCode;
+    Statistics _statistics;
+
+    std::thread _thread;
+
+    void start();
+    void run();
+    IEngine::ExitCode solveWithEngine();
+    IEngine::ExitCode solveWithDnCManager();
+
+    /*
+      Make the running engine or DnCManager reachable by cancel(), until it
+      is detached. Return false, without attaching, if the job was already
+      cancelled.
+    */
+    bool attach( Engine *engine, DnCManager *dncManager );
+    void detach();
+};
+
+#endif // __SolveJob_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,283 @@
+/*********************                                                        */
+/*! \file SubQuerySerializer.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "SubQuerySerializer.h"
+
+#include "Debug.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "Query.h"
+#include "SmtStackEntry.h"
+
+#include <cstdlib>
+
+SubQuerySerializer::TokenReader::TokenReader( const String &serialized )
+    : _tokens( serialized.tokenize( " \n" ) )
+{
+    _current = _tokens.begin();
+}
+
+String SubQuerySerializer::TokenReader::next()
+{
+    if ( _current == _tokens.end() )
+        throw MarabouError( MarabouError::MALFORMED_SERIALIZED_OBJECT,
+                            "Unexpected end of serialized object" );
+    return *( _current++ );
+}
+
+unsigned SubQuerySerializer::TokenReader::nextUnsigned()
+{
+    return (unsigned)strtoul( next().ascii(), NULL, 10 );
+}
+
+double SubQuerySerializer::TokenReader::nextDouble()
+{
+    return deserializeDouble( next() );
+}
+
+void SubQuerySerializer::TokenReader::expect( const String &keyword )
+{
+    String token = next();
+    if ( token != keyword )
+        throw MarabouError( MarabouError::MALFORMED_SERIALIZED_OBJECT,
+                            Stringf( "Expected '%s', found '%s'", keyword.ascii(), token.ascii() )
+                                .ascii() );
+}
+
+bool SubQuerySerializer::TokenReader::done() const
+{
+    return _current == _tokens.end();
+}
+
+String SubQuerySerializer::serializeDouble( double value )
+{
+    return Stringf( "%a", value );
+}
+
+double SubQuerySerializer::deserializeDouble( const String &token )
+{
+    return strtod( token.ascii(), NULL );
+}
+
+String SubQuerySerializer::computeQueryFingerprint( const Query &query )
+{
+    /*
+      Sizes, plus a checksum over the variable bounds: this catches workers
+      that were started on a different network or property, or with
+      options that change the preprocessing.
+    */
+    unsigned long long checksum = 0;
+    for ( unsigned i = 0; i < query.getNumberOfVariables(); ++i )
+    {
+        String bounds = serializeDouble( query.getLowerBound( i ) ) +
+                        serializeDouble( query.getUpperBound( i ) );
+        for ( unsigned j = 0; j < bounds.length(); ++j )
+            checksum = checksum * 31 + (unsigned char)bounds[j];
+    }
+
+    return Stringf( "%u,%u,%u,%u,%u,%u,%llx",
+                    query.getNumberOfVariables(),
+                    query.getNumberOfEquations(),
+                    query.getPiecewiseLinearConstraints().size(),
+                    query.getNonlinearConstraints().size(),
+                    query.getNumInputVariables(),
+                    query.getNumOutputVariables(),
+                    checksum );
+}
+
+String SubQuerySerializer::serializeSubQuery( const SubQuery &subQuery )
+{
+    return serializeSubQuery( subQuery, subQuery._smtState.get() );
+}
+
+String SubQuerySerializer::serializeSubQuery( const SubQuery &subQuery, const SmtState *smtState )
+{
+    /*
+      The query id is prefixed so that the empty id of the root query
+      still produces a token.
+    */
+    String output = Stringf( "subquery id:%s %u %u\n",
+                             subQuery._queryId.ascii(),
+                             subQuery._timeoutInSeconds,
+                             subQuery._depth );
+
+    ASSERT( subQuery._split );
+    serializeCaseSplit( *subQuery._split, output );
+
+    if ( smtState )
+    {
+        output += "smtstate 1\n";
+        serializeSmtState( *smtState, output );
+    }
+    else
+        output += "smtstate 0\n";
+
+    return output;
+}
+
+SubQuery *SubQuerySerializer::deserializeSubQuery( const String &serialized )
+{
+    TokenReader reader( serialized );
+    reader.expect( "subquery" );
+
+    String idToken = reader.next();
+    if ( idToken.length() < 3 || idToken.substring( 0, 3 ) != "id:" )
+        throw MarabouError( MarabouError::MALFORMED_SERIALIZED_OBJECT, "Missing subquery id" );
+
+    std::unique_ptr<SubQuery> subQuery( new SubQuery );
+    subQuery->_queryId = idToken.substring( 3, idToken.length() - 3 );
+    subQuery->_timeoutInSeconds = reader.nextUnsigned();
+    subQuery->_depth = reader.nextUnsigned();
+
+    subQuery->_split = std::unique_ptr<PiecewiseLinearCaseSplit>( new PiecewiseLinearCaseSplit );
+    deserializeCaseSplit( reader, *subQuery->_split );
+
+    reader.expect( "smtstate" );
+    if ( reader.nextUnsigned() == 1 )
+    {
+        subQuery->_smtState = std::unique_ptr<SmtState>( new SmtState );
+        deserializeSmtState( reader, *subQuery->_smtState );
+    }
+
+    return subQuery.release();
+}
+
+void SubQuerySerializer::serializeCaseSplit( const PiecewiseLinearCaseSplit &split,
+                                             String &output )
+{
+    const List<Tightening> &bounds = split.getBoundTightenings();
+    output += Stringf( "bounds %u\n", bounds.size() );
+    for ( const auto &bound : bounds )
+        output += Stringf( "%u %c %s\n",
+                           bound._variable,
+                           bound._type == Tightening::LB ? 'l' : 'u',
+                           serializeDouble( bound._value ).ascii() );
+
+    const List<Equation> &equations = split.getEquations();
+    output += Stringf( "equations %u\n", equations.size() );
+    for ( const auto &equation : equations )
+    {
+        output += Stringf( "%u %s %u",
+                           (unsigned)equation._type,
+                           serializeDouble( equation._scalar ).ascii(),
+                           equation._addends.size() );
+        for ( const auto &addend : equation._addends )
+            output += Stringf(
+                " %u %s", addend._variable, serializeDouble( addend._coefficient ).ascii() );
+        output += "\n";
+    }
+}
+
+void SubQuerySerializer::deserializeCaseSplit( TokenReader &reader,
+                                               PiecewiseLinearCaseSplit &split )
+{
+    reader.expect( "bounds" );
+    unsigned numBounds = reader.nextUnsigned();
+    for ( unsigned i = 0; i < numBounds; ++i )
+    {
+        unsigned variable = reader.nextUnsigned();
+        String type = reader.next();
+        double value = reader.nextDouble();
+        split.storeBoundTightening(
+            Tightening( variable, value, type == "l" ? Tightening::LB : Tightening::UB ) );
+    }
+
+    reader.expect( "equations" );
+    unsigned numEquations = reader.nextUnsigned();
+    for ( unsigned i = 0; i < numEquations; ++i )
+    {
+        unsigned type = reader.nextUnsigned();
+        if ( type > Equation::LE )
+            throw MarabouError( MarabouError::MALFORMED_SERIALIZED_OBJECT,
+                                Stringf( "Invalid equation type %u", type ).ascii() );
+
+        Equation equation( (Equation::EquationType)type );
+        equation.setScalar( reader.nextDouble() );
+
+        unsigned numAddends = reader.nextUnsigned();
+        for ( unsigned j = 0; j < numAddends; ++j )
+        {
+            unsigned variable = reader.nextUnsigned();
+            double coefficient = reader.nextDouble();
+            equation.addAddend( coefficient, variable );
+        }
+
+        split.addEquation( equation );
+    }
+}
+
+void SubQuerySerializer::serializeCaseSplitList( const List<PiecewiseLinearCaseSplit> &splits,
+                                                 String &output )
+{
+    output += Stringf( "splits %u\n", splits.size() );
+    for ( const auto &split : splits )
+        serializeCaseSplit( split, output );
+}
+
+void SubQuerySerializer::deserializeCaseSplitList( TokenReader &reader,
+                                                   List<PiecewiseLinearCaseSplit> &splits )
+{
+    reader.expect( "splits" );
+    unsigned numSplits = reader.nextUnsigned();
+    for ( unsigned i = 0; i < numSplits; ++i )
+    {
+        PiecewiseLinearCaseSplit split;
+        deserializeCaseSplit( reader, split );
+        splits.append( split );
+    }
+}
+
+void SubQuerySerializer::serializeSmtState( const SmtState &smtState, String &output )
+{
+    output += Stringf( "state %u\n", smtState._stateId );
+    serializeCaseSplitList( smtState._impliedValidSplitsAtRoot, output );
+
+    output += Stringf( "stack %u\n", smtState._stack.size() );
+    for ( const auto &stackEntry : smtState._stack )
+    {
+        serializeCaseSplit( stackEntry->_activeSplit, output );
+        serializeCaseSplitList( stackEntry->_impliedValidSplits, output );
+        serializeCaseSplitList( stackEntry->_alternativeSplits, output );
+    }
+}
+
+void SubQuerySerializer::deserializeSmtState( TokenReader &reader, SmtState &smtState )
+{
+    reader.expect( "state" );
+    smtState._stateId = reader.nextUnsigned();
+    deserializeCaseSplitList( reader, smtState._impliedValidSplitsAtRoot );
+
+    reader.expect( "stack" );
+    unsigned stackSize = reader.nextUnsigned();
+    for ( unsigned i = 0; i < stackSize; ++i )
+    {
+        // As in SmtStackEntry::duplicateSmtStackEntry, the engine state is
+        // recreated by replaying the splits
+        SmtStackEntry *stackEntry = new SmtStackEntry;
+        stackEntry->_engineState = NULL;
+        deserializeCaseSplit( reader, stackEntry->_activeSplit );
+        deserializeCaseSplitList( reader, stackEntry->_impliedValidSplits );
+        deserializeCaseSplitList( reader, stackEntry->_alternativeSplits );
+        smtState._stack.append( stackEntry );
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,105 @@
+/*********************                                                        */
+/*! \file SubQuerySerializer.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Conversion of SubQuery objects (and the case splits and SmtStates they
+ ** carry) to and from a compact textual form, so that they can be shipped
+ ** to other processes or stored on disk.
+
+ **/
+
+#ifndef __SubQuerySerializer_h__
+#define __SubQuerySerializer_h__
+
+#include "List.h"
+#include "MString.h"
+#include "PiecewiseLinearCaseSplit.h"
+#include "SmtState.h"
+#include "SubQuery.h"
+
+class Query;
+
+class SubQuerySerializer
+{
+public:
+    /*
+      A cursor over the whitespace-separated tokens of a serialized object.
+    */
+    class TokenReader
+    {
+    public:
+        TokenReader( const String &serialized );
+
+        String next();
+        unsigned nextUnsigned();
+        double nextDouble();
+
+        /*
+          Consume the next token and make sure it is the expected keyword.
+        */
+        void expect( const String &keyword );
+
+        bool done() const;
+
+    private:
+        List<String> _tokens;
+        List<String>::const_iterator _current;
+    };
+
+    /*
+      Serialize a subquery (id, timeout, depth, split and optional
+      SmtState) into a string, and reconstruct it. The caller owns
+      the returned subquery. The second version serializes the given
+      SmtState instead of the subquery's own.
+    */
+    static String serializeSubQuery( const SubQuery &subQuery );
+    static String serializeSubQuery( const SubQuery &subQuery, const SmtState *smtState );
+    static SubQuery *deserializeSubQuery( const String &serialized );
+
+    /*
+      Building blocks, also used for checkpointing.
+    */
+    static void serializeCaseSplit( const PiecewiseLinearCaseSplit &split, String &output );
+    static void deserializeCaseSplit( TokenReader &reader, PiecewiseLinearCaseSplit &split );
+
+    static void serializeSmtState( const SmtState &smtState, String &output );
+    static void deserializeSmtState( TokenReader &reader, SmtState &smtState );
+
+    /*
+      Doubles are written in hexadecimal floating point notation, so that
+      the bounds of the subqueries survive the round trip bit-for-bit.
+    */
+    static String serializeDouble( double value );
+    static double deserializeDouble( const String &token );
+
+    /*
+      A short description of the preprocessed query. Serialized subqueries
+      refer to the variables of the preprocessed query, so this is used to
+      make sure they are only applied to the same query (e.g., by remote
+      workers, or when resuming from a checkpoint).
+    */
+    static String computeQueryFingerprint( const Query &query );
+
+private:
+    static void serializeCaseSplitList( const List<PiecewiseLinearCaseSplit> &splits,
+                                        String &output );
+    static void deserializeCaseSplitList( TokenReader &reader,
+                                          List<PiecewiseLinearCaseSplit> &splits );
+};
+
+#endif // __SubQuerySerializer_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
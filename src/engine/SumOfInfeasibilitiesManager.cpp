@@ -330,7 +330,8 @@ void SumOfInfeasibilitiesManager::obtainCurrentAssignment()
 {
     struct timespec start = TimeUtils::sampleMicro();
 
-    _currentAssignment.clear();
+    // The same variables are assigned every time, so the entries are
+    // overwritten rather than cleared and reallocated
     for ( unsigned i = 0; i < _numberOfVariables; ++i )
         _currentAssignment[i] = _tableau.getValue( i );
 
@@ -32,7 +32,9 @@
 #include "PiecewiseLinearCaseSplit.h"
 #include "TableauRow.h"
 #include "TableauState.h"
+#include "VectorKernels.h"
 
+#include <algorithm>
 #include <string.h>
 
 Tableau::Tableau( IBoundManager &boundManager )
@@ -59,6 +61,7 @@ Tableau::Tableau( IBoundManager &boundManager )
     , _nonBasicAssignment( NULL )
     , _basicAssignment( NULL )
     , _basicStatus( NULL )
+    , _numBreakpointsPassed( 0 )
     , _basicAssignmentStatus( ITableau::BASIC_ASSIGNMENT_INVALID )
     , _statistics( NULL )
     , _costFunctionManager( NULL )
@@ -772,8 +775,7 @@ void Tableau::performPivot()
     updateCostFunctionForPivot();
 
     // Update the database
-    _basicVariables.insert( currentNonBasic );
-    _basicVariables.erase( currentBasic );
+    _basicVariables.replace( currentBasic, currentNonBasic );
 
     // Adjust the tableau indexing
     _basicIndexToVariable[_leavingVariable] = currentNonBasic;
@@ -821,8 +823,7 @@ void Tableau::performDegeneratePivot()
     updateCostFunctionForPivot();
 
     // Update the database
-    _basicVariables.insert( currentNonBasic );
-    _basicVariables.erase( currentBasic );
+    _basicVariables.replace( currentBasic, currentNonBasic );
 
     // Adjust the tableau indexing
     _basicIndexToVariable[_leavingVariable] = currentNonBasic;
@@ -955,10 +956,133 @@ void Tableau::pickLeavingVariable()
 
 void Tableau::pickLeavingVariable( double *changeColumn )
 {
+    _numBreakpointsPassed = 0;
+
     if ( GlobalConfiguration::USE_HARRIS_RATIO_TEST )
         harrisRatioTest( changeColumn );
     else
         standardRatioTest( changeColumn );
+
+    if ( usingLongStepRatioTest() && !isOptimizing() )
+        longStepRatioTest( changeColumn );
+}
+
+void Tableau::longStepRatioTest( const double *changeColumn )
+{
+    /*
+      The cost function is the sum of infeasibilities, which is piecewise
+      linear along the direction of the entering variable. An out-of-bounds
+      basic that moves towards its bounds becomes feasible at a breakpoint,
+      after which the sum decreases more slowly. The standard ratio test
+      stops at the first such breakpoint. Instead, we keep going for as
+      long as the sum still decreases, and stop either at the breakpoint
+      where it stops decreasing, or where the step is blocked: by a feasible
+      basic reaching its bound, by a passed basic reaching its far bound, or
+      by the entering variable reaching its own bound.
+
+      All steps below are non-negative; the sign is restored at the end.
+    */
+    const double *costFunction = _costFunctionManager->getCostFunction();
+    bool enteringDecreases = FloatUtils::isPositive( costFunction[_enteringVariable] );
+    double slope = FloatUtils::abs( costFunction[_enteringVariable] );
+
+    unsigned enteringVariable = _nonBasicIndexToVariable[_enteringVariable];
+    double blockingStep =
+        enteringDecreases
+            ? _nonBasicAssignment[_enteringVariable] - getLowerBound( enteringVariable )
+            : getUpperBound( enteringVariable ) - _nonBasicAssignment[_enteringVariable];
+    unsigned blockingBasic = _m;
+    double largestBlockingPivot = 0;
+
+    _breakpoints.clear();
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( changeColumn[i] < +GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE &&
+             changeColumn[i] > -GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE )
+            continue;
+
+        // The change in the basic per unit of change in the entering variable
+        double rate = enteringDecreases ? changeColumn[i] : -changeColumn[i];
+        unsigned basic = _basicIndexToVariable[i];
+        double basicCost = _costFunctionManager->getBasicCost( i );
+        double nearBound;
+        double blockingBound;
+
+        if ( rate > 0 )
+        {
+            // A basic above its upper bound moves away from it, and imposes no constraint
+            if ( basicCost > 0 )
+                continue;
+            nearBound = getLowerBound( basic );
+            blockingBound = getUpperBound( basic );
+        }
+        else
+        {
+            if ( basicCost < 0 )
+                continue;
+            nearBound = getUpperBound( basic );
+            blockingBound = getLowerBound( basic );
+        }
+
+        if ( basicCost != 0 )
+        {
+            Breakpoint breakpoint;
+            breakpoint._basicIndex = i;
+            breakpoint._step = FloatUtils::max( ( nearBound - _basicAssignment[i] ) / rate, 0 );
+            breakpoint._slopeDecrease = FloatUtils::abs( basicCost * rate );
+            _breakpoints.push_back( breakpoint );
+        }
+
+        double step = FloatUtils::max( ( blockingBound - _basicAssignment[i] ) / rate, 0 );
+        double pivot = FloatUtils::abs( changeColumn[i] );
+        if ( step < blockingStep || ( step == blockingStep && pivot > largestBlockingPivot ) )
+        {
+            blockingStep = step;
+            blockingBasic = i;
+            largestBlockingPivot = pivot;
+        }
+    }
+
+    std::sort( _breakpoints.begin(),
+               _breakpoints.end(),
+               []( const Breakpoint &a, const Breakpoint &b ) { return a._step < b._step; } );
+
+    unsigned numPassed = 0;
+    unsigned leavingVariable = blockingBasic;
+    double step = blockingStep;
+    for ( const auto &breakpoint : _breakpoints )
+    {
+        if ( breakpoint._step >= blockingStep )
+            break;
+
+        slope -= breakpoint._slopeDecrease;
+        if ( slope < GlobalConfiguration::ENTRY_ELIGIBILITY_TOLERANCE )
+        {
+            // The sum of infeasibilities stops decreasing here
+            leavingVariable = breakpoint._basicIndex;
+            step = breakpoint._step;
+            break;
+        }
+
+        ++numPassed;
+    }
+
+    // If no breakpoint can be passed, keep the choice of the regular ratio test
+    if ( numPassed == 0 )
+        return;
+
+    _numBreakpointsPassed = numPassed;
+    _leavingVariable = leavingVariable;
+    _changeRatio = enteringDecreases ? -step : step;
+    if ( _leavingVariable != _m )
+        _leavingVariableIncreases =
+            enteringDecreases ? FloatUtils::isPositive( changeColumn[_leavingVariable] )
+                              : FloatUtils::isNegative( changeColumn[_leavingVariable] );
+}
+
+unsigned Tableau::getNumBreakpointsPassed() const
+{
+    return _numBreakpointsPassed;
 }
 
 void Tableau::standardRatioTest( double *changeColumn )
@@ -1579,15 +1703,43 @@ void Tableau::getTableauRow( unsigned index, TableauRow *row )
     _unitVector[index] = 1;
     computeMultipliers( _unitVector );
 
-    for ( unsigned i = 0; i < _n - _m; ++i )
+    unsigned numNonZeroMultipliers = VectorKernels::countNonZeros( _multipliers, _m );
+    if ( numNonZeroMultipliers <
+         GlobalConfiguration::ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD * _m )
+    {
+        /*
+          e * inv(B) is sparse, so only a few rows of A participate in the
+          product. Accumulate these rows, instead of going over every
+          non-basic column.
+        */
+        std::fill_n( _workN, _n, 0.0 );
+        for ( unsigned i = 0; i < _m; ++i )
+        {
+            if ( _multipliers[i] == 0 )
+                continue;
+
+            for ( const auto &entry : *_sparseRowsOfA[i] )
+                _workN[entry._index] -= ( _multipliers[i] * entry._value );
+        }
+
+        for ( unsigned i = 0; i < _n - _m; ++i )
+        {
+            row->_row[i]._var = _nonBasicIndexToVariable[i];
+            row->_row[i]._coefficient = _workN[_nonBasicIndexToVariable[i]];
+        }
+    }
+    else
     {
-        row->_row[i]._var = _nonBasicIndexToVariable[i];
-        row->_row[i]._coefficient = 0;
+        for ( unsigned i = 0; i < _n - _m; ++i )
+        {
+            row->_row[i]._var = _nonBasicIndexToVariable[i];
+            row->_row[i]._coefficient = 0;
 
-        SparseUnsortedList *column = _sparseColumnsOfA[_nonBasicIndexToVariable[i]];
+            SparseUnsortedList *column = _sparseColumnsOfA[_nonBasicIndexToVariable[i]];
 
-        for ( const auto &entry : *column )
-            row->_row[i]._coefficient -= ( _multipliers[entry._index] * entry._value );
+            for ( const auto &entry : *column )
+                row->_row[i]._coefficient -= ( _multipliers[entry._index] * entry._value );
+        }
     }
 
     /*
@@ -2103,8 +2255,13 @@ void Tableau::addRow()
     delete[] _basicStatus;
     _basicStatus = newBasicStatus;
 
-    // // Mark the new variable as unbounded
-    _boundManager.registerNewVariable();
+    // Mark the new variable as unbounded. A row that is re-added after its
+    // state was restored (e.g., by a precision restoration) reuses the
+    // variable already registered for it
+    if ( _boundManager.getNumberOfVariables() < newN )
+        _boundManager.registerNewVariable();
+    else
+        _boundManager.resetBounds( newN - 1 );
 
     // Allocate a larger basis factorization
     IBasisFactorization *newBasisFactorization =
@@ -2143,14 +2300,132 @@ void Tableau::addRow()
     }
 }
 
+unsigned Tableau::addVariable( double lowerBound, double upperBound )
+{
+    unsigned variable = _n;
+    unsigned newN = _n + 1;
+
+    /*
+      The new variable does not appear in any row, so its column of A is
+      all zeros. It becomes non-basic: the basis, its factorization and
+      the basic assignment are unaffected. Only structures of size _n and
+      of size _n - _m grow.
+    */
+
+    // Allocate a larger _sparseColumnsOfA, keep old ones
+    SparseUnsortedList **newSparseColumnsOfA = new SparseUnsortedList *[newN];
+    if ( !newSparseColumnsOfA )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseColumnsOfA" );
+
+    memcpy( newSparseColumnsOfA, _sparseColumnsOfA, sizeof( SparseUnsortedList * ) * _n );
+    newSparseColumnsOfA[variable] = new SparseUnsortedList( _m );
+    if ( !newSparseColumnsOfA[variable] )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED,
+                            "Tableau::newSparseColumnsOfA[variable]" );
+
+    delete[] _sparseColumnsOfA;
+    _sparseColumnsOfA = newSparseColumnsOfA;
+
+    for ( unsigned i = 0; i < _m; ++i )
+        _sparseRowsOfA[i]->incrementSize();
+
+    _A->addEmptyColumn();
+
+    // _denseA is stored column by column, so the new column is appended
+    double *newDenseA = new double[_m * newN];
+    if ( !newDenseA )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newDenseA" );
+    memcpy( newDenseA, _denseA, sizeof( double ) * _m * _n );
+    std::fill_n( newDenseA + _m * _n, _m, 0.0 );
+    delete[] _denseA;
+    _denseA = newDenseA;
+
+    unsigned *newVariableToIndex = new unsigned[newN];
+    if ( !newVariableToIndex )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newVariableToIndex" );
+    memcpy( newVariableToIndex, _variableToIndex, _n * sizeof( unsigned ) );
+    delete[] _variableToIndex;
+    _variableToIndex = newVariableToIndex;
+
+    unsigned nonBasicIndex = _n - _m;
+
+    unsigned *newNonBasicIndexToVariable = new unsigned[nonBasicIndex + 1];
+    if ( !newNonBasicIndexToVariable )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED,
+                            "Tableau::newNonBasicIndexToVariable" );
+    memcpy( newNonBasicIndexToVariable,
+            _nonBasicIndexToVariable,
+            nonBasicIndex * sizeof( unsigned ) );
+    delete[] _nonBasicIndexToVariable;
+    _nonBasicIndexToVariable = newNonBasicIndexToVariable;
+
+    double *newNonBasicAssignment = new double[nonBasicIndex + 1];
+    if ( !newNonBasicAssignment )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newNonBasicAssignment" );
+    memcpy( newNonBasicAssignment, _nonBasicAssignment, nonBasicIndex * sizeof( double ) );
+    delete[] _nonBasicAssignment;
+    _nonBasicAssignment = newNonBasicAssignment;
+
+    delete _pivotRow;
+    _pivotRow = new TableauRow( nonBasicIndex + 1 );
+    if ( !_pivotRow )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::pivotRow" );
+
+    // Allocate a larger _workN. Don't need to initialize.
+    double *newWorkN = new double[newN];
+    if ( !newWorkN )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newWorkN" );
+    delete[] _workN;
+    _workN = newWorkN;
+
+    // As in addRow(), the variable may already be registered
+    if ( _boundManager.getNumberOfVariables() < newN )
+        _boundManager.registerNewVariable();
+    else
+        _boundManager.resetBounds( variable );
+
+    _n = newN;
+
+    _nonBasicIndexToVariable[nonBasicIndex] = variable;
+    _variableToIndex[variable] = nonBasicIndex;
+    _nonBasicAssignment[nonBasicIndex] = lowerBound;
+
+    setLowerBound( variable, lowerBound );
+    setUpperBound( variable, upperBound );
+
+    _costFunctionManager->initialize();
+
+    for ( const auto &watcher : _resizeWatchers )
+        watcher->notifyDimensionChange( _m, _n );
+
+    if ( _statistics )
+        _statistics->setUnsignedAttribute( Statistics::CURRENT_TABLEAU_N, _n );
+
+    return variable;
+}
+
 void Tableau::registerToWatchVariable( VariableWatcher *watcher, unsigned variable )
 {
+    while ( _variableToWatchers.size() <= variable )
+        _variableToWatchers.append( VariableWatchers() );
+
     _variableToWatchers[variable].append( watcher );
 }
 
 void Tableau::unregisterToWatchVariable( VariableWatcher *watcher, unsigned variable )
 {
-    _variableToWatchers[variable].erase( watcher );
+    if ( variable >= _variableToWatchers.size() )
+        return;
+
+    VariableWatchers &watchers = _variableToWatchers[variable];
+    for ( unsigned i = 0; i < watchers.size(); ++i )
+    {
+        if ( watchers[i] == watcher )
+        {
+            watchers.eraseAt( i );
+            return;
+        }
+    }
 }
 
 void Tableau::registerToWatchAllVariables( VariableWatcher *watcher )
@@ -2165,25 +2440,25 @@ void Tableau::registerResizeWatcher( ResizeWatcher *watcher )
 
 void Tableau::notifyLowerBound( unsigned variable, double bound )
 {
-    for ( auto &watcher : _globalWatchers )
-        watcher->notifyLowerBound( variable, bound );
+    for ( unsigned i = 0; i < _globalWatchers.size(); ++i )
+        _globalWatchers[i]->notifyLowerBound( variable, bound );
 
-    if ( _variableToWatchers.exists( variable ) )
+    if ( variable < _variableToWatchers.size() )
     {
-        for ( auto &watcher : _variableToWatchers[variable] )
-            watcher->notifyLowerBound( variable, bound );
+        for ( unsigned i = 0; i < _variableToWatchers[variable].size(); ++i )
+            _variableToWatchers[variable][i]->notifyLowerBound( variable, bound );
     }
 }
 
 void Tableau::notifyUpperBound( unsigned variable, double bound )
 {
-    for ( auto &watcher : _globalWatchers )
-        watcher->notifyUpperBound( variable, bound );
+    for ( unsigned i = 0; i < _globalWatchers.size(); ++i )
+        _globalWatchers[i]->notifyUpperBound( variable, bound );
 
-    if ( _variableToWatchers.exists( variable ) )
+    if ( variable < _variableToWatchers.size() )
     {
-        for ( auto &watcher : _variableToWatchers[variable] )
-            watcher->notifyUpperBound( variable, bound );
+        for ( unsigned i = 0; i < _variableToWatchers[variable].size(); ++i )
+            _variableToWatchers[variable][i]->notifyUpperBound( variable, bound );
     }
 }
 
@@ -2389,13 +2664,15 @@ void Tableau::updateAssignmentForPivot()
             nonBasicDelta = getUpperBound( nonBasic ) - _nonBasicAssignment[_enteringVariable];
 
         // Update all the affected basic variables
+        VectorKernels::maskedAxpy( -nonBasicDelta,
+                                   _changeColumn,
+                                   _basicAssignment,
+                                   _m,
+                                   GlobalConfiguration::DEFAULT_EPSILON_FOR_COMPARISONS );
         for ( unsigned i = 0; i < _m; ++i )
         {
-            if ( FloatUtils::isZero( _changeColumn[i] ) )
-                continue;
-
-            _basicAssignment[i] -= _changeColumn[i] * nonBasicDelta;
-            computeBasicStatus( i );
+            if ( !FloatUtils::isZero( _changeColumn[i] ) )
+                computeBasicStatus( i );
         }
 
         // Update the assignment for the non-basic variable
@@ -2427,6 +2704,20 @@ void Tableau::updateAssignmentForPivot()
                 basicGoingToUpperBound = false;
         }
 
+        if ( usingLongStepRatioTest() && _basicStatus[_leavingVariable] != Tableau::BETWEEN )
+        {
+            /*
+              An out-of-bounds basic normally leaves at the bound that it
+              reaches first. After a long step it may have crossed that
+              bound, and be leaving at the other one.
+            */
+            double newBasicValue =
+                currentBasicValue - _changeColumn[_leavingVariable] * _changeRatio;
+            basicGoingToUpperBound =
+                FloatUtils::abs( getUpperBound( currentBasic ) - newBasicValue ) <
+                FloatUtils::abs( getLowerBound( currentBasic ) - newBasicValue );
+        }
+
         if ( basicGoingToUpperBound )
             basicDelta = getUpperBound( currentBasic ) - currentBasicValue;
         else
@@ -2437,14 +2728,13 @@ void Tableau::updateAssignmentForPivot()
         // to change.
         double nonBasicDelta = basicDelta / -_changeColumn[_leavingVariable];
 
-        // Update all the other basic variables
+        // Update all the other basic variables. The leaving variable is
+        // updated too, but is overwritten below.
+        VectorKernels::axpy( -nonBasicDelta, _changeColumn, _basicAssignment, _m );
         for ( unsigned i = 0; i < _m; ++i )
         {
-            if ( i == _leavingVariable )
-                continue;
-
-            _basicAssignment[i] -= _changeColumn[i] * nonBasicDelta;
-            computeBasicStatus( i );
+            if ( i != _leavingVariable )
+                computeBasicStatus( i );
         }
 
         // Update the assignment for the entering variable
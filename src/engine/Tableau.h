@@ -29,6 +29,8 @@
 #include "SparseUnsortedList.h"
 #include "Statistics.h"
 
+#include <vector>
+
 #define TABLEAU_LOG( x, ... ) LOG( GlobalConfiguration::TABLEAU_LOGGING, "Tableau: %s\n", x )
 
 class Equation;
@@ -108,6 +110,13 @@ public:
     */
     unsigned addEquation( const Equation &equation );
 
+    /*
+      A method for adding a fresh variable, which does not yet appear in
+      any equation, to the tableau. The variable is non-basic, and is
+      assigned its lower bound. The method returns its index
+    */
+    unsigned addVariable( double lowerBound, double upperBound );
+
     /*
       Get the Tableau's dimensions.
     */
@@ -237,6 +246,13 @@ public:
     double getChangeRatio() const;
     void setChangeRatio( double changeRatio );
 
+    /*
+      The number of breakpoints of the sum of infeasibilities that the last
+      long-step ratio test passed. Each of them would otherwise have taken
+      a separate pivot.
+    */
+    unsigned getNumBreakpointsPassed() const;
+
     /*
       Returns true iff the current iteration is a fake pivot, i.e. the
       entering variable jumping from one bound to the other.
@@ -486,11 +502,11 @@ public:
 
 private:
     /*
-      Variable watchers
+      Variable watchers, in contiguous arrays indexed by variable
     */
-    typedef List<VariableWatcher *> VariableWatchers;
-    HashMap<unsigned, VariableWatchers> _variableToWatchers;
-    List<VariableWatcher *> _globalWatchers;
+    typedef Vector<VariableWatcher *> VariableWatchers;
+    Vector<VariableWatchers> _variableToWatchers;
+    Vector<VariableWatcher *> _globalWatchers;
 
     /*
       Resize watchers
@@ -616,6 +632,26 @@ private:
     */
     bool _leavingVariableIncreases;
 
+    /*
+      A breakpoint of the sum of infeasibilities along the entering
+      variable's direction: the step at which an out-of-bounds basic
+      becomes feasible, and by how much the slope of the sum decreases
+      once it does.
+    */
+    struct Breakpoint
+    {
+        unsigned _basicIndex;
+        double _step;
+        double _slopeDecrease;
+    };
+
+    /*
+      Work memory for the long-step ratio test, and the number of
+      breakpoints that the last test passed
+    */
+    std::vector<Breakpoint> _breakpoints;
+    unsigned _numBreakpointsPassed;
+
     /*
       The status of the basic assignment
     */
@@ -674,6 +710,13 @@ private:
     void standardRatioTest( double *changeColumn );
     void harrisRatioTest( double *changeColumn );
 
+    /*
+      Extend the step chosen by the standard or Harris ratio test past
+      breakpoints of the sum of infeasibilities, for as long as the sum
+      keeps decreasing.
+    */
+    void longStepRatioTest( const double *changeColumn );
+
     /*
       For debugging purposes only
     */
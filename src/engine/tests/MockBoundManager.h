@@ -58,6 +58,12 @@ public:
         return -1;
     };
 
+    void resetBounds( unsigned variable )
+    {
+        _lowerBounds[variable] = FloatUtils::negativeInfinity();
+        _upperBounds[variable] = FloatUtils::infinity();
+    }
+
     /*
        Initialize local bounds
      */
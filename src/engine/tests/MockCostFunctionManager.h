@@ -143,6 +143,10 @@ public:
     {
         return NULL;
     }
+
+    void setStatistics( Statistics * /* statistics */ )
+    {
+    }
 };
 
 #endif // __MockCostFunctionManager_h__
@@ -150,6 +150,11 @@ public:
         return _inputVariables;
     }
 
+    const NLR::NetworkLevelReasoner *getNetworkLevelReasoner() const
+    {
+        return NULL;
+    }
+
     void updateScores( DivideStrategy /**/ )
     {
     }
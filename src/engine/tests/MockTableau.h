@@ -318,6 +318,10 @@ public:
     {
         return 0;
     }
+    unsigned getNumBreakpointsPassed() const
+    {
+        return 0;
+    }
     void setChangeRatio( double /* changeRatio */ )
     {
     }
@@ -465,6 +469,11 @@ public:
         return nextAuxVar;
     }
 
+    unsigned addVariable( double /* lowerBound */, double /* upperBound */ )
+    {
+        return nextAuxVar;
+    }
+
     unsigned getM() const
     {
         return lastM;
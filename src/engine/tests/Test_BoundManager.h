@@ -17,6 +17,7 @@
 #include "FloatUtils.h"
 #include "InfeasibleQueryException.h"
 #include "MockEngine.h"
+#include "MockTableau.h"
 #include "Tightening.h"
 #include "Vector.h"
 #include "context/cdlist.h"
@@ -26,6 +27,32 @@
 
 using CVC4::context::Context;
 
+class MockTableauForBoundManager : public MockTableau
+{
+public:
+    MockTableauForBoundManager()
+        : boundManager( nullptr )
+    {
+    }
+
+    BoundManager *boundManager;
+    List<Tightening> notifications;
+
+    void notifyLowerBound( unsigned variable, double bound )
+    {
+        notifications.append( Tightening( variable, bound, Tightening::LB ) );
+
+        // An entailed tightening, as made by piecewise-linear constraints
+        if ( boundManager && variable == 0 )
+            boundManager->tightenLowerBound( 1, bound );
+    }
+
+    void notifyUpperBound( unsigned variable, double bound )
+    {
+        notifications.append( Tightening( variable, bound, Tightening::UB ) );
+    }
+};
+
 class BoundManagerTestSuite : public CxxTest::TestSuite
 {
 public:
@@ -87,6 +114,43 @@ public:
             FloatUtils::areEqual( boundManager.getUpperBound( 6 ), FloatUtils::infinity() ) );
     }
 
+    /*
+     * Growing the local bounds when registering new variables preserves the
+     * bounds of the existing ones.
+     *
+     */
+    void test_register_variable_keeps_existing_bounds()
+    {
+        BoundManager boundManager( *context );
+
+        unsigned numberOfVariables = 3u;
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( numberOfVariables ) );
+
+        for ( unsigned i = 0; i < numberOfVariables; ++i )
+        {
+            boundManager.setLowerBound( i, -1.0 * i );
+            boundManager.setUpperBound( i, 10.0 + i );
+        }
+
+        for ( unsigned i = 0; i < 10; ++i )
+            TS_ASSERT_EQUALS( boundManager.registerNewVariable(), numberOfVariables + i );
+
+        TS_ASSERT_EQUALS( boundManager.getNumberOfVariables(), 13u );
+
+        for ( unsigned i = 0; i < numberOfVariables; ++i )
+        {
+            TS_ASSERT_EQUALS( boundManager.getLowerBound( i ), -1.0 * i );
+            TS_ASSERT_EQUALS( boundManager.getUpperBound( i ), 10.0 + i );
+        }
+
+        for ( unsigned i = numberOfVariables; i < 13; ++i )
+        {
+            TS_ASSERT_EQUALS( boundManager.getLowerBound( i ), FloatUtils::negativeInfinity() );
+            TS_ASSERT_EQUALS( boundManager.getUpperBound( i ), FloatUtils::infinity() );
+        }
+    }
+
     /*
      * BoundManager throws infeasible query exception when some variable bounds
      * become invalid
@@ -146,6 +210,53 @@ public:
         TS_ASSERT( tightenings.size() == 0u );
     }
 
+    /*
+     * Only tightened variables are propagated, each once per round, including
+     * tightenings made while propagating and flags restored by a context pop
+     */
+    void test_propagate_tightenings()
+    {
+        BoundManager boundManager( *context );
+        MockTableauForBoundManager tableau;
+        tableau.boundManager = &boundManager;
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( 4 ) );
+        boundManager.registerTableau( &tableau );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.propagateTightenings() );
+        TS_ASSERT( tableau.notifications.empty() );
+
+        boundManager.setUpperBound( 3, 5 );
+        boundManager.setUpperBound( 3, 4 );
+        boundManager.setLowerBound( 0, 2 );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.propagateTightenings() );
+        TS_ASSERT_EQUALS( tableau.notifications.size(), 3U );
+        auto it = tableau.notifications.begin();
+        TS_ASSERT_EQUALS( *it, Tightening( 3, 4, Tightening::UB ) );
+        ++it;
+        TS_ASSERT_EQUALS( *it, Tightening( 0, 2, Tightening::LB ) );
+        ++it;
+        TS_ASSERT_EQUALS( *it, Tightening( 1, 2, Tightening::LB ) );
+        tableau.notifications.clear();
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.propagateTightenings() );
+        TS_ASSERT( tableau.notifications.empty() );
+
+        // A tightening pending when the context is pushed is pending again after the pop
+        boundManager.setLowerBound( 2, -1 );
+        context->push();
+        boundManager.setUpperBound( 3, 3 );
+        TS_ASSERT_THROWS_NOTHING( boundManager.propagateTightenings() );
+        TS_ASSERT_EQUALS( tableau.notifications.size(), 2U );
+        tableau.notifications.clear();
+
+        context->pop();
+        TS_ASSERT_THROWS_NOTHING( boundManager.propagateTightenings() );
+        TS_ASSERT_EQUALS( tableau.notifications.size(), 1U );
+        TS_ASSERT_EQUALS( tableau.notifications.back(), Tightening( 2, -1, Tightening::LB ) );
+    }
+
     /*
      * BoundManager correctly updates bounds with advancement and backtracking of context
      *
@@ -0,0 +1,186 @@
+/*********************                                                        */
+/*! \file Test_Checkpoint.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "Checkpoint.h"
+#include "File.h"
+#include "MarabouError.h"
+#include "SmtStackEntry.h"
+#include "TimeUtils.h"
+
+#include <cstdio>
+#include <cxxtest/TestSuite.h>
+
+const String CHECKPOINT_TEST_FILE( "CheckpointTest.txt" );
+
+class CheckpointTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+    }
+
+    void tearDown()
+    {
+        std::remove( CHECKPOINT_TEST_FILE.ascii() );
+    }
+
+    SubQuery *createSubQuery( const String &queryId, unsigned variable, double lb, double ub )
+    {
+        SubQuery *subQuery = new SubQuery;
+        subQuery->_queryId = queryId;
+        subQuery->_timeoutInSeconds = 5;
+        subQuery->_depth = 1;
+        subQuery->_split = std::unique_ptr<PiecewiseLinearCaseSplit>( new PiecewiseLinearCaseSplit );
+        subQuery->_split->storeBoundTightening( Tightening( variable, lb, Tightening::LB ) );
+        subQuery->_split->storeBoundTightening( Tightening( variable, ub, Tightening::UB ) );
+        return subQuery;
+    }
+
+    void freeSubQueries( SubQueries &subQueries )
+    {
+        for ( auto &subQuery : subQueries )
+        {
+            if ( subQuery->_smtState )
+            {
+                for ( auto &stackEntry : subQuery->_smtState->_stack )
+                    delete stackEntry;
+            }
+            delete subQuery;
+        }
+        subQueries.clear();
+    }
+
+    void test_save_and_load()
+    {
+        Checkpoint checkpoint( CHECKPOINT_TEST_FILE, "abc", 600 );
+
+        SubQuery *first = createSubQuery( "1", 0, -1, 0 );
+        SubQuery *second = createSubQuery( "2", 0, 0, 1 );
+        SubQuery *third = createSubQuery( "3", 1, 0, 1 );
+        checkpoint.addSubQuery( *first );
+        checkpoint.addSubQuery( *second );
+        checkpoint.addSubQuery( *third );
+        checkpoint.markSubQuerySolved( "2" );
+
+        // Solving an unknown subquery is not counted
+        checkpoint.markSubQuerySolved( "4" );
+
+        TS_ASSERT_EQUALS( checkpoint.getNumSubQueries(), 2U );
+        TS_ASSERT_EQUALS( checkpoint.getNumSolvedSubQueries(), 1U );
+        TS_ASSERT_THROWS_NOTHING( checkpoint.save() );
+        TS_ASSERT( File::exists( CHECKPOINT_TEST_FILE ) );
+
+        Checkpoint resumed( CHECKPOINT_TEST_FILE, "abc", 600 );
+        TS_ASSERT_THROWS_NOTHING( resumed.load() );
+        TS_ASSERT_EQUALS( resumed.getNumSubQueries(), 2U );
+        TS_ASSERT_EQUALS( resumed.getNumSolvedSubQueries(), 1U );
+
+        SubQueries subQueries;
+        resumed.getSubQueries( subQueries );
+        TS_ASSERT_EQUALS( subQueries.size(), 2U );
+        for ( const auto &subQuery : subQueries )
+        {
+            TS_ASSERT( subQuery->_queryId == "1" || subQuery->_queryId == "3" );
+            const SubQuery *original = subQuery->_queryId == "1" ? first : third;
+            TS_ASSERT( *subQuery->_split == *original->_split );
+            TS_ASSERT_EQUALS( subQuery->_timeoutInSeconds, 5U );
+            TS_ASSERT_EQUALS( subQuery->_depth, 1U );
+        }
+
+        freeSubQueries( subQueries );
+        delete first;
+        delete second;
+        delete third;
+
+        TS_ASSERT_THROWS_NOTHING( resumed.remove() );
+        TS_ASSERT( !File::exists( CHECKPOINT_TEST_FILE ) );
+    }
+
+    void test_update_smt_state()
+    {
+        Checkpoint checkpoint( CHECKPOINT_TEST_FILE, "abc", 600 );
+
+        SubQuery *root = createSubQuery( "", 0, -1, 1 );
+        checkpoint.addSubQuery( *root );
+
+        SmtState smtState;
+        smtState._stateId = 3;
+        SmtStackEntry *stackEntry = new SmtStackEntry;
+        stackEntry->_engineState = NULL;
+        stackEntry->_activeSplit.storeBoundTightening( Tightening( 2, 0, Tightening::UB ) );
+        smtState._stack.append( stackEntry );
+
+        // The state of the subquery is replaced on every update
+        checkpoint.updateSmtState( "", smtState );
+        checkpoint.updateSmtState( "", smtState );
+
+        // Updating an unknown subquery is ignored
+        checkpoint.updateSmtState( "7", smtState );
+        TS_ASSERT_EQUALS( checkpoint.getNumSubQueries(), 1U );
+
+        checkpoint.save();
+
+        Checkpoint resumed( CHECKPOINT_TEST_FILE, "abc", 600 );
+        resumed.load();
+
+        SubQueries subQueries;
+        resumed.getSubQueries( subQueries );
+        TS_ASSERT_EQUALS( subQueries.size(), 1U );
+
+        SubQuery *result = *subQueries.begin();
+        TS_ASSERT_EQUALS( result->_queryId, "" );
+        TS_ASSERT( *result->_split == *root->_split );
+        TS_ASSERT( result->_smtState );
+        TS_ASSERT_EQUALS( result->_smtState->_stateId, 3U );
+        TS_ASSERT_EQUALS( result->_smtState->_stack.size(), 1U );
+        TS_ASSERT( ( *result->_smtState->_stack.begin() )->_activeSplit ==
+                   stackEntry->_activeSplit );
+
+        freeSubQueries( subQueries );
+        delete stackEntry;
+        delete root;
+    }
+
+    void test_mismatch()
+    {
+        Checkpoint missing( CHECKPOINT_TEST_FILE, "abc", 600 );
+        TS_ASSERT_THROWS_EQUALS( missing.load(),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::FILE_DOESNT_EXIST );
+
+        Checkpoint checkpoint( CHECKPOINT_TEST_FILE, "abc", 600 );
+        checkpoint.save();
+
+        Checkpoint other( CHECKPOINT_TEST_FILE, "def", 600 );
+        TS_ASSERT_THROWS_EQUALS( other.load(),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::CHECKPOINT_MISMATCH );
+    }
+
+    void test_save_if_due()
+    {
+        Checkpoint never( CHECKPOINT_TEST_FILE, "abc", 600 );
+        never.saveIfDue();
+        TS_ASSERT( !File::exists( CHECKPOINT_TEST_FILE ) );
+        TS_ASSERT( !never.isDue( TimeUtils::sampleMicro() ) );
+
+        Checkpoint always( CHECKPOINT_TEST_FILE, "abc", 0 );
+        always.saveIfDue();
+        TS_ASSERT( File::exists( CHECKPOINT_TEST_FILE ) );
+        TS_ASSERT( always.isDue( TimeUtils::sampleMicro() ) );
+    }
+};
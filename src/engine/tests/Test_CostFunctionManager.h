@@ -18,6 +18,8 @@
 #include "MarabouError.h"
 #include "MockErrno.h"
 #include "MockTableau.h"
+#include "Statistics.h"
+#include "TableauRow.h"
 
 #include <cxxtest/TestSuite.h>
 #include <string.h>
@@ -258,6 +260,102 @@ public:
 
         TS_ASSERT_THROWS_NOTHING( delete manager );
     }
+
+    void test_incremental_update_and_periodic_recomputation()
+    {
+        CostFunctionManager *manager = NULL;
+        MockTableau tableau;
+        Statistics statistics;
+
+        unsigned n = 5;
+        unsigned m = 3;
+        tableau.setDimensions( m, n );
+
+        TS_ASSERT( manager = new CostFunctionManager( &tableau ) );
+        TS_ASSERT_THROWS_NOTHING( manager->initialize() );
+        manager->setStatistics( &statistics );
+
+        double multipliers[3] = { 0, 2, -3 };
+        memcpy( tableau.nextBtranOutput, multipliers, sizeof( double ) * 3 );
+        tableau.nextNonBasicIndexToVariable[0] = 2;
+        tableau.nextNonBasicIndexToVariable[1] = 0;
+        double columnZero[] = { 1, -1, 2 };
+        double columnTwo[] = { 3, 1, 0 };
+        tableau.nextAColumn[0] = columnZero;
+        tableau.nextAColumn[2] = columnTwo;
+
+        tableau.nextBasicIndexToVariable[0] = 5;
+        tableau.nextBasicIndexToVariable[1] = 6;
+        tableau.nextBasicIndexToVariable[2] = 7;
+
+        tableau.lowerBounds[5] = 0;
+        tableau.upperBounds[5] = 1;
+        tableau.lowerBounds[6] = 0;
+        tableau.upperBounds[6] = 1;
+        tableau.lowerBounds[7] = 0;
+        tableau.upperBounds[7] = 1;
+
+        tableau.nextValues[5] = 10;  // Too high
+        tableau.nextValues[6] = -10; // Too low
+        tableau.nextValues[7] = 0.5; // Okay
+
+        // An invalid cost function is not updated
+        TableauRow pivotRow( 2 );
+        pivotRow._row[0]._coefficient = -2;
+        pivotRow._row[1]._coefficient = 3;
+        double changeColumn[] = { 2, 0, 0 };
+
+        TS_ASSERT_EQUALS( manager->updateCostFunctionForPivot( 0, 0, -2, &pivotRow, changeColumn ),
+                          0 );
+        TS_ASSERT( manager->costFunctionInvalid() );
+        TS_ASSERT_EQUALS( statistics.getLongAttribute( Statistics::NUM_COST_FUNCTION_UPDATES ),
+                          0U );
+
+        // Basic costs are [ 1, -1, 0 ], and the reduced costs are [ -2, 8 ]
+        TS_ASSERT_THROWS_NOTHING( manager->computeCoreCostFunction() );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_COST_FUNCTION_COMPUTATIONS ), 1U );
+
+        /*
+          Entering variable #0 replaces basic #0. Its reduced cost computed
+          from the change column matches the stored one, so there is no error.
+          Its new cost is -2 / -2 = 1, from which the cost of the leaving
+          variable is removed; the other reduced cost becomes 8 - 3 * 1 = 5.
+        */
+        TS_ASSERT_EQUALS( manager->updateCostFunctionForPivot( 0, 0, -2, &pivotRow, changeColumn ),
+                          0 );
+        TS_ASSERT_EQUALS( manager->getCostFunctionStatus(),
+                          ICostFunctionManager::COST_FUNCTION_UPDATED );
+
+        const double *costFunction = manager->getCostFunction();
+        TS_ASSERT_EQUALS( costFunction[0], 0 );
+        TS_ASSERT_EQUALS( costFunction[1], 5 );
+        TS_ASSERT_EQUALS( manager->getBasicCost( 0 ), 0 );
+        TS_ASSERT_EQUALS( statistics.getLongAttribute( Statistics::NUM_COST_FUNCTION_UPDATES ),
+                          1U );
+
+        // After enough consecutive updates, the cost function is recomputed from scratch
+        for ( unsigned i = 1; i < GlobalConfiguration::COST_FUNCTION_RECOMPUTATION_FREQUENCY - 1;
+              ++i )
+        {
+            manager->updateCostFunctionForPivot( 0, 0, -2, &pivotRow, changeColumn );
+            TS_ASSERT( !manager->costFunctionInvalid() );
+        }
+
+        manager->updateCostFunctionForPivot( 0, 0, -2, &pivotRow, changeColumn );
+        TS_ASSERT( manager->costFunctionInvalid() );
+        TS_ASSERT_EQUALS( statistics.getLongAttribute( Statistics::NUM_COST_FUNCTION_UPDATES ),
+                          GlobalConfiguration::COST_FUNCTION_RECOMPUTATION_FREQUENCY );
+
+        TS_ASSERT_THROWS_NOTHING( manager->computeCoreCostFunction() );
+        TS_ASSERT_THROWS_NOTHING(
+            manager->updateCostFunctionForPivot( 0, 0, -2, &pivotRow, changeColumn ) );
+        TS_ASSERT( !manager->costFunctionInvalid() );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_COST_FUNCTION_COMPUTATIONS ), 2U );
+
+        TS_ASSERT_THROWS_NOTHING( delete manager );
+    }
 };
 
 //
@@ -0,0 +1,99 @@
+/*********************                                                        */
+/*! \file Test_EntryCandidatePool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz, Duligur Ibeling
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "EntryCandidatePool.h"
+
+#include <cxxtest/TestSuite.h>
+
+class EntryCandidatePoolTestSuite : public CxxTest::TestSuite
+{
+public:
+    void test_offer_and_pop()
+    {
+        EntryCandidatePool pool;
+        pool.initialize( 3, 10 );
+
+        TS_ASSERT( pool.empty() );
+        unsigned index;
+        TS_ASSERT( !pool.popBest( index ) );
+
+        pool.offer( 5, 1.0 );
+        pool.offer( 2, 4.0 );
+        pool.offer( 7, 2.0 );
+        TS_ASSERT_EQUALS( pool.getSize(), 3U );
+
+        // Already in the pool
+        pool.offer( 5, 100.0 );
+        TS_ASSERT_EQUALS( pool.getSize(), 3U );
+
+        // Worse than all candidates in the full pool
+        pool.offer( 1, 0.5 );
+        TS_ASSERT( !pool.contains( 1 ) );
+
+        // Evicts the worst candidate, 5
+        pool.offer( 9, 3.0 );
+        TS_ASSERT( pool.contains( 9 ) );
+        TS_ASSERT( !pool.contains( 5 ) );
+
+        // Equal scores favor the lower index: 0 evicts 7, and 8 does not get in
+        pool.offer( 8, 2.0 );
+        TS_ASSERT( !pool.contains( 8 ) );
+        pool.offer( 0, 2.0 );
+        TS_ASSERT( pool.contains( 0 ) );
+        TS_ASSERT( !pool.contains( 7 ) );
+
+        TS_ASSERT( pool.popBest( index ) );
+        TS_ASSERT_EQUALS( index, 2U );
+        TS_ASSERT( pool.popBest( index ) );
+        TS_ASSERT_EQUALS( index, 9U );
+
+        // A popped candidate may be offered again
+        pool.offer( 2, 1.5 );
+        TS_ASSERT( pool.popBest( index ) );
+        TS_ASSERT_EQUALS( index, 0U );
+        TS_ASSERT( pool.popBest( index ) );
+        TS_ASSERT_EQUALS( index, 2U );
+        TS_ASSERT( !pool.popBest( index ) );
+    }
+
+    void test_remove_all()
+    {
+        EntryCandidatePool pool;
+        pool.initialize( 4, 10 );
+
+        pool.offer( 3, 1.0 );
+        pool.offer( 6, 2.0 );
+
+        unsigned indices[4];
+        TS_ASSERT_EQUALS( pool.removeAll( indices ), 2U );
+        TS_ASSERT( ( indices[0] == 3 && indices[1] == 6 ) ||
+                   ( indices[0] == 6 && indices[1] == 3 ) );
+
+        TS_ASSERT( pool.empty() );
+        TS_ASSERT( !pool.contains( 3 ) );
+        TS_ASSERT( !pool.contains( 6 ) );
+
+        pool.offer( 3, 1.0 );
+        TS_ASSERT( pool.contains( 3 ) );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
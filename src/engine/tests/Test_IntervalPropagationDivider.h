@@ -0,0 +1,160 @@
+/*********************                                                        */
+/*! \file Test_IntervalPropagationDivider.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "IntervalPropagationDivider.h"
+#include "List.h"
+#include "NetworkLevelReasoner.h"
+#include "PiecewiseLinearCaseSplit.h"
+#include "SubQuery.h"
+
+#include <cxxtest/TestSuite.h>
+
+class IntervalPropagationDividerTestSuite : public CxxTest::TestSuite
+{
+public:
+    List<unsigned> inputVariables;
+
+    void setUp()
+    {
+        // inputVariables x0 x1
+        inputVariables.append( 0 );
+        inputVariables.append( 1 );
+    }
+
+    void tearDown()
+    {
+        inputVariables.clear();
+    }
+
+    void populateNetwork( NLR::NetworkLevelReasoner &nlr )
+    {
+        /*
+                a
+          x           d    f
+                b
+          y           e    g
+                c
+        */
+
+        nlr.addLayer( 0, NLR::Layer::INPUT, 2 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, 3 );
+        nlr.addLayer( 2, NLR::Layer::RELU, 3 );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, 2 );
+        nlr.addLayer( 4, NLR::Layer::RELU, 2 );
+        nlr.addLayer( 5, NLR::Layer::WEIGHTED_SUM, 2 );
+
+        for ( unsigned i = 1; i <= 5; ++i )
+            nlr.addLayerDependency( i - 1, i );
+
+        nlr.setWeight( 0, 0, 1, 0, 1 );
+        nlr.setWeight( 0, 0, 1, 1, 2 );
+        nlr.setWeight( 0, 1, 1, 1, -3 );
+        nlr.setWeight( 0, 1, 1, 2, 1 );
+
+        nlr.setWeight( 2, 0, 3, 0, 1 );
+        nlr.setWeight( 2, 0, 3, 1, -1 );
+        nlr.setWeight( 2, 1, 3, 0, 1 );
+        nlr.setWeight( 2, 1, 3, 1, 1 );
+        nlr.setWeight( 2, 2, 3, 0, -1 );
+        nlr.setWeight( 2, 2, 3, 1, -1 );
+
+        nlr.setWeight( 4, 0, 5, 0, 1 );
+        nlr.setWeight( 4, 0, 5, 1, 1 );
+        nlr.setWeight( 4, 1, 5, 1, 3 );
+
+        nlr.setBias( 1, 0, 1 );
+        nlr.setBias( 3, 1, 2 );
+
+        nlr.addActivationSource( 1, 0, 2, 0 );
+        nlr.addActivationSource( 1, 1, 2, 1 );
+        nlr.addActivationSource( 1, 2, 2, 2 );
+
+        nlr.addActivationSource( 3, 0, 4, 0 );
+        nlr.addActivationSource( 3, 1, 4, 1 );
+
+        nlr.setNeuronVariable( NLR::NeuronIndex( 0, 0 ), 0 );
+        nlr.setNeuronVariable( NLR::NeuronIndex( 0, 1 ), 1 );
+    }
+
+    void createSubQueries( QueryDivider &queryDivider, SubQueries &subQueries )
+    {
+        //   Input Region:
+        //   -1 <= x0 <= 1
+        //   -1 <= x1 <= 1
+        PiecewiseLinearCaseSplit previousSplit;
+        previousSplit.storeBoundTightening( Tightening( 0, -1.0, Tightening::LB ) );
+        previousSplit.storeBoundTightening( Tightening( 0, 1.0, Tightening::UB ) );
+        previousSplit.storeBoundTightening( Tightening( 1, -1.0, Tightening::LB ) );
+        previousSplit.storeBoundTightening( Tightening( 1, 1.0, Tightening::UB ) );
+
+        queryDivider.createSubQueries( 2, "mock", 0, previousSplit, 5, subQueries );
+    }
+
+    void test_create_subqueries()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        populateNetwork( nlr );
+
+        IntervalPropagationDivider queryDivider( inputVariables, &nlr );
+
+        // Bisecting x0 leaves 3 + 3 unstable ReLUs, and bisecting x1
+        // leaves 1 + 3. So x1 is bisected, although both intervals have
+        // the same width.
+        SubQueries subQueries;
+        createSubQueries( queryDivider, subQueries );
+
+        PiecewiseLinearCaseSplit newSplit1;
+        newSplit1.storeBoundTightening( Tightening( 0, -1.0, Tightening::LB ) );
+        newSplit1.storeBoundTightening( Tightening( 0, 1.0, Tightening::UB ) );
+        newSplit1.storeBoundTightening( Tightening( 1, -1.0, Tightening::LB ) );
+        newSplit1.storeBoundTightening( Tightening( 1, 0.0, Tightening::UB ) );
+
+        PiecewiseLinearCaseSplit newSplit2;
+        newSplit2.storeBoundTightening( Tightening( 0, -1.0, Tightening::LB ) );
+        newSplit2.storeBoundTightening( Tightening( 0, 1.0, Tightening::UB ) );
+        newSplit2.storeBoundTightening( Tightening( 1, 0.0, Tightening::LB ) );
+        newSplit2.storeBoundTightening( Tightening( 1, 1.0, Tightening::UB ) );
+
+        TS_ASSERT_EQUALS( subQueries.size(), 2U );
+        TS_ASSERT( *( subQueries.front()->_split ) == newSplit1 );
+        TS_ASSERT( *( subQueries.back()->_split ) == newSplit2 );
+        TS_ASSERT( subQueries.front()->_queryId == "mock-1" );
+        TS_ASSERT( subQueries.back()->_queryId == "mock-2" );
+
+        for ( const auto &subQuery : subQueries )
+            delete subQuery;
+    }
+
+    void test_create_subqueries_without_network()
+    {
+        IntervalPropagationDivider queryDivider( inputVariables, NULL );
+
+        // Falls back to the largest interval, which is x0 on a tie
+        SubQueries subQueries;
+        createSubQueries( queryDivider, subQueries );
+
+        PiecewiseLinearCaseSplit newSplit1;
+        newSplit1.storeBoundTightening( Tightening( 0, -1.0, Tightening::LB ) );
+        newSplit1.storeBoundTightening( Tightening( 0, 0.0, Tightening::UB ) );
+        newSplit1.storeBoundTightening( Tightening( 1, -1.0, Tightening::LB ) );
+        newSplit1.storeBoundTightening( Tightening( 1, 1.0, Tightening::UB ) );
+
+        TS_ASSERT_EQUALS( subQueries.size(), 2U );
+        TS_ASSERT( *( subQueries.front()->_split ) == newSplit1 );
+
+        for ( const auto &subQuery : subQueries )
+            delete subQuery;
+    }
+};
@@ -21,6 +21,7 @@
 #include "MarabouError.h"
 #include "MaxConstraint.h"
 #include "MockErrno.h"
+#include "Options.h"
 #include "Preprocessor.h"
 #include "Query.h"
 #include "ReluConstraint.h"
@@ -41,10 +42,15 @@ public:
     void setUp()
     {
         TS_ASSERT( mock = new MockForPreprocessor );
+
+        // Most tests check the other steps on queries that presolve would remove entirely
+        Options::get()->setBool( Options::DO_NOT_PRESOLVE_EQUATIONS, true );
     }
 
     void tearDown()
     {
+        Options::get()->setBool( Options::DO_NOT_PRESOLVE_EQUATIONS, false );
+
         TS_ASSERT_THROWS_NOTHING( delete mock );
     }
 
@@ -1024,6 +1030,190 @@ public:
         TS_ASSERT_EQUALS( ipq.getSolutionValue( 5 ), 1000 );
     }
 
+    void test_presolve_implied_free_column_singleton()
+    {
+        Options::get()->setBool( Options::DO_NOT_PRESOLVE_EQUATIONS, false );
+
+        Query inputQuery;
+
+        inputQuery.setNumberOfVariables( 5 );
+        for ( unsigned i = 0; i < 3; ++i )
+        {
+            inputQuery.setLowerBound( i, 0 );
+            inputQuery.setUpperBound( i, 1 );
+        }
+
+        // x3 >= 0 is implied by the equation, x4 >= 1 is not
+        inputQuery.setLowerBound( 3, 0 );
+        inputQuery.setUpperBound( 3, 10 );
+        inputQuery.setLowerBound( 4, 1 );
+        inputQuery.setUpperBound( 4, 10 );
+
+        // x0 + x1 - x3 = -2, i.e. x3 = x0 + x1 + 2, in [2, 4]
+        Equation equation1;
+        equation1.addAddend( 1, 0 );
+        equation1.addAddend( 1, 1 );
+        equation1.addAddend( -1, 3 );
+        equation1.setScalar( -2 );
+        inputQuery.addEquation( equation1 );
+
+        // x1 + x2 - x4 = 0, i.e. x4 = x1 + x2, in [0, 2]
+        Equation equation2;
+        equation2.addAddend( 1, 1 );
+        equation2.addAddend( 1, 2 );
+        equation2.addAddend( -1, 4 );
+        equation2.setScalar( 0 );
+        inputQuery.addEquation( equation2 );
+
+        Preprocessor preprocessor;
+        Query processed = *( preprocessor.preprocess( inputQuery, true ) );
+
+        // The first equation and x3 are gone, and so is x0, which is now unused
+        TS_ASSERT_EQUALS( processed.getEquations().size(), 1U );
+        TS_ASSERT_EQUALS( processed.getNumberOfVariables(), 3U );
+        TS_ASSERT( preprocessor.variableIsUnusedAndSymbolicallyFixed( 3 ) );
+        TS_ASSERT( !preprocessor.variableIsUnusedAndSymbolicallyFixed( 4 ) );
+
+        // x4 >= 1 is kept
+        TS_ASSERT_EQUALS( processed.getLowerBound( preprocessor.getNewIndex( 4 ) ), 1 );
+
+        // Postsolve
+        inputQuery.setSolutionValue( 0, 0.5 );
+        inputQuery.setSolutionValue( 1, 0.25 );
+        inputQuery.setSolutionValue( 2, 0.75 );
+        inputQuery.setSolutionValue( 3, 1000 );
+        inputQuery.setSolutionValue( 4, 1 );
+        TS_ASSERT_THROWS_NOTHING( preprocessor.setSolutionValuesOfEliminatedNeurons( inputQuery ) );
+        TS_ASSERT_EQUALS( inputQuery.getSolutionValue( 3 ), 2.75 );
+        TS_ASSERT_EQUALS( inputQuery.getSolutionValue( 4 ), 1 );
+
+        // The bounds of x3 follow from x3 = x0 + x1 + 2
+        TS_ASSERT_THROWS_NOTHING( preprocessor.setBoundsOfPresolvedVariables( inputQuery ) );
+        TS_ASSERT_EQUALS( inputQuery.getLowerBound( 3 ), 2 );
+        TS_ASSERT_EQUALS( inputQuery.getUpperBound( 3 ), 4 );
+    }
+
+    void test_presolve_doubleton_equation()
+    {
+        Options::get()->setBool( Options::DO_NOT_PRESOLVE_EQUATIONS, false );
+
+        Query inputQuery;
+
+        inputQuery.setNumberOfVariables( 5 );
+        for ( unsigned i = 0; i < 5; ++i )
+        {
+            inputQuery.setLowerBound( i, -10 );
+            inputQuery.setUpperBound( i, 10 );
+        }
+        inputQuery.setLowerBound( 2, 0 );
+        inputQuery.setUpperBound( 2, 4 );
+
+        // 2x2 - x3 = 2, i.e. x2 = 1 + 0.5x3
+        Equation equation1;
+        equation1.addAddend( 2, 2 );
+        equation1.addAddend( -1, 3 );
+        equation1.setScalar( 2 );
+        inputQuery.addEquation( equation1 );
+
+        // x0 + x1 - x2 = 0
+        Equation equation2;
+        equation2.addAddend( 1, 0 );
+        equation2.addAddend( 1, 1 );
+        equation2.addAddend( -1, 2 );
+        equation2.setScalar( 0 );
+        inputQuery.addEquation( equation2 );
+
+        // x1 = relu( x3 ), and x4 = relu( x0 )
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( 3, 1 ) );
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( 0, 4 ) );
+
+        Preprocessor preprocessor;
+        Query processed = *( preprocessor.preprocess( inputQuery, true ) );
+
+        // x2 was substituted by 1 + 0.5x3, and its bounds moved onto x3
+        TS_ASSERT( preprocessor.variableIsUnusedAndSymbolicallyFixed( 2 ) );
+        TS_ASSERT( !preprocessor.variableIsUnusedAndSymbolicallyFixed( 3 ) );
+
+        unsigned x0 = preprocessor.getNewIndex( 0 );
+        unsigned x1 = preprocessor.getNewIndex( 1 );
+        unsigned x3 = preprocessor.getNewIndex( 3 );
+        TS_ASSERT_EQUALS( processed.getLowerBound( x3 ), -2 );
+        TS_ASSERT_EQUALS( processed.getUpperBound( x3 ), 6 );
+
+        bool found = false;
+        for ( const auto &equation : processed.getEquations() )
+        {
+            // x0 + x1 - 0.5x3 = 1
+            if ( !equation.getParticipatingVariables().exists( x0 ) ||
+                 !equation.getParticipatingVariables().exists( x1 ) )
+                continue;
+
+            found = true;
+            TS_ASSERT_EQUALS( equation._addends.size(), 3U );
+            TS_ASSERT_EQUALS( equation._scalar, 1 );
+            for ( const auto &addend : equation._addends )
+            {
+                if ( addend._variable == x3 )
+                {
+                    TS_ASSERT_EQUALS( addend._coefficient, -0.5 );
+                }
+                else
+                {
+                    TS_ASSERT( addend._variable == x0 || addend._variable == x1 );
+                }
+            }
+        }
+        TS_ASSERT( found );
+
+        // Postsolve
+        for ( unsigned i = 0; i < 5; ++i )
+            inputQuery.setSolutionValue( i, 1000 );
+        inputQuery.setSolutionValue( 3, 3 );
+        TS_ASSERT_THROWS_NOTHING( preprocessor.setSolutionValuesOfEliminatedNeurons( inputQuery ) );
+        TS_ASSERT_EQUALS( inputQuery.getSolutionValue( 2 ), 2.5 );
+    }
+
+    void test_presolve_keeps_auxiliary_variables_reconstructible()
+    {
+        Options::get()->setBool( Options::DO_NOT_PRESOLVE_EQUATIONS, false );
+
+        Query inputQuery;
+
+        inputQuery.setNumberOfVariables( 2 );
+        inputQuery.setLowerBound( 0, -1 );
+        inputQuery.setUpperBound( 0, 1 );
+        inputQuery.setLowerBound( 1, -1 );
+        inputQuery.setUpperBound( 1, 1 );
+        inputQuery.markInputVariable( 0, 0 );
+        inputQuery.markOutputVariable( 1, 0 );
+
+        // x0 - x1 <= 5 always holds, so its slack variable and the equation are removed
+        Equation equation1( Equation::LE );
+        equation1.addAddend( 1, 0 );
+        equation1.addAddend( -1, 1 );
+        equation1.setScalar( 5 );
+        inputQuery.addEquation( equation1 );
+
+        // x0 + x1 <= 1 does not always hold, so it is kept
+        Equation equation2( Equation::LE );
+        equation2.addAddend( 1, 0 );
+        equation2.addAddend( 1, 1 );
+        equation2.setScalar( 1 );
+        inputQuery.addEquation( equation2 );
+
+        Preprocessor preprocessor;
+        Query processed = *( preprocessor.preprocess( inputQuery, true ) );
+
+        TS_ASSERT_EQUALS( processed.getEquations().size(), 1U );
+        TS_ASSERT_EQUALS( processed.getNumberOfVariables(), 3U );
+
+        inputQuery.setSolutionValue( 0, 0.5 );
+        inputQuery.setSolutionValue( 1, 0.5 );
+        TS_ASSERT_THROWS_NOTHING( preprocessor.setSolutionValuesOfEliminatedNeurons( inputQuery ) );
+        TS_ASSERT_EQUALS( inputQuery.getSolutionValue( 0 ), 0.5 );
+        TS_ASSERT_EQUALS( inputQuery.getSolutionValue( 1 ), 0.5 );
+    }
+
     void test_todo()
     {
         TS_TRACE( "In test_variable_elimination, test something about updated bounds and updated "
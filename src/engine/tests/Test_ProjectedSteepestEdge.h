@@ -211,6 +211,62 @@ public:
         TS_ASSERT( FloatUtils::areEqual( pse.getGamma( 2 ), 10.0 ) );
     }
 
+    void test_pooled_variable_selection()
+    {
+        MockTableau tableau;
+        tableau.setDimensions( 2, 7 );
+
+        ProjectedSteepestEdgeRule pse;
+
+        // Non basics are {x0, ..., x4}
+        for ( unsigned i = 0; i < 5; ++i )
+            tableau.nextNonBasicIndexToVariable[i] = i;
+
+        TS_ASSERT_THROWS_NOTHING( pse.initialize( tableau ) );
+
+        // All gammas are 1, so the scores are the squared costs
+        double costFunction[] = { -5.0, 3.0, -7.0, 7.0, 1.0 };
+        memcpy( tableau.nextCostFunction, costFunction, sizeof( costFunction ) );
+        tableau.mockCandidates = { 0, 1, 2, 3 };
+
+        // Ties are broken in favor of the lower index
+        Set<unsigned> excluded;
+        TS_ASSERT( pse.select( tableau, excluded ) );
+        TS_ASSERT_EQUALS( tableau.mockEnteringVariable, 2U );
+
+        // Further attempts of the same step choose from the pool
+        excluded.insert( 2 );
+        tableau.mockCandidates.clear();
+        TS_ASSERT( pse.select( tableau, excluded ) );
+        TS_ASSERT_EQUALS( tableau.mockEnteringVariable, 3U );
+
+        // In the next step, the kept candidates are re-priced
+        excluded.clear();
+        costFunction[0] = -1.0;
+        costFunction[1] = 4.0;
+        memcpy( tableau.nextCostFunction, costFunction, sizeof( costFunction ) );
+        tableau.mockCandidates = { 0, 1, 4 };
+
+        TS_ASSERT( pse.select( tableau, excluded ) );
+        TS_ASSERT_EQUALS( tableau.mockEnteringVariable, 1U );
+
+        excluded.insert( 1 );
+        TS_ASSERT( pse.select( tableau, excluded ) );
+        TS_ASSERT_EQUALS( tableau.mockEnteringVariable, 0U );
+
+        excluded.insert( 0 );
+        TS_ASSERT( pse.select( tableau, excluded ) );
+        TS_ASSERT_EQUALS( tableau.mockEnteringVariable, 4U );
+
+        excluded.insert( 4 );
+        TS_ASSERT( !pse.select( tableau, excluded ) );
+
+        // No eligible candidates
+        excluded.clear();
+        tableau.mockCandidates.clear();
+        TS_ASSERT( !pse.select( tableau, excluded ) );
+    }
+
     void test_todo()
     {
         TS_TRACE( "Move 'excluded' computation out to the Engine instead of repeating it in every "
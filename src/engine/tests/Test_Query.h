@@ -305,4 +305,175 @@ public:
         TS_ASSERT_EQUALS( output[0], result );
         delete inputQuery;
     }
+
+    void test_construct_nlr_from_equations_out_of_order()
+    {
+        // x6 = x4 + x5
+        // x3 = x0 - x1
+        // x2 = x0 + x1
+        // x5 = Relu(x3)
+        // x4 = Relu(x2)
+        Query *inputQuery = new Query;
+        inputQuery->setNumberOfVariables( 7 );
+        Equation eq1;
+        eq1.addAddend( 1, 4 );
+        eq1.addAddend( 1, 5 );
+        eq1.addAddend( -1, 6 );
+        inputQuery->addEquation( eq1 );
+        Equation eq2;
+        eq2.addAddend( 1, 0 );
+        eq2.addAddend( -1, 1 );
+        eq2.addAddend( -1, 3 );
+        inputQuery->addEquation( eq2 );
+        Equation eq3;
+        eq3.addAddend( 1, 0 );
+        eq3.addAddend( 1, 1 );
+        eq3.addAddend( -1, 2 );
+        inputQuery->addEquation( eq3 );
+        inputQuery->addPiecewiseLinearConstraint( new ReluConstraint( 3, 5 ) );
+        inputQuery->addPiecewiseLinearConstraint( new ReluConstraint( 2, 4 ) );
+        inputQuery->markInputVariable( 0, 0 );
+        inputQuery->markInputVariable( 1, 1 );
+
+        List<Equation> unhandledEquations;
+        Set<unsigned> varsInUnhandledConstraints;
+        TS_ASSERT( inputQuery->constructNetworkLevelReasoner( unhandledEquations,
+                                                              varsInUnhandledConstraints ) );
+        TS_ASSERT( unhandledEquations.empty() );
+        TS_ASSERT( varsInUnhandledConstraints.empty() );
+
+        // Neurons of a layer follow the order of the equations and constraints
+        NLR::NetworkLevelReasoner *nlr = inputQuery->getNetworkLevelReasoner();
+        TS_ASSERT_EQUALS( nlr->getNumberOfLayers(), 4U );
+        NLR::Layer *layer = nlr->getLayer( 1 );
+        TS_ASSERT_EQUALS( layer->getLayerType(), NLR::Layer::WEIGHTED_SUM );
+        TS_ASSERT_EQUALS( layer->neuronToVariable( 0 ), 3U );
+        TS_ASSERT_EQUALS( layer->neuronToVariable( 1 ), 2U );
+        layer = nlr->getLayer( 2 );
+        TS_ASSERT_EQUALS( layer->getLayerType(), NLR::Layer::RELU );
+        TS_ASSERT_EQUALS( layer->neuronToVariable( 0 ), 5U );
+        TS_ASSERT_EQUALS( layer->neuronToVariable( 1 ), 4U );
+        layer = nlr->getLayer( 3 );
+        TS_ASSERT_EQUALS( layer->getLayerType(), NLR::Layer::WEIGHTED_SUM );
+        TS_ASSERT_EQUALS( layer->neuronToVariable( 0 ), 6U );
+
+        double input[2] = { 2, -3 };
+        double output[1];
+        nlr->evaluate( input, output );
+        TS_ASSERT_EQUALS( output[0], 5.0 );
+        delete inputQuery;
+    }
+
+    void test_construct_deep_nlr()
+    {
+        /*
+          A chain of 50 weighted sum and ReLU pairs, whose equations are
+          listed from the output backwards:
+
+            x_{2i+1} = x_{2i} + 1
+            x_{2i+2} = Relu( x_{2i+1} )
+        */
+        unsigned depth = 50;
+        Query *inputQuery = new Query;
+        inputQuery->setNumberOfVariables( 2 * depth + 1 );
+        for ( int i = depth - 1; i >= 0; --i )
+        {
+            Equation equation;
+            equation.addAddend( 1, 2 * i );
+            equation.addAddend( -1, 2 * i + 1 );
+            equation.setScalar( -1 );
+            inputQuery->addEquation( equation );
+            inputQuery->addPiecewiseLinearConstraint( new ReluConstraint( 2 * i + 1, 2 * i + 2 ) );
+        }
+        inputQuery->markInputVariable( 0, 0 );
+        inputQuery->markOutputVariable( 2 * depth, 0 );
+
+        List<Equation> unhandledEquations;
+        Set<unsigned> varsInUnhandledConstraints;
+        TS_ASSERT( inputQuery->constructNetworkLevelReasoner( unhandledEquations,
+                                                              varsInUnhandledConstraints ) );
+        TS_ASSERT( unhandledEquations.empty() );
+        TS_ASSERT( varsInUnhandledConstraints.empty() );
+
+        NLR::NetworkLevelReasoner *nlr = inputQuery->getNetworkLevelReasoner();
+        TS_ASSERT_EQUALS( nlr->getNumberOfLayers(), 2 * depth + 1 );
+        for ( unsigned i = 1; i <= 2 * depth; ++i )
+        {
+            NLR::Layer *layer = nlr->getLayer( i );
+            TS_ASSERT_EQUALS( layer->getSize(), 1U );
+            TS_ASSERT_EQUALS( layer->neuronToVariable( 0 ), i );
+            TS_ASSERT_EQUALS( layer->getLayerType(),
+                              i % 2 ? NLR::Layer::WEIGHTED_SUM : NLR::Layer::RELU );
+        }
+
+        double input[1] = { -2 };
+        double output[1];
+        nlr->evaluate( input, output );
+        TS_ASSERT_EQUALS( output[0], depth - 1.0 );
+        delete inputQuery;
+    }
+
+    void test_adopt_prebuilt_nlr()
+    {
+        // x1 = 2x0 + 1
+        // x2 = Relu(x1)
+        // x2 - x0 <= 3, added after the NLR
+        Query *inputQuery = new Query;
+        inputQuery->setNumberOfVariables( 3 );
+        ReluConstraint *relu = new ReluConstraint( 1, 2 );
+        inputQuery->addPiecewiseLinearConstraint( relu );
+        inputQuery->markInputVariable( 0, 0 );
+        inputQuery->setLowerBound( 0, -1 );
+        inputQuery->setUpperBound( 0, 1 );
+
+        NLR::NetworkLevelReasoner *nlr = new NLR::NetworkLevelReasoner;
+        nlr->addLayer( 0, NLR::Layer::INPUT, 1 );
+        nlr->addLayer( 1, NLR::Layer::WEIGHTED_SUM, 1 );
+        nlr->addLayer( 2, NLR::Layer::RELU, 1 );
+        nlr->addLayerDependency( 0, 1 );
+        nlr->addLayerDependency( 1, 2 );
+        nlr->setWeight( 0, 0, 1, 0, 2 );
+        nlr->setBias( 1, 0, 1 );
+        nlr->addActivationSource( 1, 0, 2, 0 );
+        for ( unsigned i = 0; i < 3; ++i )
+            nlr->setNeuronVariable( NLR::NeuronIndex( i, 0 ), i );
+        nlr->addConstraintInTopologicalOrder( relu );
+        inputQuery->setPrebuiltNetworkLevelReasoner( nlr );
+
+        Equation property( Equation::LE );
+        property.addAddend( 1, 2 );
+        property.addAddend( -1, 0 );
+        property.setScalar( 3 );
+        inputQuery->addEquation( property );
+
+        // Copies carry the prebuilt NLR along
+        Query copy( *inputQuery );
+        TS_ASSERT( copy.hasPrebuiltNetworkLevelReasoner() );
+        TS_ASSERT_EQUALS( copy.getNetworkLevelReasoner()->getConstraintsInTopologicalOrder().size(),
+                          1U );
+
+        List<Equation> unhandledEquations;
+        Set<unsigned> varsInUnhandledConstraints;
+        TS_ASSERT( inputQuery->constructNetworkLevelReasoner( unhandledEquations,
+                                                              varsInUnhandledConstraints ) );
+        TS_ASSERT_EQUALS( inputQuery->getNetworkLevelReasoner(), nlr );
+        TS_ASSERT_EQUALS( unhandledEquations.size(), 1U );
+        TS_ASSERT_EQUALS( varsInUnhandledConstraints, Set<unsigned>( { 0, 2 } ) );
+        TS_ASSERT_EQUALS( nlr->getLayer( 0 )->getLb( 0 ), -1 );
+        TS_ASSERT_EQUALS( nlr->getLayer( 0 )->getUb( 0 ), 1 );
+
+        // The weighted sum layer is only now encoded
+        TS_ASSERT_EQUALS( inputQuery->getNumberOfEquations(), 1U );
+        inputQuery->encodePrebuiltNetworkLevelReasoner();
+        TS_ASSERT( !inputQuery->hasPrebuiltNetworkLevelReasoner() );
+        TS_ASSERT_EQUALS( inputQuery->getNumberOfEquations(), 2U );
+
+        Equation expected;
+        expected.addAddend( -1, 1 );
+        expected.addAddend( 2, 0 );
+        expected.setScalar( -1 );
+        TS_ASSERT_EQUALS( inputQuery->getEquations().back(), expected );
+
+        delete inputQuery;
+    }
 };
@@ -0,0 +1,172 @@
+/*********************                                                        */
+/*! \file Test_SubQuerySerializer.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "DnCCoordinator.h"
+#include "FloatUtils.h"
+#include "MarabouError.h"
+#include "SubQuerySerializer.h"
+
+#include <cxxtest/TestSuite.h>
+#include <string.h>
+
+class SubQuerySerializerTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+    }
+
+    void tearDown()
+    {
+    }
+
+    PiecewiseLinearCaseSplit createSplit( unsigned variable, double lowerBound, double upperBound )
+    {
+        PiecewiseLinearCaseSplit split;
+        split.storeBoundTightening( Tightening( variable, lowerBound, Tightening::LB ) );
+        split.storeBoundTightening( Tightening( variable, upperBound, Tightening::UB ) );
+        return split;
+    }
+
+    void freeSmtState( SmtState &smtState )
+    {
+        for ( auto &stackEntry : smtState._stack )
+            delete stackEntry;
+        smtState._stack.clear();
+    }
+
+    void test_double_round_trip()
+    {
+        double values[] = {
+            0, -0.0, 1.0 / 3, -1e-300, 123456789.123456789, FloatUtils::infinity(),
+            FloatUtils::negativeInfinity(),
+        };
+
+        for ( const auto &value : values )
+        {
+            double result =
+                SubQuerySerializer::deserializeDouble( SubQuerySerializer::serializeDouble( value ) );
+            TS_ASSERT_EQUALS( memcmp( &result, &value, sizeof( double ) ), 0 );
+        }
+    }
+
+    void test_subquery_round_trip()
+    {
+        SubQuery subQuery;
+        subQuery._queryId = "3-1";
+        subQuery._timeoutInSeconds = 10;
+        subQuery._depth = 2;
+
+        subQuery._split = std::unique_ptr<PiecewiseLinearCaseSplit>(
+            new PiecewiseLinearCaseSplit( createSplit( 1, -0.1, 1.0 / 7 ) ) );
+        Equation equation( Equation::GE );
+        equation.addAddend( 2.5, 0 );
+        equation.addAddend( -1.0 / 3, 4 );
+        equation.setScalar( 0.2 );
+        subQuery._split->addEquation( equation );
+
+        String serialized;
+        TS_ASSERT_THROWS_NOTHING( serialized = SubQuerySerializer::serializeSubQuery( subQuery ) );
+
+        SubQuery *result = NULL;
+        TS_ASSERT_THROWS_NOTHING( result = SubQuerySerializer::deserializeSubQuery( serialized ) );
+
+        TS_ASSERT_EQUALS( result->_queryId, "3-1" );
+        TS_ASSERT_EQUALS( result->_timeoutInSeconds, 10U );
+        TS_ASSERT_EQUALS( result->_depth, 2U );
+        TS_ASSERT( *result->_split == *subQuery._split );
+        TS_ASSERT( !result->_smtState );
+
+        delete result;
+    }
+
+    void test_root_subquery_with_smt_state()
+    {
+        SubQuery subQuery;
+        subQuery._queryId = "";
+        subQuery._timeoutInSeconds = 0;
+        subQuery._depth = 0;
+        subQuery._split = std::unique_ptr<PiecewiseLinearCaseSplit>( new PiecewiseLinearCaseSplit );
+
+        subQuery._smtState = std::unique_ptr<SmtState>( new SmtState );
+        subQuery._smtState->_stateId = 5;
+        subQuery._smtState->_impliedValidSplitsAtRoot.append( createSplit( 2, 0, 0 ) );
+
+        SmtStackEntry *stackEntry = new SmtStackEntry;
+        stackEntry->_engineState = NULL;
+        stackEntry->_activeSplit = createSplit( 3, 0, 1 );
+        stackEntry->_impliedValidSplits.append( createSplit( 4, 0, 2 ) );
+        stackEntry->_alternativeSplits.append( createSplit( 3, -1, 0 ) );
+        subQuery._smtState->_stack.append( stackEntry );
+
+        SubQuery *result = NULL;
+        TS_ASSERT_THROWS_NOTHING( result = SubQuerySerializer::deserializeSubQuery(
+                                      SubQuerySerializer::serializeSubQuery( subQuery ) ) );
+
+        TS_ASSERT_EQUALS( result->_queryId, "" );
+        TS_ASSERT( result->_split->getBoundTightenings().empty() );
+        TS_ASSERT( result->_smtState );
+        TS_ASSERT_EQUALS( result->_smtState->_stateId, 5U );
+        TS_ASSERT( result->_smtState->_impliedValidSplitsAtRoot ==
+                   subQuery._smtState->_impliedValidSplitsAtRoot );
+        TS_ASSERT_EQUALS( result->_smtState->_stack.size(), 1U );
+
+        SmtStackEntry *resultEntry = *result->_smtState->_stack.begin();
+        TS_ASSERT( resultEntry->_activeSplit == stackEntry->_activeSplit );
+        TS_ASSERT( resultEntry->_impliedValidSplits == stackEntry->_impliedValidSplits );
+        TS_ASSERT( resultEntry->_alternativeSplits == stackEntry->_alternativeSplits );
+        TS_ASSERT( !resultEntry->_engineState );
+
+        freeSmtState( *result->_smtState );
+        freeSmtState( *subQuery._smtState );
+        delete result;
+    }
+
+    void test_malformed_input()
+    {
+        TS_ASSERT_THROWS_EQUALS( SubQuerySerializer::deserializeSubQuery( "" ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::MALFORMED_SERIALIZED_OBJECT );
+
+        TS_ASSERT_THROWS_EQUALS( SubQuerySerializer::deserializeSubQuery( "subquery 1 0 0" ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::MALFORMED_SERIALIZED_OBJECT );
+
+        TS_ASSERT_THROWS_EQUALS(
+            SubQuerySerializer::deserializeSubQuery( "subquery id:1 0 0\nbounds 2\n0 l 0x0p+0\n" ),
+            const MarabouError &e,
+            e.getCode(),
+            MarabouError::MALFORMED_SERIALIZED_OBJECT );
+    }
+
+    void test_coordinator_messages()
+    {
+        String type;
+        String body;
+
+        DnCCoordinator::decomposeMessage(
+            DnCCoordinator::composeMessage( DnCCoordinator::SUBQUERY, "subquery id:1 0 0\n" ),
+            type,
+            body );
+        TS_ASSERT_EQUALS( type, DnCCoordinator::SUBQUERY );
+        TS_ASSERT_EQUALS( body, "subquery id:1 0 0\n" );
+
+        DnCCoordinator::decomposeMessage( DnCCoordinator::QUIT, type, body );
+        TS_ASSERT_EQUALS( type, DnCCoordinator::QUIT );
+        TS_ASSERT_EQUALS( body, "" );
+    }
+};
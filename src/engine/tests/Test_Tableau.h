@@ -396,6 +396,151 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void test_long_step_ratio_test()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+        Context context;
+        BoundManager boundManager( context );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( 7 ) );
+        TS_ASSERT( tableau = new Tableau( boundManager ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        tableau->toggleLongStepRatioTest( true );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 219 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 112 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 400 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->computeCostFunction() );
+
+        costFunctionManager.nextCostFunction = new double[4];
+        costFunctionManager.nextCostFunction[0] = -1;
+        costFunctionManager.nextCostFunction[1] = -1;
+        costFunctionManager.nextCostFunction[2] = -1;
+        costFunctionManager.nextCostFunction[3] = -1;
+
+        costFunctionManager.nextBasicCost[0] = -1;
+        costFunctionManager.nextBasicCost[1] = 0;
+        costFunctionManager.nextBasicCost[2] = +1;
+
+        tableau->setEnteringVariableIndex( 2u );
+        TS_ASSERT_EQUALS( tableau->getEnteringVariable(), 2u );
+
+        // Current basic values are: 217, 113, 406
+
+        double d1[] = { 1, 0.1, 2 };
+        // Var 6 becomes feasible after a step of 2, at which point the sum
+        // of infeasibilities stops decreasing: same as the regular test
+        TS_ASSERT_THROWS_NOTHING( tableau->pickLeavingVariable( d1 ) );
+        TS_ASSERT_EQUALS( tableau->getLeavingVariable(), 6u );
+        TS_ASSERT_EQUALS( tableau->getChangeRatio(), 2.0 );
+        TS_ASSERT_EQUALS( tableau->getNumBreakpointsPassed(), 0u );
+
+        double d2[] = { 1, 0, 0.5 };
+        // Var 6 becomes feasible after a step of 8, and then the sum still
+        // decreases at a rate of 0.5. Var 6 would hit its lower bound after
+        // a step of 12, but the entering variable hits its upper bound first
+        TS_ASSERT_THROWS_NOTHING( tableau->pickLeavingVariable( d2 ) );
+        TS_ASSERT_EQUALS( tableau->getLeavingVariable(), 2u );
+        TS_ASSERT_EQUALS( tableau->getChangeRatio(), 9.0 );
+        TS_ASSERT_EQUALS( tableau->getNumBreakpointsPassed(), 1u );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
+    void test_long_step_pivot_to_far_bound()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+        Context context;
+        BoundManager boundManager( context );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( 7 ) );
+        TS_ASSERT( tableau = new Tableau( boundManager ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        tableau->toggleLongStepRatioTest( true );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 219 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 100 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 400 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->computeCostFunction() );
+
+        costFunctionManager.nextCostFunction = new double[4];
+        costFunctionManager.nextCostFunction[0] = -1;
+        costFunctionManager.nextCostFunction[1] = -1;
+        costFunctionManager.nextCostFunction[2] = -4;
+        costFunctionManager.nextCostFunction[3] = -1;
+
+        costFunctionManager.nextBasicCost[0] = -1;
+        costFunctionManager.nextBasicCost[1] = 0;
+        costFunctionManager.nextBasicCost[2] = +1;
+
+        tableau->setEnteringVariableIndex( 2u );
+        TS_ASSERT_EQUALS( tableau->getEnteringVariable(), 2u );
+
+        /*
+          x3 increases, and the change column is [ 1, 1, 3 ]. x7 = 406
+          becomes feasible after a step of 4/3, after which the sum of
+          infeasibilities still decreases at a rate of 4 - 3 = 1. It then
+          hits its lower bound after a step of 2, before x6 does (13) and
+          before x3 hits its upper bound (9).
+        */
+        TS_ASSERT_THROWS_NOTHING( tableau->computeChangeColumn() );
+        TS_ASSERT_THROWS_NOTHING( tableau->pickLeavingVariable() );
+        TS_ASSERT_EQUALS( tableau->getLeavingVariable(), 6u );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getChangeRatio(), 2.0 ) );
+        TS_ASSERT_EQUALS( tableau->getNumBreakpointsPassed(), 1u );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->computePivotRow() );
+        TS_ASSERT_THROWS_NOTHING( tableau->performPivot() );
+
+        // x7 leaves at its lower bound, having passed its upper bound
+        TS_ASSERT( !tableau->isBasic( 6u ) );
+        TS_ASSERT( tableau->isBasic( 2u ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 6u ), 400.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 2u ), 3.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 5u ), 111.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 4u ), 215.0 ) );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
     void test_perform_pivot_nonbasic_goes_to_opposite_bound()
     {
         Tableau *tableau = NULL;
@@ -1250,6 +1395,84 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void test_add_variable()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+        Context context;
+        BoundManager boundManager( context );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( 7 ) );
+        TS_ASSERT( tableau = new Tableau( boundManager ) );
+        TS_ASSERT_THROWS_NOTHING( boundManager.registerTableau( tableau ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 219 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 112 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 400 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+        tableau->computeAssignment();
+
+        double basicValues[3] = { tableau->getValue( 4 ),
+                                  tableau->getValue( 5 ),
+                                  tableau->getValue( 6 ) };
+
+        /*
+          The new variable x8 gets a zero column: it is non-basic, at
+          its lower bound, and does not affect the basic assignment.
+        */
+        unsigned newVariable = 0;
+        TS_ASSERT_THROWS_NOTHING( newVariable = tableau->addVariable( -3, 5 ) );
+        TS_ASSERT_EQUALS( newVariable, 7U );
+        TS_ASSERT_EQUALS( tableau->getN(), 8U );
+        TS_ASSERT_EQUALS( tableau->getM(), 3U );
+        TS_ASSERT( !tableau->isBasic( 7u ) );
+        TS_ASSERT_EQUALS( tableau->getLowerBound( 7 ), -3.0 );
+        TS_ASSERT_EQUALS( tableau->getUpperBound( 7 ), 5.0 );
+        TS_ASSERT_EQUALS( tableau->getValue( 7 ), -3.0 );
+
+        tableau->computeAssignment();
+        TS_ASSERT_EQUALS( tableau->getValue( 4 ), basicValues[0] );
+        TS_ASSERT_EQUALS( tableau->getValue( 5 ), basicValues[1] );
+        TS_ASSERT_EQUALS( tableau->getValue( 6 ), basicValues[2] );
+
+        /*
+          The new variable can participate in a new equation:
+
+             x1 + 2x8 + x9 = 4
+
+          Where x9 is a new basic variable
+        */
+        Equation equation;
+        equation.addAddend( 1, 0 );
+        equation.addAddend( 2, 7 );
+        equation.setScalar( 4 );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->addEquation( equation ) );
+        TS_ASSERT_EQUALS( tableau->getN(), 9U );
+        TS_ASSERT( tableau->isBasic( 8u ) );
+
+        tableau->computeAssignment();
+        TS_ASSERT_EQUALS( tableau->getValue( 8 ), 9.0 ); // 4 - 1 - 2 * (-3)
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
     void test_tighten_bounds()
     {
         Tableau *tableau = NULL;
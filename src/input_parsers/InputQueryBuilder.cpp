@@ -68,13 +68,22 @@ void InputQueryBuilder::setUpperBound( Variable var, float value )
 
 void InputQueryBuilder::addRelu( Variable inputVar, Variable outputVar )
 {
-    _reluList.append( new ReluConstraint( inputVar, outputVar ) );
+    ReluConstraint *relu = new ReluConstraint( inputVar, outputVar );
+    _reluList.append( relu );
     setLowerBound( outputVar, 0.0f );
+    addActivationSource( inputVar, outputVar, NLR::Layer::RELU, relu );
 }
 
 void InputQueryBuilder::addLeakyRelu( Variable inputVar, Variable outputVar, float alpha )
 {
-    _leakyReluList.append( new LeakyReluConstraint( inputVar, outputVar, alpha ) );
+    LeakyReluConstraint *leakyRelu = new LeakyReluConstraint( inputVar, outputVar, alpha );
+    _leakyReluList.append( leakyRelu );
+
+    unsigned neuron;
+    LayerDescription *layer = getNeuronLayer( outputVar, NLR::Layer::LEAKY_RELU, neuron );
+    if ( layer )
+        layer->_alpha = alpha;
+    addActivationSource( inputVar, outputVar, NLR::Layer::LEAKY_RELU, leakyRelu );
 }
 
 void InputQueryBuilder::addSigmoid( Variable inputVar, Variable outputVar )
@@ -82,6 +91,7 @@ void InputQueryBuilder::addSigmoid( Variable inputVar, Variable outputVar )
     _sigmoidList.append( new SigmoidConstraint( inputVar, outputVar ) );
     setLowerBound( outputVar, 0.0 );
     setUpperBound( outputVar, 1.0 );
+    addActivationSource( inputVar, outputVar, NLR::Layer::SIGMOID, NULL );
 }
 
 void InputQueryBuilder::addTanh( Variable inputVar, Variable outputVar )
@@ -110,23 +120,259 @@ void InputQueryBuilder::addTanh( Variable inputVar, Variable outputVar )
 
 void InputQueryBuilder::addMaxConstraint( Variable var, Set<Variable> elements )
 {
-    _maxList.append( new MaxConstraint( var, elements ) );
+    MaxConstraint *max = new MaxConstraint( var, elements );
+    _maxList.append( max );
+
+    unsigned neuron;
+    LayerDescription *layer = getNeuronLayer( var, NLR::Layer::MAX, neuron );
+    if ( layer )
+    {
+        for ( const auto &element : elements )
+            layer->_connections.append( Connection{ element, neuron, 0 } );
+        layer->_constraints.append( max );
+    }
 }
 
 void InputQueryBuilder::addSignConstraint( Variable inputVar, Variable outputVar )
 {
-    _signList.append( new SignConstraint( inputVar, outputVar ) );
+    SignConstraint *sign = new SignConstraint( inputVar, outputVar );
+    _signList.append( sign );
+    addActivationSource( inputVar, outputVar, NLR::Layer::SIGN, sign );
 }
 
 void InputQueryBuilder::addAbsConstraint( Variable inputVar, Variable outputVar )
 {
-    _absList.append( new AbsoluteValueConstraint( inputVar, outputVar ) );
+    AbsoluteValueConstraint *abs = new AbsoluteValueConstraint( inputVar, outputVar );
+    _absList.append( abs );
+    addActivationSource( inputVar, outputVar, NLR::Layer::ABSOLUTE_VALUE, abs );
+}
+
+void InputQueryBuilder::addLayer( NLR::Layer::Type type, const Vector<Variable> &variables )
+{
+    LayerDescription layer;
+    layer._type = type;
+    layer._variables = variables;
+    layer._alpha = 0;
+    if ( type == NLR::Layer::WEIGHTED_SUM )
+        layer._biases = Vector<double>( variables.size(), 0.0 );
+
+    unsigned layerIndex = _layers.size() + 1;
+    for ( unsigned i = 0; i < variables.size(); ++i )
+    {
+        ASSERT( !_variableToNeuron.exists( variables[i] ) );
+        _variableToNeuron[variables[i]] = NLR::NeuronIndex( layerIndex, i );
+    }
+
+    _layers.append( layer );
+}
+
+void InputQueryBuilder::setWeight( Variable sourceVar, Variable outputVar, double weight )
+{
+    unsigned neuron;
+    LayerDescription *layer = getNeuronLayer( outputVar, NLR::Layer::WEIGHTED_SUM, neuron );
+    if ( !layer )
+        throw InputParserError( InputParserError::UNEXPECTED_INPUT,
+                                Stringf( "Variable %u is not a weighted sum neuron", outputVar )
+                                    .ascii() );
+
+    if ( !FloatUtils::isZero( weight ) )
+        layer->_connections.append( Connection{ sourceVar, neuron, weight } );
+}
+
+void InputQueryBuilder::setBias( Variable outputVar, double bias )
+{
+    unsigned neuron;
+    LayerDescription *layer = getNeuronLayer( outputVar, NLR::Layer::WEIGHTED_SUM, neuron );
+    if ( !layer )
+        throw InputParserError( InputParserError::UNEXPECTED_INPUT,
+                                Stringf( "Variable %u is not a weighted sum neuron", outputVar )
+                                    .ascii() );
+
+    layer->_biases[neuron] = bias;
+}
+
+bool InputQueryBuilder::isWeightedSumNeuron( Variable var ) const
+{
+    return _variableToNeuron.exists( var ) &&
+           _layers[_variableToNeuron.at( var )._layer - 1]._type == NLR::Layer::WEIGHTED_SUM;
+}
+
+double InputQueryBuilder::getBias( Variable outputVar ) const
+{
+    ASSERT( isWeightedSumNeuron( outputVar ) );
+    const NLR::NeuronIndex &index = _variableToNeuron.at( outputVar );
+    return _layers[index._layer - 1]._biases[index._neuron];
+}
+
+void InputQueryBuilder::addTanhLayer( const Vector<Variable> &inputVars,
+                                      const Vector<Variable> &outputVars )
+{
+    ASSERT( inputVars.size() == outputVars.size() );
+
+    // Uses the identity `tanh(x) = 2 * sigmoid(2x) - 1`, as in addTanh
+    Vector<Variable> affineVars;
+    Vector<Variable> sigmoidVars;
+    for ( unsigned i = 0; i < inputVars.size(); ++i )
+    {
+        affineVars.append( getNewVariable() );
+        sigmoidVars.append( getNewVariable() );
+    }
+
+    addLayer( NLR::Layer::WEIGHTED_SUM, affineVars );
+    for ( unsigned i = 0; i < inputVars.size(); ++i )
+        setWeight( inputVars[i], affineVars[i], 2.0 );
+
+    addLayer( NLR::Layer::SIGMOID, sigmoidVars );
+    for ( unsigned i = 0; i < inputVars.size(); ++i )
+        addSigmoid( affineVars[i], sigmoidVars[i] );
+
+    addLayer( NLR::Layer::WEIGHTED_SUM, outputVars );
+    for ( unsigned i = 0; i < outputVars.size(); ++i )
+    {
+        setWeight( sigmoidVars[i], outputVars[i], 2.0 );
+        setBias( outputVars[i], -1.0 );
+        setLowerBound( outputVars[i], -1.0 );
+        setUpperBound( outputVars[i], 1.0 );
+    }
+}
+
+InputQueryBuilder::LayerDescription *
+InputQueryBuilder::getNeuronLayer( Variable var, NLR::Layer::Type type, unsigned &neuron )
+{
+    if ( !_variableToNeuron.exists( var ) )
+        return NULL;
+
+    const NLR::NeuronIndex &index = _variableToNeuron[var];
+    LayerDescription &layer = _layers[index._layer - 1];
+    if ( layer._type != type )
+        return NULL;
+
+    neuron = index._neuron;
+    return &layer;
+}
+
+void InputQueryBuilder::addActivationSource( Variable inputVar,
+                                             Variable outputVar,
+                                             NLR::Layer::Type type,
+                                             PiecewiseLinearConstraint *constraint )
+{
+    unsigned neuron;
+    LayerDescription *layer = getNeuronLayer( outputVar, type, neuron );
+    if ( !layer )
+        return;
+
+    layer->_connections.append( Connection{ inputVar, neuron, 0 } );
+    if ( constraint )
+        layer->_constraints.append( constraint );
+}
+
+NLR::NetworkLevelReasoner *InputQueryBuilder::constructNetworkLevelReasoner()
+{
+    if ( _layers.empty() || _inputVars.empty() )
+        return NULL;
+
+    Map<Variable, NLR::NeuronIndex> variableToNeuron = _variableToNeuron;
+    unsigned index = 0;
+    for ( const auto &inputVar : _inputVars )
+        variableToNeuron[inputVar] = NLR::NeuronIndex( 0, index++ );
+
+    // Every neuron of an activation layer needs a source, and every
+    // connection needs to come from a neuron of a preceding layer
+    for ( unsigned i = 0; i < _layers.size(); ++i )
+    {
+        Set<unsigned> neuronsWithSources;
+        for ( const auto &connection : _layers[i]._connections )
+        {
+            if ( !variableToNeuron.exists( connection._source ) ||
+                 variableToNeuron[connection._source]._layer > i )
+                return NULL;
+            neuronsWithSources.insert( connection._neuron );
+        }
+
+        if ( _layers[i]._type != NLR::Layer::WEIGHTED_SUM &&
+             neuronsWithSources.size() != _layers[i]._variables.size() )
+            return NULL;
+    }
+
+    NLR::NetworkLevelReasoner *nlr = new NLR::NetworkLevelReasoner;
+
+    nlr->addLayer( 0, NLR::Layer::INPUT, _inputVars.size() );
+    index = 0;
+    for ( const auto &inputVar : _inputVars )
+        nlr->setNeuronVariable( NLR::NeuronIndex( 0, index++ ), inputVar );
+
+    for ( unsigned i = 0; i < _layers.size(); ++i )
+    {
+        const LayerDescription &description = _layers[i];
+        unsigned layerIndex = i + 1;
+
+        nlr->addLayer( layerIndex, description._type, description._variables.size() );
+        NLR::Layer *layer = nlr->getLayer( layerIndex );
+
+        for ( unsigned j = 0; j < description._variables.size(); ++j )
+            nlr->setNeuronVariable( NLR::NeuronIndex( layerIndex, j ), description._variables[j] );
+
+        if ( description._type == NLR::Layer::WEIGHTED_SUM )
+        {
+            for ( unsigned j = 0; j < description._variables.size(); ++j )
+                nlr->setBias( layerIndex, j, description._biases[j] );
+        }
+        else if ( description._type == NLR::Layer::LEAKY_RELU )
+            layer->setAlpha( description._alpha );
+
+        for ( const auto &connection : description._connections )
+        {
+            const NLR::NeuronIndex &source = variableToNeuron[connection._source];
+            nlr->addLayerDependency( source._layer, layerIndex );
+
+            if ( description._type == NLR::Layer::WEIGHTED_SUM )
+            {
+                // A source may appear more than once, e.g. in x + x
+                double weight = layer->getWeight( source._layer, source._neuron, connection._neuron );
+                nlr->setWeight( source._layer,
+                                source._neuron,
+                                layerIndex,
+                                connection._neuron,
+                                weight + connection._weight );
+            }
+            else
+                nlr->addActivationSource(
+                    source._layer, source._neuron, layerIndex, connection._neuron );
+        }
+
+        for ( const auto &constraint : description._constraints )
+            nlr->addConstraintInTopologicalOrder( constraint );
+    }
+
+    return nlr;
+}
+
+void InputQueryBuilder::addWeightedSumLayersAsEquations( IQuery &query ) const
+{
+    for ( const auto &layer : _layers )
+    {
+        if ( layer._type != NLR::Layer::WEIGHTED_SUM )
+            continue;
+
+        Vector<Equation> equations( layer._variables.size() );
+        for ( const auto &connection : layer._connections )
+            equations[connection._neuron].addAddend( connection._weight, connection._source );
+
+        for ( unsigned i = 0; i < layer._variables.size(); ++i )
+        {
+            equations[i].addAddend( -1, layer._variables[i] );
+            equations[i].setScalar( -layer._biases[i] );
+            query.addEquation( equations[i] );
+        }
+    }
 }
 
 void InputQueryBuilder::generateQuery( IQuery &query )
 {
     query.setNumberOfVariables( _numVars );
 
+    NLR::NetworkLevelReasoner *nlr = constructNetworkLevelReasoner();
+
     int i = 0;
     for ( Variable inputVar : _inputVars )
     {
@@ -225,20 +471,15 @@ void InputQueryBuilder::generateQuery( IQuery &query )
         ASSERT( upper.first < _numVars );
         query.setUpperBound( upper.first, upper.second );
     }
-}
 
-Equation *InputQueryBuilder::findEquationWithOutputVariable( Variable variable )
-{
-    for ( Equation &equation : _equationList )
-    {
-        Equation::Addend outputAddend = equation._addends.back();
-        if ( variable == outputAddend._variable )
-        {
-            ASSERT( outputAddend._coefficient == -1 );
-            return &equation;
-        }
-    }
-    return NULL;
+    // The weighted sum layers are only encoded as equations if the
+    // network could not be laid out as a network level reasoner
+    if ( nlr )
+        query.setPrebuiltNetworkLevelReasoner( nlr );
+    else
+        addWeightedSumLayersAsEquations( query );
+    _layers.clear();
+    _variableToNeuron.clear();
 }
 
 InputQueryBuilder::~InputQueryBuilder()
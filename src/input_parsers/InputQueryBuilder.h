@@ -26,6 +26,7 @@
 #include "List.h"
 #include "Map.h"
 #include "MaxConstraint.h"
+#include "NetworkLevelReasoner.h"
 #include "NonlinearConstraint.h"
 #include "PiecewiseLinearConstraint.h"
 #include "ReluConstraint.h"
@@ -54,6 +55,59 @@ private:
     Map<Variable, float> _lowerBounds;
     Map<Variable, float> _upperBounds;
 
+    /*
+      The layers of the network, in the order in which they were added.
+      The connections of a weighted sum layer are its weights, and those
+      of an activation layer are the sources of its neurons (their
+      weight is unused). Connections refer to source variables, so that
+      the network level reasoner can be assembled once all the input
+      variables are known.
+    */
+    struct Connection
+    {
+        Variable _source;
+        unsigned _neuron;
+        double _weight;
+    };
+
+    struct LayerDescription
+    {
+        NLR::Layer::Type _type;
+        Vector<Variable> _variables;
+        Vector<double> _biases;
+        Vector<Connection> _connections;
+        double _alpha;
+        List<PiecewiseLinearConstraint *> _constraints;
+    };
+
+    Vector<LayerDescription> _layers;
+
+    /*
+      Map each neuron variable to its index in the network level
+      reasoner. Layer 0 is reserved for the input variables, so the
+      i'th layer added has index i + 1.
+    */
+    Map<Variable, NLR::NeuronIndex> _variableToNeuron;
+
+    /*
+      If the variable is a neuron of a layer of the given type, return
+      that layer and store the neuron's index. Otherwise return NULL.
+    */
+    LayerDescription *getNeuronLayer( Variable var, NLR::Layer::Type type, unsigned &neuron );
+
+    void addActivationSource( Variable inputVar,
+                              Variable outputVar,
+                              NLR::Layer::Type type,
+                              PiecewiseLinearConstraint *constraint );
+
+    /*
+      Assemble the network level reasoner from the layers. Returns NULL if
+      some layer reads from a variable that is not a neuron, in which case
+      the weighted sum layers are encoded as equations instead.
+    */
+    NLR::NetworkLevelReasoner *constructNetworkLevelReasoner();
+    void addWeightedSumLayersAsEquations( IQuery &query ) const;
+
 public:
     InputQueryBuilder();
 
@@ -72,9 +126,29 @@ public:
     void addMaxConstraint( Variable maxVar, Set<Variable> elements );
     void addAbsConstraint( Variable var1, Variable var2 );
 
-    void generateQuery( IQuery &query );
+    /*
+      Lay out the network directly, layer by layer, instead of through
+      equations. addLayer adds a layer whose neurons are the given
+      variables, in order. The neurons of a weighted sum layer are then
+      defined through setWeight and setBias, and those of an activation
+      layer by the constraint methods above (addRelu etc.) that have
+      them as outputs. A network level reasoner is then built directly
+      from the layers by generateQuery, and the tableau equations of its
+      weighted sum layers are only generated during preprocessing.
+    */
+    void addLayer( NLR::Layer::Type type, const Vector<Variable> &variables );
+    void setWeight( Variable sourceVar, Variable outputVar, double weight );
+    void setBias( Variable outputVar, double bias );
+    bool isWeightedSumNeuron( Variable var ) const;
+    double getBias( Variable outputVar ) const;
 
-    Equation *findEquationWithOutputVariable( Variable variable );
+    /*
+      Add the layers of tanh(x) = 2 * sigmoid(2x) - 1 over the given
+      variables
+    */
+    void addTanhLayer( const Vector<Variable> &inputVars, const Vector<Variable> &outputVars );
+
+    void generateQuery( IQuery &query );
     virtual ~InputQueryBuilder();
 };
 
@@ -1361,6 +1361,7 @@ void OnnxParser::batchNormEquations( onnx::NodeProto &node, bool makeEquations )
     ASSERT( inputVars.size() == tensorSize( inputShape ) );
     ASSERT( outputVars.size() == tensorSize( outputShape ) );
 
+    _query.addLayer( NLR::Layer::WEIGHTED_SUM, outputVars );
     for ( unsigned int i = 0; i < inputVars.size(); i++ )
     {
         unsigned int channel = ( i % batchLength ) / channelLength;
@@ -1369,11 +1370,8 @@ void OnnxParser::batchNormEquations( onnx::NodeProto &node, bool makeEquations )
         double inputMean = inputMeans[channel];
         double inputVariance = inputVariances[channel];
 
-        Equation e = Equation();
-        e.addAddend( -1, outputVars[i] );
-        e.addAddend( 1 / sqrt( inputVariance + epsilon ) * scale, inputVars[i] );
-        e.setScalar( inputMean / sqrt( inputVariance + epsilon ) * scale - bias );
-        _query.addEquation( e );
+        _query.setWeight( inputVars[i], outputVars[i], 1 / sqrt( inputVariance + epsilon ) * scale );
+        _query.setBias( outputVars[i], bias - inputMean / sqrt( inputVariance + epsilon ) * scale );
     }
 }
 
@@ -1489,6 +1487,7 @@ void OnnxParser::maxPoolEquations( onnx::NodeProto &node, [[maybe_unused]] bool
     // Make equations
     Vector<Variable> inputVars = _varMap[inputNodeName];
     Vector<Variable> outputVars = makeNodeVariables( outputNodeName, false );
+    _query.addLayer( NLR::Layer::MAX, outputVars );
     for ( TensorIndex i = 0; i < outputShape[widthIndex]; i++ )
     {
         for ( TensorIndex j = 0; j < outputShape[heightIndex]; j++ )
@@ -1656,7 +1655,8 @@ void OnnxParser::convEquations( onnx::NodeProto &node, [[maybe_unused]] bool mak
         }
     }
 
-    // There is one equation for every output variable
+    // There is one weighted sum neuron for every output variable
+    _query.addLayer( NLR::Layer::WEIGHTED_SUM, outputVars );
     for ( TensorIndex i = 0; i < outWidth; i++ )
     {
         for ( TensorIndex j = 0; j < outHeight; j++ )
@@ -1664,9 +1664,10 @@ void OnnxParser::convEquations( onnx::NodeProto &node, [[maybe_unused]] bool mak
             for ( TensorIndex k = 0; k < outChannels; k++ ) // Out_channel corresponds to filter
                                                             // number
             {
-                Equation e = Equation();
+                TensorIndices outputVarIndices = { 0, k, i, j };
+                Variable outputVar = tensorLookup( outputVars, outputShape, outputVarIndices );
 
-                // The equation convolves the filter with the specified input region
+                // The neuron convolves the filter with the specified input region
                 // Iterate over the filter
                 for ( TensorIndex di = 0; di < filterWidth; di++ )
                 {
@@ -1685,18 +1686,13 @@ void OnnxParser::convEquations( onnx::NodeProto &node, [[maybe_unused]] bool mak
                                     tensorLookup( inputVars, inputShape, inputVarIndices );
                                 TensorIndices weightIndices = { k, dk, di, dj };
                                 double weight = tensorLookup( filter, filterShape, weightIndices );
-                                e.addAddend( weight, inputVar );
+                                _query.setWeight( inputVar, outputVar, weight );
                             }
                         }
                     }
                 }
 
-                // Add output variable
-                TensorIndices outputVarIndices = { 0, k, i, j };
-                Variable outputVar = tensorLookup( outputVars, outputShape, outputVarIndices );
-                e.addAddend( -1, outputVar );
-                e.setScalar( -biases[k] );
-                _query.addEquation( e );
+                _query.setBias( outputVar, biases[k] );
             }
         }
     }
@@ -1765,27 +1761,23 @@ void OnnxParser::gemmEquations( onnx::NodeProto &node, bool makeEquations )
     // Create new variables
     Vector<Variable> outputVariables = makeNodeVariables( outputNodeName, false );
 
-    // Generate equations
+    // Generate the weighted sum layer
+    _query.addLayer( NLR::Layer::WEIGHTED_SUM, outputVariables );
     for ( TensorIndex i = 0; i < finalInput1Shape[0]; i++ )
     {
         for ( TensorIndex j = 0; j < finalInput2Shape[1]; j++ )
         {
-            Equation e = Equation();
+            Variable outputVariable = tensorLookup( outputVariables, outputShape, { i, j } );
             for ( TensorIndex k = 0; k < finalInput1Shape[1]; k++ )
             {
                 double coefficient = alpha * tensorLookup( matrix, finalInput2Shape, { k, j } );
                 Variable inputVariable = tensorLookup( inputVariables, finalInput1Shape, { i, k } );
-                e.addAddend( coefficient, inputVariable );
+                _query.setWeight( inputVariable, outputVariable, coefficient );
             }
             // Set the bias
             TensorIndices biasIndices = broadcastIndex( biasShape, outputShape, { i, j } );
             double bias = beta * tensorLookup( biases, biasShape, biasIndices );
-            e.setScalar( -bias );
-
-            // Put output variable as the last addend
-            Variable outputVariable = tensorLookup( outputVariables, outputShape, { i, j } );
-            e.addAddend( -1, outputVariable );
-            _query.addEquation( e );
+            _query.setBias( outputVariable, bias );
         }
     }
 }
@@ -1812,6 +1804,7 @@ void OnnxParser::reluEquations( onnx::NodeProto &node, bool makeEquations )
     ASSERT( inputVars.size() == outputVars.size() );
 
     // Generate equations
+    _query.addLayer( NLR::Layer::RELU, outputVars );
     for ( PackedTensorIndices i = 0; i < inputVars.size(); i++ )
     {
         int inputVar = inputVars[i];
@@ -1842,6 +1835,7 @@ void OnnxParser::signEquations( onnx::NodeProto &node, bool makeEquations )
     ASSERT( inputVars.size() == outputVars.size() );
 
     // Generate equations
+    _query.addLayer( NLR::Layer::SIGN, outputVars );
     for ( PackedTensorIndices i = 0; i < inputVars.size(); i++ )
     {
         int inputVar = inputVars[i];
@@ -1876,6 +1870,7 @@ void OnnxParser::leakyReluEquations( onnx::NodeProto &node, bool makeEquations )
     ASSERT( inputVars.size() == outputVars.size() );
 
     // Generate equations
+    _query.addLayer( NLR::Layer::LEAKY_RELU, outputVars );
     for ( PackedTensorIndices i = 0; i < inputVars.size(); i++ )
     {
         _query.addLeakyRelu( inputVars[i], outputVars[i], alpha );
@@ -1937,24 +1932,21 @@ void OnnxParser::scaleAndAddEquations( onnx::NodeProto &node,
             throw MarabouError( MarabouError::ONNX_PARSER_ERROR, errorMessage.ascii() );
         }
 
+        _query.addLayer( NLR::Layer::WEIGHTED_SUM, outputVariables );
         for ( PackedTensorIndices i = 0; i < input1Variables.size(); i++ )
         {
-            Equation e = Equation();
-            e.addAddend( coefficient1, input1Variables[i] );
-            e.addAddend( coefficient2, input2Variables[i] );
-            e.addAddend( -1, outputVariables[i] );
-            e.setScalar( 0.0 );
-            _query.addEquation( e );
+            _query.setWeight( input1Variables[i], outputVariables[i], coefficient1 );
+            _query.setWeight( input2Variables[i], outputVariables[i], coefficient2 );
         }
         return;
     }
 
     // Otherwise, we are adding constants to variables.
-    // We don't need new equations or new variables if the input variable is
-    // the output of a linear equation. Instead, we can just edit the scalar
-    // term of the existing linear equation. However, if the input variables
-    // are not outputs of linear equations (input variables or outputs of
-    // activation functions) then we will need new equations.
+    // We don't need a new layer or new variables if the input variables are
+    // neurons of a weighted sum layer, and are not negated. Instead, we can
+    // just edit the biases of the existing layer. However, if the input
+    // variables are not weighted sum neurons (input variables or outputs of
+    // activation functions) then we will need a new weighted sum layer.
     String constantName = input1IsConstant ? input1Name : input2Name;
     String variableName = input1IsConstant ? input2Name : input1Name;
     TensorShape inputConstantsShape = input1IsConstant ? input1Shape : input2Shape;
@@ -1964,9 +1956,24 @@ void OnnxParser::scaleAndAddEquations( onnx::NodeProto &node,
     double constantCoefficient = input1IsConstant ? coefficient1 : coefficient2;
     double variableCoefficient = input1IsConstant ? coefficient2 : coefficient1;
 
-    // Adjust equations to incorporate the constant addition
-    unsigned int numberOfEquationsChanged = 0;
     unsigned int numberOfOutputVariables = tensorSize( outputShape );
+    bool adjustBiases =
+        variableCoefficient == 1 && inputVariables.size() == numberOfOutputVariables;
+    for ( const auto &inputVariable : inputVariables )
+    {
+        if ( !_query.isWeightedSumNeuron( inputVariable ) )
+            adjustBiases = false;
+    }
+
+    Vector<Variable> outputVariables;
+    if ( adjustBiases )
+        _varMap[outputName] = inputVariables;
+    else
+    {
+        outputVariables = makeNodeVariables( outputName, false );
+        _query.addLayer( NLR::Layer::WEIGHTED_SUM, outputVariables );
+    }
+
     for ( PackedTensorIndices i = 0; i < numberOfOutputVariables; i++ )
     {
         TensorIndices outputIndices = unpackIndex( outputShape, i );
@@ -1976,42 +1983,20 @@ void OnnxParser::scaleAndAddEquations( onnx::NodeProto &node,
         Variable inputVariable =
             tensorLookup( inputVariables, inputVariablesShape, inputVariableIndices );
 
-        Equation *equation = _query.findEquationWithOutputVariable( inputVariable );
-        if ( equation )
-        {
-            TensorIndices inputConstantIndices =
-                broadcastIndex( inputConstantsShape, outputShape, outputIndices );
-            double inputConstant =
-                tensorLookup( inputConstants, inputConstantsShape, inputConstantIndices );
-
-            double currentVariableCoefficient = equation->getCoefficient( inputVariable );
-            equation->setCoefficient( inputVariable,
-                                      variableCoefficient * currentVariableCoefficient );
-            equation->setScalar( equation->_scalar - constantCoefficient * inputConstant );
+        TensorIndices inputConstantIndices =
+            broadcastIndex( inputConstantsShape, outputShape, outputIndices );
+        double inputConstant =
+            tensorLookup( inputConstants, inputConstantsShape, inputConstantIndices );
 
-            numberOfEquationsChanged += 1;
+        if ( adjustBiases )
+        {
+            _query.setBias( inputVariable,
+                            _query.getBias( inputVariable ) + constantCoefficient * inputConstant );
         }
-    }
-
-    if ( numberOfEquationsChanged == inputVariables.size() )
-    {
-        // If we changed one equation for every input variable, then
-        // we don't need any new equations
-        _varMap[outputName] = inputVariables;
-    }
-    else
-    {
-        // Otherwise, assert no equations were changed,
-        // and we need to create new equations
-        ASSERT( numberOfEquationsChanged == 0 );
-        Vector<Variable> outputVariables = makeNodeVariables( outputName, false );
-        for ( PackedTensorIndices i = 0; i < outputVariables.size(); i++ )
+        else
         {
-            Equation e = Equation();
-            e.addAddend( variableCoefficient, inputVariables[i] );
-            e.addAddend( -1, outputVariables[i] );
-            e.setScalar( -constantCoefficient * inputConstants[i] );
-            _query.addEquation( e );
+            _query.setWeight( inputVariable, outputVariables[i], variableCoefficient );
+            _query.setBias( outputVariables[i], constantCoefficient * inputConstant );
         }
     }
 }
@@ -2081,6 +2066,7 @@ void OnnxParser::matMulEquations( onnx::NodeProto &node, bool makeEquations )
 
     // Create new variables
     Vector<Variable> outputVariables = makeNodeVariables( nodeName, false );
+    _query.addLayer( NLR::Layer::WEIGHTED_SUM, outputVariables );
 
     // Pad the output if needed (matrix-matrix multiplication)
     if ( outputShape.size() == 1 && input2Shape.size() > 1 )
@@ -2101,7 +2087,7 @@ void OnnxParser::matMulEquations( onnx::NodeProto &node, bool makeEquations )
         {
             for ( TensorIndex j = 0; j < d3; j++ )
             {
-                Equation e;
+                Variable outputVariable = tensorLookup( outputVariables, outputShape, { i, j } );
                 for ( TensorIndex k = 0; k < d2; k++ )
                 {
                     double constant;
@@ -2116,19 +2102,13 @@ void OnnxParser::matMulEquations( onnx::NodeProto &node, bool makeEquations )
                         constant = tensorLookup( constants, { d2, d3 }, { k, j } );
                         variable = tensorLookup( variables, { d1, d2 }, { i, k } );
                     }
-                    e.addAddend( constant, variable );
+                    _query.setWeight( variable, outputVariable, constant );
                 }
-
-                // Put output variable as the last addend
-                Variable outputVariable = tensorLookup( outputVariables, outputShape, { i, j } );
-                e.addAddend( -1, outputVariable );
-                e.setScalar( 0.0 );
-                _query.addEquation( e );
             }
         }
         else
         {
-            Equation e;
+            Variable outputVariable = outputVariables[i];
             for ( TensorIndex k = 0; k < d2; k++ )
             {
                 double constant;
@@ -2143,14 +2123,8 @@ void OnnxParser::matMulEquations( onnx::NodeProto &node, bool makeEquations )
                     constant = constants[k];
                     variable = tensorLookup( variables, { d1, d2 }, { i, k } );
                 }
-                e.addAddend( constant, variable );
+                _query.setWeight( variable, outputVariable, constant );
             }
-
-            // Put output variable as the last addend last
-            Variable outputVariable = outputVariables[i];
-            e.addAddend( -1, outputVariable );
-            e.setScalar( 0.0 );
-            _query.addEquation( e );
         }
     }
 }
@@ -2177,6 +2151,7 @@ void OnnxParser::sigmoidEquations( onnx::NodeProto &node, bool makeEquations )
     ASSERT( inputVars.size() == outputVars.size() );
 
     // Generate equations
+    _query.addLayer( NLR::Layer::SIGMOID, outputVars );
     for ( unsigned int i = 0; i < inputVars.size(); i++ )
     {
         Variable inputVar = inputVars[i];
@@ -2208,8 +2183,5 @@ void OnnxParser::tanhEquations( onnx::NodeProto &node, bool makeEquations )
     ASSERT( inputVars.size() == outputVars.size() );
 
     // Generate equations
-    for ( uint i = 0; i < outputVars.size(); i++ )
-    {
-        _query.addTanh( inputVars[i], outputVars[i] );
-    }
+    _query.addTanhLayer( inputVars, outputVars );
 }
@@ -408,6 +408,37 @@ public:
         run_test( "tanh", input, output );
     }
 
+    void test_network_level_reasoner_is_built_directly()
+    {
+        String networkPath = Stringf( "%s/tanh.onnx", RESOURCES_DIR "/onnx/layer-zoo" );
+
+        InputQueryBuilder queryBuilder;
+        TS_ASSERT_THROWS_NOTHING( OnnxParser::parse( queryBuilder, networkPath, {}, {} ) );
+
+        InputQuery inputQuery;
+        queryBuilder.generateQuery( inputQuery );
+
+        // The weighted sum layers are not encoded as equations yet
+        TS_ASSERT_EQUALS( inputQuery.getNumberOfEquations(), 0U );
+
+        Query *query = inputQuery.generateQuery();
+        TS_ASSERT( query->hasPrebuiltNetworkLevelReasoner() );
+
+        // Input, 2x, sigmoid, 2s - 1
+        NLR::NetworkLevelReasoner *nlr = query->getNetworkLevelReasoner();
+        TS_ASSERT_EQUALS( nlr->getNumberOfLayers(), 4U );
+        TS_ASSERT_EQUALS( nlr->getLayer( 1 )->getLayerType(), NLR::Layer::WEIGHTED_SUM );
+        TS_ASSERT_EQUALS( nlr->getLayer( 2 )->getLayerType(), NLR::Layer::SIGMOID );
+        TS_ASSERT_EQUALS( nlr->getLayer( 3 )->getLayerType(), NLR::Layer::WEIGHTED_SUM );
+        TS_ASSERT_EQUALS( nlr->getLayer( 3 )->getBias( 0 ), -1 );
+
+        query->encodePrebuiltNetworkLevelReasoner();
+        TS_ASSERT( !query->hasPrebuiltNetworkLevelReasoner() );
+        TS_ASSERT_EQUALS( query->getNumberOfEquations(), 8U );
+
+        delete query;
+    }
+
     void test_cast_int_to_float()
     {
         Vector<double> input = {
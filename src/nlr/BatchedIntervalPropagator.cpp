@@ -0,0 +1,320 @@
+/*********************                                                        */
+/*! \file BatchedIntervalPropagator.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "BatchedIntervalPropagator.h"
+
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "MStringf.h"
+#include "MatrixMultiplication.h"
+#include "NLRError.h"
+#include "SigmoidConstraint.h"
+
+namespace NLR {
+
+BatchedIntervalPropagator::BatchedIntervalPropagator( const LayerOwner *layerOwner )
+    : _layerOwner( layerOwner )
+    , _batchSize( 0 )
+{
+}
+
+void BatchedIntervalPropagator::run( unsigned batchSize,
+                                     const double *inputLowerBounds,
+                                     const double *inputUpperBounds )
+{
+    _batchSize = batchSize;
+    _lowerBounds.clear();
+    _upperBounds.clear();
+    _stabilityMasks.clear();
+    _numberOfUnstableNeurons.assign( batchSize, 0 );
+
+    for ( const auto &pair : _layerOwner->getLayerIndexToLayer() )
+    {
+        const Layer *layer = pair.second;
+        unsigned size = layer->getSize();
+        _lowerBounds[pair.first].assign( batchSize * size, 0 );
+        _upperBounds[pair.first].assign( batchSize * size, 0 );
+
+        switch ( layer->getLayerType() )
+        {
+        case Layer::INPUT:
+            computeBoundsForInput( layer, inputLowerBounds, inputUpperBounds );
+            break;
+
+        case Layer::WEIGHTED_SUM:
+            computeBoundsForWeightedSum( layer );
+            break;
+
+        case Layer::RELU:
+        case Layer::ABSOLUTE_VALUE:
+        case Layer::SIGN:
+        case Layer::LEAKY_RELU:
+        case Layer::SIGMOID:
+        case Layer::ROUND:
+            computeBoundsForActivation( layer );
+            break;
+
+        case Layer::MAX:
+            computeBoundsForMax( layer );
+            break;
+
+        default:
+            throw NLRError( NLRError::LAYER_TYPE_NOT_SUPPORTED,
+                            Stringf( "Layer %u not supported by batched interval propagation",
+                                     layer->getLayerType() )
+                                .ascii() );
+        }
+
+        // Eliminated neurons have the same value in all the boxes
+        double *lbs = _lowerBounds[pair.first].data();
+        double *ubs = _upperBounds[pair.first].data();
+        for ( unsigned i = 0; i < size; ++i )
+        {
+            if ( !layer->neuronEliminated( i ) )
+                continue;
+
+            double value = layer->getEliminatedNeuronValue( i );
+            for ( unsigned box = 0; box < batchSize; ++box )
+            {
+                lbs[box * size + i] = value;
+                ubs[box * size + i] = value;
+            }
+        }
+    }
+}
+
+unsigned BatchedIntervalPropagator::getBatchSize() const
+{
+    return _batchSize;
+}
+
+const double *BatchedIntervalPropagator::getLowerBounds( unsigned layerIndex ) const
+{
+    return _lowerBounds.at( layerIndex ).data();
+}
+
+const double *BatchedIntervalPropagator::getUpperBounds( unsigned layerIndex ) const
+{
+    return _upperBounds.at( layerIndex ).data();
+}
+
+const Vector<bool> &BatchedIntervalPropagator::getStabilityMask( unsigned layerIndex ) const
+{
+    return _stabilityMasks.at( layerIndex );
+}
+
+unsigned BatchedIntervalPropagator::getNumberOfUnstableNeurons( unsigned box ) const
+{
+    ASSERT( box < _batchSize );
+    return _numberOfUnstableNeurons[box];
+}
+
+void BatchedIntervalPropagator::computeBoundsForInput( const Layer *layer,
+                                                       const double *inputLowerBounds,
+                                                       const double *inputUpperBounds )
+{
+    unsigned index = layer->getLayerIndex();
+    unsigned size = layer->getSize();
+    std::copy( inputLowerBounds, inputLowerBounds + _batchSize * size, _lowerBounds[index].data() );
+    std::copy( inputUpperBounds, inputUpperBounds + _batchSize * size, _upperBounds[index].data() );
+}
+
+void BatchedIntervalPropagator::computeBoundsForWeightedSum( const Layer *layer )
+{
+    unsigned index = layer->getLayerIndex();
+    unsigned size = layer->getSize();
+    double *lbs = _lowerBounds[index].data();
+    double *ubs = _upperBounds[index].data();
+
+    const double *biases = layer->getBiases();
+    for ( unsigned box = 0; box < _batchSize; ++box )
+    {
+        std::copy( biases, biases + size, lbs + box * size );
+        std::copy( biases, biases + size, ubs + box * size );
+    }
+
+    /*
+      With the weights split into positive and negative ones:
+
+        lbs += sourceLbs * positiveWeights + sourceUbs * negativeWeights
+        ubs += sourceUbs * positiveWeights + sourceLbs * negativeWeights
+    */
+    for ( const auto &sourceLayerEntry : layer->getSourceLayers() )
+    {
+        unsigned sourceIndex = sourceLayerEntry.first;
+        unsigned sourceSize = sourceLayerEntry.second;
+        const double *sourceLbs = _lowerBounds.at( sourceIndex ).data();
+        const double *sourceUbs = _upperBounds.at( sourceIndex ).data();
+        const double *positiveWeights = layer->getPositiveWeights( sourceIndex );
+        const double *negativeWeights = layer->getNegativeWeights( sourceIndex );
+
+        matrixMultiplication( sourceLbs, positiveWeights, lbs, _batchSize, sourceSize, size );
+        matrixMultiplication( sourceUbs, negativeWeights, lbs, _batchSize, sourceSize, size );
+        matrixMultiplication( sourceUbs, positiveWeights, ubs, _batchSize, sourceSize, size );
+        matrixMultiplication( sourceLbs, negativeWeights, ubs, _batchSize, sourceSize, size );
+    }
+}
+
+void BatchedIntervalPropagator::computeBoundsForActivation( const Layer *layer )
+{
+    unsigned index = layer->getLayerIndex();
+    unsigned size = layer->getSize();
+    double *lbs = _lowerBounds[index].data();
+    double *ubs = _upperBounds[index].data();
+
+    bool hasMask = hasStabilityMask( layer->getLayerType() );
+    if ( hasMask )
+        _stabilityMasks[index].assign( _batchSize * size, true );
+
+    for ( unsigned i = 0; i < size; ++i )
+    {
+        if ( layer->neuronEliminated( i ) )
+            continue;
+
+        NeuronIndex source = *layer->getActivationSources( i ).begin();
+        unsigned sourceSize = _layerOwner->getLayer( source._layer )->getSize();
+        const double *sourceLbs = _lowerBounds.at( source._layer ).data();
+        const double *sourceUbs = _upperBounds.at( source._layer ).data();
+
+        for ( unsigned box = 0; box < _batchSize; ++box )
+        {
+            unsigned sourceEntry = box * sourceSize + source._neuron;
+            unsigned entry = box * size + i;
+            bool stable = computeActivationBounds(
+                layer, sourceLbs[sourceEntry], sourceUbs[sourceEntry], lbs[entry], ubs[entry] );
+
+            if ( hasMask && !stable )
+            {
+                _stabilityMasks[index][entry] = false;
+                ++_numberOfUnstableNeurons[box];
+            }
+        }
+    }
+}
+
+void BatchedIntervalPropagator::computeBoundsForMax( const Layer *layer )
+{
+    unsigned index = layer->getLayerIndex();
+    unsigned size = layer->getSize();
+    double *lbs = _lowerBounds[index].data();
+    double *ubs = _upperBounds[index].data();
+
+    for ( unsigned i = 0; i < size; ++i )
+    {
+        if ( layer->neuronEliminated( i ) )
+            continue;
+
+        for ( unsigned box = 0; box < _batchSize; ++box )
+        {
+            lbs[box * size + i] = FloatUtils::negativeInfinity();
+            ubs[box * size + i] = FloatUtils::negativeInfinity();
+        }
+
+        for ( const auto &source : layer->getActivationSources( i ) )
+        {
+            unsigned sourceSize = _layerOwner->getLayer( source._layer )->getSize();
+            const double *sourceLbs = _lowerBounds.at( source._layer ).data();
+            const double *sourceUbs = _upperBounds.at( source._layer ).data();
+
+            for ( unsigned box = 0; box < _batchSize; ++box )
+            {
+                unsigned sourceEntry = box * sourceSize + source._neuron;
+                unsigned entry = box * size + i;
+                lbs[entry] = FloatUtils::max( lbs[entry], sourceLbs[sourceEntry] );
+                ubs[entry] = FloatUtils::max( ubs[entry], sourceUbs[sourceEntry] );
+            }
+        }
+    }
+}
+
+bool BatchedIntervalPropagator::computeActivationBounds( const Layer *layer,
+                                                         double sourceLb,
+                                                         double sourceUb,
+                                                         double &lb,
+                                                         double &ub )
+{
+    bool stable = !( sourceLb < 0 && sourceUb > 0 );
+
+    switch ( layer->getLayerType() )
+    {
+    case Layer::RELU:
+        lb = FloatUtils::max( sourceLb, 0 );
+        ub = FloatUtils::max( sourceUb, 0 );
+        break;
+
+    case Layer::ABSOLUTE_VALUE:
+        if ( sourceLb > 0 )
+        {
+            lb = sourceLb;
+            ub = sourceUb;
+        }
+        else if ( sourceUb < 0 )
+        {
+            lb = -sourceUb;
+            ub = -sourceLb;
+        }
+        else
+        {
+            lb = 0;
+            ub = FloatUtils::max( sourceUb, -sourceLb );
+        }
+        break;
+
+    case Layer::SIGN:
+        lb = FloatUtils::isNegative( sourceLb ) ? -1 : 1;
+        ub = FloatUtils::isNegative( sourceUb ) ? -1 : 1;
+        break;
+
+    case Layer::LEAKY_RELU:
+    {
+        double alpha = layer->getAlpha();
+        lb = sourceLb > 0 ? sourceLb : alpha * sourceLb;
+        ub = sourceUb > 0 ? sourceUb : alpha * sourceUb;
+        break;
+    }
+
+    case Layer::SIGMOID:
+        lb = SigmoidConstraint::sigmoid( sourceLb );
+        ub = SigmoidConstraint::sigmoid( sourceUb );
+        break;
+
+    case Layer::ROUND:
+        lb = FloatUtils::round( sourceLb );
+        ub = FloatUtils::round( sourceUb );
+        break;
+
+    default:
+        ASSERT( false );
+        break;
+    }
+
+    return stable;
+}
+
+bool BatchedIntervalPropagator::hasStabilityMask( Layer::Type type )
+{
+    return type == Layer::RELU || type == Layer::ABSOLUTE_VALUE || type == Layer::SIGN ||
+           type == Layer::LEAKY_RELU;
+}
+
+} // namespace NLR
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,104 @@
+/*********************                                                        */
+/*! \file BatchedIntervalPropagator.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Interval arithmetic for many input boxes at once. The bounds of a
+ ** layer are computed for the whole batch together: for a weighted sum
+ ** layer, by multiplying the batch's bounds of each source layer with the
+ ** positive and negative weights that the layer stores. The bounds of the
+ ** layers themselves are left as they are.
+
+ **/
+
+#ifndef __BatchedIntervalPropagator_h__
+#define __BatchedIntervalPropagator_h__
+
+#include "Layer.h"
+#include "LayerOwner.h"
+#include "Map.h"
+#include "Vector.h"
+
+namespace NLR {
+
+class BatchedIntervalPropagator
+{
+public:
+    BatchedIntervalPropagator( const LayerOwner *layerOwner );
+
+    /*
+      Propagate a batch of bounded input boxes through the network. The
+      bounds of the boxes are stored box after box, each holding the
+      bounds of all the neurons of the input layer. Eliminated neurons
+      keep their values, whatever the boxes say.
+    */
+    void run( unsigned batchSize, const double *inputLowerBounds, const double *inputUpperBounds );
+
+    unsigned getBatchSize() const;
+
+    /*
+      The bounds of the neurons of a layer for each box of the last run,
+      stored box after box
+    */
+    const double *getLowerBounds( unsigned layerIndex ) const;
+    const double *getUpperBounds( unsigned layerIndex ) const;
+
+    /*
+      For a ReLU, leaky ReLU, absolute value or sign layer: whether each
+      of its neurons is stable in each box, i.e. whether the bounds of
+      the neuron's source do not have 0 strictly between them. Stored box
+      after box, and empty for the other layers.
+    */
+    const Vector<bool> &getStabilityMask( unsigned layerIndex ) const;
+
+    /*
+      The number of neurons that are not stable in a box, over all layers
+    */
+    unsigned getNumberOfUnstableNeurons( unsigned box ) const;
+
+private:
+    const LayerOwner *_layerOwner;
+    unsigned _batchSize;
+
+    Map<unsigned, Vector<double>> _lowerBounds;
+    Map<unsigned, Vector<double>> _upperBounds;
+    Map<unsigned, Vector<bool>> _stabilityMasks;
+    Vector<unsigned> _numberOfUnstableNeurons;
+
+    void computeBoundsForInput( const Layer *layer,
+                                const double *inputLowerBounds,
+                                const double *inputUpperBounds );
+    void computeBoundsForWeightedSum( const Layer *layer );
+    void computeBoundsForActivation( const Layer *layer );
+    void computeBoundsForMax( const Layer *layer );
+
+    /*
+      Bound one neuron of an activation layer, given the bounds of its
+      source. Return whether the neuron is stable.
+    */
+    static bool computeActivationBounds( const Layer *layer,
+                                         double sourceLb,
+                                         double sourceUb,
+                                         double &lb,
+                                         double &ub );
+
+    static bool hasStabilityMask( Layer::Type type );
+};
+
+} // namespace NLR
+
+#endif // __BatchedIntervalPropagator_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
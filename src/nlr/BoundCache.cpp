@@ -0,0 +1,426 @@
+/*********************                                                        */
+/*! \file BoundCache.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "BoundCache.h"
+
+#include "CommonError.h"
+#include "FloatUtils.h"
+#include "Options.h"
+#include "SymbolicBoundTighteningType.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+
+namespace NLR {
+
+/*
+  The file starts with this magic number, followed by the entries. Each
+  entry is an EntryHeader, followed by the lower and upper bounds of the
+  inputs, and the lower and upper bounds of all neurons.
+*/
+static const unsigned long long BOUND_CACHE_MAGIC = 0x3165686361434c4eULL;
+
+static const unsigned long long FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+static const unsigned long long FNV_PRIME = 0x100000001b3ULL;
+
+static void hashBytes( unsigned long long &hash, const void *data, unsigned long long size )
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    for ( unsigned long long i = 0; i < size; ++i )
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+}
+
+template <typename T> static void hashValue( unsigned long long &hash, T value )
+{
+    hashBytes( hash, &value, sizeof( T ) );
+}
+
+BoundCache::BoundCache( const String &path )
+    : _path( path )
+{
+}
+
+unsigned long long
+BoundCache::computeNetworkHash( const NetworkLevelReasoner &networkLevelReasoner )
+{
+    unsigned long long hash = FNV_OFFSET_BASIS;
+
+    unsigned numberOfLayers = networkLevelReasoner.getNumberOfLayers();
+    hashValue( hash, numberOfLayers );
+
+    for ( unsigned i = 0; i < numberOfLayers; ++i )
+    {
+        const Layer *layer = networkLevelReasoner.getLayer( i );
+        unsigned size = layer->getSize();
+        Layer::Type type = layer->getLayerType();
+
+        hashValue( hash, i );
+        hashValue( hash, (unsigned)type );
+        hashValue( hash, size );
+
+        if ( type == Layer::LEAKY_RELU )
+            hashValue( hash, layer->getAlpha() );
+
+        for ( const auto &sourceLayer : layer->getSourceLayers() )
+        {
+            hashValue( hash, sourceLayer.first );
+            hashValue( hash, sourceLayer.second );
+
+            if ( type == Layer::WEIGHTED_SUM )
+                hashBytes( hash,
+                           layer->getWeightMatrix( sourceLayer.first ),
+                           sizeof( double ) * sourceLayer.second * size );
+        }
+
+        if ( type == Layer::WEIGHTED_SUM )
+            hashBytes( hash, layer->getBiases(), sizeof( double ) * size );
+        else if ( type != Layer::INPUT )
+        {
+            for ( unsigned neuron = 0; neuron < size; ++neuron )
+            {
+                for ( const auto &source : layer->getActivationSources( neuron ) )
+                {
+                    hashValue( hash, source._layer );
+                    hashValue( hash, source._neuron );
+                }
+            }
+        }
+
+        for ( unsigned neuron = 0; neuron < size; ++neuron )
+        {
+            if ( layer->neuronEliminated( neuron ) )
+            {
+                hashValue( hash, neuron );
+                hashValue( hash, layer->getEliminatedNeuronValue( neuron ) );
+            }
+        }
+    }
+
+    return hash;
+}
+
+bool BoundCache::getBounds( const NetworkLevelReasoner &networkLevelReasoner,
+                            Vector<double> &lowerBounds,
+                            Vector<double> &upperBounds )
+{
+    EntryHeader key;
+    key._networkHash = computeNetworkHash( networkLevelReasoner );
+    key._numberOfNeurons = 0;
+
+    Vector<double> inputLowerBounds;
+    Vector<double> inputUpperBounds;
+    for ( unsigned i = 0; i < networkLevelReasoner.getNumberOfLayers(); ++i )
+    {
+        const Layer *layer = networkLevelReasoner.getLayer( i );
+        key._numberOfNeurons += layer->getSize();
+
+        if ( layer->getLayerType() != Layer::INPUT )
+            continue;
+
+        for ( unsigned neuron = 0; neuron < layer->getSize(); ++neuron )
+        {
+            inputLowerBounds.append( layer->getLb( neuron ) );
+            inputUpperBounds.append( layer->getUb( neuron ) );
+        }
+    }
+    key._numberOfInputs = inputLowerBounds.size();
+
+    if ( lookup( key, inputLowerBounds, inputUpperBounds, lowerBounds, upperBounds ) )
+        return true;
+
+    computeBounds( networkLevelReasoner, lowerBounds, upperBounds );
+    store( key, inputLowerBounds, inputUpperBounds, lowerBounds, upperBounds );
+    return false;
+}
+
+void BoundCache::computeBounds( const NetworkLevelReasoner &networkLevelReasoner,
+                                Vector<double> &lowerBounds,
+                                Vector<double> &upperBounds )
+{
+    // Work on a copy, so that the bounds depend only on the inputs, and not
+    // on any other bounds the network currently has
+    NetworkLevelReasoner copy;
+    networkLevelReasoner.storeIntoOther( copy );
+
+    for ( unsigned i = 0; i < copy.getNumberOfLayers(); ++i )
+    {
+        Layer *layer = copy.getLayer( i );
+        const Layer *original = networkLevelReasoner.getLayer( i );
+        bool input = ( layer->getLayerType() == Layer::INPUT );
+
+        for ( unsigned neuron = 0; neuron < layer->getSize(); ++neuron )
+        {
+            if ( layer->neuronEliminated( neuron ) )
+                continue;
+
+            if ( input )
+            {
+                layer->setLb( neuron, original->getLb( neuron ) );
+                layer->setUb( neuron, original->getUb( neuron ) );
+            }
+            else
+            {
+                layer->setLb( neuron, FloatUtils::negativeInfinity() );
+                layer->setUb( neuron, FloatUtils::infinity() );
+            }
+        }
+    }
+
+    copy.intervalArithmeticBoundPropagation();
+
+    SymbolicBoundTighteningType type = Options::get()->getSymbolicBoundTighteningType();
+    if ( type == SymbolicBoundTighteningType::SYMBOLIC_BOUND_TIGHTENING )
+        copy.symbolicBoundPropagation();
+    else if ( type == SymbolicBoundTighteningType::DEEP_POLY )
+        copy.deepPolyPropagation();
+
+    lowerBounds.clear();
+    upperBounds.clear();
+    for ( unsigned i = 0; i < copy.getNumberOfLayers(); ++i )
+    {
+        const Layer *layer = copy.getLayer( i );
+        for ( unsigned neuron = 0; neuron < layer->getSize(); ++neuron )
+        {
+            lowerBounds.append( layer->getLb( neuron ) );
+            upperBounds.append( layer->getUb( neuron ) );
+        }
+    }
+}
+
+bool BoundCache::lookup( const char *data,
+                         unsigned long long size,
+                         const EntryHeader &key,
+                         const Vector<double> &inputLowerBounds,
+                         const Vector<double> &inputUpperBounds,
+                         Vector<double> &lowerBounds,
+                         Vector<double> &upperBounds ) const
+{
+    unsigned long long magic;
+    if ( size < sizeof( magic ) )
+        return false;
+
+    memcpy( &magic, data, sizeof( magic ) );
+    if ( magic != BOUND_CACHE_MAGIC )
+        return false;
+
+    bool found = false;
+    unsigned long long offset = sizeof( magic );
+    while ( offset + sizeof( EntryHeader ) <= size )
+    {
+        EntryHeader header;
+        memcpy( &header, data + offset, sizeof( EntryHeader ) );
+        offset += sizeof( EntryHeader );
+
+        unsigned long long numberOfBounds =
+            2 * ( (unsigned long long)header._numberOfInputs + header._numberOfNeurons );
+        if ( offset + numberOfBounds * sizeof( double ) > size )
+        {
+            // A partially written entry
+            break;
+        }
+
+        const char *bounds = data + offset;
+        offset += numberOfBounds * sizeof( double );
+
+        if ( header._networkHash != key._networkHash ||
+             header._numberOfInputs != key._numberOfInputs ||
+             header._numberOfNeurons != key._numberOfNeurons )
+            continue;
+
+        // The entry is only sound if its input box contains the current one
+        bool contains = true;
+        for ( unsigned i = 0; i < key._numberOfInputs && contains; ++i )
+        {
+            double lb;
+            double ub;
+            memcpy( &lb, bounds + sizeof( double ) * i, sizeof( double ) );
+            memcpy( &ub,
+                    bounds + sizeof( double ) * ( key._numberOfInputs + i ),
+                    sizeof( double ) );
+            contains = ( lb <= inputLowerBounds[i] ) && ( inputUpperBounds[i] <= ub );
+        }
+
+        if ( !contains )
+            continue;
+
+        if ( !found )
+        {
+            lowerBounds.assign( key._numberOfNeurons, FloatUtils::negativeInfinity() );
+            upperBounds.assign( key._numberOfNeurons, FloatUtils::infinity() );
+            found = true;
+        }
+
+        const char *neuronBounds = bounds + sizeof( double ) * 2 * key._numberOfInputs;
+        for ( unsigned i = 0; i < key._numberOfNeurons; ++i )
+        {
+            double lb;
+            double ub;
+            memcpy( &lb, neuronBounds + sizeof( double ) * i, sizeof( double ) );
+            memcpy( &ub,
+                    neuronBounds + sizeof( double ) * ( key._numberOfNeurons + i ),
+                    sizeof( double ) );
+
+            if ( lb > lowerBounds[i] )
+                lowerBounds[i] = lb;
+            if ( ub < upperBounds[i] )
+                upperBounds[i] = ub;
+        }
+    }
+
+    return found;
+}
+
+#ifndef _WIN32
+
+bool BoundCache::lookup( const EntryHeader &key,
+                         const Vector<double> &inputLowerBounds,
+                         const Vector<double> &inputUpperBounds,
+                         Vector<double> &lowerBounds,
+                         Vector<double> &upperBounds ) const
+{
+    int descriptor = ::open( _path.ascii(), O_RDONLY );
+    if ( descriptor < 0 )
+        return false;
+
+    struct stat fileData;
+    if ( fstat( descriptor, &fileData ) != 0 || fileData.st_size == 0 )
+    {
+        ::close( descriptor );
+        return false;
+    }
+
+    unsigned long long size = fileData.st_size;
+    void *data = mmap( NULL, size, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+    ::close( descriptor );
+
+    if ( data == MAP_FAILED )
+        throw CommonError( CommonError::READ_FAILED, _path.ascii() );
+
+    bool found = lookup( (const char *)data,
+                         size,
+                         key,
+                         inputLowerBounds,
+                         inputUpperBounds,
+                         lowerBounds,
+                         upperBounds );
+    munmap( data, size );
+    return found;
+}
+
+#else
+
+bool BoundCache::lookup( const EntryHeader &key,
+                         const Vector<double> &inputLowerBounds,
+                         const Vector<double> &inputUpperBounds,
+                         Vector<double> &lowerBounds,
+                         Vector<double> &upperBounds ) const
+{
+    FILE *file = fopen( _path.ascii(), "rb" );
+    if ( !file )
+        return false;
+
+    Vector<char> data;
+    char buffer[4096];
+    size_t bytesRead;
+    while ( ( bytesRead = fread( buffer, 1, sizeof( buffer ), file ) ) > 0 )
+        for ( size_t i = 0; i < bytesRead; ++i )
+            data.append( buffer[i] );
+    fclose( file );
+
+    return lookup( data.data(),
+                   data.size(),
+                   key,
+                   inputLowerBounds,
+                   inputUpperBounds,
+                   lowerBounds,
+                   upperBounds );
+}
+
+#endif
+
+void BoundCache::store( const EntryHeader &key,
+                        const Vector<double> &inputLowerBounds,
+                        const Vector<double> &inputUpperBounds,
+                        const Vector<double> &lowerBounds,
+                        const Vector<double> &upperBounds ) const
+{
+    // Write the whole entry at once, so that concurrent runs appending to
+    // the same file do not interleave
+    Vector<char> entry;
+    auto appendBytes = [&entry]( const void *data, unsigned long long size ) {
+        const char *bytes = (const char *)data;
+        for ( unsigned long long i = 0; i < size; ++i )
+            entry.append( bytes[i] );
+    };
+
+    appendBytes( &key, sizeof( EntryHeader ) );
+    appendBytes( inputLowerBounds.data(), sizeof( double ) * inputLowerBounds.size() );
+    appendBytes( inputUpperBounds.data(), sizeof( double ) * inputUpperBounds.size() );
+    appendBytes( lowerBounds.data(), sizeof( double ) * lowerBounds.size() );
+    appendBytes( upperBounds.data(), sizeof( double ) * upperBounds.size() );
+
+#ifndef _WIN32
+    int descriptor = ::open( _path.ascii(), O_WRONLY | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR );
+    if ( descriptor < 0 )
+        throw CommonError( CommonError::OPEN_FAILED, _path.ascii() );
+
+    struct stat fileData;
+    if ( fstat( descriptor, &fileData ) == 0 && fileData.st_size == 0 )
+    {
+        Vector<char> withMagic;
+        const char *magic = (const char *)&BOUND_CACHE_MAGIC;
+        for ( unsigned i = 0; i < sizeof( BOUND_CACHE_MAGIC ); ++i )
+            withMagic.append( magic[i] );
+        entry = withMagic + entry;
+    }
+
+    bool written = ( ::write( descriptor, entry.data(), entry.size() ) == (ssize_t)entry.size() );
+    ::close( descriptor );
+#else
+    FILE *file = fopen( _path.ascii(), "ab" );
+    if ( !file )
+        throw CommonError( CommonError::OPEN_FAILED, _path.ascii() );
+
+    fseek( file, 0, SEEK_END );
+    if ( ftell( file ) == 0 )
+        fwrite( &BOUND_CACHE_MAGIC, sizeof( BOUND_CACHE_MAGIC ), 1, file );
+
+    bool written = ( fwrite( entry.data(), 1, entry.size(), file ) == entry.size() );
+    fclose( file );
+#endif
+
+    if ( !written )
+        throw CommonError( CommonError::WRITE_FAILED, _path.ascii() );
+}
+
+} // namespace NLR
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,109 @@
+/*********************                                                        */
+/*! \file BoundCache.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** An on-disk cache of the bounds of the neurons of a network, for reuse
+ ** across runs that verify different properties of the same network.
+ **
+ ** Each entry holds the bounds of all neurons of a network, computed from
+ ** a box of its inputs only, and is keyed by a hash of the network
+ ** (topology, weights, biases and eliminated neurons) and by that box.
+ ** Since the bounds hold for every input in the box, an entry can be
+ ** reused for any input box that it contains. Entries are appended to the
+ ** file, which is memory-mapped when looked up.
+ **
+ ** The file is in the native byte order, and is not meant to be moved
+ ** across architectures.
+
+ **/
+
+#ifndef __BoundCache_h__
+#define __BoundCache_h__
+
+#include "MString.h"
+#include "NetworkLevelReasoner.h"
+#include "Vector.h"
+
+namespace NLR {
+
+class BoundCache
+{
+public:
+    BoundCache( const String &path );
+
+    /*
+      Get bounds on all neurons of the network (enumerated layer by layer)
+      that hold over the current bounds of its input layers. The bounds are
+      the intersection of the cached entries whose input box contains the
+      current one; if there are none, they are computed on a copy of the
+      network, by interval arithmetic and the symbolic bound tightening
+      set in the options, and then cached. Return true iff they were found
+      in the cache.
+    */
+    bool getBounds( const NetworkLevelReasoner &networkLevelReasoner,
+                    Vector<double> &lowerBounds,
+                    Vector<double> &upperBounds );
+
+    /*
+      A hash of everything in the network that its bounds depend on, other
+      than the bounds of its inputs
+    */
+    static unsigned long long
+    computeNetworkHash( const NetworkLevelReasoner &networkLevelReasoner );
+
+private:
+    String _path;
+
+    struct EntryHeader
+    {
+        unsigned long long _networkHash;
+        unsigned _numberOfInputs;
+        unsigned _numberOfNeurons;
+    };
+
+    /*
+      Intersect the bounds of the matching entries in the contents of the
+      file. Return true iff there were any.
+    */
+    bool lookup( const char *data,
+                 unsigned long long size,
+                 const EntryHeader &key,
+                 const Vector<double> &inputLowerBounds,
+                 const Vector<double> &inputUpperBounds,
+                 Vector<double> &lowerBounds,
+                 Vector<double> &upperBounds ) const;
+    bool lookup( const EntryHeader &key,
+                 const Vector<double> &inputLowerBounds,
+                 const Vector<double> &inputUpperBounds,
+                 Vector<double> &lowerBounds,
+                 Vector<double> &upperBounds ) const;
+
+    void store( const EntryHeader &key,
+                const Vector<double> &inputLowerBounds,
+                const Vector<double> &inputUpperBounds,
+                const Vector<double> &lowerBounds,
+                const Vector<double> &upperBounds ) const;
+
+    static void computeBounds( const NetworkLevelReasoner &networkLevelReasoner,
+                               Vector<double> &lowerBounds,
+                               Vector<double> &upperBounds );
+};
+
+} // namespace NLR
+
+#endif // __BoundCache_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -34,6 +34,7 @@
 #include "MatrixMultiplication.h"
 #include "NLRError.h"
 #include "TimeUtils.h"
+#include "Vector.h"
 
 #include <boost/thread.hpp>
 
@@ -119,7 +120,7 @@ void DeepPolyAnalysis::freeMemoryIfNeeded()
     }
 }
 
-void DeepPolyAnalysis::run()
+void DeepPolyAnalysis::run( unsigned firstLayer )
 {
     struct timespec deepPolyStart;
     (void)deepPolyStart;
@@ -137,6 +138,8 @@ void DeepPolyAnalysis::run()
         */
         unsigned index = pair.first;
         Layer *layer = pair.second;
+        if ( index < firstLayer )
+            continue;
 
         ASSERT( _deepPolyElements.exists( index ) );
         log( Stringf( "Running deeppoly analysis for layer %u...", index ) );
@@ -177,6 +180,40 @@ void DeepPolyAnalysis::run()
     }
 }
 
+void DeepPolyAnalysis::boundVirtualLayer( Layer *layer )
+{
+    ASSERT( layer->getLayerType() == Layer::WEIGHTED_SUM );
+    ASSERT( layer->getSourceLayers().size() == 1 );
+    ASSERT( _deepPolyElements.exists( layer->getSourceLayers().begin()->first ) );
+
+    // The layer may be wider than the network's layers, so it gets its
+    // own working memory
+    unsigned size = layer->getSize();
+    Vector<double> work1SymbolicLb( size * _maxLayerSize, 0 );
+    Vector<double> work1SymbolicUb( size * _maxLayerSize, 0 );
+    Vector<double> work2SymbolicLb( size * _maxLayerSize, 0 );
+    Vector<double> work2SymbolicUb( size * _maxLayerSize, 0 );
+    Vector<double> workSymbolicLowerBias( size, 0 );
+    Vector<double> workSymbolicUpperBias( size, 0 );
+
+    DeepPolyWeightedSumElement deepPolyElement( layer );
+    deepPolyElement.setWorkingMemory( work1SymbolicLb.data(),
+                                      work1SymbolicUb.data(),
+                                      work2SymbolicLb.data(),
+                                      work2SymbolicUb.data(),
+                                      workSymbolicLowerBias.data(),
+                                      workSymbolicUpperBias.data() );
+
+    log( Stringf( "Bounding virtual layer of size %u...", size ) );
+    deepPolyElement.execute( _deepPolyElements );
+    for ( unsigned i = 0; i < size; ++i )
+    {
+        layer->setLb( i, deepPolyElement.getLowerBound( i ) );
+        layer->setUb( i, deepPolyElement.getUpperBound( i ) );
+    }
+    log( Stringf( "Bounding virtual layer of size %u - done", size ) );
+}
+
 void DeepPolyAnalysis::allocateMemory()
 {
     freeMemoryIfNeeded();
@@ -31,7 +31,22 @@ public:
     DeepPolyAnalysis( LayerOwner *layerOwner );
     ~DeepPolyAnalysis();
 
-    void run();
+    /*
+      Execute the elements of the layers from the given one. The elements
+      of the layers before it keep the results of their last execution.
+    */
+    void run( unsigned firstLayer = 0 );
+
+    /*
+      Bound the neurons of a weighted sum layer that is not part of the
+      network, and whose only source is one of its layers, such as the
+      specifications of a property over the output layer. The layer is
+      back-substituted down to the input layer through the relaxations of
+      the last run, so its cost grows with the layer's size rather than
+      with the sizes of the network's layers. The bounds are stored in
+      the layer.
+    */
+    void boundVirtualLayer( Layer *layer );
 
 private:
     LayerOwner *_layerOwner;
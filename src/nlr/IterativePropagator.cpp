@@ -282,6 +282,8 @@ double IterativePropagator::optimizeWithGurobi( GurobiWrapper &gurobi,
 
 void IterativePropagator::tightenSingleVariableBounds( ThreadArgument &argument )
 {
+    Options::Scope optionsScope( argument._options );
+
     try
     {
         // try the phase corresponding to the larger interval first
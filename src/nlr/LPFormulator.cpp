@@ -556,6 +556,8 @@ void LPFormulator::optimizeBoundsOfNeuronsWithLpRlaxation( ThreadArgument &args,
 
 void LPFormulator::tightenSingleVariableBoundsWithLPRelaxation( ThreadArgument &argument )
 {
+    Options::Scope optionsScope( argument._options );
+
     try
     {
         GurobiWrapper *gurobi = argument._gurobi;
@@ -41,6 +41,8 @@ Layer::Layer( unsigned index, Type type, unsigned size, LayerOwner *layerOwner )
     , _assignment( NULL )
     , _lb( NULL )
     , _ub( NULL )
+    , _obtainedLb( NULL )
+    , _obtainedUb( NULL )
     , _inputLayerSize( 0 )
     , _symbolicLb( NULL )
     , _symbolicUb( NULL )
@@ -68,6 +70,12 @@ void Layer::allocateMemory()
     std::fill_n( _lb, _size, 0 );
     std::fill_n( _ub, _size, 0 );
 
+    _obtainedLb = new double[_size];
+    _obtainedUb = new double[_size];
+
+    std::fill_n( _obtainedLb, _size, 0 );
+    std::fill_n( _obtainedUb, _size, 0 );
+
     _assignment = new double[_size];
 
     _simulations.assign(
@@ -665,6 +673,34 @@ void Layer::obtainCurrentBounds()
     }
 }
 
+void Layer::obtainAndRememberCurrentBounds()
+{
+    obtainCurrentBounds();
+    memcpy( _obtainedLb, _lb, sizeof( double ) * _size );
+    memcpy( _obtainedUb, _ub, sizeof( double ) * _size );
+}
+
+bool Layer::currentBoundsChanged() const
+{
+    const ITableau *tableau = _layerOwner->getTableau();
+    for ( const auto &entry : _neuronToVariable )
+    {
+        unsigned neuron = entry.first;
+        double lb = tableau->getLowerBound( entry.second );
+        double ub = tableau->getUpperBound( entry.second );
+
+        // The previous propagation started from the obtained bounds, and
+        // possibly tightened them into the layer's current ones. If the
+        // Tableau has either, that propagation is still up to date
+        if ( lb != _obtainedLb[neuron] && lb != _lb[neuron] )
+            return true;
+        if ( ub != _obtainedUb[neuron] && ub != _ub[neuron] )
+            return true;
+    }
+
+    return false;
+}
+
 double Layer::getLb( unsigned neuron ) const
 {
     if ( _eliminatedNeurons.exists( neuron ) )
@@ -1385,6 +1421,37 @@ void Layer::computeSymbolicBounds()
     }
 }
 
+void Layer::parallelForNeurons( const ThreadPool::RangeFunction &function ) const
+{
+    unsigned minNeuronsPerThread =
+        GlobalConfiguration::SYMBOLIC_BOUND_TIGHTENING_MIN_ENTRIES_PER_THREAD /
+        std::max( _inputLayerSize, 1u );
+    ThreadPool::get()->parallelFor( _size, minNeuronsPerThread, function );
+}
+
+void Layer::storeTighterSymbolicBounds()
+{
+    for ( unsigned i = 0; i < _size; ++i )
+    {
+        if ( _eliminatedNeurons.exists( i ) )
+            continue;
+
+        if ( _lb[i] < _symbolicLbOfLb[i] )
+        {
+            _lb[i] = _symbolicLbOfLb[i];
+            _layerOwner->receiveTighterBound(
+                Tightening( _neuronToVariable[i], _lb[i], Tightening::LB ) );
+        }
+
+        if ( _ub[i] > _symbolicUbOfUb[i] )
+        {
+            _ub[i] = _symbolicUbOfUb[i];
+            _layerOwner->receiveTighterBound(
+                Tightening( _neuronToVariable[i], _ub[i], Tightening::UB ) );
+        }
+    }
+}
+
 void Layer::computeSymbolicBoundsDefault()
 {
     // This is the default operation, for layers that are not
@@ -1469,156 +1536,143 @@ void Layer::computeSymbolicBoundsForRelu()
         }
     }
 
-    for ( unsigned i = 0; i < _size; ++i )
-    {
-        if ( _eliminatedNeurons.exists( i ) )
-            continue;
-
-        /*
-          There are two ways we can determine that a ReLU has become fixed:
-
-          1. If the ReLU's variable has been externally fixed
-          2. lbLb >= 0 (ACTIVE) or ubUb <= 0 (INACTIVE)
-        */
-        PhaseStatus reluPhase = PHASE_NOT_FIXED;
+    parallelForNeurons( [this]( unsigned begin, unsigned end ) {
+        for ( unsigned i = begin; i < end; ++i )
+        {
+            if ( _eliminatedNeurons.exists( i ) )
+                continue;
 
-        // Has the f variable been eliminated or fixed?
-        if ( FloatUtils::isPositive( _lb[i] ) )
-            reluPhase = RELU_PHASE_ACTIVE;
-        else if ( FloatUtils::isZero( _ub[i] ) )
-            reluPhase = RELU_PHASE_INACTIVE;
+            /*
+              There are two ways we can determine that a ReLU has become fixed:
 
-        ASSERT( _neuronToActivationSources.exists( i ) );
-        NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-        const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
+              1. If the ReLU's variable has been externally fixed
+              2. lbLb >= 0 (ACTIVE) or ubUb <= 0 (INACTIVE)
+            */
+            PhaseStatus reluPhase = PHASE_NOT_FIXED;
 
-        /*
-          A ReLU initially "inherits" the symbolic bounds computed
-          for its input variable
-        */
-        unsigned sourceLayerSize = sourceLayer->getSize();
-        const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
-        const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
+            // Has the f variable been eliminated or fixed?
+            if ( FloatUtils::isPositive( _lb[i] ) )
+                reluPhase = RELU_PHASE_ACTIVE;
+            else if ( FloatUtils::isZero( _ub[i] ) )
+                reluPhase = RELU_PHASE_INACTIVE;
 
-        for ( unsigned j = 0; j < _inputLayerSize; ++j )
-        {
-            _symbolicLb[j * _size + i] =
-                sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
-            _symbolicUb[j * _size + i] =
-                sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
-        }
-        _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
-        _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
+            ASSERT( _neuronToActivationSources.exists( i ) );
+            NeuronIndex sourceIndex = *_neuronToActivationSources.at( i ).begin();
+            const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
 
-        double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
-        double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
+            /*
+              A ReLU initially "inherits" the symbolic bounds computed
+              for its input variable
+            */
+            unsigned sourceLayerSize = sourceLayer->getSize();
+            const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
+            const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
 
-        _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
-        _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
-        _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
-        _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
+            for ( unsigned j = 0; j < _inputLayerSize; ++j )
+            {
+                _symbolicLb[j * _size + i] =
+                    sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
+                _symbolicUb[j * _size + i] =
+                    sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
+            }
+            _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
+            _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
 
-        // Has the b variable been fixed?
-        if ( !FloatUtils::isNegative( sourceLb ) )
-        {
-            reluPhase = RELU_PHASE_ACTIVE;
-        }
-        else if ( !FloatUtils::isPositive( sourceUb ) )
-        {
-            reluPhase = RELU_PHASE_INACTIVE;
-        }
+            double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
+            double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
 
-        if ( reluPhase == PHASE_NOT_FIXED )
-        {
-            // If we got here, we know that lbLb < 0 and ubUb
-            // > 0 There are four possible cases, depending on
-            // whether ubLb and lbUb are negative or positive
-            // (see Neurify paper, page 14).
+            _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
+            _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
+            _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
+            _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
 
-            // Upper bound
-            if ( _symbolicLbOfUb[i] <= 0 )
+            // Has the b variable been fixed?
+            if ( !FloatUtils::isNegative( sourceLb ) )
             {
-                // lbOfUb[i] < 0 < ubOfUb[i]
-                // Concretize the upper bound using the Ehler's-like approximation
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
-                    _symbolicUb[j * _size + i] = _symbolicUb[j * _size + i] * _symbolicUbOfUb[i] /
-                                                 ( _symbolicUbOfUb[i] - _symbolicLbOfUb[i] );
-
-                // Do the same for the bias, and then adjust
-                _symbolicUpperBias[i] = _symbolicUpperBias[i] * _symbolicUbOfUb[i] /
-                                        ( _symbolicUbOfUb[i] - _symbolicLbOfUb[i] );
-                _symbolicUpperBias[i] -= _symbolicLbOfUb[i] * _symbolicUbOfUb[i] /
-                                         ( _symbolicUbOfUb[i] - _symbolicLbOfUb[i] );
+                reluPhase = RELU_PHASE_ACTIVE;
             }
-
-            // Lower bound
-            if ( _symbolicUbOfLb[i] <= 0 )
+            else if ( !FloatUtils::isPositive( sourceUb ) )
             {
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
-                    _symbolicLb[j * _size + i] = 0;
-
-                _symbolicLowerBias[i] = 0;
+                reluPhase = RELU_PHASE_INACTIVE;
             }
-            else
+
+            if ( reluPhase == PHASE_NOT_FIXED )
             {
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
-                    _symbolicLb[j * _size + i] = _symbolicLb[j * _size + i] * _symbolicUbOfLb[i] /
-                                                 ( _symbolicUbOfLb[i] - _symbolicLbOfLb[i] );
+                // If we got here, we know that lbLb < 0 and ubUb
+                // > 0 There are four possible cases, depending on
+                // whether ubLb and lbUb are negative or positive
+                // (see Neurify paper, page 14).
 
-                _symbolicLowerBias[i] = _symbolicLowerBias[i] * _symbolicUbOfLb[i] /
-                                        ( _symbolicUbOfLb[i] - _symbolicLbOfLb[i] );
-            }
+                // Upper bound
+                if ( _symbolicLbOfUb[i] <= 0 )
+                {
+                    // lbOfUb[i] < 0 < ubOfUb[i]
+                    // Concretize the upper bound using the Ehler's-like approximation
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                        _symbolicUb[j * _size + i] =
+                            _symbolicUb[j * _size + i] * _symbolicUbOfUb[i] /
+                            ( _symbolicUbOfUb[i] - _symbolicLbOfUb[i] );
+
+                    // Do the same for the bias, and then adjust
+                    _symbolicUpperBias[i] = _symbolicUpperBias[i] * _symbolicUbOfUb[i] /
+                                            ( _symbolicUbOfUb[i] - _symbolicLbOfUb[i] );
+                    _symbolicUpperBias[i] -= _symbolicLbOfUb[i] * _symbolicUbOfUb[i] /
+                                             ( _symbolicUbOfUb[i] - _symbolicLbOfUb[i] );
+                }
 
-            _symbolicLbOfLb[i] = 0;
-        }
-        else
-        {
-            // The phase of this ReLU is fixed!
-            if ( reluPhase == RELU_PHASE_ACTIVE )
-            {
-                // Active ReLU, bounds are propagated as is
+                // Lower bound
+                if ( _symbolicUbOfLb[i] <= 0 )
+                {
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                        _symbolicLb[j * _size + i] = 0;
+
+                    _symbolicLowerBias[i] = 0;
+                }
+                else
+                {
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                        _symbolicLb[j * _size + i] =
+                            _symbolicLb[j * _size + i] * _symbolicUbOfLb[i] /
+                            ( _symbolicUbOfLb[i] - _symbolicLbOfLb[i] );
+
+                    _symbolicLowerBias[i] = _symbolicLowerBias[i] * _symbolicUbOfLb[i] /
+                                            ( _symbolicUbOfLb[i] - _symbolicLbOfLb[i] );
+                }
+
+                _symbolicLbOfLb[i] = 0;
             }
             else
             {
-                // Inactive ReLU, returns zero
-                _symbolicLbOfLb[i] = 0;
-                _symbolicUbOfLb[i] = 0;
-                _symbolicLbOfUb[i] = 0;
-                _symbolicUbOfUb[i] = 0;
-
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                // The phase of this ReLU is fixed!
+                if ( reluPhase == RELU_PHASE_ACTIVE )
                 {
-                    _symbolicUb[j * _size + i] = 0;
-                    _symbolicLb[j * _size + i] = 0;
+                    // Active ReLU, bounds are propagated as is
                 }
+                else
+                {
+                    // Inactive ReLU, returns zero
+                    _symbolicLbOfLb[i] = 0;
+                    _symbolicUbOfLb[i] = 0;
+                    _symbolicLbOfUb[i] = 0;
+                    _symbolicUbOfUb[i] = 0;
 
-                _symbolicLowerBias[i] = 0;
-                _symbolicUpperBias[i] = 0;
-            }
-        }
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    {
+                        _symbolicUb[j * _size + i] = 0;
+                        _symbolicLb[j * _size + i] = 0;
+                    }
 
-        if ( _symbolicLbOfUb[i] < 0 )
-            _symbolicLbOfUb[i] = 0;
+                    _symbolicLowerBias[i] = 0;
+                    _symbolicUpperBias[i] = 0;
+                }
+            }
 
-        /*
-          We now have the tightest bounds we can for the relu
-          variable. If they are tigheter than what was previously
-          known, store them.
-        */
-        if ( _lb[i] < _symbolicLbOfLb[i] )
-        {
-            _lb[i] = _symbolicLbOfLb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _lb[i], Tightening::LB ) );
+            if ( _symbolicLbOfUb[i] < 0 )
+                _symbolicLbOfUb[i] = 0;
         }
+    } );
 
-        if ( _ub[i] > _symbolicUbOfUb[i] )
-        {
-            _ub[i] = _symbolicUbOfUb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _ub[i], Tightening::UB ) );
-        }
-    }
+    storeTighterSymbolicBounds();
 }
 
 void Layer::computeSymbolicBoundsForSign()
@@ -1628,7 +1682,6 @@ void Layer::computeSymbolicBoundsForSign()
 
     for ( unsigned i = 0; i < _size; ++i )
     {
-        // Eliminate neurons are skipped
         if ( _eliminatedNeurons.exists( i ) )
         {
             _symbolicLowerBias[i] = _eliminatedNeurons[i];
@@ -1638,201 +1691,190 @@ void Layer::computeSymbolicBoundsForSign()
             _symbolicUbOfLb[i] = _eliminatedNeurons[i];
             _symbolicLbOfUb[i] = _eliminatedNeurons[i];
             _symbolicUbOfUb[i] = _eliminatedNeurons[i];
-
-            continue;
         }
+    }
 
-        /*
-          There are two ways we can determine that a Sign has become fixed:
-
-          1. If the Sign's variable has been externally fixed
-          2. lbLb >= 0 (Positive) or ubUb < 0 (Negative)
-        */
-        PhaseStatus signPhase = PHASE_NOT_FIXED;
+    parallelForNeurons( [this]( unsigned begin, unsigned end ) {
+        for ( unsigned i = begin; i < end; ++i )
+        {
+            if ( _eliminatedNeurons.exists( i ) )
+                continue;
 
-        // Has the f variable been eliminated or fixed?
-        if ( !FloatUtils::isNegative( _lb[i] ) )
-            signPhase = SIGN_PHASE_POSITIVE;
-        else if ( FloatUtils::isNegative( _ub[i] ) )
-            signPhase = SIGN_PHASE_NEGATIVE;
+            /*
+              There are two ways we can determine that a Sign has become fixed:
 
-        ASSERT( _neuronToActivationSources.exists( i ) );
-        NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-        const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
+              1. If the Sign's variable has been externally fixed
+              2. lbLb >= 0 (Positive) or ubUb < 0 (Negative)
+            */
+            PhaseStatus signPhase = PHASE_NOT_FIXED;
 
-        /*
-          A Sign initially "inherits" the symbolic bounds computed
-          for its input variable
-        */
-        unsigned sourceLayerSize = sourceLayer->getSize();
-        const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
-        const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
+            // Has the f variable been eliminated or fixed?
+            if ( !FloatUtils::isNegative( _lb[i] ) )
+                signPhase = SIGN_PHASE_POSITIVE;
+            else if ( FloatUtils::isNegative( _ub[i] ) )
+                signPhase = SIGN_PHASE_NEGATIVE;
 
-        for ( unsigned j = 0; j < _inputLayerSize; ++j )
-        {
-            _symbolicLb[j * _size + i] =
-                sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
-            _symbolicUb[j * _size + i] =
-                sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
-        }
-        _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
-        _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
+            ASSERT( _neuronToActivationSources.exists( i ) );
+            NeuronIndex sourceIndex = *_neuronToActivationSources.at( i ).begin();
+            const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
 
-        double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
-        double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
+            /*
+              A Sign initially "inherits" the symbolic bounds computed
+              for its input variable
+            */
+            unsigned sourceLayerSize = sourceLayer->getSize();
+            const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
+            const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
 
-        _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
-        _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
-        _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
-        _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
+            for ( unsigned j = 0; j < _inputLayerSize; ++j )
+            {
+                _symbolicLb[j * _size + i] =
+                    sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
+                _symbolicUb[j * _size + i] =
+                    sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
+            }
+            _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
+            _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
 
-        // Has the b variable been fixed?
-        if ( !FloatUtils::isNegative( sourceLb ) )
-        {
-            signPhase = SIGN_PHASE_POSITIVE;
-        }
-        else if ( FloatUtils::isNegative( sourceUb ) )
-        {
-            signPhase = SIGN_PHASE_NEGATIVE;
-        }
+            double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
+            double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
 
-        if ( signPhase == PHASE_NOT_FIXED )
-        {
-            PhaseStatus upperSignPhase = PHASE_NOT_FIXED;
-            PhaseStatus lowerSignPhase = PHASE_NOT_FIXED;
+            _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
+            _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
+            _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
+            _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
 
-            // If we got here, we know that lbLb < 0 and ubUb
-            // > 0
+            // Has the b variable been fixed?
+            if ( !FloatUtils::isNegative( sourceLb ) )
+            {
+                signPhase = SIGN_PHASE_POSITIVE;
+            }
+            else if ( FloatUtils::isNegative( sourceUb ) )
+            {
+                signPhase = SIGN_PHASE_NEGATIVE;
+            }
 
-            // Upper bound
-            if ( !FloatUtils::isNegative( _symbolicLbOfUb[i] ) )
+            if ( signPhase == PHASE_NOT_FIXED )
             {
-                // The upper bound is strictly positive - turns into
-                // the constant 1
+                PhaseStatus upperSignPhase = PHASE_NOT_FIXED;
+                PhaseStatus lowerSignPhase = PHASE_NOT_FIXED;
 
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
-                    _symbolicUb[j * _size + i] = 0;
+                // If we got here, we know that lbLb < 0 and ubUb
+                // > 0
 
-                _symbolicUpperBias[i] = 1;
+                // Upper bound
+                if ( !FloatUtils::isNegative( _symbolicLbOfUb[i] ) )
+                {
+                    // The upper bound is strictly positive - turns into
+                    // the constant 1
 
-                upperSignPhase = SIGN_PHASE_POSITIVE;
-            }
-            else
-            {
-                // The upper bound's phase is not fixed, use the
-                // parallelogram approximation
-                double factor = -2.0 / _symbolicLbOfLb[i];
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                        _symbolicUb[j * _size + i] = 0;
 
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
-                    _symbolicUb[j * _size + i] *= factor;
+                    _symbolicUpperBias[i] = 1;
 
+                    upperSignPhase = SIGN_PHASE_POSITIVE;
+                }
+                else
+                {
+                    // The upper bound's phase is not fixed, use the
+                    // parallelogram approximation
+                    double factor = -2.0 / _symbolicLbOfLb[i];
 
-                // Do the same for the bias, and then adjust
-                _symbolicUpperBias[i] *= factor;
-                _symbolicUpperBias[i] += 1;
-            }
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                        _symbolicUb[j * _size + i] *= factor;
 
-            // Lower bound
-            if ( FloatUtils::isNegative( _symbolicUbOfLb[i] ) )
-            {
-                // The lower bound is strictly negative - turns into
-                // the constant -1
 
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
-                    _symbolicLb[j * _size + i] = 0;
+                    // Do the same for the bias, and then adjust
+                    _symbolicUpperBias[i] *= factor;
+                    _symbolicUpperBias[i] += 1;
+                }
 
-                _symbolicLowerBias[i] = -1;
+                // Lower bound
+                if ( FloatUtils::isNegative( _symbolicUbOfLb[i] ) )
+                {
+                    // The lower bound is strictly negative - turns into
+                    // the constant -1
 
-                lowerSignPhase = SIGN_PHASE_NEGATIVE;
-            }
-            else
-            {
-                // The lower bound's phase is not fixed, use the
-                // parallelogram approximation
-                double factor = 2.0 / _symbolicUbOfUb[i];
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                        _symbolicLb[j * _size + i] = 0;
 
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    _symbolicLowerBias[i] = -1;
+
+                    lowerSignPhase = SIGN_PHASE_NEGATIVE;
+                }
+                else
                 {
-                    _symbolicLb[j * _size + i] *= factor;
+                    // The lower bound's phase is not fixed, use the
+                    // parallelogram approximation
+                    double factor = 2.0 / _symbolicUbOfUb[i];
+
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    {
+                        _symbolicLb[j * _size + i] *= factor;
+                    }
+
+                    // Do the same for the bias, and then adjust
+                    _symbolicLowerBias[i] *= factor;
+                    _symbolicLowerBias[i] -= 1;
                 }
 
-                // Do the same for the bias, and then adjust
-                _symbolicLowerBias[i] *= factor;
-                _symbolicLowerBias[i] -= 1;
-            }
+                if ( upperSignPhase == PHASE_NOT_FIXED )
+                {
+                    _symbolicUbOfUb[i] = 1;
+                    _symbolicLbOfUb[i] = -1;
+                }
+                else
+                {
+                    _symbolicUbOfUb[i] = 1;
+                    _symbolicLbOfUb[i] = 1;
+                }
 
-            if ( upperSignPhase == PHASE_NOT_FIXED )
-            {
-                _symbolicUbOfUb[i] = 1;
-                _symbolicLbOfUb[i] = -1;
+                if ( lowerSignPhase == PHASE_NOT_FIXED )
+                {
+                    _symbolicUbOfLb[i] = 1;
+                    _symbolicLbOfLb[i] = -1;
+                }
+                else
+                {
+                    _symbolicUbOfLb[i] = -1;
+                    _symbolicLbOfLb[i] = -1;
+                }
             }
             else
             {
-                _symbolicUbOfUb[i] = 1;
-                _symbolicLbOfUb[i] = 1;
-            }
+                // The phase of this Sign is fixed!
+                double constant = ( signPhase == SIGN_PHASE_POSITIVE ) ? 1 : -1;
 
-            if ( lowerSignPhase == PHASE_NOT_FIXED )
-            {
-                _symbolicUbOfLb[i] = 1;
-                _symbolicLbOfLb[i] = -1;
-            }
-            else
-            {
-                _symbolicUbOfLb[i] = -1;
-                _symbolicLbOfLb[i] = -1;
-            }
-        }
-        else
-        {
-            // The phase of this Sign is fixed!
-            double constant = ( signPhase == SIGN_PHASE_POSITIVE ) ? 1 : -1;
+                _symbolicLbOfLb[i] = constant;
+                _symbolicUbOfLb[i] = constant;
+                _symbolicLbOfUb[i] = constant;
+                _symbolicUbOfUb[i] = constant;
 
-            _symbolicLbOfLb[i] = constant;
-            _symbolicUbOfLb[i] = constant;
-            _symbolicLbOfUb[i] = constant;
-            _symbolicUbOfUb[i] = constant;
+                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                {
+                    _symbolicUb[j * _size + i] = 0;
+                    _symbolicLb[j * _size + i] = 0;
+                }
 
-            for ( unsigned j = 0; j < _inputLayerSize; ++j )
-            {
-                _symbolicUb[j * _size + i] = 0;
-                _symbolicLb[j * _size + i] = 0;
+                _symbolicLowerBias[i] = constant;
+                _symbolicUpperBias[i] = constant;
             }
 
-            _symbolicLowerBias[i] = constant;
-            _symbolicUpperBias[i] = constant;
+            if ( _symbolicLbOfLb[i] < -1 )
+                _symbolicLbOfLb[i] = -1;
+            if ( _symbolicUbOfUb[i] > 1 )
+                _symbolicUbOfUb[i] = 1;
         }
+    } );
 
-        if ( _symbolicLbOfLb[i] < -1 )
-            _symbolicLbOfLb[i] = -1;
-        if ( _symbolicUbOfUb[i] > 1 )
-            _symbolicUbOfUb[i] = 1;
+    storeTighterSymbolicBounds();
+}
 
-        /*
-          We now have the tightest bounds we can for the sign
-          variable. If they are tigheter than what was previously
-          known, store them.
-        */
-        if ( _lb[i] < _symbolicLbOfLb[i] )
-        {
-            _lb[i] = _symbolicLbOfLb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _lb[i], Tightening::LB ) );
-        }
-
-        if ( _ub[i] > _symbolicUbOfUb[i] )
-        {
-            _ub[i] = _symbolicUbOfUb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _ub[i], Tightening::UB ) );
-        }
-    }
-}
-
-void Layer::computeSymbolicBoundsForAbsoluteValue()
-{
-    std::fill_n( _symbolicLb, _size * _inputLayerSize, 0 );
-    std::fill_n( _symbolicUb, _size * _inputLayerSize, 0 );
+void Layer::computeSymbolicBoundsForAbsoluteValue()
+{
+    std::fill_n( _symbolicLb, _size * _inputLayerSize, 0 );
+    std::fill_n( _symbolicUb, _size * _inputLayerSize, 0 );
 
     for ( unsigned i = 0; i < _size; ++i )
     {
@@ -1845,120 +1887,109 @@ void Layer::computeSymbolicBoundsForAbsoluteValue()
             _symbolicUbOfLb[i] = _eliminatedNeurons[i];
             _symbolicLbOfUb[i] = _eliminatedNeurons[i];
             _symbolicUbOfUb[i] = _eliminatedNeurons[i];
-
-            continue;
         }
+    }
 
-        PhaseStatus absPhase = PHASE_NOT_FIXED;
-
-        ASSERT( _neuronToActivationSources.exists( i ) );
-        NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-        const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
-
-        unsigned sourceLayerSize = sourceLayer->getSize();
-        const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
-        const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
-
-        for ( unsigned j = 0; j < _inputLayerSize; ++j )
+    parallelForNeurons( [this]( unsigned begin, unsigned end ) {
+        for ( unsigned i = begin; i < end; ++i )
         {
-            _symbolicLb[j * _size + i] =
-                sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
-            _symbolicUb[j * _size + i] =
-                sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
-        }
-
-        _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
-        _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
+            if ( _eliminatedNeurons.exists( i ) )
+                continue;
 
-        double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
-        double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
+            PhaseStatus absPhase = PHASE_NOT_FIXED;
 
-        _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
-        _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
-        _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
-        _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
+            ASSERT( _neuronToActivationSources.exists( i ) );
+            NeuronIndex sourceIndex = *_neuronToActivationSources.at( i ).begin();
+            const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
 
-        if ( sourceLb >= 0 )
-            absPhase = ABS_PHASE_POSITIVE;
-        else if ( sourceUb <= 0 )
-            absPhase = ABS_PHASE_NEGATIVE;
+            unsigned sourceLayerSize = sourceLayer->getSize();
+            const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
+            const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
 
-        if ( absPhase == PHASE_NOT_FIXED )
-        {
-            // If we got here, we know that lbOfLb < 0 < ubOfUb. In this case,
-            // we do naive concretization: lb is 0, ub is the max between
-            // -lb and ub of the input neuron
             for ( unsigned j = 0; j < _inputLayerSize; ++j )
             {
-                _symbolicLb[j * _size + i] = 0;
-                _symbolicUb[j * _size + i] = 0;
+                _symbolicLb[j * _size + i] =
+                    sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
+                _symbolicUb[j * _size + i] =
+                    sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
             }
 
-            _symbolicLowerBias[i] = 0;
-            _symbolicUpperBias[i] = FloatUtils::max( -sourceLb, sourceUb );
+            _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
+            _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
 
-            _symbolicLbOfLb[i] = 0;
-            _symbolicUbOfLb[i] = _symbolicUpperBias[i];
-            _symbolicLbOfUb[i] = 0;
-            _symbolicUbOfUb[i] = _symbolicUpperBias[i];
-        }
-        else
-        {
-            // The phase of this AbsoluteValueConstraint is fixed!
-            if ( absPhase == ABS_PHASE_POSITIVE )
+            double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
+            double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
+
+            _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
+            _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
+            _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
+            _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
+
+            if ( sourceLb >= 0 )
+                absPhase = ABS_PHASE_POSITIVE;
+            else if ( sourceUb <= 0 )
+                absPhase = ABS_PHASE_NEGATIVE;
+
+            if ( absPhase == PHASE_NOT_FIXED )
             {
-                // Positive AbsoluteValue, bounds are propagated as is
+                // If we got here, we know that lbOfLb < 0 < ubOfUb. In this case,
+                // we do naive concretization: lb is 0, ub is the max between
+                // -lb and ub of the input neuron
+                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                {
+                    _symbolicLb[j * _size + i] = 0;
+                    _symbolicUb[j * _size + i] = 0;
+                }
+
+                _symbolicLowerBias[i] = 0;
+                _symbolicUpperBias[i] = FloatUtils::max( -sourceLb, sourceUb );
+
+                _symbolicLbOfLb[i] = 0;
+                _symbolicUbOfLb[i] = _symbolicUpperBias[i];
+                _symbolicLbOfUb[i] = 0;
+                _symbolicUbOfUb[i] = _symbolicUpperBias[i];
             }
             else
             {
-                // Negative AbsoluteValue, bounds are negated and flipped
-                double temp;
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                // The phase of this AbsoluteValueConstraint is fixed!
+                if ( absPhase == ABS_PHASE_POSITIVE )
                 {
-                    temp = _symbolicUb[j * _size + i];
-                    _symbolicUb[j * _size + i] = -_symbolicLb[j * _size + i];
-                    _symbolicLb[j * _size + i] = -temp;
+                    // Positive AbsoluteValue, bounds are propagated as is
                 }
+                else
+                {
+                    // Negative AbsoluteValue, bounds are negated and flipped
+                    double temp;
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    {
+                        temp = _symbolicUb[j * _size + i];
+                        _symbolicUb[j * _size + i] = -_symbolicLb[j * _size + i];
+                        _symbolicLb[j * _size + i] = -temp;
+                    }
 
-                temp = _symbolicLowerBias[i];
-                _symbolicLowerBias[i] = -_symbolicUpperBias[i];
-                _symbolicUpperBias[i] = -temp;
+                    temp = _symbolicLowerBias[i];
+                    _symbolicLowerBias[i] = -_symbolicUpperBias[i];
+                    _symbolicUpperBias[i] = -temp;
 
-                // Old lb, negated, is the new ub
-                temp = _symbolicLbOfLb[i];
-                _symbolicLbOfLb[i] = -_symbolicUbOfUb[i];
-                _symbolicUbOfUb[i] = -temp;
+                    // Old lb, negated, is the new ub
+                    temp = _symbolicLbOfLb[i];
+                    _symbolicLbOfLb[i] = -_symbolicUbOfUb[i];
+                    _symbolicUbOfUb[i] = -temp;
 
-                temp = _symbolicUbOfLb[i];
-                _symbolicUbOfLb[i] = -_symbolicLbOfUb[i];
-                _symbolicLbOfUb[i] = -temp;
+                    temp = _symbolicUbOfLb[i];
+                    _symbolicUbOfLb[i] = -_symbolicLbOfUb[i];
+                    _symbolicLbOfUb[i] = -temp;
+                }
             }
-        }
-
-        // In extreme cases (constraint set externally), _symbolicLbOfLb
-        // could be negative - so adjust this
-        if ( _symbolicLbOfLb[i] < 0 )
-            _symbolicLbOfLb[i] = 0;
 
-        /*
-          We now have the tightest bounds we can for the abs
-          variable. If they are tigheter than what was previously
-          known, store them.
-        */
-        if ( _lb[i] < _symbolicLbOfLb[i] )
-        {
-            _lb[i] = _symbolicLbOfLb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _lb[i], Tightening::LB ) );
+            // In extreme cases (constraint set externally), _symbolicLbOfLb
+            // could be negative - so adjust this
+            if ( _symbolicLbOfLb[i] < 0 )
+                _symbolicLbOfLb[i] = 0;
         }
+    } );
 
-        if ( _ub[i] > _symbolicUbOfUb[i] )
-        {
-            _ub[i] = _symbolicUbOfUb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _ub[i], Tightening::UB ) );
-        }
-    }
+    storeTighterSymbolicBounds();
 }
 
 void Layer::computeSymbolicBoundsForLeakyRelu()
@@ -1982,231 +2013,216 @@ void Layer::computeSymbolicBoundsForLeakyRelu()
         }
     }
 
-    for ( unsigned i = 0; i < _size; ++i )
-    {
-        if ( _eliminatedNeurons.exists( i ) )
-            continue;
-
-        /*
-          There are two ways we can determine that a LeakyReLU has become fixed:
+    parallelForNeurons( [this]( unsigned begin, unsigned end ) {
+        for ( unsigned i = begin; i < end; ++i )
+        {
+            if ( _eliminatedNeurons.exists( i ) )
+                continue;
 
-          1. If the LeakyReLU's variable has been externally fixed
-          2. lbLb >= 0 (ACTIVE) or ubUb <= 0 (INACTIVE)
-        */
-        PhaseStatus leakyReluPhase = PHASE_NOT_FIXED;
+            /*
+              There are two ways we can determine that a LeakyReLU has become fixed:
 
-        // Has the f variable been eliminated or fixed?
-        if ( FloatUtils::isPositive( _lb[i] ) )
-            leakyReluPhase = RELU_PHASE_ACTIVE;
-        else if ( FloatUtils::isZero( _ub[i] ) )
-            leakyReluPhase = RELU_PHASE_INACTIVE;
+              1. If the LeakyReLU's variable has been externally fixed
+              2. lbLb >= 0 (ACTIVE) or ubUb <= 0 (INACTIVE)
+            */
+            PhaseStatus leakyReluPhase = PHASE_NOT_FIXED;
 
-        ASSERT( _neuronToActivationSources.exists( i ) );
-        NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-        const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
+            // Has the f variable been eliminated or fixed?
+            if ( FloatUtils::isPositive( _lb[i] ) )
+                leakyReluPhase = RELU_PHASE_ACTIVE;
+            else if ( FloatUtils::isZero( _ub[i] ) )
+                leakyReluPhase = RELU_PHASE_INACTIVE;
 
-        /*
-          A LeakyReLU initially "inherits" the symbolic bounds computed
-          for its input variable
-        */
-        unsigned sourceLayerSize = sourceLayer->getSize();
-        const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
-        const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
+            ASSERT( _neuronToActivationSources.exists( i ) );
+            NeuronIndex sourceIndex = *_neuronToActivationSources.at( i ).begin();
+            const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
 
-        for ( unsigned j = 0; j < _inputLayerSize; ++j )
-        {
-            _symbolicLb[j * _size + i] =
-                sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
-            _symbolicUb[j * _size + i] =
-                sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
-        }
-        _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
-        _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
+            /*
+              A LeakyReLU initially "inherits" the symbolic bounds computed
+              for its input variable
+            */
+            unsigned sourceLayerSize = sourceLayer->getSize();
+            const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
+            const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
 
-        double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
-        double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
+            for ( unsigned j = 0; j < _inputLayerSize; ++j )
+            {
+                _symbolicLb[j * _size + i] =
+                    sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
+                _symbolicUb[j * _size + i] =
+                    sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
+            }
+            _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
+            _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
 
-        _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
-        _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
-        _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
-        _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
+            double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
+            double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
 
-        // Has the b variable been fixed?
-        if ( !FloatUtils::isNegative( sourceLb ) )
-        {
-            leakyReluPhase = RELU_PHASE_ACTIVE;
-        }
-        else if ( !FloatUtils::isPositive( sourceUb ) )
-        {
-            leakyReluPhase = RELU_PHASE_INACTIVE;
-        }
+            _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
+            _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
+            _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
+            _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
 
-        if ( leakyReluPhase == PHASE_NOT_FIXED )
-        {
-            // LeakyReLU not fixed
-            // Symbolic upper bound: x_f <= (x_b - l) * u / ( u - l)
-            // Concrete upper bound: x_f <= ub_b
-            double width = sourceUb - sourceLb;
-            double coeff = ( sourceUb - _alpha * sourceLb ) / width;
+            // Has the b variable been fixed?
+            if ( !FloatUtils::isNegative( sourceLb ) )
+            {
+                leakyReluPhase = RELU_PHASE_ACTIVE;
+            }
+            else if ( !FloatUtils::isPositive( sourceUb ) )
+            {
+                leakyReluPhase = RELU_PHASE_INACTIVE;
+            }
 
-            if ( _alpha <= 1 )
+            if ( leakyReluPhase == PHASE_NOT_FIXED )
             {
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                // LeakyReLU not fixed
+                // Symbolic upper bound: x_f <= (x_b - l) * u / ( u - l)
+                // Concrete upper bound: x_f <= ub_b
+                double width = sourceUb - sourceLb;
+                double coeff = ( sourceUb - _alpha * sourceLb ) / width;
+
+                if ( _alpha <= 1 )
                 {
-                    _symbolicUb[j * _size + i] *= coeff;
-                }
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    {
+                        _symbolicUb[j * _size + i] *= coeff;
+                    }
 
-                // Do the same for the bias, and then adjust
-                _symbolicUpperBias[i] *= coeff;
-                _symbolicUpperBias[i] += ( ( _alpha - 1 ) * sourceUb * sourceLb ) / width;
+                    // Do the same for the bias, and then adjust
+                    _symbolicUpperBias[i] *= coeff;
+                    _symbolicUpperBias[i] += ( ( _alpha - 1 ) * sourceUb * sourceLb ) / width;
 
 
-                // For the lower bound, in general, x_f >= lambda * x_b, where
-                // 0 <= lambda <= 1, would be a sound lower bound. We
-                // use the heuristic described in section 4.1 of
-                // https://files.sri.inf.ethz.ch/website/papers/DeepPoly.pdf
-                // to set the value of lambda (either 0 or 1 is considered).
-                if ( sourceUb > sourceLb )
-                {
-                    // lambda = 1
-                    // Symbolic lower bound: x_f >= x_b
-                    // Concrete lower bound: x_f >= sourceLb
+                    // For the lower bound, in general, x_f >= lambda * x_b, where
+                    // 0 <= lambda <= 1, would be a sound lower bound. We
+                    // use the heuristic described in section 4.1 of
+                    // https://files.sri.inf.ethz.ch/website/papers/DeepPoly.pdf
+                    // to set the value of lambda (either 0 or 1 is considered).
+                    if ( sourceUb > sourceLb )
+                    {
+                        // lambda = 1
+                        // Symbolic lower bound: x_f >= x_b
+                        // Concrete lower bound: x_f >= sourceLb
 
-                    // Lower bounds are passed as is
+                        // Lower bounds are passed as is
+                    }
+                    else
+                    {
+                        // lambda = 1
+                        // Symbolic lower bound: x_f >= _alpha x_b
+                        // Concrete lower bound: x_f >= 0
+
+                        for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                        {
+                            _symbolicLb[j * _size + i] *= _alpha;
+                        }
+
+                        _symbolicLowerBias[i] *= _alpha;
+                    }
                 }
                 else
                 {
-                    // lambda = 1
-                    // Symbolic lower bound: x_f >= _alpha x_b
-                    // Concrete lower bound: x_f >= 0
-
                     for ( unsigned j = 0; j < _inputLayerSize; ++j )
                     {
-                        _symbolicLb[j * _size + i] *= _alpha;
+                        _symbolicLb[j * _size + i] *= coeff;
                     }
 
-                    _symbolicLowerBias[i] *= _alpha;
-                }
-            }
-            else
-            {
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
-                {
-                    _symbolicLb[j * _size + i] *= coeff;
-                }
-
-                // Do the same for the bias, and then adjust
-                _symbolicLowerBias[i] *= coeff;
-                _symbolicLowerBias[i] += ( ( _alpha - 1 ) * sourceUb * sourceLb ) / width;
+                    // Do the same for the bias, and then adjust
+                    _symbolicLowerBias[i] *= coeff;
+                    _symbolicLowerBias[i] += ( ( _alpha - 1 ) * sourceUb * sourceLb ) / width;
 
-                if ( sourceUb > sourceLb )
-                {
-                    // Upper bounds are passed as is
-                }
-                else
-                {
-                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    if ( sourceUb > sourceLb )
                     {
-                        _symbolicUb[j * _size + i] *= _alpha;
+                        // Upper bounds are passed as is
                     }
+                    else
+                    {
+                        for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                        {
+                            _symbolicUb[j * _size + i] *= _alpha;
+                        }
 
-                    _symbolicUpperBias[i] *= _alpha;
+                        _symbolicUpperBias[i] *= _alpha;
+                    }
                 }
-            }
 
-            /*
-              We now have the symbolic representation for the current
-              layer. Next, we compute new lower and upper bounds for
-              it. For each of these bounds, we compute an upper bound and
-              a lower bound.
-            */
-            _symbolicLbOfLb[i] = _symbolicLowerBias[i];
-            _symbolicUbOfLb[i] = _symbolicLowerBias[i];
-            _symbolicLbOfUb[i] = _symbolicUpperBias[i];
-            _symbolicUbOfUb[i] = _symbolicUpperBias[i];
+                /*
+                  We now have the symbolic representation for the current
+                  layer. Next, we compute new lower and upper bounds for
+                  it. For each of these bounds, we compute an upper bound and
+                  a lower bound.
+                */
+                _symbolicLbOfLb[i] = _symbolicLowerBias[i];
+                _symbolicUbOfLb[i] = _symbolicLowerBias[i];
+                _symbolicLbOfUb[i] = _symbolicUpperBias[i];
+                _symbolicUbOfUb[i] = _symbolicUpperBias[i];
 
-            for ( unsigned j = 0; j < _inputLayerSize; ++j )
-            {
-                double inputLb = _layerOwner->getLayer( 0 )->getLb( j );
-                double inputUb = _layerOwner->getLayer( 0 )->getUb( j );
+                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                {
+                    double inputLb = _layerOwner->getLayer( 0 )->getLb( j );
+                    double inputUb = _layerOwner->getLayer( 0 )->getUb( j );
 
-                double entry = _symbolicLb[j * _size + i];
+                    double entry = _symbolicLb[j * _size + i];
 
-                if ( entry >= 0 )
-                {
-                    _symbolicLbOfLb[i] += ( entry * inputLb );
-                    _symbolicUbOfLb[i] += ( entry * inputUb );
-                }
-                else
-                {
-                    _symbolicLbOfLb[i] += ( entry * inputUb );
-                    _symbolicUbOfLb[i] += ( entry * inputLb );
-                }
+                    if ( entry >= 0 )
+                    {
+                        _symbolicLbOfLb[i] += ( entry * inputLb );
+                        _symbolicUbOfLb[i] += ( entry * inputUb );
+                    }
+                    else
+                    {
+                        _symbolicLbOfLb[i] += ( entry * inputUb );
+                        _symbolicUbOfLb[i] += ( entry * inputLb );
+                    }
 
-                entry = _symbolicUb[j * _size + i];
+                    entry = _symbolicUb[j * _size + i];
 
-                if ( entry >= 0 )
-                {
-                    _symbolicLbOfUb[i] += ( entry * inputLb );
-                    _symbolicUbOfUb[i] += ( entry * inputUb );
-                }
-                else
-                {
-                    _symbolicLbOfUb[i] += ( entry * inputUb );
-                    _symbolicUbOfUb[i] += ( entry * inputLb );
+                    if ( entry >= 0 )
+                    {
+                        _symbolicLbOfUb[i] += ( entry * inputLb );
+                        _symbolicUbOfUb[i] += ( entry * inputUb );
+                    }
+                    else
+                    {
+                        _symbolicLbOfUb[i] += ( entry * inputUb );
+                        _symbolicUbOfUb[i] += ( entry * inputLb );
+                    }
                 }
             }
-        }
-        else
-        {
-            // The phase of this LeakyReLU is fixed!
-            if ( leakyReluPhase == RELU_PHASE_ACTIVE )
-            {
-                // Positive LeakyReLU, bounds are propagated as is
-            }
             else
             {
-                // Negative LeakyReLU, bounds are multiplied by _alpha
-                _symbolicLbOfLb[i] *= _alpha;
-                _symbolicUbOfLb[i] *= _alpha;
-                _symbolicLbOfUb[i] *= _alpha;
-                _symbolicUbOfUb[i] *= _alpha;
-
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                // The phase of this LeakyReLU is fixed!
+                if ( leakyReluPhase == RELU_PHASE_ACTIVE )
                 {
-                    _symbolicUb[j * _size + i] *= _alpha;
-                    _symbolicLb[j * _size + i] *= _alpha;
+                    // Positive LeakyReLU, bounds are propagated as is
                 }
+                else
+                {
+                    // Negative LeakyReLU, bounds are multiplied by _alpha
+                    _symbolicLbOfLb[i] *= _alpha;
+                    _symbolicUbOfLb[i] *= _alpha;
+                    _symbolicLbOfUb[i] *= _alpha;
+                    _symbolicUbOfUb[i] *= _alpha;
 
-                _symbolicLowerBias[i] *= _alpha;
-                _symbolicUpperBias[i] *= _alpha;
-            }
-        }
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    {
+                        _symbolicUb[j * _size + i] *= _alpha;
+                        _symbolicLb[j * _size + i] *= _alpha;
+                    }
 
-        if ( _symbolicUbOfUb[i] > sourceUb )
-            _symbolicUbOfUb[i] = sourceUb;
-        if ( _symbolicLbOfLb[i] < _alpha * sourceLb )
-            _symbolicLbOfLb[i] = _alpha * sourceLb;
+                    _symbolicLowerBias[i] *= _alpha;
+                    _symbolicUpperBias[i] *= _alpha;
+                }
+            }
 
-        /*
-          We now have the tightest bounds we can for the leakyRelu
-          variable. If they are tigheter than what was previously
-          known, store them.
-        */
-        if ( _lb[i] < _symbolicLbOfLb[i] )
-        {
-            _lb[i] = _symbolicLbOfLb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _lb[i], Tightening::LB ) );
+            if ( _symbolicUbOfUb[i] > sourceUb )
+                _symbolicUbOfUb[i] = sourceUb;
+            if ( _symbolicLbOfLb[i] < _alpha * sourceLb )
+                _symbolicLbOfLb[i] = _alpha * sourceLb;
         }
+    } );
 
-        if ( _ub[i] > _symbolicUbOfUb[i] )
-        {
-            _ub[i] = _symbolicUbOfUb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _ub[i], Tightening::UB ) );
-        }
-    }
+    storeTighterSymbolicBounds();
 }
 
 
@@ -2229,187 +2245,173 @@ void Layer::computeSymbolicBoundsForSigmoid()
         }
     }
 
-    for ( unsigned i = 0; i < _size; ++i )
-    {
-        if ( _eliminatedNeurons.exists( i ) )
-            continue;
-
-        ASSERT( _neuronToActivationSources.exists( i ) );
-        NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-        const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
-
-        /*
-          A Sigmoid initially "inherits" the symbolic bounds computed
-          for its input variable
-        */
-        unsigned sourceLayerSize = sourceLayer->getSize();
-        const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
-        const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
-
-        for ( unsigned j = 0; j < _inputLayerSize; ++j )
+    parallelForNeurons( [this]( unsigned begin, unsigned end ) {
+        for ( unsigned i = begin; i < end; ++i )
         {
-            _symbolicLb[j * _size + i] =
-                sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
-            _symbolicUb[j * _size + i] =
-                sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
-        }
-        _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
-        _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
-
-        double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
-        double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
+            if ( _eliminatedNeurons.exists( i ) )
+                continue;
 
-        _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
-        _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
-        _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
-        _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
+            ASSERT( _neuronToActivationSources.exists( i ) );
+            NeuronIndex sourceIndex = *_neuronToActivationSources.at( i ).begin();
+            const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
 
-        // Bounds of lb, ub are the Sigmoids of source lb, ub
-        double sourceUbSigmoid = SigmoidConstraint::sigmoid( sourceUb );
-        double sourceLbSigmoid = SigmoidConstraint::sigmoid( sourceLb );
+            /*
+              A Sigmoid initially "inherits" the symbolic bounds computed
+              for its input variable
+            */
+            unsigned sourceLayerSize = sourceLayer->getSize();
+            const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
+            const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
 
-        // Case when the Sigmoid constraint is fixed
-        if ( FloatUtils::areEqual( FloatUtils::round( sourceUb ), FloatUtils::round( sourceLb ) ) )
-        {
             for ( unsigned j = 0; j < _inputLayerSize; ++j )
             {
-                _symbolicLb[j * _size + i] = 0;
-                _symbolicUb[j * _size + i] = 0;
+                _symbolicLb[j * _size + i] =
+                    sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
+                _symbolicUb[j * _size + i] =
+                    sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
             }
+            _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
+            _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
 
-            _symbolicLbOfUb[i] = sourceUbSigmoid;
-            _symbolicUbOfUb[i] = sourceUbSigmoid;
-            _symbolicLbOfLb[i] = sourceLbSigmoid;
-            _symbolicUbOfLb[i] = sourceLbSigmoid;
+            double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
+            double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
 
-            _symbolicUpperBias[i] = sourceUbSigmoid;
-            _symbolicLowerBias[i] = sourceLbSigmoid;
-        }
+            _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
+            _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
+            _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
+            _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
 
-        // Sigmoid not fixed
-        else
-        {
-            double lambda = ( _ub[i] - _lb[i] ) / ( sourceUb - sourceLb );
-            double lambdaPrime = std::min( SigmoidConstraint::sigmoidDerivative( sourceLb ),
-                                           SigmoidConstraint::sigmoidDerivative( sourceUb ) );
+            // Bounds of lb, ub are the Sigmoids of source lb, ub
+            double sourceUbSigmoid = SigmoidConstraint::sigmoid( sourceUb );
+            double sourceLbSigmoid = SigmoidConstraint::sigmoid( sourceLb );
 
-            // update lower bound
-            if ( FloatUtils::isPositive( sourceLb ) )
+            // Case when the Sigmoid constraint is fixed
+            if ( FloatUtils::areEqual( FloatUtils::round( sourceUb ),
+                                       FloatUtils::round( sourceLb ) ) )
             {
                 for ( unsigned j = 0; j < _inputLayerSize; ++j )
                 {
-                    _symbolicLb[j * _size + i] *= lambda;
+                    _symbolicLb[j * _size + i] = 0;
+                    _symbolicUb[j * _size + i] = 0;
                 }
 
-                // Do the same for the bias, and then adjust
-                _symbolicLowerBias[i] *= lambda;
-                _symbolicLowerBias[i] += sourceLbSigmoid - lambda * sourceLb;
+                _symbolicLbOfUb[i] = sourceUbSigmoid;
+                _symbolicUbOfUb[i] = sourceUbSigmoid;
+                _symbolicLbOfLb[i] = sourceLbSigmoid;
+                _symbolicUbOfLb[i] = sourceLbSigmoid;
+
+                _symbolicUpperBias[i] = sourceUbSigmoid;
+                _symbolicLowerBias[i] = sourceLbSigmoid;
             }
+
+            // Sigmoid not fixed
             else
             {
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
-                {
-                    _symbolicLb[j * _size + i] *= lambdaPrime;
-                }
+                double lambda = ( _ub[i] - _lb[i] ) / ( sourceUb - sourceLb );
+                double lambdaPrime = std::min( SigmoidConstraint::sigmoidDerivative( sourceLb ),
+                                               SigmoidConstraint::sigmoidDerivative( sourceUb ) );
 
-                // Do the same for the bias, and then adjust
-                _symbolicLowerBias[i] *= lambdaPrime;
-                _symbolicLowerBias[i] += sourceLbSigmoid - lambdaPrime * sourceLb;
-            }
+                // update lower bound
+                if ( FloatUtils::isPositive( sourceLb ) )
+                {
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    {
+                        _symbolicLb[j * _size + i] *= lambda;
+                    }
 
-            // update upper bound
-            if ( !FloatUtils::isPositive( sourceUb ) )
-            {
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    // Do the same for the bias, and then adjust
+                    _symbolicLowerBias[i] *= lambda;
+                    _symbolicLowerBias[i] += sourceLbSigmoid - lambda * sourceLb;
+                }
+                else
                 {
-                    _symbolicUb[j * _size + i] *= lambda;
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    {
+                        _symbolicLb[j * _size + i] *= lambdaPrime;
+                    }
+
+                    // Do the same for the bias, and then adjust
+                    _symbolicLowerBias[i] *= lambdaPrime;
+                    _symbolicLowerBias[i] += sourceLbSigmoid - lambdaPrime * sourceLb;
                 }
 
-                // Do the same for the bias, and then adjust
-                _symbolicUpperBias[i] *= lambda;
-                _symbolicUpperBias[i] += sourceUbSigmoid - lambda * sourceUb;
-            }
-            else
-            {
-                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                // update upper bound
+                if ( !FloatUtils::isPositive( sourceUb ) )
                 {
-                    _symbolicUb[j * _size + i] *= lambdaPrime;
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    {
+                        _symbolicUb[j * _size + i] *= lambda;
+                    }
+
+                    // Do the same for the bias, and then adjust
+                    _symbolicUpperBias[i] *= lambda;
+                    _symbolicUpperBias[i] += sourceUbSigmoid - lambda * sourceUb;
                 }
+                else
+                {
+                    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                    {
+                        _symbolicUb[j * _size + i] *= lambdaPrime;
+                    }
 
-                // Do the same for the bias, and then adjust
-                _symbolicUpperBias[i] *= lambdaPrime;
-                _symbolicUpperBias[i] += sourceUbSigmoid - lambdaPrime * sourceUb;
-            }
+                    // Do the same for the bias, and then adjust
+                    _symbolicUpperBias[i] *= lambdaPrime;
+                    _symbolicUpperBias[i] += sourceUbSigmoid - lambdaPrime * sourceUb;
+                }
 
 
-            /*
-              We now have the symbolic representation for the current
-              layer. Next, we compute new lower and upper bounds for
-              it. For each of these bounds, we compute an upper bound and
-              a lower bound.
-            */
-            _symbolicLbOfLb[i] = _symbolicLowerBias[i];
-            _symbolicUbOfLb[i] = _symbolicLowerBias[i];
-            _symbolicLbOfUb[i] = _symbolicUpperBias[i];
-            _symbolicUbOfUb[i] = _symbolicUpperBias[i];
+                /*
+                  We now have the symbolic representation for the current
+                  layer. Next, we compute new lower and upper bounds for
+                  it. For each of these bounds, we compute an upper bound and
+                  a lower bound.
+                */
+                _symbolicLbOfLb[i] = _symbolicLowerBias[i];
+                _symbolicUbOfLb[i] = _symbolicLowerBias[i];
+                _symbolicLbOfUb[i] = _symbolicUpperBias[i];
+                _symbolicUbOfUb[i] = _symbolicUpperBias[i];
 
-            for ( unsigned j = 0; j < _inputLayerSize; ++j )
-            {
-                double inputLb = _layerOwner->getLayer( 0 )->getLb( j );
-                double inputUb = _layerOwner->getLayer( 0 )->getUb( j );
+                for ( unsigned j = 0; j < _inputLayerSize; ++j )
+                {
+                    double inputLb = _layerOwner->getLayer( 0 )->getLb( j );
+                    double inputUb = _layerOwner->getLayer( 0 )->getUb( j );
 
-                double entry = _symbolicLb[j * _size + i];
+                    double entry = _symbolicLb[j * _size + i];
 
-                if ( entry >= 0 )
-                {
-                    _symbolicLbOfLb[i] += ( entry * inputLb );
-                    _symbolicUbOfLb[i] += ( entry * inputUb );
-                }
-                else
-                {
-                    _symbolicLbOfLb[i] += ( entry * inputUb );
-                    _symbolicUbOfLb[i] += ( entry * inputLb );
-                }
+                    if ( entry >= 0 )
+                    {
+                        _symbolicLbOfLb[i] += ( entry * inputLb );
+                        _symbolicUbOfLb[i] += ( entry * inputUb );
+                    }
+                    else
+                    {
+                        _symbolicLbOfLb[i] += ( entry * inputUb );
+                        _symbolicUbOfLb[i] += ( entry * inputLb );
+                    }
 
-                entry = _symbolicUb[j * _size + i];
+                    entry = _symbolicUb[j * _size + i];
 
-                if ( entry >= 0 )
-                {
-                    _symbolicLbOfUb[i] += ( entry * inputLb );
-                    _symbolicUbOfUb[i] += ( entry * inputUb );
-                }
-                else
-                {
-                    _symbolicLbOfUb[i] += ( entry * inputUb );
-                    _symbolicUbOfUb[i] += ( entry * inputLb );
+                    if ( entry >= 0 )
+                    {
+                        _symbolicLbOfUb[i] += ( entry * inputLb );
+                        _symbolicUbOfUb[i] += ( entry * inputUb );
+                    }
+                    else
+                    {
+                        _symbolicLbOfUb[i] += ( entry * inputUb );
+                        _symbolicUbOfUb[i] += ( entry * inputLb );
+                    }
                 }
             }
-        }
-
-        if ( _symbolicLbOfLb[i] < -1 )
-            _symbolicLbOfLb[i] = -1;
-        if ( _symbolicUbOfUb[i] > 1 )
-            _symbolicUbOfUb[i] = 1;
 
-        /*
-          We now have the tightest bounds we can for the relu
-          variable. If they are tigheter than what was previously
-          known, store them.
-        */
-        if ( _lb[i] < _symbolicLbOfLb[i] )
-        {
-            _lb[i] = _symbolicLbOfLb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _lb[i], Tightening::LB ) );
+            if ( _symbolicLbOfLb[i] < -1 )
+                _symbolicLbOfLb[i] = -1;
+            if ( _symbolicUbOfUb[i] > 1 )
+                _symbolicUbOfUb[i] = 1;
         }
+    } );
 
-        if ( _ub[i] > _symbolicUbOfUb[i] )
-        {
-            _ub[i] = _symbolicUbOfUb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _ub[i], Tightening::UB ) );
-        }
-    }
+    storeTighterSymbolicBounds();
 }
 
 void Layer::computeSymbolicBoundsForRound()
@@ -2431,95 +2433,81 @@ void Layer::computeSymbolicBoundsForRound()
         }
     }
 
-    for ( unsigned i = 0; i < _size; ++i )
-    {
-        if ( _eliminatedNeurons.exists( i ) )
-            continue;
-
-        ASSERT( _neuronToActivationSources.exists( i ) );
-        NeuronIndex sourceIndex = *_neuronToActivationSources[i].begin();
-        const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
+    parallelForNeurons( [this]( unsigned begin, unsigned end ) {
+        for ( unsigned i = begin; i < end; ++i )
+        {
+            if ( _eliminatedNeurons.exists( i ) )
+                continue;
 
-        /*
-          A Round initially "inherits" the symbolic bounds computed
-          for its input variable
-        */
-        unsigned sourceLayerSize = sourceLayer->getSize();
-        const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
-        const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
+            ASSERT( _neuronToActivationSources.exists( i ) );
+            NeuronIndex sourceIndex = *_neuronToActivationSources.at( i ).begin();
+            const Layer *sourceLayer = _layerOwner->getLayer( sourceIndex._layer );
 
-        for ( unsigned j = 0; j < _inputLayerSize; ++j )
-        {
-            _symbolicLb[j * _size + i] =
-                sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
-            _symbolicUb[j * _size + i] =
-                sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
-        }
-        _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
-        _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
+            /*
+              A Round initially "inherits" the symbolic bounds computed
+              for its input variable
+            */
+            unsigned sourceLayerSize = sourceLayer->getSize();
+            const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
+            const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
 
-        double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
-        double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
+            for ( unsigned j = 0; j < _inputLayerSize; ++j )
+            {
+                _symbolicLb[j * _size + i] =
+                    sourceSymbolicLb[j * sourceLayerSize + sourceIndex._neuron];
+                _symbolicUb[j * _size + i] =
+                    sourceSymbolicUb[j * sourceLayerSize + sourceIndex._neuron];
+            }
+            _symbolicLowerBias[i] = sourceLayer->getSymbolicLowerBias()[sourceIndex._neuron];
+            _symbolicUpperBias[i] = sourceLayer->getSymbolicUpperBias()[sourceIndex._neuron];
 
-        _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
-        _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
-        _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
-        _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
+            double sourceLb = sourceLayer->getLb( sourceIndex._neuron );
+            double sourceUb = sourceLayer->getUb( sourceIndex._neuron );
 
+            _symbolicLbOfLb[i] = sourceLayer->getSymbolicLbOfLb( sourceIndex._neuron );
+            _symbolicUbOfLb[i] = sourceLayer->getSymbolicUbOfLb( sourceIndex._neuron );
+            _symbolicLbOfUb[i] = sourceLayer->getSymbolicLbOfUb( sourceIndex._neuron );
+            _symbolicUbOfUb[i] = sourceLayer->getSymbolicUbOfUb( sourceIndex._neuron );
 
-        // Bounds of lb, ub are the rounded values of source lb, ub
-        double sourceUbRound = FloatUtils::round( sourceUb );
-        double sourceLbRound = FloatUtils::round( sourceLb );
 
-        _symbolicLbOfUb[i] = sourceUbRound;
-        _symbolicUbOfUb[i] = sourceUbRound;
-        _symbolicLbOfLb[i] = sourceLbRound;
-        _symbolicUbOfLb[i] = sourceLbRound;
+            // Bounds of lb, ub are the rounded values of source lb, ub
+            double sourceUbRound = FloatUtils::round( sourceUb );
+            double sourceLbRound = FloatUtils::round( sourceLb );
 
+            _symbolicLbOfUb[i] = sourceUbRound;
+            _symbolicUbOfUb[i] = sourceUbRound;
+            _symbolicLbOfLb[i] = sourceLbRound;
+            _symbolicUbOfLb[i] = sourceLbRound;
 
-        // Case when the Round constraint is fixed
-        if ( FloatUtils::areEqual( FloatUtils::round( sourceUb ), FloatUtils::round( sourceLb ) ) )
-        {
-            _symbolicUb[i] = 0;
-            _symbolicUpperBias[i] = sourceUbRound;
 
-            _symbolicLb[i] = 0;
-            _symbolicLowerBias[i] = sourceLbRound;
-        }
+            // Case when the Round constraint is fixed
+            if ( FloatUtils::areEqual( FloatUtils::round( sourceUb ),
+                                       FloatUtils::round( sourceLb ) ) )
+            {
+                _symbolicUb[i] = 0;
+                _symbolicUpperBias[i] = sourceUbRound;
 
-        // Round not fixed
-        else
-        {
-            // Symbolic upper bound: x_f <= x_b + 0.5
-            // Concrete upper bound: x_f <= round(ub_b)
+                _symbolicLb[i] = 0;
+                _symbolicLowerBias[i] = sourceLbRound;
+            }
 
-            _symbolicUpperBias[i] += 0.5;
+            // Round not fixed
+            else
+            {
+                // Symbolic upper bound: x_f <= x_b + 0.5
+                // Concrete upper bound: x_f <= round(ub_b)
 
-            // Symbolic lower bound: x_f >= x_b - 0.5
-            // Concrete lower bound: x_f >= round(lb_b)
+                _symbolicUpperBias[i] += 0.5;
 
-            _symbolicLowerBias[i] -= 0.5;
-        }
+                // Symbolic lower bound: x_f >= x_b - 0.5
+                // Concrete lower bound: x_f >= round(lb_b)
 
-        /*
-          We now have the tightest bounds we can for the relu
-          variable. If they are tigheter than what was previously
-          known, store them.
-        */
-        if ( _lb[i] < _symbolicLbOfLb[i] )
-        {
-            _lb[i] = _symbolicLbOfLb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _lb[i], Tightening::LB ) );
+                _symbolicLowerBias[i] -= 0.5;
+            }
         }
+    } );
 
-        if ( _ub[i] > _symbolicUbOfUb[i] )
-        {
-            _ub[i] = _symbolicUbOfUb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _ub[i], Tightening::UB ) );
-        }
-    }
+    storeTighterSymbolicBounds();
 }
 
 void Layer::computeSymbolicBoundsForMax()
@@ -3303,28 +3291,34 @@ void Layer::computeSymbolicBoundsForWeightedSum()
         /*
           Compute the biases for the new layer
         */
-        for ( unsigned j = 0; j < _size; ++j )
-        {
-            if ( _eliminatedNeurons.exists( j ) )
-                continue;
+        const double *weights = _layerToWeights[sourceLayerIndex];
+        const double *sourceLowerBias = sourceLayer->getSymbolicLowerBias();
+        const double *sourceUpperBias = sourceLayer->getSymbolicUpperBias();
 
-            // Add the weighted bias from the source layer
-            for ( unsigned k = 0; k < sourceLayerSize; ++k )
+        parallelForNeurons( [&]( unsigned begin, unsigned end ) {
+            for ( unsigned j = begin; j < end; ++j )
             {
-                double weight = _layerToWeights[sourceLayerIndex][k * _size + j];
+                if ( _eliminatedNeurons.exists( j ) )
+                    continue;
 
-                if ( weight > 0 )
-                {
-                    _symbolicLowerBias[j] += sourceLayer->getSymbolicLowerBias()[k] * weight;
-                    _symbolicUpperBias[j] += sourceLayer->getSymbolicUpperBias()[k] * weight;
-                }
-                else
+                // Add the weighted bias from the source layer
+                for ( unsigned k = 0; k < sourceLayerSize; ++k )
                 {
-                    _symbolicLowerBias[j] += sourceLayer->getSymbolicUpperBias()[k] * weight;
-                    _symbolicUpperBias[j] += sourceLayer->getSymbolicLowerBias()[k] * weight;
+                    double weight = weights[k * _size + j];
+
+                    if ( weight > 0 )
+                    {
+                        _symbolicLowerBias[j] += sourceLowerBias[k] * weight;
+                        _symbolicUpperBias[j] += sourceUpperBias[k] * weight;
+                    }
+                    else
+                    {
+                        _symbolicLowerBias[j] += sourceUpperBias[k] * weight;
+                        _symbolicUpperBias[j] += sourceLowerBias[k] * weight;
+                    }
                 }
             }
-        }
+        } );
     }
 
 
@@ -3334,67 +3328,53 @@ void Layer::computeSymbolicBoundsForWeightedSum()
       it. For each of these bounds, we compute an upper bound and
       a lower bound.
     */
-    for ( unsigned i = 0; i < _size; ++i )
-    {
-        if ( _eliminatedNeurons.exists( i ) )
-            continue;
-
-        _symbolicLbOfLb[i] = _symbolicLowerBias[i];
-        _symbolicUbOfLb[i] = _symbolicLowerBias[i];
-        _symbolicLbOfUb[i] = _symbolicUpperBias[i];
-        _symbolicUbOfUb[i] = _symbolicUpperBias[i];
-
-        for ( unsigned j = 0; j < _inputLayerSize; ++j )
+    const Layer *inputLayer = _layerOwner->getLayer( 0 );
+    parallelForNeurons( [this, inputLayer]( unsigned begin, unsigned end ) {
+        for ( unsigned i = begin; i < end; ++i )
         {
-            double inputLb = _layerOwner->getLayer( 0 )->getLb( j );
-            double inputUb = _layerOwner->getLayer( 0 )->getUb( j );
+            if ( _eliminatedNeurons.exists( i ) )
+                continue;
 
-            double entry = _symbolicLb[j * _size + i];
+            _symbolicLbOfLb[i] = _symbolicLowerBias[i];
+            _symbolicUbOfLb[i] = _symbolicLowerBias[i];
+            _symbolicLbOfUb[i] = _symbolicUpperBias[i];
+            _symbolicUbOfUb[i] = _symbolicUpperBias[i];
 
-            if ( entry >= 0 )
-            {
-                _symbolicLbOfLb[i] += ( entry * inputLb );
-                _symbolicUbOfLb[i] += ( entry * inputUb );
-            }
-            else
+            for ( unsigned j = 0; j < _inputLayerSize; ++j )
             {
-                _symbolicLbOfLb[i] += ( entry * inputUb );
-                _symbolicUbOfLb[i] += ( entry * inputLb );
-            }
+                double inputLb = inputLayer->getLb( j );
+                double inputUb = inputLayer->getUb( j );
 
-            entry = _symbolicUb[j * _size + i];
+                double entry = _symbolicLb[j * _size + i];
 
-            if ( entry >= 0 )
-            {
-                _symbolicLbOfUb[i] += ( entry * inputLb );
-                _symbolicUbOfUb[i] += ( entry * inputUb );
-            }
-            else
-            {
-                _symbolicLbOfUb[i] += ( entry * inputUb );
-                _symbolicUbOfUb[i] += ( entry * inputLb );
-            }
-        }
+                if ( entry >= 0 )
+                {
+                    _symbolicLbOfLb[i] += ( entry * inputLb );
+                    _symbolicUbOfLb[i] += ( entry * inputUb );
+                }
+                else
+                {
+                    _symbolicLbOfLb[i] += ( entry * inputUb );
+                    _symbolicUbOfLb[i] += ( entry * inputLb );
+                }
 
-        /*
-          We now have the tightest bounds we can for the
-          weighted sum variable. If they are tigheter than
-          what was previously known, store them.
-        */
-        if ( _lb[i] < _symbolicLbOfLb[i] )
-        {
-            _lb[i] = _symbolicLbOfLb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _lb[i], Tightening::LB ) );
-        }
+                entry = _symbolicUb[j * _size + i];
 
-        if ( _ub[i] > _symbolicUbOfUb[i] )
-        {
-            _ub[i] = _symbolicUbOfUb[i];
-            _layerOwner->receiveTighterBound(
-                Tightening( _neuronToVariable[i], _ub[i], Tightening::UB ) );
+                if ( entry >= 0 )
+                {
+                    _symbolicLbOfUb[i] += ( entry * inputLb );
+                    _symbolicUbOfUb[i] += ( entry * inputUb );
+                }
+                else
+                {
+                    _symbolicLbOfUb[i] += ( entry * inputUb );
+                    _symbolicUbOfUb[i] += ( entry * inputLb );
+                }
+            }
         }
-    }
+    } );
+
+    storeTighterSymbolicBounds();
 }
 
 double Layer::softmaxLSELowerBound( const Vector<double> &inputs,
@@ -3779,6 +3759,8 @@ Layer::Layer( const Layer *other )
     , _assignment( NULL )
     , _lb( NULL )
     , _ub( NULL )
+    , _obtainedLb( NULL )
+    , _obtainedUb( NULL )
     , _inputLayerSize( 0 )
     , _symbolicLb( NULL )
     , _symbolicUb( NULL )
@@ -3909,6 +3891,18 @@ void Layer::freeMemoryIfNeeded()
         _ub = NULL;
     }
 
+    if ( _obtainedLb )
+    {
+        delete[] _obtainedLb;
+        _obtainedLb = NULL;
+    }
+
+    if ( _obtainedUb )
+    {
+        delete[] _obtainedUb;
+        _obtainedUb = NULL;
+    }
+
     if ( _symbolicLb )
     {
         delete[] _symbolicLb;
@@ -27,6 +27,7 @@
 #include "ReluConstraint.h"
 #include "SigmoidConstraint.h"
 #include "SignConstraint.h"
+#include "ThreadPool.h"
 #include "Vector.h"
 
 namespace NLR {
@@ -137,6 +138,15 @@ public:
     void obtainCurrentBounds( const Query &inputQuery );
     void obtainCurrentBounds();
     void computeSymbolicBounds();
+
+    /*
+      For incremental propagation: obtain the current bounds from the
+      Tableau and remember them, and check whether the bounds of the
+      Tableau have changed since, i.e. whether any of them is neither the
+      remembered bound nor the one that the layer currently has.
+    */
+    void obtainAndRememberCurrentBounds();
+    bool currentBoundsChanged() const;
     void computeIntervalArithmeticBounds();
 
     /*
@@ -184,6 +194,10 @@ private:
     double *_lb;
     double *_ub;
 
+    // The bounds last obtained by obtainAndRememberCurrentBounds()
+    double *_obtainedLb;
+    double *_obtainedUb;
+
     Map<unsigned, List<NeuronIndex>> _neuronToActivationSources;
 
     Map<unsigned, unsigned> _neuronToVariable;
@@ -292,6 +306,20 @@ private:
     void computeSymbolicBoundsForBilinear();
     void computeSymbolicBoundsDefault();
 
+    /*
+      Run the function on ranges of the neurons of the layer, split
+      between the threads of the pool when the layer is wide enough. The
+      function may only write the symbolic bounds of its own neurons.
+    */
+    void parallelForNeurons( const ThreadPool::RangeFunction &function ) const;
+
+    /*
+      Tighten the bounds of the (non-eliminated) neurons to the concrete
+      bounds of their symbolic bounds, where tighter, and report them to the
+      layer owner in the order of the neurons
+    */
+    void storeTighterSymbolicBounds();
+
     /*
       Helper functions for interval bound tightening
     */
@@ -412,6 +412,8 @@ void MILPFormulator::optimizeBoundsOfNeuronsWithMILPEncoding( ThreadArgument &ar
 
 void MILPFormulator::tightenSingleVariableBoundsWithMILPEncoding( ThreadArgument &argument )
 {
+    Options::Scope optionsScope( argument._options );
+
     try
     {
         /*
@@ -31,6 +31,7 @@
 #include "Query.h"
 #include "ReluConstraint.h"
 #include "SignConstraint.h"
+#include "Tracer.h"
 
 #include <cstring>
 
@@ -41,6 +42,8 @@ namespace NLR {
 NetworkLevelReasoner::NetworkLevelReasoner()
     : _tableau( NULL )
     , _deepPolyAnalysis( nullptr )
+    , _incrementalPropagationValid( false )
+    , _incrementalPropagationType( SymbolicBoundTighteningType::NONE )
 {
 }
 
@@ -200,12 +203,18 @@ void NetworkLevelReasoner::clearConstraintTightenings()
 
 void NetworkLevelReasoner::symbolicBoundPropagation()
 {
+    TraceSpan span( "NLR::symbolicBoundPropagation" );
+
+    _incrementalPropagationValid = false;
     for ( unsigned i = 0; i < _layerIndexToLayer.size(); ++i )
         _layerIndexToLayer[i]->computeSymbolicBounds();
 }
 
 void NetworkLevelReasoner::deepPolyPropagation()
 {
+    TraceSpan span( "NLR::deepPolyPropagation" );
+
+    _incrementalPropagationValid = false;
     if ( _deepPolyAnalysis == nullptr )
         _deepPolyAnalysis = std::unique_ptr<DeepPolyAnalysis>( new DeepPolyAnalysis( this ) );
     _deepPolyAnalysis->run();
@@ -213,6 +222,9 @@ void NetworkLevelReasoner::deepPolyPropagation()
 
 void NetworkLevelReasoner::lpRelaxationPropagation()
 {
+    TraceSpan span( "NLR::lpRelaxationPropagation" );
+
+    _incrementalPropagationValid = false;
     LPFormulator lpFormulator( this );
     lpFormulator.setCutoff( 0 );
 
@@ -231,6 +243,7 @@ void NetworkLevelReasoner::lpRelaxationPropagation()
 
 void NetworkLevelReasoner::LPTighteningForOneLayer( unsigned targetIndex )
 {
+    _incrementalPropagationValid = false;
     LPFormulator lpFormulator( this );
     lpFormulator.setCutoff( 0 );
 
@@ -243,6 +256,9 @@ void NetworkLevelReasoner::LPTighteningForOneLayer( unsigned targetIndex )
 
 void NetworkLevelReasoner::MILPPropagation()
 {
+    TraceSpan span( "NLR::MILPPropagation" );
+
+    _incrementalPropagationValid = false;
     MILPFormulator milpFormulator( this );
     milpFormulator.setCutoff( 0 );
 
@@ -256,6 +272,7 @@ void NetworkLevelReasoner::MILPPropagation()
 
 void NetworkLevelReasoner::MILPTighteningForOneLayer( unsigned targetIndex )
 {
+    _incrementalPropagationValid = false;
     MILPFormulator milpFormulator( this );
     milpFormulator.setCutoff( 0 );
 
@@ -268,6 +285,9 @@ void NetworkLevelReasoner::MILPTighteningForOneLayer( unsigned targetIndex )
 
 void NetworkLevelReasoner::iterativePropagation()
 {
+    TraceSpan span( "NLR::iterativePropagation" );
+
+    _incrementalPropagationValid = false;
     IterativePropagator iterativePropagator( this );
     iterativePropagator.setCutoff( 0 );
     iterativePropagator.optimizeBoundsWithIterativePropagation( _layerIndexToLayer );
@@ -275,12 +295,214 @@ void NetworkLevelReasoner::iterativePropagation()
 
 void NetworkLevelReasoner::intervalArithmeticBoundPropagation()
 {
+    TraceSpan span( "NLR::intervalArithmeticBoundPropagation" );
+
+    _incrementalPropagationValid = false;
     for ( unsigned i = 1; i < _layerIndexToLayer.size(); ++i )
         _layerIndexToLayer[i]->computeIntervalArithmeticBounds();
 }
 
+unsigned
+NetworkLevelReasoner::incrementalSymbolicBoundPropagation( SymbolicBoundTighteningType type )
+{
+    TraceSpan span( "NLR::incrementalSymbolicBoundPropagation" );
+
+    ASSERT( _tableau );
+
+    unsigned numberOfLayers = _layerIndexToLayer.size();
+    unsigned firstLayer = 0;
+    if ( _incrementalPropagationValid && _incrementalPropagationType == type )
+    {
+        while ( firstLayer < numberOfLayers &&
+                !_layerIndexToLayer[firstLayer]->currentBoundsChanged() )
+            ++firstLayer;
+    }
+
+    // If the propagation is interrupted, the layers are left inconsistent
+    _incrementalPropagationValid = false;
+    _incrementalPropagationType = type;
+
+    for ( unsigned i = firstLayer; i < numberOfLayers; ++i )
+        _layerIndexToLayer[i]->obtainAndRememberCurrentBounds();
+
+    if ( firstLayer < numberOfLayers )
+    {
+        if ( type == SymbolicBoundTighteningType::SYMBOLIC_BOUND_TIGHTENING )
+        {
+            for ( unsigned i = firstLayer; i < numberOfLayers; ++i )
+                _layerIndexToLayer[i]->computeSymbolicBounds();
+        }
+        else if ( type == SymbolicBoundTighteningType::DEEP_POLY )
+        {
+            if ( _deepPolyAnalysis == nullptr )
+                _deepPolyAnalysis =
+                    std::unique_ptr<DeepPolyAnalysis>( new DeepPolyAnalysis( this ) );
+            _deepPolyAnalysis->run( firstLayer );
+        }
+    }
+
+    _incrementalPropagationValid = true;
+    return firstLayer;
+}
+
+unsigned NetworkLevelReasoner::setOutputSpecifications( const List<Equation> &equations )
+{
+    _outputSpecifications.clear();
+    _outputSpecificationLayer = nullptr;
+
+    if ( _layerIndexToLayer.size() < 2 )
+        return 0;
+
+    unsigned outputLayerIndex = _layerIndexToLayer.size() - 1;
+    const Layer *outputLayer = _layerIndexToLayer[outputLayerIndex];
+
+    Map<unsigned, unsigned> outputVariableToNeuron;
+    for ( unsigned i = 0; i < outputLayer->getSize(); ++i )
+    {
+        if ( outputLayer->neuronHasVariable( i ) )
+            outputVariableToNeuron[outputLayer->neuronToVariable( i )] = i;
+    }
+
+    Set<unsigned> neuronVariables;
+    for ( const auto &pair : _layerIndexToLayer )
+    {
+        const Layer *layer = pair.second;
+        for ( unsigned i = 0; i < layer->getSize(); ++i )
+        {
+            if ( layer->neuronHasVariable( i ) )
+                neuronVariables.insert( layer->neuronToVariable( i ) );
+        }
+    }
+
+    List<const Equation *> specificationEquations;
+    for ( const auto &equation : equations )
+    {
+        unsigned numOutputAddends = 0;
+        unsigned numOtherAddends = 0;
+        bool valid = true;
+        for ( const auto &addend : equation._addends )
+        {
+            if ( FloatUtils::isZero( addend._coefficient ) )
+                continue;
+
+            if ( outputVariableToNeuron.exists( addend._variable ) )
+                ++numOutputAddends;
+            else if ( neuronVariables.exists( addend._variable ) )
+                valid = false;
+            else
+                ++numOtherAddends;
+        }
+
+        // An auxiliary variable is only bounded through an equality
+        if ( numOtherAddends > 0 && equation._type != Equation::EQ )
+            valid = false;
+
+        if ( valid && numOutputAddends > 0 && numOtherAddends <= 1 )
+            specificationEquations.append( &equation );
+    }
+
+    if ( specificationEquations.empty() )
+        return 0;
+
+    _outputSpecificationLayer = std::unique_ptr<Layer>(
+        new Layer( _layerIndexToLayer.size(),
+                   Layer::WEIGHTED_SUM,
+                   specificationEquations.size(),
+                   this ) );
+    _outputSpecificationLayer->addSourceLayer( outputLayerIndex, outputLayer->getSize() );
+
+    for ( const auto &equation : specificationEquations )
+    {
+        unsigned specification = _outputSpecifications.size();
+
+        OutputSpecification outputSpecification;
+        outputSpecification._type = equation->_type;
+        outputSpecification._scalar = equation->_scalar;
+        outputSpecification._hasAuxiliaryVariable = false;
+        outputSpecification._auxiliaryVariable = 0;
+        outputSpecification._auxiliaryCoefficient = 0;
+
+        // The equation is specification + coefficient * auxiliary = scalar
+        for ( const auto &addend : equation->_addends )
+        {
+            if ( FloatUtils::isZero( addend._coefficient ) )
+                continue;
+
+            if ( outputVariableToNeuron.exists( addend._variable ) )
+            {
+                _outputSpecificationLayer->setWeight( outputLayerIndex,
+                                                      outputVariableToNeuron[addend._variable],
+                                                      specification,
+                                                      addend._coefficient );
+            }
+            else
+            {
+                outputSpecification._hasAuxiliaryVariable = true;
+                outputSpecification._auxiliaryVariable = addend._variable;
+                outputSpecification._auxiliaryCoefficient = addend._coefficient;
+            }
+        }
+
+        _outputSpecifications.append( outputSpecification );
+    }
+
+    return _outputSpecifications.size();
+}
+
+void NetworkLevelReasoner::outputSpecificationPropagation()
+{
+    TraceSpan span( "NLR::outputSpecificationPropagation" );
+
+    if ( _outputSpecifications.empty() || _deepPolyAnalysis == nullptr )
+        return;
+
+    Layer *layer = _outputSpecificationLayer.get();
+    for ( unsigned i = 0; i < layer->getSize(); ++i )
+    {
+        layer->setLb( i, FloatUtils::negativeInfinity() );
+        layer->setUb( i, FloatUtils::infinity() );
+    }
+
+    _deepPolyAnalysis->boundVirtualLayer( layer );
+
+    for ( unsigned i = 0; i < _outputSpecifications.size(); ++i )
+    {
+        const OutputSpecification &specification = _outputSpecifications[i];
+        double lb = layer->getLb( i );
+        double ub = layer->getUb( i );
+
+        if ( !specification._hasAuxiliaryVariable )
+        {
+            if ( specification._type != Equation::GE &&
+                 FloatUtils::gt( lb, specification._scalar ) )
+                throw InfeasibleQueryException();
+            if ( specification._type != Equation::LE &&
+                 FloatUtils::lt( ub, specification._scalar ) )
+                throw InfeasibleQueryException();
+            continue;
+        }
+
+        // auxiliary = ( scalar - specification ) / coefficient
+        double coefficient = specification._auxiliaryCoefficient;
+        double auxiliaryLb = ( specification._scalar - ub ) / coefficient;
+        double auxiliaryUb = ( specification._scalar - lb ) / coefficient;
+        if ( coefficient < 0 )
+            std::swap( auxiliaryLb, auxiliaryUb );
+
+        if ( FloatUtils::isFinite( auxiliaryLb ) )
+            receiveTighterBound(
+                Tightening( specification._auxiliaryVariable, auxiliaryLb, Tightening::LB ) );
+        if ( FloatUtils::isFinite( auxiliaryUb ) )
+            receiveTighterBound(
+                Tightening( specification._auxiliaryVariable, auxiliaryUb, Tightening::UB ) );
+    }
+}
+
 void NetworkLevelReasoner::freeMemoryIfNeeded()
 {
+    _outputSpecifications.clear();
+    _outputSpecificationLayer = nullptr;
+
     for ( const auto &layer : _layerIndexToLayer )
         delete layer.second;
     _layerIndexToLayer.clear();
@@ -306,12 +528,14 @@ void NetworkLevelReasoner::storeIntoOther( NetworkLevelReasoner &other ) const
 void NetworkLevelReasoner::updateVariableIndices( const Map<unsigned, unsigned> &oldIndexToNewIndex,
                                                   const Map<unsigned, unsigned> &mergedVariables )
 {
+    _incrementalPropagationValid = false;
     for ( auto &layer : _layerIndexToLayer )
         layer.second->updateVariableIndices( oldIndexToNewIndex, mergedVariables );
 }
 
 void NetworkLevelReasoner::obtainCurrentBounds( const Query &inputQuery )
 {
+    _incrementalPropagationValid = false;
     for ( const auto &layer : _layerIndexToLayer )
         layer.second->obtainCurrentBounds( inputQuery );
 }
@@ -319,12 +543,14 @@ void NetworkLevelReasoner::obtainCurrentBounds( const Query &inputQuery )
 void NetworkLevelReasoner::obtainCurrentBounds()
 {
     ASSERT( _tableau );
+    _incrementalPropagationValid = false;
     for ( const auto &layer : _layerIndexToLayer )
         layer.second->obtainCurrentBounds();
 }
 
 void NetworkLevelReasoner::setTableau( const ITableau *tableau )
 {
+    _incrementalPropagationValid = false;
     _tableau = tableau;
 }
 
@@ -335,6 +561,7 @@ const ITableau *NetworkLevelReasoner::getTableau() const
 
 void NetworkLevelReasoner::eliminateVariable( unsigned variable, double value )
 {
+    _incrementalPropagationValid = false;
     for ( auto &layer : _layerIndexToLayer )
         layer.second->eliminateVariable( variable, value );
 }
@@ -676,6 +903,8 @@ NetworkLevelReasoner::mergeConsecutiveWSLayers( const Map<unsigned, double> &low
                                                 const Set<unsigned> &varsInUnhandledConstraints,
                                                 Map<unsigned, LinearExpression> &eliminatedNeurons )
 {
+    _incrementalPropagationValid = false;
+
     // Iterate over all layers, except the input layer
     unsigned layer = 1;
 
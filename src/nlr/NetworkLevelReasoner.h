@@ -24,6 +24,7 @@
 #include "MatrixMultiplication.h"
 #include "NeuronIndex.h"
 #include "PiecewiseLinearFunctionType.h"
+#include "SymbolicBoundTighteningType.h"
 #include "Tightening.h"
 #include "Vector.h"
 
@@ -130,6 +131,44 @@ public:
     void MILPTighteningForOneLayer( unsigned targetIndex );
     void iterativePropagation();
 
+    /*
+      Symbolic bound propagation or DeepPoly during the search: obtain the
+      current bounds from the tableau, and propagate them only from the
+      first layer whose bounds have changed since the previous incremental
+      propagation. The layers before it keep the concrete and symbolic
+      bounds that propagation computed for them. Obtaining the bounds or
+      propagating them in any other way makes the next incremental
+      propagation start from the first layer. Return the number of layers
+      skipped.
+    */
+    unsigned incrementalSymbolicBoundPropagation( SymbolicBoundTighteningType type );
+
+    /*
+      Backward bound propagation for output specifications, i.e. linear
+      functions of the output neurons that the query constrains, such as
+      y0 - y1 <= 0. Back-substituting a specification from the output
+      layer to the input layer gives tighter bounds for it than those of
+      the output neurons give, at the cost of one more layer of
+      DeepPoly with a neuron per specification. Inequalities usually
+      already are the last layer of the network, since the auxiliary
+      variable of each becomes a neuron, but equalities are not.
+
+      setOutputSpecifications() keeps the equations whose variables are
+      all output neurons, and the equalities that also have one variable
+      that is not a neuron of any layer, such as the auxiliary variable
+      that the preprocessor adds to an inequality. It returns how many it
+      kept, and should be called once the variables have their final
+      indices.
+
+      outputSpecificationPropagation() bounds the specifications through
+      the relaxations of the last DeepPoly propagation, and reports the
+      bounds they imply for the auxiliary variables. If a specification
+      without an auxiliary variable cannot satisfy its equation, the query
+      is infeasible.
+    */
+    unsigned setOutputSpecifications( const List<Equation> &equations );
+    void outputSpecificationPropagation();
+
     void receiveTighterBound( Tightening tightening );
     void getConstraintTightenings( List<Tightening> &tightenings );
     void clearConstraintTightenings();
@@ -210,6 +249,27 @@ private:
 
     std::unique_ptr<DeepPolyAnalysis> _deepPolyAnalysis;
 
+    // Whether the layers hold the results of the previous incremental
+    // propagation, and of which type it was
+    bool _incrementalPropagationValid;
+    SymbolicBoundTighteningType _incrementalPropagationType;
+
+    struct OutputSpecification
+    {
+        // The specification is related to _scalar by _type, or plus
+        // _auxiliaryCoefficient times _auxiliaryVariable it equals _scalar
+        Equation::EquationType _type;
+        double _scalar;
+        bool _hasAuxiliaryVariable;
+        unsigned _auxiliaryVariable;
+        double _auxiliaryCoefficient;
+    };
+
+    // The specifications, and a virtual weighted sum layer over the output
+    // layer with a neuron for each of them
+    Vector<OutputSpecification> _outputSpecifications;
+    std::unique_ptr<Layer> _outputSpecificationLayer;
+
     void freeMemoryIfNeeded();
 
     List<PiecewiseLinearConstraint *> _constraintsInTopologicalOrder;
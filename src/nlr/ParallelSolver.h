@@ -17,6 +17,7 @@
 #define __ParallelSolver_h__
 
 #include "GurobiWrapper.h"
+#include "Options.h"
 
 #include <atomic>
 #include <boost/lockfree/queue.hpp>
@@ -75,6 +76,7 @@ public:
             , _skipTightenLb( skipTightenLb )
             , _skipTightenUb( skipTightenUb )
             , _lastFixedNeuron( NULL )
+            , _options( Options::get() )
         {
         }
 
@@ -112,6 +114,7 @@ public:
             , _skipTightenLb( skipTightenLb )
             , _skipTightenUb( skipTightenUb )
             , _lastFixedNeuron( NULL )
+            , _options( Options::get() )
         {
         }
 
@@ -146,6 +149,7 @@ public:
             , _signChanges( signChanges )
             , _cutoffs( cutoffs )
             , _lastFixedNeuron( lastFixedNeuron )
+            , _options( Options::get() )
         {
         }
 
@@ -173,6 +177,7 @@ public:
             , _targetIndex( targetIndex )
             , _threads( threads )
             , _solverToIndex( solverToIndex )
+            , _options( Options::get() )
         {
         }
 
@@ -198,6 +203,9 @@ public:
         unsigned _targetIndex;
         boost::thread *_threads;
         const Map<GurobiWrapper *, unsigned> *_solverToIndex;
+
+        // The options of the spawning thread, installed by the spawned one
+        Options *_options;
     };
 
     /*
@@ -0,0 +1,177 @@
+/*********************                                                        */
+/*! \file Test_BatchedIntervalPropagator.h
+** \verbatim
+** Top contributors (to current version):
+**   Guy Katz
+** This file is part of the Marabou project.
+** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved. See the file COPYING in the top-level source
+** directory for licensing information.\endverbatim
+**
+** [[ Add lengthier description here ]]
+
+**/
+
+#include "BatchedIntervalPropagator.h"
+#include "FloatUtils.h"
+#include "Layer.h"
+#include "NetworkLevelReasoner.h"
+
+#include <cxxtest/TestSuite.h>
+
+class BatchedIntervalPropagatorTestSuite : public CxxTest::TestSuite
+{
+public:
+    void populateNetwork( NLR::NetworkLevelReasoner &nlr )
+    {
+        /*
+                a
+          x           d    f
+                b
+          y           e    g
+                c
+        */
+
+        // Create the layers
+        nlr.addLayer( 0, NLR::Layer::INPUT, 2 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, 3 );
+        nlr.addLayer( 2, NLR::Layer::RELU, 3 );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, 2 );
+        nlr.addLayer( 4, NLR::Layer::RELU, 2 );
+        nlr.addLayer( 5, NLR::Layer::WEIGHTED_SUM, 2 );
+
+        // Mark layer dependencies
+        for ( unsigned i = 1; i <= 5; ++i )
+            nlr.addLayerDependency( i - 1, i );
+
+        // Set the weights and biases for the weighted sum layers
+        nlr.setWeight( 0, 0, 1, 0, 1 );
+        nlr.setWeight( 0, 0, 1, 1, 2 );
+        nlr.setWeight( 0, 1, 1, 1, -3 );
+        nlr.setWeight( 0, 1, 1, 2, 1 );
+
+        nlr.setWeight( 2, 0, 3, 0, 1 );
+        nlr.setWeight( 2, 0, 3, 1, -1 );
+        nlr.setWeight( 2, 1, 3, 0, 1 );
+        nlr.setWeight( 2, 1, 3, 1, 1 );
+        nlr.setWeight( 2, 2, 3, 0, -1 );
+        nlr.setWeight( 2, 2, 3, 1, -1 );
+
+        nlr.setWeight( 4, 0, 5, 0, 1 );
+        nlr.setWeight( 4, 0, 5, 1, 1 );
+        nlr.setWeight( 4, 1, 5, 1, 3 );
+
+        nlr.setBias( 1, 0, 1 );
+        nlr.setBias( 3, 1, 2 );
+
+        // Mark the ReLU sources
+        nlr.addActivationSource( 1, 0, 2, 0 );
+        nlr.addActivationSource( 1, 1, 2, 1 );
+        nlr.addActivationSource( 1, 2, 2, 2 );
+
+        nlr.addActivationSource( 3, 0, 4, 0 );
+        nlr.addActivationSource( 3, 1, 4, 1 );
+    }
+
+    void test_batched_interval_propagation()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        populateNetwork( nlr );
+
+        NLR::BatchedIntervalPropagator propagator( &nlr );
+
+        /*
+          Box 1: 4 <= x <= 6, 1 <= y <= 5
+          Box 2: -2 <= x <= -1, 0 <= y <= 1
+        */
+        double inputLbs[] = { 4, 1, -2, 0 };
+        double inputUbs[] = { 6, 5, -1, 1 };
+
+        TS_ASSERT_THROWS_NOTHING( propagator.run( 2, inputLbs, inputUbs ) );
+        TS_ASSERT_EQUALS( propagator.getBatchSize(), 2U );
+
+        /*
+          Box 1:
+            a: [5, 7]     b: [-7, 9]    c: [1, 5]
+            d: [0, 15]    e: [-10, 5]
+            f: [0, 15]    g: [0, 30]
+
+          Box 2:
+            a: [-1, 0]    b: [-7, -2]   c: [0, 1]
+            d: [-1, 0]    e: [1, 2]
+            f: [0, 0]     g: [3, 6]
+        */
+        double expectedLayer1Lbs[] = { 5, -7, 1, -1, -7, 0 };
+        double expectedLayer1Ubs[] = { 7, 9, 5, 0, -2, 1 };
+        double expectedLayer3Lbs[] = { 0, -10, -1, 1 };
+        double expectedLayer3Ubs[] = { 15, 5, 0, 2 };
+        double expectedLayer5Lbs[] = { 0, 0, 0, 3 };
+        double expectedLayer5Ubs[] = { 15, 30, 0, 6 };
+
+        for ( unsigned i = 0; i < 6; ++i )
+        {
+            TS_ASSERT( FloatUtils::areEqual( propagator.getLowerBounds( 1 )[i],
+                                             expectedLayer1Lbs[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( propagator.getUpperBounds( 1 )[i],
+                                             expectedLayer1Ubs[i] ) );
+        }
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT( FloatUtils::areEqual( propagator.getLowerBounds( 3 )[i],
+                                             expectedLayer3Lbs[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( propagator.getUpperBounds( 3 )[i],
+                                             expectedLayer3Ubs[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( propagator.getLowerBounds( 5 )[i],
+                                             expectedLayer5Lbs[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( propagator.getUpperBounds( 5 )[i],
+                                             expectedLayer5Ubs[i] ) );
+        }
+
+        // Only b and e are unstable, and only in the first box
+        bool expectedLayer2Mask[] = { true, false, true, true, true, true };
+        bool expectedLayer4Mask[] = { true, false, true, true };
+
+        TS_ASSERT_EQUALS( propagator.getStabilityMask( 2 ).size(), 6U );
+        for ( unsigned i = 0; i < 6; ++i )
+            TS_ASSERT_EQUALS( propagator.getStabilityMask( 2 )[i], expectedLayer2Mask[i] );
+
+        TS_ASSERT_EQUALS( propagator.getStabilityMask( 4 ).size(), 4U );
+        for ( unsigned i = 0; i < 4; ++i )
+            TS_ASSERT_EQUALS( propagator.getStabilityMask( 4 )[i], expectedLayer4Mask[i] );
+
+        TS_ASSERT_EQUALS( propagator.getNumberOfUnstableNeurons( 0 ), 2U );
+        TS_ASSERT_EQUALS( propagator.getNumberOfUnstableNeurons( 1 ), 0U );
+    }
+
+    void test_batched_interval_propagation_matches_single_boxes()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        populateNetwork( nlr );
+
+        NLR::BatchedIntervalPropagator batched( &nlr );
+        NLR::BatchedIntervalPropagator single( &nlr );
+
+        double inputLbs[] = { -1, -1, 0, -3, 2, 2, -5, 1 };
+        double inputUbs[] = { 1, 1, 0.5, 3, 4, 2, -4, 7 };
+
+        TS_ASSERT_THROWS_NOTHING( batched.run( 4, inputLbs, inputUbs ) );
+
+        for ( unsigned box = 0; box < 4; ++box )
+        {
+            TS_ASSERT_THROWS_NOTHING( single.run( 1, inputLbs + 2 * box, inputUbs + 2 * box ) );
+
+            for ( unsigned i = 0; i < 2; ++i )
+            {
+                TS_ASSERT( FloatUtils::areEqual( batched.getLowerBounds( 5 )[2 * box + i],
+                                                 single.getLowerBounds( 5 )[i] ) );
+                TS_ASSERT( FloatUtils::areEqual( batched.getUpperBounds( 5 )[2 * box + i],
+                                                 single.getUpperBounds( 5 )[i] ) );
+            }
+
+            TS_ASSERT_EQUALS( batched.getNumberOfUnstableNeurons( box ),
+                              single.getNumberOfUnstableNeurons( 0 ) );
+        }
+    }
+};
@@ -0,0 +1,205 @@
+/*********************                                                        */
+/*! \file Test_BoundCache.h
+** \verbatim
+** Top contributors (to current version):
+**   Guy Katz
+** This file is part of the Marabou project.
+** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved. See the file COPYING in the top-level source
+** directory for licensing information.\endverbatim
+**
+** [[ Add lengthier description here ]]
+
+**/
+
+#include "BoundCache.h"
+#include "FloatUtils.h"
+#include "Layer.h"
+#include "NetworkLevelReasoner.h"
+#include "Options.h"
+#include "Query.h"
+
+#include <cstdio>
+#include <cxxtest/TestSuite.h>
+
+const String BOUND_CACHE_TEST_FILE( "BoundCacheTest.bin" );
+
+class BoundCacheTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        std::remove( BOUND_CACHE_TEST_FILE.ascii() );
+    }
+
+    void tearDown()
+    {
+        std::remove( BOUND_CACHE_TEST_FILE.ascii() );
+    }
+
+    void populateNetwork( NLR::NetworkLevelReasoner &nlr, double weight = 1 )
+    {
+        /*
+
+              1      R       1      R       1  1
+          x0 --- x2 ---> x4 --- x6 ---> x8 --- x10
+            \    /        \    /          \    /
+           1 \  /        1 \  /          0 \  /
+              \/            \/              \/
+              /\            /\              /\
+           1 /  \        1 /  \          1 /  \
+            /    \   R    /    \    R     / 1  \
+          x1 --- x3 ---> x5 --- x7 ---> x9 --- x11
+              -1            -1
+        */
+
+        nlr.addLayer( 0, NLR::Layer::INPUT, 2 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, 2 );
+        nlr.addLayer( 2, NLR::Layer::RELU, 2 );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, 2 );
+        nlr.addLayer( 4, NLR::Layer::RELU, 2 );
+        nlr.addLayer( 5, NLR::Layer::WEIGHTED_SUM, 2 );
+
+        for ( unsigned i = 1; i <= 5; ++i )
+            nlr.addLayerDependency( i - 1, i );
+
+        nlr.setWeight( 0, 0, 1, 0, weight );
+        nlr.setWeight( 0, 0, 1, 1, 1 );
+        nlr.setWeight( 0, 1, 1, 0, 1 );
+        nlr.setWeight( 0, 1, 1, 1, -1 );
+
+        nlr.setWeight( 2, 0, 3, 0, 1 );
+        nlr.setWeight( 2, 0, 3, 1, 1 );
+        nlr.setWeight( 2, 1, 3, 0, 1 );
+        nlr.setWeight( 2, 1, 3, 1, -1 );
+
+        nlr.setWeight( 4, 0, 5, 0, 1 );
+        nlr.setWeight( 4, 0, 5, 1, 0 );
+        nlr.setWeight( 4, 1, 5, 0, 1 );
+        nlr.setWeight( 4, 1, 5, 1, 1 );
+
+        nlr.setBias( 5, 0, 1 );
+
+        nlr.addActivationSource( 1, 0, 2, 0 );
+        nlr.addActivationSource( 1, 1, 2, 1 );
+        nlr.addActivationSource( 3, 0, 4, 0 );
+        nlr.addActivationSource( 3, 1, 4, 1 );
+
+        for ( unsigned layer = 0; layer <= 5; ++layer )
+            for ( unsigned neuron = 0; neuron < 2; ++neuron )
+                nlr.setNeuronVariable( NLR::NeuronIndex( layer, neuron ), 2 * layer + neuron );
+    }
+
+    void
+    setInputBox( NLR::NetworkLevelReasoner &nlr, double lb0, double ub0, double lb1, double ub1 )
+    {
+        Query query;
+        query.setNumberOfVariables( 12 );
+        query.setLowerBound( 0, lb0 );
+        query.setUpperBound( 0, ub0 );
+        query.setLowerBound( 1, lb1 );
+        query.setUpperBound( 1, ub1 );
+
+        // Tight bounds on the other neurons should not end up in the cache
+        for ( unsigned i = 2; i < 12; ++i )
+        {
+            query.setLowerBound( i, 0 );
+            query.setUpperBound( i, 0 );
+        }
+
+        nlr.obtainCurrentBounds( query );
+    }
+
+    void test_network_hash()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        populateNetwork( nlr );
+        NLR::NetworkLevelReasoner sameNlr;
+        populateNetwork( sameNlr );
+        NLR::NetworkLevelReasoner otherNlr;
+        populateNetwork( otherNlr, 2 );
+
+        TS_ASSERT_EQUALS( NLR::BoundCache::computeNetworkHash( nlr ),
+                          NLR::BoundCache::computeNetworkHash( sameNlr ) );
+        TS_ASSERT_DIFFERS( NLR::BoundCache::computeNetworkHash( nlr ),
+                           NLR::BoundCache::computeNetworkHash( otherNlr ) );
+
+        sameNlr.eliminateVariable( 5, 0 );
+        TS_ASSERT_DIFFERS( NLR::BoundCache::computeNetworkHash( nlr ),
+                           NLR::BoundCache::computeNetworkHash( sameNlr ) );
+    }
+
+    void test_store_and_reuse()
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "deeppoly" );
+
+        NLR::NetworkLevelReasoner nlr;
+        populateNetwork( nlr );
+        NLR::BoundCache boundCache( BOUND_CACHE_TEST_FILE );
+
+        Vector<double> lowerBounds;
+        Vector<double> upperBounds;
+        setInputBox( nlr, -1, 1, -1, 1 );
+        TS_ASSERT( !boundCache.getBounds( nlr, lowerBounds, upperBounds ) );
+        TS_ASSERT_EQUALS( lowerBounds.size(), 12U );
+
+        // The bounds of the DeepPoly paper, computed from the inputs alone
+        TS_ASSERT( FloatUtils::areEqual( lowerBounds[0], -1 ) );
+        TS_ASSERT( FloatUtils::areEqual( upperBounds[0], 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( lowerBounds[10], 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( upperBounds[10], 5.5 ) );
+        TS_ASSERT( FloatUtils::areEqual( lowerBounds[11], 0 ) );
+        TS_ASSERT( FloatUtils::areEqual( upperBounds[11], 2 ) );
+
+        // The same box, and a box it contains, are found in the cache
+        Vector<double> cachedLowerBounds;
+        Vector<double> cachedUpperBounds;
+        TS_ASSERT( boundCache.getBounds( nlr, cachedLowerBounds, cachedUpperBounds ) );
+        TS_ASSERT_EQUALS( cachedLowerBounds, lowerBounds );
+        TS_ASSERT_EQUALS( cachedUpperBounds, upperBounds );
+
+        setInputBox( nlr, -0.5, 0.5, 0, 1 );
+        TS_ASSERT( boundCache.getBounds( nlr, cachedLowerBounds, cachedUpperBounds ) );
+        TS_ASSERT_EQUALS( cachedLowerBounds, lowerBounds );
+        TS_ASSERT_EQUALS( cachedUpperBounds, upperBounds );
+
+        // A box that is not contained is computed, and then cached
+        setInputBox( nlr, -1, 2, -1, 1 );
+        TS_ASSERT( !boundCache.getBounds( nlr, lowerBounds, upperBounds ) );
+        TS_ASSERT( FloatUtils::areEqual( upperBounds[0], 2 ) );
+        TS_ASSERT( boundCache.getBounds( nlr, cachedLowerBounds, cachedUpperBounds ) );
+        TS_ASSERT_EQUALS( cachedLowerBounds, lowerBounds );
+        TS_ASSERT_EQUALS( cachedUpperBounds, upperBounds );
+
+        // Boxes contained in several entries get the tightest bounds
+        setInputBox( nlr, 0, 1, 0, 1 );
+        TS_ASSERT( boundCache.getBounds( nlr, cachedLowerBounds, cachedUpperBounds ) );
+        TS_ASSERT( FloatUtils::areEqual( cachedUpperBounds[0], 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( cachedUpperBounds[10], 5.5 ) );
+
+        // A different network is not
+        NLR::NetworkLevelReasoner otherNlr;
+        populateNetwork( otherNlr, 2 );
+        setInputBox( otherNlr, -1, 1, -1, 1 );
+        TS_ASSERT( !boundCache.getBounds( otherNlr, cachedLowerBounds, cachedUpperBounds ) );
+        TS_ASSERT( FloatUtils::areEqual( cachedUpperBounds[2], 3 ) );
+    }
+
+    void test_invalid_file_is_ignored()
+    {
+        FILE *file = fopen( BOUND_CACHE_TEST_FILE.ascii(), "w" );
+        fprintf( file, "not a cache" );
+        fclose( file );
+
+        NLR::NetworkLevelReasoner nlr;
+        populateNetwork( nlr );
+        setInputBox( nlr, -1, 1, -1, 1 );
+
+        NLR::BoundCache boundCache( BOUND_CACHE_TEST_FILE );
+        Vector<double> lowerBounds;
+        Vector<double> upperBounds;
+        TS_ASSERT( !boundCache.getBounds( nlr, lowerBounds, upperBounds ) );
+        TS_ASSERT( !boundCache.getBounds( nlr, lowerBounds, upperBounds ) );
+    }
+};
@@ -15,7 +15,9 @@
 
 #include "../../engine/tests/MockTableau.h"
 #include "DeepPolySoftmaxElement.h"
+#include "Equation.h"
 #include "FloatUtils.h"
+#include "InfeasibleQueryException.h"
 #include "InputQuery.h"
 #include "Layer.h"
 #include "NetworkLevelReasoner.h"
@@ -211,6 +213,120 @@ public:
             TS_ASSERT( existsBound( bounds, bound ) );
     }
 
+    void test_deeppoly_output_specifications()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetwork( nlr, tableau );
+
+        tableau.setLowerBound( 0, -1 );
+        tableau.setUpperBound( 0, 1 );
+        tableau.setLowerBound( 1, -1 );
+        tableau.setUpperBound( 1, 1 );
+
+        // x10 - x11 + x12 = 0, where x12 is an auxiliary variable
+        Equation specification1;
+        specification1.addAddend( 1, 10 );
+        specification1.addAddend( -1, 11 );
+        specification1.addAddend( 1, 12 );
+        specification1.setScalar( 0 );
+
+        // x10 + x11 >= 0
+        Equation specification2( Equation::GE );
+        specification2.addAddend( 1, 10 );
+        specification2.addAddend( 1, 11 );
+        specification2.setScalar( 0 );
+
+        // Not specifications: a hidden neuron, two auxiliary variables, and
+        // an auxiliary variable in an inequality
+        Equation other1;
+        other1.addAddend( 1, 2 );
+        other1.addAddend( 1, 10 );
+        other1.setScalar( 0 );
+
+        Equation other2;
+        other2.addAddend( 1, 10 );
+        other2.addAddend( 1, 12 );
+        other2.addAddend( 1, 13 );
+        other2.setScalar( 1 );
+
+        Equation other3( Equation::LE );
+        other3.addAddend( 1, 11 );
+        other3.addAddend( -1, 10 );
+        other3.addAddend( 1, 13 );
+        other3.setScalar( 0 );
+
+        List<Equation> equations( { other1, specification1, other2, specification2, other3 } );
+        TS_ASSERT_EQUALS( nlr.setOutputSpecifications( equations ), 2U );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.deepPolyPropagation() );
+        nlr.clearConstraintTightenings();
+
+        /*
+          The outputs are x10: [1, 5.5] and x11: [0, 2], so their bounds
+          only give x10 - x11: [-1, 5.5]. Back-substituting
+          x10 - x11 = x8 + 1 gives [1, 4], and so x12: [-4, -1].
+        */
+        TS_ASSERT_THROWS_NOTHING( nlr.outputSpecificationPropagation() );
+
+        List<Tightening> expectedBounds(
+            { Tightening( 12, -4, Tightening::LB ), Tightening( 12, -1, Tightening::UB ) } );
+
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+
+        TS_ASSERT_EQUALS( expectedBounds.size(), bounds.size() );
+        for ( const auto &bound : expectedBounds )
+            TS_ASSERT( existsBound( bounds, bound ) );
+    }
+
+    void test_deeppoly_output_specifications_infeasible()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetwork( nlr, tableau );
+
+        tableau.setLowerBound( 0, -1 );
+        tableau.setUpperBound( 0, 1 );
+        tableau.setLowerBound( 1, -1 );
+        tableau.setUpperBound( 1, 1 );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.deepPolyPropagation() );
+
+        // x10 - x11 is in [1, 4]
+        Equation::EquationType types[] = { Equation::EQ,
+                                           Equation::LE,
+                                           Equation::GE,
+                                           Equation::LE,
+                                           Equation::GE };
+        double scalars[] = { 0, 0.5, 4.5, 1, 4 };
+        bool infeasible[] = { true, true, true, false, false };
+
+        for ( unsigned i = 0; i < 5; ++i )
+        {
+            Equation specification( types[i] );
+            specification.addAddend( 1, 10 );
+            specification.addAddend( -1, 11 );
+            specification.setScalar( scalars[i] );
+
+            TS_ASSERT_EQUALS( nlr.setOutputSpecifications( List<Equation>( { specification } ) ),
+                              1U );
+            if ( infeasible[i] )
+            {
+                TS_ASSERT_THROWS( nlr.outputSpecificationPropagation(),
+                                  const InfeasibleQueryException & );
+            }
+            else
+            {
+                TS_ASSERT_THROWS_NOTHING( nlr.outputSpecificationPropagation() );
+            }
+        }
+    }
+
     void populateResidualNetwork1( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
     {
         /*
@@ -16,10 +16,12 @@
 #include "../../engine/tests/MockTableau.h" // TODO: fix this
 #include "DeepPolySoftmaxElement.h"
 #include "FloatUtils.h"
+#include "GlobalConfiguration.h"
 #include "Layer.h"
 #include "NetworkLevelReasoner.h"
 #include "Options.h"
 #include "Query.h"
+#include "ThreadPool.h"
 #include "Tightening.h"
 #include "Vector.h"
 
@@ -7596,6 +7598,208 @@ public:
         TS_ASSERT( boundsEqual( bounds, expectedBounds ) );
     }
 
+    void applyTightenings( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
+    {
+        List<Tightening> tightenings;
+        nlr.getConstraintTightenings( tightenings );
+        nlr.clearConstraintTightenings();
+
+        for ( const auto &tightening : tightenings )
+        {
+            if ( tightening._type == Tightening::LB )
+                tableau.setLowerBound( tightening._variable, tightening._value );
+            else
+                tableau.setUpperBound( tightening._variable, tightening._value );
+        }
+    }
+
+    void checkIncrementalPropagation( NLR::NetworkLevelReasoner &nlr,
+                                      MockTableau &tableau,
+                                      SymbolicBoundTighteningType type,
+                                      unsigned expectedSkippedLayers )
+    {
+        TS_ASSERT_EQUALS( nlr.incrementalSymbolicBoundPropagation( type ),
+                          expectedSkippedLayers );
+
+        List<Tightening> incrementalBounds;
+        nlr.getConstraintTightenings( incrementalBounds );
+
+        Vector<double> lowerBounds;
+        Vector<double> upperBounds;
+        for ( unsigned i = 0; i < nlr.getNumberOfLayers(); ++i )
+        {
+            for ( unsigned j = 0; j < nlr.getLayer( i )->getSize(); ++j )
+            {
+                lowerBounds.append( nlr.getLayer( i )->getLb( j ) );
+                upperBounds.append( nlr.getLayer( i )->getUb( j ) );
+            }
+        }
+
+        // Propagating from scratch gives the same bounds. It may discover
+        // tightenings already discovered by the skipped layers.
+        NLR::NetworkLevelReasoner fromScratch;
+        MockTableau fromScratchTableau;
+        fromScratch.setTableau( &fromScratchTableau );
+        populateNetworkSBTRelu( fromScratch, fromScratchTableau );
+        fromScratch.setBias( 1, 0, -15 );
+        for ( unsigned i = 0; i < 7; ++i )
+        {
+            fromScratchTableau.setLowerBound( i, tableau.getLowerBound( i ) );
+            fromScratchTableau.setUpperBound( i, tableau.getUpperBound( i ) );
+        }
+
+        fromScratch.obtainCurrentBounds();
+        if ( type == SymbolicBoundTighteningType::SYMBOLIC_BOUND_TIGHTENING )
+            fromScratch.symbolicBoundPropagation();
+        else
+            fromScratch.deepPolyPropagation();
+
+        unsigned index = 0;
+        for ( unsigned i = 0; i < fromScratch.getNumberOfLayers(); ++i )
+        {
+            for ( unsigned j = 0; j < fromScratch.getLayer( i )->getSize(); ++j, ++index )
+            {
+                TS_ASSERT( FloatUtils::areEqual( fromScratch.getLayer( i )->getLb( j ),
+                                                 lowerBounds[index] ) );
+                TS_ASSERT( FloatUtils::areEqual( fromScratch.getLayer( i )->getUb( j ),
+                                                 upperBounds[index] ) );
+            }
+        }
+
+        List<Tightening> fromScratchBounds;
+        fromScratch.getConstraintTightenings( fromScratchBounds );
+        for ( const auto &tightening : incrementalBounds )
+            TS_ASSERT( fromScratchBounds.exists( tightening ) );
+    }
+
+    void incrementalPropagation( SymbolicBoundTighteningType type )
+    {
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetworkSBTRelu( nlr, tableau );
+
+        // x2 = 2x0 + 3x1 - 15 is in [-4, 12], so its ReLU is not fixed
+        nlr.setBias( 1, 0, -15 );
+        tableau.setLowerBound( 0, 4 );
+        tableau.setUpperBound( 0, 6 );
+        tableau.setLowerBound( 1, 1 );
+        tableau.setUpperBound( 1, 5 );
+
+        // The first propagation starts from the input layer
+        checkIncrementalPropagation( nlr, tableau, type, 0 );
+        applyTightenings( nlr, tableau );
+
+        // Nothing has changed, except for the bounds it tightened
+        checkIncrementalPropagation( nlr, tableau, type, 4 );
+        applyTightenings( nlr, tableau );
+
+        // Fixing the phase of the ReLU only affects the layers from it
+        tableau.setLowerBound( 4, 0 );
+        tableau.setUpperBound( 4, 0 );
+        checkIncrementalPropagation( nlr, tableau, type, 2 );
+        applyTightenings( nlr, tableau );
+
+        // So does loosening it back, when backtracking
+        tableau.setLowerBound( 4, 0 );
+        tableau.setUpperBound( 4, 12 );
+        checkIncrementalPropagation( nlr, tableau, type, 2 );
+        applyTightenings( nlr, tableau );
+
+        // Tightening an input affects all layers
+        tableau.setUpperBound( 0, 5 );
+        checkIncrementalPropagation( nlr, tableau, type, 0 );
+        applyTightenings( nlr, tableau );
+
+        // Any other propagation makes the next one start from scratch
+        nlr.obtainCurrentBounds();
+        checkIncrementalPropagation( nlr, tableau, type, 0 );
+        applyTightenings( nlr, tableau );
+
+        checkIncrementalPropagation( nlr, tableau, type, 4 );
+    }
+
+    void test_incremental_sbt()
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "sbt" );
+        incrementalPropagation( SymbolicBoundTighteningType::SYMBOLIC_BOUND_TIGHTENING );
+    }
+
+    void test_incremental_deeppoly()
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "deeppoly" );
+        incrementalPropagation( SymbolicBoundTighteningType::DEEP_POLY );
+    }
+
+    void populateWideNetwork( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau, unsigned width )
+    {
+        nlr.addLayer( 0, NLR::Layer::INPUT, 2 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, width );
+        nlr.addLayer( 2, NLR::Layer::RELU, width );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, 1 );
+
+        for ( unsigned i = 1; i <= 3; ++i )
+            nlr.addLayerDependency( i - 1, i );
+
+        for ( unsigned i = 0; i < width; ++i )
+        {
+            nlr.setWeight( 0, 0, 1, i, (double)( i % 7 ) - 3 );
+            nlr.setWeight( 0, 1, 1, i, (double)( i % 5 ) - 2 );
+            nlr.setBias( 1, i, (double)( i % 3 ) - 1 );
+            nlr.addActivationSource( 1, i, 2, i );
+            nlr.setWeight( 2, i, 3, 0, ( i % 2 ) ? 1 : -1 );
+
+            nlr.setNeuronVariable( NLR::NeuronIndex( 1, i ), 2 + i );
+            nlr.setNeuronVariable( NLR::NeuronIndex( 2, i ), 2 + width + i );
+        }
+
+        nlr.setNeuronVariable( NLR::NeuronIndex( 0, 0 ), 0 );
+        nlr.setNeuronVariable( NLR::NeuronIndex( 0, 1 ), 1 );
+        nlr.setNeuronVariable( NLR::NeuronIndex( 3, 0 ), 2 + 2 * width );
+
+        double large = 1000000;
+        tableau.getBoundManager().initialize( 3 + 2 * width );
+        for ( unsigned i = 2; i < 3 + 2 * width; ++i )
+        {
+            tableau.setLowerBound( i, -large );
+            tableau.setUpperBound( i, large );
+        }
+
+        tableau.setLowerBound( 0, -1 );
+        tableau.setUpperBound( 0, 1 );
+        tableau.setLowerBound( 1, -1 );
+        tableau.setUpperBound( 1, 2 );
+    }
+
+    void test_sbt_multithreaded()
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "sbt" );
+
+        // Wide enough for four threads
+        unsigned width = 2 * GlobalConfiguration::SYMBOLIC_BOUND_TIGHTENING_MIN_ENTRIES_PER_THREAD;
+
+        List<Tightening> serialBounds;
+        List<Tightening> parallelBounds;
+        for ( unsigned numberOfThreads : { 1, 4 } )
+        {
+            ThreadPool::get()->setNumberOfThreads( numberOfThreads );
+
+            NLR::NetworkLevelReasoner nlr;
+            MockTableau tableau;
+            nlr.setTableau( &tableau );
+            populateWideNetwork( nlr, tableau, width );
+
+            nlr.obtainCurrentBounds();
+            TS_ASSERT_THROWS_NOTHING( nlr.symbolicBoundPropagation() );
+            nlr.getConstraintTightenings( numberOfThreads == 1 ? serialBounds : parallelBounds );
+        }
+        ThreadPool::get()->setNumberOfThreads( 1 );
+
+        // The same bounds, reported in the same order
+        TS_ASSERT_EQUALS( serialBounds.size(), 4 * width + 2 );
+        TS_ASSERT( serialBounds == parallelBounds );
+    }
+
     void test_concretize_input_assignment()
     {
         NLR::NetworkLevelReasoner nlr;
@@ -14,6 +14,8 @@
 
 #include "BoundExplainer.h"
 
+#include "VectorKernels.h"
+
 using namespace CVC4::context;
 
 BoundExplainer::BoundExplainer( unsigned numberOfVariables, unsigned numberOfRows, Context &ctx )
@@ -253,8 +255,7 @@ void BoundExplainer::addVecTimesScalar( Vector<double> &sum,
 
     ASSERT( sum.size() == _numberOfRows && input.size() == _numberOfRows );
 
-    for ( unsigned i = 0; i < _numberOfRows; ++i )
-        sum[i] += scalar * input[i];
+    VectorKernels::axpy( scalar, input.data(), sum.data(), _numberOfRows );
 }
 
 void BoundExplainer::extractRowCoefficients( const TableauRow &row,
@@ -14,6 +14,15 @@
 
 #include "Checker.h"
 
+#include "MarabouError.h"
+
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 Checker::Checker( const UnsatCertificateNode *root,
                   unsigned proofSize,
                   const SparseMatrix *initialTableau,
@@ -27,35 +36,176 @@ Checker::Checker( const UnsatCertificateNode *root,
     , _groundLowerBounds( groundLowerBounds )
     , _problemConstraints( problemConstraints )
     , _delegationCounter( 0 )
+    , _fixPhases( true )
+    , _numberOfWorkers( 1 )
+    , _frontierDepth( 0 )
+    , _currentDepth( 0 )
+    , _stream( NULL )
 {
     for ( auto constraint : problemConstraints )
         constraint->setPhaseStatus( PHASE_NOT_FIXED );
 }
 
+Checker::Checker( const Checker &other, const Task &task )
+    : _root( task._node )
+    , _proofSize( other._proofSize )
+    , _initialTableau( other._initialTableau )
+    , _groundUpperBounds( task._groundUpperBounds )
+    , _groundLowerBounds( task._groundLowerBounds )
+    , _problemConstraints( other._problemConstraints )
+    , _delegationCounter( 0 )
+    , _fixPhases( false )
+    , _numberOfWorkers( 1 )
+    , _frontierDepth( 0 )
+    , _currentDepth( 0 )
+    , _stream( NULL )
+{
+}
+
+void Checker::setNumberOfWorkers( unsigned numberOfWorkers )
+{
+    _numberOfWorkers = numberOfWorkers > 0 ? numberOfWorkers : 1;
+}
+
 bool Checker::check()
 {
-    return checkNode( _root );
+    _frontierDepth = 0;
+    if ( _numberOfWorkers > 1 && !hasSavedDelegation( _root ) )
+    {
+        // Defer enough subtrees to keep all workers busy, even if their sizes are uneven
+        double numberOfTasks =
+            (double)_numberOfWorkers * GlobalConfiguration::CERTIFICATE_TASKS_PER_WORKER;
+        _frontierDepth = (unsigned)std::ceil( std::log2( numberOfTasks ) );
+        _fixPhases = false;
+    }
+
+    _tasks.clear();
+    bool answer = checkNode( _root );
+    _frontierDepth = 0;
+    _fixPhases = true;
+
+    if ( !_tasks.empty() )
+    {
+        if ( answer )
+            answer = checkTasks();
+        _tasks.clear();
+    }
+
+    return answer;
+}
+
+bool Checker::checkStream( UnsatCertificateStream &stream )
+{
+    _stream = &stream;
+    std::unique_ptr<UnsatCertificateNode> root( _stream->readNode() );
+
+    unsigned trailSize = _boundTrail.size();
+    bool checkedChildren = false;
+    bool answer = checkNodeWithoutReverting( root.get(), checkedChildren );
+    if ( !checkedChildren )
+        _stream->skipSubtrees( root->getChildren().size() );
+    revertGroundBounds( trailSize );
+
+    _stream = NULL;
+    return answer;
+}
+
+bool Checker::checkTasks()
+{
+    std::atomic_uint nextTask( 0 );
+    std::atomic_bool failed( false );
+    std::exception_ptr error = NULL;
+    std::mutex errorMutex;
+
+    Vector<const Task *> tasks;
+    for ( const auto &task : _tasks )
+        tasks.append( &task );
+
+    auto work = [&]() {
+        unsigned index;
+        while ( !failed.load() && ( index = nextTask.fetch_add( 1 ) ) < tasks.size() )
+        {
+            try
+            {
+                Checker worker( *this, *tasks[index] );
+                if ( !worker.checkNode( tasks[index]->_node ) )
+                    failed = true;
+            }
+            catch ( ... )
+            {
+                std::lock_guard<std::mutex> lock( errorMutex );
+                error = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    unsigned numberOfThreads = std::min( _numberOfWorkers, tasks.size() );
+    List<std::thread *> threads;
+    for ( unsigned i = 0; i < numberOfThreads; ++i )
+        threads.append( new std::thread( work ) );
+
+    for ( auto &thread : threads )
+    {
+        thread->join();
+        delete thread;
+    }
+
+    if ( error )
+        std::rethrow_exception( error );
+
+    return !failed.load();
 }
 
 bool Checker::checkNode( const UnsatCertificateNode *node )
 {
-    Vector<double> groundUpperBoundsBackup( _groundUpperBounds );
-    Vector<double> groundLowerBoundsBackup( _groundLowerBounds );
+    unsigned trailSize = _boundTrail.size();
+    bool checkedChildren = false;
 
-    _upperBoundChanges.push( {} );
-    _lowerBoundChanges.push( {} );
+    ++_currentDepth;
+    bool answer = checkNodeWithoutReverting( node, checkedChildren );
+    --_currentDepth;
 
-    // Update ground bounds according to head split
-    for ( const auto &tightening : node->getSplit().getBoundTightenings() )
+    revertGroundBounds( trailSize );
+    return answer;
+}
+
+bool Checker::checkChild( const UnsatCertificateNode *child )
+{
+    if ( _stream )
     {
-        auto &temp = tightening._type == Tightening::UB ? _groundUpperBounds : _groundLowerBounds;
-        temp[tightening._variable] = tightening._value;
+        std::unique_ptr<UnsatCertificateNode> record( _stream->readNode() );
+
+        unsigned trailSize = _boundTrail.size();
+        bool checkedChildren = false;
+        bool answer = checkNodeWithoutReverting( record.get(), checkedChildren );
+        if ( !checkedChildren )
+            _stream->skipSubtrees( record->getChildren().size() );
+        revertGroundBounds( trailSize );
 
-        tightening._type == Tightening::UB
-            ? _upperBoundChanges.top().insert( tightening._variable )
-            : _lowerBoundChanges.top().insert( tightening._variable );
+        return answer;
     }
 
+    if ( _frontierDepth > 0 && _currentDepth == _frontierDepth )
+    {
+        Task task;
+        task._node = child;
+        task._groundUpperBounds = _groundUpperBounds;
+        task._groundLowerBounds = _groundLowerBounds;
+        _tasks.append( task );
+        return true;
+    }
+
+    return checkNode( child );
+}
+
+bool Checker::checkNodeWithoutReverting( const UnsatCertificateNode *node, bool &checkedChildren )
+{
+    // Update ground bounds according to head split
+    for ( const auto &tightening : node->getSplit().getBoundTightenings() )
+        updateGroundBound(
+            tightening._variable, tightening._type == Tightening::UB, tightening._value );
+
     // Check all PLC bound propagations
     if ( !checkAllPLCExplanations( node, GlobalConfiguration::LEMMA_CERTIFICATION_TOLERANCE ) )
         return false;
@@ -97,40 +247,79 @@ bool Checker::checkNode( const UnsatCertificateNode *node )
         return false;
 
     // Fix the constraints phase according to the child, and check each child
+    checkedChildren = true;
     for ( const auto &child : node->getChildren() )
     {
         fixChildSplitPhase( child, childrenSplitConstraint );
-        if ( !checkNode( child ) )
+        if ( !checkChild( child ) )
             answer = false;
     }
 
     // Revert all changes
     if ( childrenSplitConstraint )
-        childrenSplitConstraint->setPhaseStatus( PHASE_NOT_FIXED );
+        fixPhase( *childrenSplitConstraint, PHASE_NOT_FIXED );
 
-    if ( childrenSplitConstraint && childrenSplitConstraint->getType() == DISJUNCTION )
+    if ( _fixPhases && childrenSplitConstraint &&
+         childrenSplitConstraint->getType() == DISJUNCTION )
     {
         for ( const auto &child : node->getChildren() )
             ( (DisjunctionConstraint *)childrenSplitConstraint )
                 ->addFeasibleDisjunct( child->getSplit() );
     }
 
-    // Revert only bounds that where changed during checking the current node
-    for ( const auto &i : _upperBoundChanges.top() )
-        _groundUpperBounds[i] = groundUpperBoundsBackup[i];
+    return answer;
+}
 
-    for ( const auto &i : _lowerBoundChanges.top() )
-        _groundLowerBounds[i] = groundLowerBoundsBackup[i];
+void Checker::updateGroundBound( unsigned variable, bool isUpper, double value )
+{
+    Vector<double> &bounds = isUpper ? _groundUpperBounds : _groundLowerBounds;
 
-    _upperBoundChanges.pop();
-    _lowerBoundChanges.pop();
+    BoundChange change;
+    change._variable = variable;
+    change._isUpper = isUpper;
+    change._previousValue = bounds[variable];
+    _boundTrail.push_back( change );
 
-    return answer;
+    bounds[variable] = value;
+}
+
+void Checker::revertGroundBounds( unsigned trailSize )
+{
+    while ( _boundTrail.size() > trailSize )
+    {
+        const BoundChange &change = _boundTrail.back();
+        ( change._isUpper ? _groundUpperBounds : _groundLowerBounds )[change._variable] =
+            change._previousValue;
+        _boundTrail.pop_back();
+    }
+}
+
+void Checker::fixPhase( PiecewiseLinearConstraint &constraint, PhaseStatus phase )
+{
+    if ( _fixPhases )
+        constraint.setPhaseStatus( phase );
+}
+
+bool Checker::hasSavedDelegation( const UnsatCertificateNode *node )
+{
+    if ( node->getDelegationStatus() == DelegationStatus::DELEGATE_SAVE )
+        return true;
+
+    for ( const auto &child : node->getChildren() )
+    {
+        if ( hasSavedDelegation( child ) )
+            return true;
+    }
+
+    return false;
 }
 
 void Checker::fixChildSplitPhase( UnsatCertificateNode *child,
                                   PiecewiseLinearConstraint *childrenSplitConstraint )
 {
+    if ( !_fixPhases )
+        return;
+
     if ( childrenSplitConstraint && childrenSplitConstraint->getType() == RELU )
     {
         List<Tightening> tightenings = child->getSplit().getBoundTightenings();
@@ -267,12 +456,7 @@ bool Checker::checkAllPLCExplanations( const UnsatCertificateNode *node, double
                            ? FloatUtils::lt( explainedBound, temp[affectedVar] )
                            : FloatUtils::gt( explainedBound, temp[affectedVar] );
         if ( isTighter )
-        {
-            temp[affectedVar] = explainedBound;
-            ASSERT( !_upperBoundChanges.empty() && !_lowerBoundChanges.empty() );
-            affectedVarBound == Tightening::UB ? _upperBoundChanges.top().insert( affectedVar )
-                                               : _lowerBoundChanges.top().insert( affectedVar );
-        }
+            updateGroundBound( affectedVar, affectedVarBound == Tightening::UB, explainedBound );
     }
     return true;
 }
@@ -648,12 +832,12 @@ double Checker::checkReluLemma( const PLCLemma &expl,
            FloatUtils::isPositive( bound ) ) ||
          ( affectedVarBound == Tightening::UB && affectedVar == aux &&
            FloatUtils::isZero( bound ) ) )
-        constraint.setPhaseStatus( RELU_PHASE_ACTIVE );
+        fixPhase( constraint, RELU_PHASE_ACTIVE );
     else if ( ( affectedVarBound == Tightening::LB && affectedVar == aux &&
                 FloatUtils::isPositive( bound ) ) ||
               ( affectedVarBound == Tightening::UB && affectedVar == f &&
                 FloatUtils::isZero( bound ) ) )
-        constraint.setPhaseStatus( RELU_PHASE_INACTIVE );
+        fixPhase( constraint, RELU_PHASE_INACTIVE );
 
     // Make sure the explanation is explained using a ReLU bound tightening. Cases are matching each
     // rule in ReluConstraint.cpp We allow explained bound to be tighter than the ones recorded
@@ -754,12 +938,12 @@ double Checker::checkSignLemma( const PLCLemma &expl,
            FloatUtils::gt( bound, -1 ) ) ||
          ( affectedVarBound == Tightening::LB && affectedVar == b &&
            !FloatUtils::isNegative( bound ) ) )
-        constraint.setPhaseStatus( SIGN_PHASE_POSITIVE );
+        fixPhase( constraint, SIGN_PHASE_POSITIVE );
     else if ( ( affectedVarBound == Tightening::UB && affectedVar == f &&
                 FloatUtils::gt( bound, 1 ) ) ||
               ( affectedVarBound == Tightening::UB && affectedVar == b &&
                 FloatUtils::isNegative( bound ) ) )
-        constraint.setPhaseStatus( SIGN_PHASE_NEGATIVE );
+        fixPhase( constraint, SIGN_PHASE_NEGATIVE );
 
     // Make sure the explanation is explained using a sign bound tightening. Cases are matching each
     // rule in SignConstraint.cpp We allow explained bound to be tighter than the ones recorded
@@ -889,13 +1073,13 @@ double Checker::checkAbsLemma( const PLCLemma &expl,
             if ( affectedVar == neg && causingVarBound == Tightening::UB &&
                  explainedFBound > explainedBBound - epsilon && bound == 0 )
             {
-                constraint.setPhaseStatus( ABS_PHASE_NEGATIVE );
+                fixPhase( constraint, ABS_PHASE_NEGATIVE );
                 return 0;
             }
             else if ( affectedVar == pos && causingVarBound == Tightening::LB &&
                       explainedFBound > -explainedBBound - epsilon && bound == 0 )
             {
-                constraint.setPhaseStatus( ABS_PHASE_POSITIVE );
+                fixPhase( constraint, ABS_PHASE_POSITIVE );
                 return 0;
             }
 
@@ -919,25 +1103,25 @@ double Checker::checkAbsLemma( const PLCLemma &expl,
     if ( affectedVar == pos && causingVar == b && causingVarBound == Tightening::LB &&
          !FloatUtils::isNegative( explainedBound + epsilon ) && bound == 0 )
     {
-        constraint.setPhaseStatus( ABS_PHASE_POSITIVE );
+        fixPhase( constraint, ABS_PHASE_POSITIVE );
         return 0;
     }
     else if ( affectedVar == neg && causingVar == b && causingVarBound == Tightening::UB &&
               !FloatUtils::isPositive( explainedBound - epsilon ) && bound == 0 )
     {
-        constraint.setPhaseStatus( ABS_PHASE_NEGATIVE );
+        fixPhase( constraint, ABS_PHASE_NEGATIVE );
         return 0;
     }
     else if ( affectedVar == neg && causingVar == pos && causingVarBound == Tightening::LB &&
               FloatUtils::isPositive( explainedBound + epsilon ) && bound == 0 )
     {
-        constraint.setPhaseStatus( ABS_PHASE_NEGATIVE );
+        fixPhase( constraint, ABS_PHASE_NEGATIVE );
         return 0;
     }
     else if ( affectedVar == pos && causingVar == neg && causingVarBound == Tightening::LB &&
               FloatUtils::isPositive( explainedBound + epsilon ) && bound == 0 )
     {
-        constraint.setPhaseStatus( ABS_PHASE_POSITIVE );
+        fixPhase( constraint, ABS_PHASE_POSITIVE );
         return 0;
     }
 
@@ -1041,7 +1225,7 @@ double Checker::checkLeakyReluLemma( const PLCLemma &expl,
            FloatUtils::isPositive( bound ) ) ||
          ( affectedVarBound == Tightening::UB && affectedVar == activeAux &&
            FloatUtils::isZero( bound ) ) )
-        constraint.setPhaseStatus( RELU_PHASE_ACTIVE );
+        fixPhase( constraint, RELU_PHASE_ACTIVE );
     else if ( ( affectedVarBound == Tightening::UB && affectedVar == f &&
                 FloatUtils::isNegative( bound ) ) ||
               ( affectedVarBound == Tightening::UB && affectedVar == b &&
@@ -1050,7 +1234,7 @@ double Checker::checkLeakyReluLemma( const PLCLemma &expl,
                 FloatUtils::isPositive( bound ) ) ||
               ( affectedVarBound == Tightening::UB && affectedVar == inactiveAux &&
                 FloatUtils::isZero( bound ) ) )
-        constraint.setPhaseStatus( RELU_PHASE_INACTIVE );
+        fixPhase( constraint, RELU_PHASE_INACTIVE );
 
     // Make sure the explanation is explained using a LeakyReLU bound tightening. Cases are matching
     // each rule in ReluConstraint.cpp We allow explained bound to be tighter than the ones recorded
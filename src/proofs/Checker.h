@@ -20,9 +20,11 @@
 #include "LeakyReluConstraint.h"
 #include "MaxConstraint.h"
 #include "Set.h"
-#include "Stack.h"
 #include "Tightening.h"
 #include "UnsatCertificateNode.h"
+#include "UnsatCertificateStream.h"
+
+#include <vector>
 
 /*
   A class responsible to certify the UnsatCertificate
@@ -44,7 +46,50 @@ public:
     */
     bool check();
 
+    /*
+      Checks a certificate that is read from a stream, rather than held in
+      memory. Only the nodes on the path from the root to the current node
+      are kept in memory. The tree passed to the constructor is ignored.
+    */
+    bool checkStream( UnsatCertificateStream &stream );
+
+    /*
+      Check disjoint subtrees of the certificate on the given number of
+      threads. Parallel checking is only used for in-memory certificates
+      without leaves that are delegated to files, as these require
+      tracking the phases of the problem constraints along the way.
+    */
+    void setNumberOfWorkers( unsigned numberOfWorkers );
+
 private:
+    /*
+      A subtree whose check was deferred to a worker thread, together
+      with the ground bounds at its parent
+    */
+    struct Task
+    {
+        const UnsatCertificateNode *_node;
+        Vector<double> _groundUpperBounds;
+        Vector<double> _groundLowerBounds;
+    };
+
+    /*
+      An entry of the bound trail, used for reverting the ground bounds
+      when backtracking
+    */
+    struct BoundChange
+    {
+        unsigned _variable;
+        bool _isUpper;
+        double _previousValue;
+    };
+
+    /*
+      Creates a checker for a deferred subtree. Such checkers do not fix
+      the phases of the problem constraints, so that they can share them.
+    */
+    Checker( const Checker &other, const Task &task );
+
     // The root of the tree to check
     const UnsatCertificateNode *_root;
     unsigned _proofSize;
@@ -59,15 +104,60 @@ private:
 
     unsigned _delegationCounter;
 
-    // Keeps track of bounds changes, so only stored bounds will be reverted when traversing the
+    // Keeps track of bounds changes, so only changed bounds will be reverted when traversing the
     // tree
-    Stack<Set<unsigned>> _upperBoundChanges;
-    Stack<Set<unsigned>> _lowerBoundChanges;
+    std::vector<BoundChange> _boundTrail;
+
+    // Whether the phases of the problem constraints are fixed along the traversal. These are only
+    // needed when writing delegated leaves to files.
+    bool _fixPhases;
+
+    unsigned _numberOfWorkers;
+
+    // When checking in parallel, the children of nodes at this depth are deferred into tasks.
+    // Zero means no deferral.
+    unsigned _frontierDepth;
+    unsigned _currentDepth;
+    List<Task> _tasks;
+
+    // When checking a stream, the children are read from it
+    UnsatCertificateStream *_stream;
 
     /*
-      Checks a node in the certificate tree
+      Checks a node in the certificate tree, and reverts all ground bound changes made while
+      checking it. The second version does not revert the changes, and reports whether the
+      children of the node were checked.
     */
     bool checkNode( const UnsatCertificateNode *node );
+    bool checkNodeWithoutReverting( const UnsatCertificateNode *node, bool &checkedChildren );
+
+    /*
+      Checks a child of the current node: directly, by deferring it to a worker, or by reading its
+      record from the stream
+    */
+    bool checkChild( const UnsatCertificateNode *child );
+
+    /*
+      Checks the deferred tasks on the worker threads
+    */
+    bool checkTasks();
+
+    /*
+      Update a ground bound, recording the previous value in the trail, and revert the ground
+      bounds to a previous size of the trail
+    */
+    void updateGroundBound( unsigned variable, bool isUpper, double value );
+    void revertGroundBounds( unsigned trailSize );
+
+    /*
+      Fix the phase of a problem constraint, if phases are tracked
+    */
+    void fixPhase( PiecewiseLinearConstraint &constraint, PhaseStatus phase );
+
+    /*
+      Return true iff some node in the tree is marked to be saved to a file
+    */
+    static bool hasSavedDelegation( const UnsatCertificateNode *node );
 
     /*
       Return true iff all changes in the ground bounds are certified, with tolerance to errors with
@@ -22,6 +22,12 @@ Contradiction::Contradiction( const Vector<double> &contradiction )
         _contradiction.initialize( contradiction.data(), contradiction.size() );
 }
 
+Contradiction::Contradiction( const SparseUnsortedList &contradiction )
+    : _var( 0 )
+    , _contradiction( contradiction )
+{
+}
+
 Contradiction::Contradiction( unsigned var )
     : _var( var )
     , _contradiction()
@@ -26,6 +26,7 @@ class Contradiction
 {
 public:
     Contradiction( const Vector<double> &contradiction );
+    Contradiction( const SparseUnsortedList &contradiction );
     Contradiction( unsigned var );
 
     ~Contradiction();
@@ -0,0 +1,246 @@
+/*********************                                                        */
+/*! \file UnsatCertificateStream.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Omri Isac, Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include "UnsatCertificateStream.h"
+
+#include "MStringf.h"
+#include "MarabouError.h"
+
+enum {
+    // Flush the write buffer once it grows beyond this size
+    WRITE_BUFFER_SIZE = 1 << 20,
+};
+
+void UnsatCertificateStream::write( const UnsatCertificateNode *root, IFile &file )
+{
+    String buffer = "certificate 1\n";
+    writeNode( root, file, buffer );
+    file.write( buffer );
+}
+
+void UnsatCertificateStream::writeNode( const UnsatCertificateNode *node,
+                                        IFile &file,
+                                        String &buffer )
+{
+    String record = Stringf( "flags %u %u %u %u\n",
+                             node->getChildren().size(),
+                             node->getSATSolutionFlag() ? 1 : 0,
+                             node->getVisited() ? 1 : 0,
+                             (unsigned)node->getDelegationStatus() );
+
+    record += "split\n";
+    SubQuerySerializer::serializeCaseSplit( node->getSplit(), record );
+
+    record += Stringf( "lemmas %u\n", node->getPLCLemmas().size() );
+    for ( const auto &lemma : node->getPLCLemmas() )
+    {
+        record += Stringf( "lemma %u %u %c %c %s %u",
+                           (unsigned)lemma->getConstraintType(),
+                           lemma->getAffectedVar(),
+                           lemma->getAffectedVarBound() == Tightening::LB ? 'l' : 'u',
+                           lemma->getCausingVarBound() == Tightening::LB ? 'l' : 'u',
+                           SubQuerySerializer::serializeDouble( lemma->getBound() ).ascii(),
+                           lemma->getCausingVars().size() );
+        for ( const auto &var : lemma->getCausingVars() )
+            record += Stringf( " %u", var );
+        record += Stringf( " %u\n", lemma->getExplanations().size() );
+
+        for ( const auto &explanation : lemma->getExplanations() )
+        {
+            record += "explanation";
+            writeSparseList( explanation, record );
+            record += "\n";
+        }
+    }
+
+    const Contradiction *contradiction = node->getContradiction();
+    if ( !contradiction )
+        record += "contradiction none\n";
+    else if ( contradiction->getContradiction().empty() )
+        record += Stringf( "contradiction var %u\n", contradiction->getVar() );
+    else
+    {
+        record += "contradiction sparse";
+        writeSparseList( contradiction->getContradiction(), record );
+        record += "\n";
+    }
+
+    for ( const auto &child : node->getChildren() )
+    {
+        record += "child\n";
+        SubQuerySerializer::serializeCaseSplit( child->getSplit(), record );
+    }
+
+    // Each record is preceded by its number of lines
+    unsigned numLines = 0;
+    for ( unsigned i = 0; i < record.length(); ++i )
+    {
+        if ( record[i] == '\n' )
+            ++numLines;
+    }
+
+    buffer += Stringf( "node %u\n", numLines );
+    buffer += record;
+    if ( buffer.length() > WRITE_BUFFER_SIZE )
+    {
+        file.write( buffer );
+        buffer = "";
+    }
+
+    for ( const auto &child : node->getChildren() )
+        writeNode( child, file, buffer );
+}
+
+void UnsatCertificateStream::writeSparseList( const SparseUnsortedList &list, String &output )
+{
+    output += Stringf( " %u %u", list.getSize(), list.getNnz() );
+    for ( const auto &entry : list )
+        output += Stringf(
+            " %u %s", entry._index, SubQuerySerializer::serializeDouble( entry._value ).ascii() );
+}
+
+UnsatCertificateStream::UnsatCertificateStream( IFile &file )
+    : _file( file )
+{
+    SubQuerySerializer::TokenReader header( _file.readLine() );
+    header.expect( "certificate" );
+    if ( header.nextUnsigned() != 1 )
+        throw MarabouError( MarabouError::MALFORMED_SERIALIZED_OBJECT,
+                            "Unsupported certificate version" );
+}
+
+String UnsatCertificateStream::readRecord()
+{
+    SubQuerySerializer::TokenReader header( _file.readLine() );
+    header.expect( "node" );
+    unsigned numLines = header.nextUnsigned();
+
+    String record;
+    for ( unsigned i = 0; i < numLines; ++i )
+        record += _file.readLine() + "\n";
+
+    return record;
+}
+
+UnsatCertificateNode *UnsatCertificateStream::readNode()
+{
+    SubQuerySerializer::TokenReader reader( readRecord() );
+
+    reader.expect( "flags" );
+    unsigned numChildren = reader.nextUnsigned();
+    bool hasSATSolution = reader.nextUnsigned() != 0;
+    bool visited = reader.nextUnsigned() != 0;
+    DelegationStatus delegationStatus = (DelegationStatus)reader.nextUnsigned();
+
+    reader.expect( "split" );
+    PiecewiseLinearCaseSplit split;
+    SubQuerySerializer::deserializeCaseSplit( reader, split );
+
+    UnsatCertificateNode *node = new UnsatCertificateNode( NULL, split );
+    if ( hasSATSolution )
+        node->setSATSolutionFlag();
+    if ( visited )
+        node->setVisited();
+    node->setDelegationStatus( delegationStatus );
+
+    reader.expect( "lemmas" );
+    unsigned numLemmas = reader.nextUnsigned();
+    for ( unsigned i = 0; i < numLemmas; ++i )
+    {
+        reader.expect( "lemma" );
+        PiecewiseLinearFunctionType constraintType =
+            (PiecewiseLinearFunctionType)reader.nextUnsigned();
+        unsigned affectedVar = reader.nextUnsigned();
+        Tightening::BoundType affectedVarBound =
+            reader.next() == "l" ? Tightening::LB : Tightening::UB;
+        Tightening::BoundType causingVarBound =
+            reader.next() == "l" ? Tightening::LB : Tightening::UB;
+        double bound = reader.nextDouble();
+
+        List<unsigned> causingVars;
+        unsigned numCausingVars = reader.nextUnsigned();
+        for ( unsigned j = 0; j < numCausingVars; ++j )
+            causingVars.append( reader.nextUnsigned() );
+
+        unsigned numExplanations = reader.nextUnsigned();
+        Vector<SparseUnsortedList> explanations( numExplanations );
+        for ( unsigned j = 0; j < numExplanations; ++j )
+        {
+            reader.expect( "explanation" );
+            readSparseList( reader, explanations[j] );
+        }
+
+        std::shared_ptr<PLCLemma> lemma( new PLCLemma( causingVars,
+                                                       affectedVar,
+                                                       bound,
+                                                       causingVarBound,
+                                                       affectedVarBound,
+                                                       explanations,
+                                                       constraintType ) );
+        node->addPLCLemma( lemma );
+    }
+
+    reader.expect( "contradiction" );
+    String contradictionType = reader.next();
+    if ( contradictionType == "var" )
+        node->setContradiction( new Contradiction( reader.nextUnsigned() ) );
+    else if ( contradictionType == "sparse" )
+    {
+        SparseUnsortedList contradiction;
+        readSparseList( reader, contradiction );
+        node->setContradiction( new Contradiction( contradiction ) );
+    }
+
+    for ( unsigned i = 0; i < numChildren; ++i )
+    {
+        reader.expect( "child" );
+        PiecewiseLinearCaseSplit childSplit;
+        SubQuerySerializer::deserializeCaseSplit( reader, childSplit );
+        new UnsatCertificateNode( node, childSplit );
+    }
+
+    return node;
+}
+
+void UnsatCertificateStream::skipSubtrees( unsigned numberOfChildren )
+{
+    for ( unsigned i = 0; i < numberOfChildren; ++i )
+    {
+        SubQuerySerializer::TokenReader reader( readRecord() );
+        reader.expect( "flags" );
+        skipSubtrees( reader.nextUnsigned() );
+    }
+}
+
+void UnsatCertificateStream::readSparseList( SubQuerySerializer::TokenReader &reader,
+                                             SparseUnsortedList &list )
+{
+    unsigned size = reader.nextUnsigned();
+    unsigned nnz = reader.nextUnsigned();
+
+    list = SparseUnsortedList( size );
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        unsigned index = reader.nextUnsigned();
+        list.append( index, reader.nextDouble() );
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,77 @@
+/*********************                                                        */
+/*! \file UnsatCertificateStream.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Omri Isac, Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A compact text format for UNSAT certificates, in which the nodes of the
+ ** certificate tree are stored one after the other, in pre-order. Each
+ ** node record holds the node's head split, flags, PLC lemmas and
+ ** contradiction, plus the head splits of its children, so that a checker
+ ** can read the tree node by node and only keep the current path in
+ ** memory. Doubles are written in hexadecimal floating point notation, so
+ ** the certificate survives the round trip bit-for-bit.
+ **/
+
+#ifndef __UnsatCertificateStream_h__
+#define __UnsatCertificateStream_h__
+
+#include "IFile.h"
+#include "MString.h"
+#include "SubQuerySerializer.h"
+#include "UnsatCertificateNode.h"
+
+class UnsatCertificateStream
+{
+public:
+    /*
+      Write the tree rooted at the given node to an open file
+    */
+    static void write( const UnsatCertificateNode *root, IFile &file );
+
+    /*
+      Read a certificate from an open file
+    */
+    UnsatCertificateStream( IFile &file );
+
+    /*
+      Read the next node, in pre-order. The node's children are not read:
+      instead, the node gets a childless child for each of its children,
+      which only holds the child's head split. The records of the children
+      come next in the stream. The caller owns the returned node.
+    */
+    UnsatCertificateNode *readNode();
+
+    /*
+      Skip the records of the subtrees of the given number of children
+    */
+    void skipSubtrees( unsigned numberOfChildren );
+
+private:
+    IFile &_file;
+
+    static void writeNode( const UnsatCertificateNode *node, IFile &file, String &buffer );
+    static void writeSparseList( const SparseUnsortedList &list, String &output );
+
+    /*
+      Read the lines of the next record
+    */
+    String readRecord();
+
+    static void readSparseList( SubQuerySerializer::TokenReader &reader, SparseUnsortedList &list );
+};
+
+#endif // __UnsatCertificateStream_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
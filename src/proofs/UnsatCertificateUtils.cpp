@@ -14,6 +14,89 @@
 
 #include "UnsatCertificateUtils.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/*
+  The linear combination of the rows of the initial tableau given by an
+  explanation, as (variable, coefficient) pairs sorted by variable and
+  without zero coefficients. Only the non-zero entries of the rows are
+  touched. The contributions to each variable are summed in the order of
+  the rows, as in a dense accumulation, so the results are identical.
+*/
+static void computeSparseRowCombination( const SparseUnsortedList &explanation,
+                                         const SparseMatrix *initialTableau,
+                                         unsigned numberOfVariables,
+                                         std::vector<std::pair<unsigned, double>> &combination )
+{
+    SparseUnsortedList tableauRow( numberOfVariables );
+    std::vector<std::pair<unsigned, double>> contributions;
+
+    for ( const auto &entry : explanation )
+    {
+        if ( FloatUtils::isZero( entry._value ) )
+            continue;
+
+        initialTableau->getRow( entry._index, &tableauRow );
+        for ( const auto &tableauEntry : tableauRow )
+        {
+            if ( !FloatUtils::isZero( tableauEntry._value ) )
+                contributions.push_back(
+                    std::make_pair( tableauEntry._index, entry._value * tableauEntry._value ) );
+        }
+    }
+
+    std::stable_sort( contributions.begin(),
+                      contributions.end(),
+                      []( const std::pair<unsigned, double> &a,
+                          const std::pair<unsigned, double> &b ) { return a.first < b.first; } );
+
+    combination.clear();
+    for ( unsigned i = 0; i < contributions.size(); )
+    {
+        unsigned index = contributions[i].first;
+        double sum = 0;
+        for ( ; i < contributions.size() && contributions[i].first == index; ++i )
+            sum += contributions[i].second;
+
+        if ( !FloatUtils::isZero( sum ) )
+            combination.push_back( std::make_pair( index, sum ) );
+    }
+}
+
+/*
+  The bound implied by a combination, using the ground bounds
+*/
+static double
+computeCombinationBound( const std::vector<std::pair<unsigned, double>> &combination,
+                         bool isUpper,
+                         const double *groundUpperBounds,
+                         const double *groundLowerBounds )
+{
+    double derivedBound = 0;
+    double temp;
+
+    for ( const auto &entry : combination )
+    {
+        temp = entry.second;
+        if ( !FloatUtils::isZero( temp ) )
+        {
+            if ( isUpper )
+                temp *= FloatUtils::isPositive( entry.second ) ? groundUpperBounds[entry.first]
+                                                               : groundLowerBounds[entry.first];
+            else
+                temp *= FloatUtils::isPositive( entry.second ) ? groundLowerBounds[entry.first]
+                                                               : groundUpperBounds[entry.first];
+
+            if ( !FloatUtils::isZero( temp ) )
+                derivedBound += temp;
+        }
+    }
+
+    return derivedBound;
+}
+
 double UNSATCertificateUtils::computeBound( unsigned var,
                                             bool isUpper,
                                             const SparseUnsortedList &explanation,
@@ -24,9 +107,6 @@ double UNSATCertificateUtils::computeBound( unsigned var,
 {
     ASSERT( var < numberOfVariables );
 
-    double derivedBound = 0;
-    double temp;
-
     if ( explanation.empty() )
         return isUpper ? groundUpperBounds[var] : groundLowerBounds[var];
 
@@ -42,32 +122,24 @@ double UNSATCertificateUtils::computeBound( unsigned var,
     if ( allZeros )
         return isUpper ? groundUpperBounds[var] : groundLowerBounds[var];
 
-    Vector<double> explanationRowCombination( numberOfVariables, 0 );
     // Create linear combination of original rows implied from explanation
-    UNSATCertificateUtils::getExplanationRowCombination(
-        var, explanation, explanationRowCombination, initialTableau, numberOfVariables );
-
-    // Set the bound derived from the linear combination, using original bounds.
-    for ( unsigned i = 0; i < numberOfVariables; ++i )
-    {
-        temp = explanationRowCombination[i];
-        if ( !FloatUtils::isZero( temp ) )
-        {
-            if ( isUpper )
-                temp *= FloatUtils::isPositive( explanationRowCombination[i] )
-                          ? groundUpperBounds[i]
-                          : groundLowerBounds[i];
-            else
-                temp *= FloatUtils::isPositive( explanationRowCombination[i] )
-                          ? groundLowerBounds[i]
-                          : groundUpperBounds[i];
+    std::vector<std::pair<unsigned, double>> combination;
+    computeSparseRowCombination( explanation, initialTableau, numberOfVariables, combination );
 
-            if ( !FloatUtils::isZero( temp ) )
-                derivedBound += temp;
-        }
-    }
+    // Since: 0 = Sum (ci * xi) + c * var = Sum (ci * xi) + (c + 1) * var - var
+    // We have: var = Sum (ci * xi) + (c + 1) * var
+    auto varEntry = std::lower_bound( combination.begin(),
+                                      combination.end(),
+                                      var,
+                                      []( const std::pair<unsigned, double> &entry,
+                                          unsigned index ) { return entry.first < index; } );
+    if ( varEntry != combination.end() && varEntry->first == var )
+        ++varEntry->second;
+    else
+        combination.insert( varEntry, std::make_pair( var, 1.0 ) );
 
-    return derivedBound;
+    // Set the bound derived from the linear combination, using original bounds.
+    return computeCombinationBound( combination, isUpper, groundUpperBounds, groundLowerBounds );
 }
 
 void UNSATCertificateUtils::getExplanationRowCombination( unsigned var,
@@ -114,41 +186,11 @@ double UNSATCertificateUtils::computeCombinationUpperBound( const SparseUnsorted
 {
     ASSERT( !explanation.empty() );
 
-    SparseUnsortedList tableauRow( numberOfVariables );
-    Vector<double> explanationRowCombination( numberOfVariables, 0 );
-
-    for ( const auto &entry : explanation )
-    {
-        if ( FloatUtils::isZero( entry._value ) )
-            continue;
-
-        initialTableau->getRow( entry._index, &tableauRow );
-        for ( const auto &tableauEntry : tableauRow )
-        {
-            if ( !FloatUtils::isZero( tableauEntry._value ) )
-                explanationRowCombination[tableauEntry._index] +=
-                    tableauEntry._value * entry._value;
-        }
-    }
-
-    double derivedBound = 0;
-    double temp;
+    std::vector<std::pair<unsigned, double>> combination;
+    computeSparseRowCombination( explanation, initialTableau, numberOfVariables, combination );
 
     // Set the bound derived from the linear combination, using original bounds.
-    for ( unsigned i = 0; i < numberOfVariables; ++i )
-    {
-        temp = explanationRowCombination[i];
-        if ( !FloatUtils::isZero( temp ) )
-        {
-            temp *= FloatUtils::isPositive( explanationRowCombination[i] ) ? groundUpperBounds[i]
-                                                                           : groundLowerBounds[i];
-
-            if ( !FloatUtils::isZero( temp ) )
-                derivedBound += temp;
-        }
-    }
-
-    return derivedBound;
+    return computeCombinationBound( combination, true, groundUpperBounds, groundLowerBounds );
 }
 
 const Set<PiecewiseLinearFunctionType> UNSATCertificateUtils::getSupportedActivations()
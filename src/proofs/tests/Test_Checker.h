@@ -14,6 +14,7 @@
 
 #include "CSRMatrix.h"
 #include "Checker.h"
+#include "MockFile.h"
 #include "cxxtest/TestSuite.h"
 
 class CheckerTestSuite : public CxxTest::TestSuite
@@ -83,4 +84,128 @@ public:
 
         delete root;
     }
+
+    /*
+      Build a complete tree that splits x_depth at 0.5 on each level. The only equation is
+      x0 + ... + x_{n-2} - x_{n-1} = 0, which is infeasible as soon as one of the splits is
+      the lower one. The leaf in which all splits are the upper ones is feasible, so it is either
+      marked as SAT, or given a wrong contradiction.
+    */
+    void buildTree( UnsatCertificateNode *node,
+                    unsigned depth,
+                    unsigned maxDepth,
+                    bool allUpper,
+                    bool markSatLeaf )
+    {
+        if ( depth == maxDepth )
+        {
+            if ( allUpper && markSatLeaf )
+                node->setSATSolutionFlag();
+            else
+            {
+                SparseUnsortedList explanation( 1 );
+                explanation.append( 0, 1 );
+                node->setContradiction( new Contradiction( explanation ) );
+            }
+            return;
+        }
+
+        node->setVisited();
+
+        PiecewiseLinearCaseSplit lowerSplit;
+        lowerSplit.storeBoundTightening( Tightening( depth, 0.5, Tightening::UB ) );
+        PiecewiseLinearCaseSplit upperSplit;
+        upperSplit.storeBoundTightening( Tightening( depth, 0.5, Tightening::LB ) );
+
+        buildTree( new UnsatCertificateNode( node, lowerSplit ),
+                   depth + 1,
+                   maxDepth,
+                   false,
+                   markSatLeaf );
+        buildTree( new UnsatCertificateNode( node, upperSplit ),
+                   depth + 1,
+                   maxDepth,
+                   allUpper,
+                   markSatLeaf );
+    }
+
+    void test_parallel_certification()
+    {
+        unsigned maxDepth = 6, n = maxDepth + 1;
+        Vector<double> A( n, 1 );
+        A[maxDepth] = -1;
+        auto initialTableau = CSRMatrix( A.data(), 1, n );
+
+        Vector<double> groundUpperBounds( n, 1 );
+        Vector<double> groundLowerBounds( n, 0 );
+        groundUpperBounds[maxDepth] = maxDepth + 1;
+        groundLowerBounds[maxDepth] = maxDepth - 0.25;
+
+        auto *root = new UnsatCertificateNode( NULL, PiecewiseLinearCaseSplit() );
+        buildTree( root, 0, maxDepth, true, true );
+
+        List<PiecewiseLinearConstraint *> constraintsList;
+        Checker checker(
+            root, 1, &initialTableau, groundUpperBounds, groundLowerBounds, constraintsList );
+
+        TS_ASSERT( checker.check() );
+        checker.setNumberOfWorkers( 4 );
+        TS_ASSERT( checker.check() );
+        TS_ASSERT( checker.check() );
+
+        // The contradiction of the feasible leaf is wrong, and the checker should find it
+        // regardless of the order in which the subtrees are checked
+        auto *wrongRoot = new UnsatCertificateNode( NULL, PiecewiseLinearCaseSplit() );
+        buildTree( wrongRoot, 0, maxDepth, true, false );
+
+        Checker wrongChecker(
+            wrongRoot, 1, &initialTableau, groundUpperBounds, groundLowerBounds, constraintsList );
+        TS_ASSERT( !wrongChecker.check() );
+        wrongChecker.setNumberOfWorkers( 4 );
+        TS_ASSERT( !wrongChecker.check() );
+
+        delete root;
+        delete wrongRoot;
+    }
+
+    void test_stream_certification()
+    {
+        unsigned maxDepth = 4, n = maxDepth + 1;
+        Vector<double> A( n, 1 );
+        A[maxDepth] = -1;
+        auto initialTableau = CSRMatrix( A.data(), 1, n );
+
+        Vector<double> groundUpperBounds( n, 1 );
+        Vector<double> groundLowerBounds( n, 0 );
+        groundUpperBounds[maxDepth] = maxDepth + 1;
+        groundLowerBounds[maxDepth] = maxDepth - 0.25;
+
+        auto *root = new UnsatCertificateNode( NULL, PiecewiseLinearCaseSplit() );
+        buildTree( root, 0, maxDepth, true, true );
+
+        // The checker ignores its tree when checking a stream
+        List<PiecewiseLinearConstraint *> constraintsList;
+        Checker checker(
+            NULL, 1, &initialTableau, groundUpperBounds, groundLowerBounds, constraintsList );
+
+        MockFile file;
+        UnsatCertificateStream::write( root, file );
+        UnsatCertificateStream stream( file );
+        TS_ASSERT( checker.checkStream( stream ) );
+        TS_ASSERT_EQUALS( file.writtenLines, "" );
+
+        // The subtree of a delegated node is skipped, and the rest of the stream is still checked
+        auto *wrongRoot = new UnsatCertificateNode( NULL, PiecewiseLinearCaseSplit() );
+        buildTree( wrongRoot, 0, maxDepth, true, false );
+        wrongRoot->getChildren().front()->setDelegationStatus(
+            DelegationStatus::DELEGATE_DONT_SAVE );
+
+        UnsatCertificateStream::write( wrongRoot, file );
+        UnsatCertificateStream wrongStream( file );
+        TS_ASSERT( !checker.checkStream( wrongStream ) );
+        TS_ASSERT_EQUALS( file.writtenLines, "" );
+
+        delete root;
+        delete wrongRoot;
+    }
 };
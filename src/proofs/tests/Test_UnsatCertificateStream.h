@@ -0,0 +1,142 @@
+/*********************                                                        */
+/*! \file Test_UnsatCertificateStream.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Omri Isac, Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include "MockFile.h"
+#include "UnsatCertificateStream.h"
+
+#include <cxxtest/TestSuite.h>
+
+class UnsatCertificateStreamTestSuite : public CxxTest::TestSuite
+{
+public:
+    void test_round_trip()
+    {
+        ReluConstraint relu( 0, 1 );
+        auto splits = relu.getCaseSplits();
+
+        auto *root = new UnsatCertificateNode( NULL, PiecewiseLinearCaseSplit() );
+        root->setVisited();
+
+        auto *inactive = new UnsatCertificateNode( root, splits.front() );
+        auto *active = new UnsatCertificateNode( root, splits.back() );
+
+        // A lemma with an explanation, and a sparse contradiction whose values are not exact in
+        // decimal notation
+        SparseUnsortedList explanation( 3 );
+        explanation.append( 0, 0.1 );
+        explanation.append( 2, -1.0 / 3 );
+        Vector<SparseUnsortedList> explanations( 1, explanation );
+        std::shared_ptr<PLCLemma> lemma( new PLCLemma(
+            { 0 }, 1, 0, Tightening::UB, Tightening::UB, explanations, RELU ) );
+        inactive->addPLCLemma( lemma );
+        inactive->setContradiction( new Contradiction( explanation ) );
+
+        active->setContradiction( new Contradiction( 4 ) );
+        active->setDelegationStatus( DelegationStatus::DELEGATE_DONT_SAVE );
+
+        MockFile file;
+        UnsatCertificateStream::write( root, file );
+        UnsatCertificateStream stream( file );
+
+        // The root, with the head splits of its children
+        UnsatCertificateNode *readRoot = stream.readNode();
+        TS_ASSERT( readRoot->getVisited() );
+        TS_ASSERT( !readRoot->getContradiction() );
+        TS_ASSERT_EQUALS( readRoot->getChildren().size(), 2U );
+        TS_ASSERT( readRoot->getChildren().front()->getSplit() == splits.front() );
+        TS_ASSERT( readRoot->getChildren().back()->getSplit() == splits.back() );
+        TS_ASSERT( readRoot->getChildren().front()->getChildren().empty() );
+        delete readRoot;
+
+        UnsatCertificateNode *readInactive = stream.readNode();
+        TS_ASSERT( readInactive->getSplit() == splits.front() );
+        TS_ASSERT( !readInactive->getVisited() );
+        TS_ASSERT_EQUALS( readInactive->getPLCLemmas().size(), 1U );
+
+        const PLCLemma &readLemma = *readInactive->getPLCLemmas().front();
+        TS_ASSERT_EQUALS( readLemma.getCausingVars(), List<unsigned>( { 0 } ) );
+        TS_ASSERT_EQUALS( readLemma.getAffectedVar(), 1U );
+        TS_ASSERT_EQUALS( readLemma.getBound(), 0 );
+        TS_ASSERT_EQUALS( readLemma.getCausingVarBound(), Tightening::UB );
+        TS_ASSERT_EQUALS( readLemma.getAffectedVarBound(), Tightening::UB );
+        TS_ASSERT_EQUALS( readLemma.getConstraintType(), RELU );
+        TS_ASSERT_EQUALS( readLemma.getExplanations().size(), 1U );
+
+        const SparseUnsortedList &readExplanation = readLemma.getExplanations().front();
+        TS_ASSERT_EQUALS( readExplanation.getSize(), 3U );
+        TS_ASSERT_EQUALS( readExplanation.getNnz(), 2U );
+        TS_ASSERT_EQUALS( readExplanation.get( 0 ), 0.1 );
+        TS_ASSERT_EQUALS( readExplanation.get( 2 ), -1.0 / 3 );
+
+        const SparseUnsortedList &readContradiction =
+            readInactive->getContradiction()->getContradiction();
+        TS_ASSERT_EQUALS( readContradiction.getNnz(), 2U );
+        TS_ASSERT_EQUALS( readContradiction.get( 2 ), -1.0 / 3 );
+        delete readInactive;
+
+        UnsatCertificateNode *readActive = stream.readNode();
+        TS_ASSERT( readActive->getSplit() == splits.back() );
+        TS_ASSERT( readActive->getContradiction()->getContradiction().empty() );
+        TS_ASSERT_EQUALS( readActive->getContradiction()->getVar(), 4U );
+        TS_ASSERT_EQUALS( readActive->getDelegationStatus(), DelegationStatus::DELEGATE_DONT_SAVE );
+        TS_ASSERT( readActive->getPLCLemmas().empty() );
+        delete readActive;
+
+        TS_ASSERT_EQUALS( file.writtenLines, "" );
+
+        delete root;
+    }
+
+    void test_skip_subtrees()
+    {
+        auto *root = new UnsatCertificateNode( NULL, PiecewiseLinearCaseSplit() );
+
+        PiecewiseLinearCaseSplit lowerSplit;
+        lowerSplit.storeBoundTightening( Tightening( 0, 0, Tightening::UB ) );
+        PiecewiseLinearCaseSplit upperSplit;
+        upperSplit.storeBoundTightening( Tightening( 0, 0, Tightening::LB ) );
+
+        auto *lower = new UnsatCertificateNode( root, lowerSplit );
+        new UnsatCertificateNode( lower, lowerSplit );
+        new UnsatCertificateNode( lower, upperSplit );
+        auto *upper = new UnsatCertificateNode( root, upperSplit );
+        upper->setSATSolutionFlag();
+
+        MockFile file;
+        UnsatCertificateStream::write( root, file );
+        UnsatCertificateStream stream( file );
+
+        UnsatCertificateNode *readRoot = stream.readNode();
+        UnsatCertificateNode *readLower = stream.readNode();
+        stream.skipSubtrees( readLower->getChildren().size() );
+
+        UnsatCertificateNode *readUpper = stream.readNode();
+        TS_ASSERT( readUpper->getSplit() == upperSplit );
+        TS_ASSERT( readUpper->getSATSolutionFlag() );
+        TS_ASSERT_EQUALS( file.writtenLines, "" );
+
+        delete readRoot;
+        delete readLower;
+        delete readUpper;
+        delete root;
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -16,6 +16,7 @@
 #include "Engine.h"
 #include "FloatUtils.h"
 #include "LinearExpression.h"
+#include "Options.h"
 #include "Query.h"
 
 #include <cxxtest/TestSuite.h>
@@ -224,6 +225,81 @@ public:
             TS_ASSERT( !result );
         }
     }
+
+    void buildLazyRowsQuery( Query &inputQuery, double x3LowerBound, double x3UpperBound )
+    {
+        inputQuery.setNumberOfVariables( 4 );
+
+        for ( unsigned i = 0; i < 3; ++i )
+        {
+            inputQuery.setLowerBound( i, 0 );
+            inputQuery.setUpperBound( i, 1 );
+        }
+
+        inputQuery.setLowerBound( 3, x3LowerBound );
+        inputQuery.setUpperBound( 3, x3UpperBound );
+
+        // x0 - x1 + x2 = 0
+        Equation equation1;
+        equation1.addAddend( 1, 0 );
+        equation1.addAddend( -1, 1 );
+        equation1.addAddend( 1, 2 );
+        equation1.setScalar( 0 );
+        inputQuery.addEquation( equation1 );
+
+        // x0 + x1 + x2 - x3 = 0, where x3 occurs nowhere else
+        Equation equation2;
+        equation2.addAddend( 1, 0 );
+        equation2.addAddend( 1, 1 );
+        equation2.addAddend( 1, 2 );
+        equation2.addAddend( -1, 3 );
+        equation2.setScalar( 0 );
+        inputQuery.addEquation( equation2 );
+    }
+
+    void test_lazy_rows()
+    {
+        Options::get()->setBool( Options::LAZY_ROW_GENERATION, true );
+
+        {
+            Query inputQuery;
+            buildLazyRowsQuery( inputQuery, 1.5, 2 );
+
+            Engine engine;
+            TS_ASSERT( engine.processInputQuery( inputQuery ) );
+            TS_ASSERT( engine.solve() );
+
+            const Statistics *statistics = engine.getStatistics();
+            TS_ASSERT_EQUALS( statistics->getUnsignedAttribute( Statistics::NUM_DEFERRED_ROWS ),
+                              1U );
+            TS_ASSERT_EQUALS( statistics->getUnsignedAttribute( Statistics::NUM_LAZY_ROWS_ADDED ),
+                              1U );
+
+            engine.extractSolution( inputQuery );
+
+            double value0 = inputQuery.getSolutionValue( 0 );
+            double value1 = inputQuery.getSolutionValue( 1 );
+            double value2 = inputQuery.getSolutionValue( 2 );
+            double value3 = inputQuery.getSolutionValue( 3 );
+
+            TS_ASSERT( FloatUtils::areEqual( value0 - value1 + value2, 0 ) );
+            TS_ASSERT( FloatUtils::areEqual( value0 + value1 + value2, value3 ) );
+            TS_ASSERT( FloatUtils::gte( value3, 1.5 ) );
+            TS_ASSERT( FloatUtils::lte( value3, 2 ) );
+        }
+
+        {
+            // x0 + x1 + x2 = 2x1 cannot exceed 2
+            Query inputQuery;
+            buildLazyRowsQuery( inputQuery, 2.5, 3 );
+
+            Engine engine;
+            if ( engine.processInputQuery( inputQuery ) )
+                TS_ASSERT( !engine.solve() );
+        }
+
+        Options::get()->setBool( Options::LAZY_ROW_GENERATION, false );
+    }
 };
 
 //
@@ -0,0 +1,167 @@
+/*********************                                                        */
+/*! \file Test_solveJob.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "AcasParser.h"
+#include "FloatUtils.h"
+#include "Options.h"
+#include "Query.h"
+#include "ReluConstraint.h"
+#include "SolveJob.h"
+
+#include <cxxtest/TestSuite.h>
+
+class SolveJobTestSuite : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+    }
+
+    void tearDown()
+    {
+    }
+
+    /*
+      x0 in [-1, 1], x1 = relu( x0 ), x0 + x1 <= bound
+    */
+    void createReluQuery( Query &inputQuery, double bound )
+    {
+        inputQuery.setNumberOfVariables( 2 );
+        inputQuery.setLowerBound( 0, -1 );
+        inputQuery.setUpperBound( 0, 1 );
+        inputQuery.setLowerBound( 1, 0 );
+        inputQuery.setUpperBound( 1, 1000 );
+
+        Equation equation( Equation::LE );
+        equation.addAddend( 1, 0 );
+        equation.addAddend( 1, 1 );
+        equation.setScalar( bound );
+        inputQuery.addEquation( equation );
+
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( 0, 1 ) );
+        inputQuery.markOutputVariable( 1, 0 );
+    }
+
+    void test_solve_job()
+    {
+        Query satQuery;
+        createReluQuery( satQuery, 1 );
+        SolveJob satJob( satQuery );
+
+        Query unsatQuery;
+        createReluQuery( unsatQuery, -2 );
+        SolveJob unsatJob( unsatQuery );
+
+        TS_ASSERT( satJob.wait() );
+        TS_ASSERT( satJob.poll() );
+        TS_ASSERT_EQUALS( satJob.getExitCode(), IEngine::SAT );
+
+        double x0 = satQuery.getSolutionValue( 0 );
+        double x1 = satQuery.getSolutionValue( 1 );
+        TS_ASSERT( FloatUtils::areEqual( x1, FloatUtils::max( x0, 0 ) ) );
+        TS_ASSERT( FloatUtils::lte( x0 + x1, 1 ) );
+
+        TS_ASSERT( unsatJob.wait( 60 ) );
+        TS_ASSERT_EQUALS( unsatJob.getExitCode(), IEngine::UNSAT );
+    }
+
+    void test_cancel()
+    {
+        Query inputQuery;
+        AcasParser acasParser( RESOURCES_DIR "/nnet/acasxu/ACASXU_experimental_v2a_1_1.nnet" );
+        acasParser.generateQuery( inputQuery );
+
+        SolveJob job( inputQuery );
+        job.cancel();
+
+        TS_ASSERT( job.wait() );
+        TS_ASSERT_EQUALS( job.getExitCode(), IEngine::QUIT_REQUESTED );
+    }
+
+    void test_progress_reports()
+    {
+        Query inputQuery;
+        AcasParser acasParser( RESOURCES_DIR "/nnet/acasxu/ACASXU_experimental_v2a_1_1.nnet" );
+        acasParser.generateQuery( inputQuery );
+
+        unsigned numReports = 0;
+        bool boundsAreValid = true;
+        Map<unsigned, double> lowerBounds;
+        Map<unsigned, double> upperBounds;
+        auto callback = [&]( const SolveProgress &progress ) {
+            ++numReports;
+            for ( unsigned i = 0; i < 5; ++i )
+            {
+                unsigned variable = acasParser.getOutputVariable( i );
+                if ( !progress._lowerBounds.exists( variable ) ||
+                     FloatUtils::gt( progress._lowerBounds.get( variable ),
+                                     progress._upperBounds.get( variable ) ) )
+                {
+                    boundsAreValid = false;
+                    continue;
+                }
+
+                lowerBounds[variable] = progress._lowerBounds.get( variable );
+                upperBounds[variable] = progress._upperBounds.get( variable );
+            }
+        };
+
+        // Report on every iteration of the main loop
+        SolveJob job( inputQuery, callback, 0 );
+        TS_ASSERT( job.wait() );
+        TS_ASSERT_EQUALS( job.getExitCode(), IEngine::SAT );
+
+        TS_ASSERT( numReports > 1 );
+        TS_ASSERT( boundsAreValid );
+
+        // The reported bounds hold for the whole query, and in particular
+        // for the solution
+        for ( unsigned i = 0; i < 5 && boundsAreValid; ++i )
+        {
+            unsigned variable = acasParser.getOutputVariable( i );
+            double value = inputQuery.getSolutionValue( variable );
+            TS_ASSERT( FloatUtils::lte( lowerBounds[variable], value, 0.0001 ) );
+            TS_ASSERT( FloatUtils::gte( upperBounds[variable], value, 0.0001 ) );
+        }
+    }
+
+    void test_progress_reports_in_dnc_mode()
+    {
+        Options options( *Options::get() );
+        Options::Scope optionsScope( &options );
+        options.setBool( Options::DNC_MODE, true );
+        options.setInt( Options::NUM_WORKERS, 2 );
+        options.setInt( Options::VERBOSITY, 0 );
+
+        Query inputQuery;
+        AcasParser acasParser( RESOURCES_DIR "/nnet/acasxu/ACASXU_experimental_v2a_1_1.nnet" );
+        acasParser.generateQuery( inputQuery );
+
+        // Reports of the workers are serialized
+        unsigned numReports = 0;
+        bool reportsHaveQueryIds = true;
+        auto callback = [&]( const SolveProgress &progress ) {
+            ++numReports;
+            if ( progress._queryId.length() == 0 )
+                reportsHaveQueryIds = false;
+        };
+
+        SolveJob job( inputQuery, callback, 0 );
+        TS_ASSERT( job.wait() );
+        TS_ASSERT_EQUALS( job.getExitCode(), IEngine::SAT );
+        TS_ASSERT( numReports > 0 );
+        TS_ASSERT( reportsHaveQueryIds );
+    }
+};